@@ -26,6 +26,20 @@
 #define SC_EXTERN_TYPEDEFS_H
 
 #include "common_types.h"
+#include "sc_interface_cfg.h"
+
+/**
+ * @brief Underlying storage type for ATS command numbers and entry offsets
+ *
+ * This is selected by #SC_CMD_INDEX_BITS, and is shared by the command
+ * number, entry offset, and internal command/sequence index types so
+ * that values can be converted between them without truncation.
+ */
+#if (SC_CMD_INDEX_BITS == 32)
+typedef uint32 SC_IndexBase_t;
+#else
+typedef uint16 SC_IndexBase_t;
+#endif
 
 /**
  * @brief An identifier for RTS's
@@ -77,7 +91,7 @@ typedef uint16 SC_AtsNum_t;
  * defined in the table any order (that is, they may have absolute
  * time stamps that are not in sequence).
  */
-typedef uint16 SC_CommandNum_t;
+typedef SC_IndexBase_t SC_CommandNum_t;
 
 /**
  * @brief Represents an offset into an ATS or RTS buffer
@@ -87,12 +101,12 @@ typedef uint16 SC_CommandNum_t;
  * specific command at that position.
  *
  * The valid range is [0..(SC_ATS_BUFF_SIZE/4)-1] for ATS
- * or [0..(SC_RTS_BUFF_SIZE/4)-1] for RTS
+ * or [0..(SC_RTS_MAX_SIZE/4)-1] for RTS
  *
  * @note ATS/RTS Buffers are indexed using 32-bit words.
  * To get a byte offset, this value needs to be multiplied by 4.
  */
-typedef uint16 SC_EntryOffset_t;
+typedef SC_IndexBase_t SC_EntryOffset_t;
 
 /**
  * Convert from an ID or Number value (e.g. RTS/ATS identifier) to a native unsigned int
@@ -108,7 +122,7 @@ typedef uint16 SC_EntryOffset_t;
  * This is mainly intended for initializing values from literals or integers
  * This is the inverse macro of SC_IDNUM_AS_UINT()
  */
-#define SC_IDNUM_FROM_UINT(arg) ((uint16)(arg))
+#define SC_IDNUM_FROM_UINT(arg) ((SC_IndexBase_t)(arg))
 
 /* _INITIALIZER macros to be used in static (e.g. table) definitions that need to resolve at compile time */
 #define SC_RTS_NUM_INITIALIZER(i)     SC_IDNUM_FROM_UINT(i)
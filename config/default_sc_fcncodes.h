@@ -321,7 +321,10 @@
  * \brief Jump the time in the running ATS
  *
  *  \par Description
- *       Moves the 'current time' pointer in the ATS to another time
+ *       Moves the 'current time' pointer in the ATS to another time,
+ *       forward or back.  When jumping back, the reset policy selects
+ *       whether commands jumped back over are returned to LOADED and
+ *       sent again (see #SC_JumpAtsReset)
  *
  *  \par Command Structure
  *       #SC_JumpAtsCmd_t
@@ -337,6 +340,7 @@
  *       - Command packet length not as expected
  *       - All ATS Cmds were skipped in the jump, ATS is shut off
  *       - No ATS is active
+ *       - Invalid reset policy specified
  *
  *  \par Evidence of failure may be found in the following telemetry:
  *       - #SC_HkTlm_Payload_t.CmdErrCtr will increment
@@ -602,6 +606,748 @@
  */
 #define SC_ENABLE_RTS_GRP_CC 16
 
+/**
+ * \brief Report the ATS commands scheduled in a time window
+ *
+ *  \par Description
+ *       Reports the command number, time tag, message ID, function code
+ *       and status of each command in the specified ATS whose time tag is
+ *       greater than or equal to the window start time and less than the
+ *       window end time.  The commands are found with a binary search of
+ *       the ATS time index table and are reported in time order in one or
+ *       more #SC_AtsWindowTlm_t packets, each holding up to
+ *       #SC_ATS_WINDOW_ENTRIES_PER_PKT commands.  A window that holds no
+ *       commands is reported with a single empty packet.  At most
+ *       #SC_ATS_WINDOW_MAX_PKTS packets are sent; when a window holds
+ *       more commands, the FirstEntry and NumEntries of the last packet
+ *       add up to less than TotalEntries, and the rest of the window can
+ *       be queried starting at the time of the last command received.
+ *
+ *  \par Command Structure
+ *       #SC_QueryAtsWindowCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #SC_HkTlm_Payload_t.CmdCtr will increment
+ *       - The #SC_QUERYATS_CMD_INF_EID will be sent
+ *       - One or more #SC_AtsWindowTlm_t packets will be sent
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - Invalid ATS ID
+ *       - The specified ATS is not loaded
+ *       - Window end time is not after the window start time
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #SC_HkTlm_Payload_t.CmdErrCtr will increment
+ *       - Error specific event message
+ *
+ *  \par Criticality
+ *       None
+ */
+#define SC_QUERY_ATS_WINDOW_CC 17
+
+/**
+ * \brief Report a summary of the ATS command status
+ *
+ *  \par Description
+ *       Reports the status of every command in the specified ATS, in
+ *       time order, as a run-length encoded summary.  Each run is a
+ *       16-bit word holding a status and the number of consecutive
+ *       commands with that status (see #SC_ATS_STATUS_RUN_STATUS_SHIFT
+ *       and #SC_ATS_STATUS_RUN_MAX_LENGTH).  The summary is built over
+ *       several wakeups, #SC_ATS_STATUS_ENTRIES_PER_WAKEUP commands at a
+ *       time, and sent in one or more #SC_AtsStatusTlm_t packets, the
+ *       last of which has LastPacket set.
+ *
+ *  \par Command Structure
+ *       #SC_ReportAtsStatusCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #SC_HkTlm_Payload_t.CmdCtr will increment
+ *       - The #SC_REPORTATS_CMD_INF_EID will be sent
+ *       - One or more #SC_AtsStatusTlm_t packets will be sent
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - Invalid ATS ID
+ *       - The specified ATS is not loaded
+ *       - A previously requested summary is still being built
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #SC_HkTlm_Payload_t.CmdErrCtr will increment
+ *       - Error specific event message
+ *
+ *  \par Criticality
+ *       None
+ */
+#define SC_REPORT_ATS_STATUS_CC 18
+
+/**
+ * \brief Call an RTS from within an RTS
+ *
+ *  \par Description
+ *       This command is only valid as an entry in an RTS, where it is
+ *       carried out by the RTP itself rather than sent on the Software Bus.
+ *       The specified RTS is started in the same wakeup and the calling RTS
+ *       waits at the call entry until it returns.  When the called RTS
+ *       completes, the calling RTS continues with its next command, that
+ *       command's wakeup count being counted from the return.  If the
+ *       called RTS is stopped or fails, the calling RTS is stopped too.
+ *       At most #SC_RTS_MAX_CALL_DEPTH calls may be waiting to return.
+ *
+ *  \par Command Structure
+ *       #SC_CallRtsCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #SC_HkTlm_Payload_t.RtsCmdCtr will increment
+ *       - #SC_HkTlm_Payload_t.RtsActiveCtr will increment
+ *       - The #SC_RTS_CALL_DBG_EID will be sent
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - RTS ID is invalid
+ *       - The called RTS is disabled, not loaded or already executing
+ *       - #SC_RTS_MAX_CALL_DEPTH calls are already waiting to return
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #SC_HkTlm_Payload_t.RtsCmdErrCtr will increment
+ *       - The calling RTS is stopped
+ *       - Error specific event message
+ *
+ *  \par Criticality
+ *       None
+ *
+ *  \sa #SC_CHAIN_RTS_CC
+ */
+#define SC_CALL_RTS_CC 19
+
+/**
+ * \brief Chain to an RTS from within an RTS
+ *
+ *  \par Description
+ *       This command is only valid as an entry in an RTS, where it is
+ *       carried out by the RTP itself rather than sent on the Software Bus.
+ *       The RTS holding the entry ends and the specified RTS is started in
+ *       its place in the same wakeup.  If the ending RTS was called, the
+ *       new RTS returns to its caller.  An RTS may chain to itself to
+ *       start over.
+ *
+ *  \par Command Structure
+ *       #SC_ChainRtsCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #SC_HkTlm_Payload_t.RtsCmdCtr will increment
+ *       - #SC_HkTlm_Payload_t.RtsActiveCtr will increment
+ *       - The #SC_RTS_CHAIN_DBG_EID will be sent
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - RTS ID is invalid
+ *       - The RTS chained to is disabled, not loaded or already executing
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #SC_HkTlm_Payload_t.RtsCmdErrCtr will increment
+ *       - The chaining RTS is stopped
+ *       - Error specific event message
+ *
+ *  \par Criticality
+ *       None
+ *
+ *  \sa #SC_CALL_RTS_CC
+ */
+#define SC_CHAIN_RTS_CC 20
+
+/**
+ * \brief Begin a loop in an RTS
+ *
+ *  \par Description
+ *       This command is only valid as an entry in an RTS, where it is
+ *       interpreted by the RTP as it looks for the next command to send.
+ *       The entries between this one and the matching #SC_RTS_END_LOOP_CC
+ *       entry are run the given number of times, or until the RTS is
+ *       stopped if the count is #SC_RTS_LOOP_FOREVER.  Loops may be nested
+ *       up to #SC_RTS_MAX_LOOP_DEPTH deep.  The wakeup count of a loop
+ *       entry is ignored; the next command is timed from the one before.
+ *
+ *  \par Command Structure
+ *       #SC_RtsLoopCmd_t
+ *
+ *  \par Command Verification
+ *       The commands in the loop body are sent the requested number of
+ *       times, as seen in #SC_HkTlm_Payload_t.RtsCmdCtr
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Loops are already nested #SC_RTS_MAX_LOOP_DEPTH deep
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #SC_HkTlm_Payload_t.RtsCmdErrCtr will increment
+ *       - The RTS is stopped
+ *       - The #SC_RTS_LOOP_ERR_EID event message
+ *
+ *  \par Criticality
+ *       None
+ *
+ *  \sa #SC_RTS_END_LOOP_CC, #SC_RTS_GOTO_CC
+ */
+#define SC_RTS_LOOP_CC 21
+
+/**
+ * \brief End a loop in an RTS
+ *
+ *  \par Description
+ *       This command is only valid as an entry in an RTS, where it is
+ *       interpreted by the RTP.  It closes the innermost loop begun with
+ *       #SC_RTS_LOOP_CC, going back to the start of the loop body until the
+ *       loop has run its count, then continuing with the next entry.
+ *
+ *  \par Command Structure
+ *       #SC_RtsEndLoopCmd_t
+ *
+ *  \par Command Verification
+ *       The commands in the loop body are sent the requested number of
+ *       times, as seen in #SC_HkTlm_Payload_t.RtsCmdCtr
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - There is no loop to end
+ *       - The RTS reaches #SC_RTS_MAX_CTRL_STEPS control entries in a row
+ *         without finding a command to send
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #SC_HkTlm_Payload_t.RtsCmdErrCtr will increment
+ *       - The RTS is stopped
+ *       - Error specific event message
+ *
+ *  \par Criticality
+ *       None
+ *
+ *  \sa #SC_RTS_LOOP_CC, #SC_RTS_GOTO_CC
+ */
+#define SC_RTS_END_LOOP_CC 22
+
+/**
+ * \brief Continue an RTS from another entry
+ *
+ *  \par Description
+ *       This command is only valid as an entry in an RTS, where it is
+ *       interpreted by the RTP.  The RTS continues with the entry at the
+ *       given word offset, which must be the start of an entry in the same
+ *       RTS; this is checked when the RTS is loaded.  Any loops in progress
+ *       are abandoned.  The wakeup count of a goto entry is ignored.
+ *
+ *  \par Command Structure
+ *       #SC_RtsGotoCmd_t
+ *
+ *  \par Command Verification
+ *       The RTS continues with the commands from the given entry
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - The RTS reaches #SC_RTS_MAX_CTRL_STEPS control entries in a row
+ *         without finding a command to send
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #SC_HkTlm_Payload_t.RtsCmdErrCtr will increment
+ *       - The RTS is stopped
+ *       - The #SC_RTS_CTRL_STEPS_ERR_EID event message
+ *
+ *  \par Criticality
+ *       None
+ *
+ *  \sa #SC_RTS_LOOP_CC, #SC_RTS_END_LOOP_CC
+ */
+#define SC_RTS_GOTO_CC 23
+
+/**
+ * \brief Start an Instance of an RTS
+ *
+ *  \par Description
+ *       Starts a loaded RTS in a second RTS, called the instance, which
+ *       executes the commands of the loaded RTS without a copy of its own.
+ *       The instance has its own status, next command and counters in the
+ *       RTS info table, so one loaded RTS may be running several times at
+ *       once.  The instance RTS must be empty, and goes back to empty when
+ *       it stops.  If the instance RTS ID is zero, SC uses the highest
+ *       numbered empty RTS.
+ *
+ *  \par Command Structure
+ *       #SC_StartRtsInstanceCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #SC_HkTlm_Payload_t.CmdCtr will increment
+ *       - #SC_HkTlm_Payload_t.RtsActiveCtr will increment
+ *       - The #SC_STARTRTS_INSTANCE_INF_EID will be sent
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - Either RTS ID is invalid
+ *       - The RTS to run is disabled, not loaded or has an invalid first command
+ *       - The instance RTS is not empty, or no RTS is empty
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #SC_HkTlm_Payload_t.CmdErrCtr will increment
+ *       - #SC_HkTlm_Payload_t.RtsActiveErrCtr will increment
+ *       - The #SC_STARTRTS_INSTANCE_ERR_EID event message
+ *
+ *  \par Criticality
+ *       None
+ *
+ *  \sa #SC_START_RTS_CC, #SC_STOP_RTS_CC
+ */
+#define SC_START_RTS_INSTANCE_CC 24
+
+/**
+ * \brief Start an RTS with Arguments
+ *
+ *  \par Description
+ *       Starts an RTS in the same way as #SC_START_RTS_CC, and gives it a
+ *       block of #SC_RTS_ARG_BLOCK_SIZE argument bytes.  #SC_RTS_PATCH_CC
+ *       entries in the RTS copy ranges of the arguments into the commands
+ *       that follow them as they are sent, so one loaded RTS can serve
+ *       for commands that differ only in a target or value.  An RTS
+ *       started any other way has arguments of all zeros.
+ *
+ *  \par Command Structure
+ *       #SC_StartRtsParamCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #SC_HkTlm_Payload_t.CmdCtr will increment
+ *       - #SC_HkTlm_Payload_t.RtsActiveCtr will increment
+ *       - The #SC_RTS_START_INF_EID will be sent
+ *
+ *  \par Error Conditions
+ *       This command fails for the same reasons as #SC_START_RTS_CC
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #SC_HkTlm_Payload_t.CmdErrCtr will increment
+ *       - #SC_HkTlm_Payload_t.RtsActiveErrCtr will increment
+ *       - The event message sent by #SC_START_RTS_CC for the error
+ *
+ *  \par Criticality
+ *       None
+ *
+ *  \sa #SC_START_RTS_CC, #SC_RTS_PATCH_CC
+ */
+#define SC_START_RTS_PARAM_CC 25
+
+/**
+ * \brief Patch an argument into the next command of an RTS
+ *
+ *  \par Description
+ *       This command is only valid as an entry in an RTS, where it is
+ *       interpreted by the RTP as it looks for the next command to send.
+ *       When that command is sent, a range of the arguments given to
+ *       #SC_START_RTS_PARAM_CC is copied into it past its command header,
+ *       and its checksum is computed again.  The command is patched in a
+ *       copy, the RTS itself is not changed.  Up to #SC_RTS_MAX_PATCHES
+ *       patch entries may come before one command.  The wakeup count of a
+ *       patch entry is ignored.
+ *
+ *  \par Command Structure
+ *       #SC_RtsPatchCmd_t
+ *
+ *  \par Command Verification
+ *       The patched command is sent, as seen in
+ *       #SC_HkTlm_Payload_t.RtsCmdCtr
+ *
+ *  \par Error Conditions
+ *       An RTS table is rejected at load, with the
+ *       #SC_RTS_PATCH_LOAD_ERR_EID event, if a patch range is outside the
+ *       arguments, on the command header, or past the end of the command
+ *       that directly follows the patch entries.
+ *
+ *       This command may fail for the following reason(s):
+ *       - More than #SC_RTS_MAX_PATCHES patch entries before one command
+ *       - The range is outside the command it lands in after a loop, end
+ *         loop, goto or timed entry
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #SC_HkTlm_Payload_t.RtsCmdErrCtr will increment
+ *       - The RTS is stopped
+ *       - The #SC_RTS_PATCH_ERR_EID event message
+ *
+ *  \par Criticality
+ *       None
+ *
+ *  \sa #SC_START_RTS_PARAM_CC
+ */
+#define SC_RTS_PATCH_CC 26
+
+/**
+ * \brief START a set of RTS
+ *
+ *  \par Description
+ *       This command STARTS each RTS in the set that is currently LOADED,
+ *       ENABLED and STOPPED.  RTS in the set that can't be started are
+ *       counted in #SC_HkTlm_Payload_t.RtsActiveErrCtr.
+ *       The set is a bitmask of RTS IDs laid out the same way as
+ *       #SC_HkTlm_Payload_t.RtsExecutingStatus, so RTS 1 is the lowest bit
+ *       of the first word.  The RTS need not be contiguous, and one
+ *       summary event is sent for the whole set.
+ *
+ *  \par Command Structure
+ *       #SC_StartRtsSetCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #SC_HkTlm_Payload_t.CmdCtr will increment
+ *       - #SC_STARTRTSSET_CMD_INF_EID event will give the number of RTS in the set,
+ *         the number actually STARTED and the number that were DISABLED, or not
+ *         LOADED or in use
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - The set is empty, or has bits set past RTS #SC_NUMBER_OF_RTS
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #SC_HkTlm_Payload_t.CmdErrCtr will increment
+ *       - The #SC_CMD_LEN_ERR_EID event will indicate invalid command packet length.
+ *       - The #SC_RTSSET_CMD_ERR_EID event will indicate an invalid set.
+ *
+ *  \par Criticality
+ *       None
+ *
+ *  \sa #SC_START_RTS_GRP_CC, #SC_STOP_RTS_SET_CC
+ */
+#define SC_START_RTS_SET_CC 27
+
+/**
+ * \brief STOP a set of RTS
+ *
+ *  \par Description
+ *       This command STOPS each RTS in the set that is currently STARTED.
+ *       The set is a bitmask of RTS IDs laid out the same way as
+ *       #SC_HkTlm_Payload_t.RtsExecutingStatus, so RTS 1 is the lowest bit
+ *       of the first word.  The RTS need not be contiguous, and one
+ *       summary event is sent for the whole set.
+ *
+ *  \par Command Structure
+ *       #SC_StopRtsSetCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #SC_HkTlm_Payload_t.CmdCtr will increment
+ *       - #SC_STOPRTSSET_CMD_INF_EID event will give the number of RTS in the set
+ *         and the number actually STOPPED
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - The set is empty, or has bits set past RTS #SC_NUMBER_OF_RTS
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #SC_HkTlm_Payload_t.CmdErrCtr will increment
+ *       - The #SC_CMD_LEN_ERR_EID event will indicate invalid command packet length.
+ *       - The #SC_RTSSET_CMD_ERR_EID event will indicate an invalid set.
+ *
+ *  \par Criticality
+ *       None
+ *
+ *  \sa #SC_STOP_RTS_GRP_CC, #SC_START_RTS_SET_CC
+ */
+#define SC_STOP_RTS_SET_CC 28
+
+/**
+ * \brief DISABLE a set of RTS
+ *
+ *  \par Description
+ *       This command DISABLES each RTS in the set that is currently ENABLED.
+ *       The set is a bitmask of RTS IDs laid out the same way as
+ *       #SC_HkTlm_Payload_t.RtsExecutingStatus, so RTS 1 is the lowest bit
+ *       of the first word.  The RTS need not be contiguous, and one
+ *       summary event is sent for the whole set.
+ *
+ *  \par Command Structure
+ *       #SC_DisableRtsSetCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #SC_HkTlm_Payload_t.CmdCtr will increment
+ *       - #SC_DISRTSSET_CMD_INF_EID event will give the number of RTS in the set
+ *         and the number actually DISABLED
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - The set is empty, or has bits set past RTS #SC_NUMBER_OF_RTS
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #SC_HkTlm_Payload_t.CmdErrCtr will increment
+ *       - The #SC_CMD_LEN_ERR_EID event will indicate invalid command packet length.
+ *       - The #SC_RTSSET_CMD_ERR_EID event will indicate an invalid set.
+ *
+ *  \par Criticality
+ *       None
+ *
+ *  \sa #SC_DISABLE_RTS_GRP_CC, #SC_ENABLE_RTS_SET_CC
+ */
+#define SC_DISABLE_RTS_SET_CC 29
+
+/**
+ * \brief ENABLE a set of RTS
+ *
+ *  \par Description
+ *       This command ENABLES each RTS in the set that is currently DISABLED.
+ *       The set is a bitmask of RTS IDs laid out the same way as
+ *       #SC_HkTlm_Payload_t.RtsExecutingStatus, so RTS 1 is the lowest bit
+ *       of the first word.  The RTS need not be contiguous, and one
+ *       summary event is sent for the whole set.
+ *
+ *  \par Command Structure
+ *       #SC_EnableRtsSetCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #SC_HkTlm_Payload_t.CmdCtr will increment
+ *       - #SC_ENARTSSET_CMD_INF_EID event will give the number of RTS in the set
+ *         and the number actually ENABLED
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - The set is empty, or has bits set past RTS #SC_NUMBER_OF_RTS
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #SC_HkTlm_Payload_t.CmdErrCtr will increment
+ *       - The #SC_CMD_LEN_ERR_EID event will indicate invalid command packet length.
+ *       - The #SC_RTSSET_CMD_ERR_EID event will indicate an invalid set.
+ *
+ *  \par Criticality
+ *       None
+ *
+ *  \sa #SC_ENABLE_RTS_GRP_CC, #SC_DISABLE_RTS_SET_CC
+ */
+#define SC_ENABLE_RTS_SET_CC 30
+
+/**
+ * \brief Time the rest of an RTS by the clock
+ *
+ *  \par Description
+ *       This command is only valid as an entry in an RTS, where it is
+ *       interpreted by the RTP.  From this entry on, the wakeup count of
+ *       each command is read as a delay in time rather than in wakeups:
+ *       the upper 16 bits are seconds and the lower 16 bits are 1/65536ths
+ *       of a second.  Each delay counts from the time the previous command
+ *       was due, or for the first one from the time this entry was reached,
+ *       rather than from when the previous command was actually sent, so
+ *       late or missed wakeups do not build up over the RTS.  A command is sent
+ *       on the first wakeup at or after its time, still in RTS number order
+ *       with the other RTSs and within #SC_MAX_CMDS_PER_WAKEUP.  Reaching
+ *       this entry again starts the delays over from that time.  Times come
+ *       from the reference set by #SC_TIME_TO_USE, so a jump in that time
+ *       moves every command still waiting.  The wakeup count of this entry
+ *       is ignored.
+ *
+ *  \par Command Structure
+ *       #SC_RtsTimedCmd_t
+ *
+ *  \par Command Verification
+ *       The commands after this entry are sent at their times, as seen in
+ *       #SC_HkTlm_Payload_t.RtsCmdCtr
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - The RTS reaches #SC_RTS_MAX_CTRL_STEPS control entries in a row
+ *         without finding a command to send
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #SC_HkTlm_Payload_t.RtsCmdErrCtr will increment
+ *       - The RTS is stopped
+ *       - The #SC_RTS_CTRL_STEPS_ERR_EID event message
+ *
+ *  \par Criticality
+ *       None
+ *
+ *  \sa #SC_START_RTS_CC
+ */
+#define SC_RTS_TIMED_CC 31
+
+/**
+ * \brief Set the priority level of a set of RTS
+ *
+ *  \par Description
+ *       Gives each RTS in the set a priority level, from 0, the highest,
+ *       through #SC_RTS_PRIORITY_LEVELS - 1.  When more RTS commands are due
+ *       than #SC_MAX_CMDS_PER_WAKEUP allows, the RTP sends those of the
+ *       highest level first and takes turns among the RTSs of a level, so
+ *       no RTS in a busy level is left waiting behind the others.  RTSs at
+ *       a level below #SC_RTS_PRIORITY_OVER_ATP send their commands ahead
+ *       of the ATP.  An instance of an RTS runs at the level of the RTS it
+ *       runs.  Levels may be changed while the RTS are executing, and are
+ *       kept when an RTS is reloaded.  The set is laid out the same way as
+ *       for #SC_START_RTS_SET_CC.
+ *
+ *  \par Command Structure
+ *       #SC_SetRtsPriorityCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #SC_HkTlm_Payload_t.CmdCtr will increment
+ *       - The #SC_SET_RTS_PRIORITY_INF_EID event will give the level and the
+ *         number of RTS in the set
+ *       - The RTS info table shows the new level of each RTS
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - The set is empty, or has bits set past RTS #SC_NUMBER_OF_RTS
+ *       - The priority level is not less than #SC_RTS_PRIORITY_LEVELS
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #SC_HkTlm_Payload_t.CmdErrCtr will increment
+ *       - The #SC_CMD_LEN_ERR_EID event will indicate invalid command packet length.
+ *       - The #SC_SET_RTS_PRIORITY_ERR_EID event will indicate an invalid set or level.
+ *
+ *  \par Criticality
+ *       Raising the level of routine RTSs can delay critical ones.
+ *
+ *  \sa #SC_START_RTS_SET_CC
+ */
+#define SC_SET_RTS_PRIORITY_CC 32
+
+/**
+ * \brief Reset the diagnostic statistics
+ *
+ *  \par Description
+ *       Clears the statistics of the #SC_DiagTlm_t packet, which is sent
+ *       with each housekeeping packet.  For each command the ATP or RTP
+ *       sends, the packet keeps how long after its scheduled time the
+ *       command went out: the ATS time tag for the ATP, the command time
+ *       for a timed RTS, and the start of the wakeup it was sent in for
+ *       any other RTS.  The latencies are kept as log-scaled histograms
+ *       with their count, minimum, maximum and mean.
+ *
+ *  \par Command Structure
+ *       #SC_ResetDiagCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #SC_HkTlm_Payload_t.CmdCtr will increment
+ *       - The #SC_RESET_DIAG_INF_EID event will be sent
+ *       - The statistics in the next #SC_DiagTlm_t packet will be zero
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #SC_HkTlm_Payload_t.CmdErrCtr will increment
+ *       - Error specific event message #SC_CMD_LEN_ERR_EID
+ *
+ *  \par Criticality
+ *       None
+ *
+ *  \sa #SC_RESET_COUNTERS_CC
+ */
+#define SC_RESET_DIAG_CC 33
+
+/**
+ * \brief Report the next commands due
+ *
+ *  \par Description
+ *       Reports the next commands SC will send, up to the number asked
+ *       for, merged across the executing ATS and all executing RTSs in the
+ *       order they are due.  ATS commands are taken from the ATS time
+ *       index table starting at the command the ATP will send next.  Each
+ *       executing RTS contributes the command it will send next, whose due
+ *       wakeup count or time has already been worked out; the commands
+ *       after it depend on the control entries carried out as it runs.  An
+ *       RTS held by a call it made is not included.  A wakeup is taken to
+ *       be one second when ordering ATS and RTS commands together.  The
+ *       commands are reported in one #SC_LookaheadTlm_t packet.
+ *
+ *  \par Command Structure
+ *       #SC_QueryLookaheadCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #SC_HkTlm_Payload_t.CmdCtr will increment
+ *       - The #SC_LOOKAHEAD_CMD_INF_EID will be sent
+ *       - A #SC_LookaheadTlm_t packet will be sent
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - Number of commands asked for is 0 or more than #SC_LOOKAHEAD_ENTRIES
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #SC_HkTlm_Payload_t.CmdErrCtr will increment
+ *       - Error specific event message
+ *
+ *  \par Criticality
+ *       None
+ *
+ *  \sa #SC_QUERY_ATS_WINDOW_CC
+ */
+#define SC_QUERY_LOOKAHEAD_CC 34
+
+/**
+ * \brief Set the event reporting mode
+ *
+ *  \par Description
+ *       Selects how the events SC can send at a high rate are reported.
+ *       In #SC_EventMode_IMMEDIATE mode each is sent as it happens.  In
+ *       #SC_EventMode_DEFERRED mode they are queued as they happen and,
+ *       once SC has finished with the message it was processing, such as
+ *       a wakeup, one summary event is sent for each kind of event queued,
+ *       listing the RTS numbers involved.  The #SC_RTS_START_INF_EID,
+ *       #SC_RTS_COMPL_INF_EID, #SC_RTS_DIST_ERR_EID, #SC_RTS_CHKSUM_ERR_EID,
+ *       #SC_STARTRTSGRP_CMD_NOT_LDED_ERR_EID and
+ *       #SC_STARTRTSGRP_CMD_DISABLED_ERR_EID events are reported this way,
+ *       the error summaries as error events.  Other error events, which
+ *       give the offset of a bad table entry, are always sent as they
+ *       happen.
+ *
+ *  \par Command Structure
+ *       #SC_SetEventModeCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #SC_HkTlm_Payload_t.CmdCtr will increment
+ *       - #SC_HkTlm_Payload_t.EventMode will show the new mode
+ *       - The #SC_EVENT_MODE_CMD_INF_EID will be sent
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - Invalid mode specified
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #SC_HkTlm_Payload_t.CmdErrCtr will increment
+ *       - Error specific event message
+ *
+ *  \par Criticality
+ *       None
+ */
+#define SC_SET_EVENT_MODE_CC 35
+
 /**\}*/
 
 #ifndef SC_OMIT_DEPRECATED
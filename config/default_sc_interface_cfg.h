@@ -69,4 +69,145 @@
  */
 #define SC_NUMBER_OF_RTS 64
 
+/**
+ * \brief  Width of ATS command numbers and buffer entry offsets
+ *
+ *  \par Description:
+ *       The number of bits used to store ATS command numbers, the internal
+ *       command/sequence indices, and the word offsets of entries within
+ *       the ATS and RTS buffers.  The default of 16 bits keeps the table and
+ *       telemetry layouts compatible with earlier versions of SC, but limits
+ *       an ATS to 65535 commands and 64K words.  Setting this to 32 allows
+ *       much larger ATS buffers and command counts, at the cost of a larger
+ *       ATS command lookup table and changed ATS entry header and
+ *       housekeeping telemetry layouts.
+ *
+ *  \par Limits:
+ *       This parameter must be either 16 or 32.
+ */
+#define SC_CMD_INDEX_BITS 16
+
+/**
+ * \brief  Number of ATS commands per ATS window telemetry packet
+ *
+ *  \par Description:
+ *       The maximum number of ATS commands reported in each packet sent
+ *       in response to a #SC_QUERY_ATS_WINDOW_CC command.  Windows with
+ *       more commands than this are reported as a series of packets.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 1, and the resulting packet
+ *       must fit in CFE_MISSION_SB_MAX_SB_MSG_SIZE.
+ */
+#define SC_ATS_WINDOW_ENTRIES_PER_PKT 32
+
+/**
+ * \brief  Number of status runs per ATS status summary packet
+ *
+ *  \par Description:
+ *       The maximum number of run-length encoded status runs carried in
+ *       each packet of the summary sent in response to a
+ *       #SC_REPORT_ATS_STATUS_CC command.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 1, and the resulting packet
+ *       must fit in CFE_MISSION_SB_MAX_SB_MSG_SIZE.
+ */
+#define SC_ATS_STATUS_RUNS_PER_PKT 64
+
+/**
+ * \brief  Number of commands in the lookahead telemetry packet
+ *
+ *  \par Description:
+ *       The most commands a #SC_QUERY_LOOKAHEAD_CC command can ask to
+ *       have reported, all of which are sent in one packet.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 1 and no more than 255, and the
+ *       resulting packet must fit in CFE_MISSION_SB_MAX_SB_MSG_SIZE.
+ */
+#define SC_LOOKAHEAD_ENTRIES 32
+
+/**
+ * \brief  Size of the RTS argument block
+ *
+ *  \par Description:
+ *       The number of argument bytes carried by a #SC_START_RTS_PARAM_CC
+ *       command and kept for each RTS, for its #SC_RTS_PATCH_CC entries
+ *       to copy into its commands.
+ *
+ *  \par Limits:
+ *       This parameter must be a multiple of 4, at least 4 and no larger
+ *       than #SC_PACKET_MAX_SIZE.
+ */
+#define SC_RTS_ARG_BLOCK_SIZE 16
+
+/**
+ * \brief  Number of bins in each dispatch latency histogram
+ *
+ *  \par Description:
+ *       The number of bins in the ATP and RTP dispatch latency histograms
+ *       of the diagnostic packet.  The bins are log-scaled: bin 0 counts
+ *       commands sent less than #SC_LATENCY_HIST_BASE_USEC after their
+ *       scheduled time, each following bin covers twice the span of the
+ *       one before it, and the last bin counts all longer latencies.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 2 and no more than 32.
+ */
+#define SC_LATENCY_HIST_BINS 16
+
+/**
+ * \brief  Upper bound of the first dispatch latency histogram bin
+ *
+ *  \par Description:
+ *       The latency, in microseconds, below which a command is counted in
+ *       bin 0 of a dispatch latency histogram.  Bin N, for N from 1 up to
+ *       #SC_LATENCY_HIST_BINS - 2, counts latencies from
+ *       SC_LATENCY_HIST_BASE_USEC * 2^(N-1) up to
+ *       SC_LATENCY_HIST_BASE_USEC * 2^N.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 1.
+ */
+#define SC_LATENCY_HIST_BASE_USEC 1000
+
+/**
+ * \brief  Number of overloaded seconds kept by the ATS load forecast
+ *
+ *  \par Description:
+ *       The number of seconds, with the most commands tagged in them,
+ *       that the diagnostic packet lists when a verified ATS or Append
+ *       table asks for more commands in a second than SC can send.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 1 and no more than 16.
+ */
+#define SC_FORECAST_WINDOWS 4
+
+/**
+ * \brief  Number of entries in the trigger table
+ *
+ *  \par Description:
+ *       The number of entries in the trigger table, each of which
+ *       starts an RTS when a message it names arrives.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 1 and no larger than 255.
+ */
+#define SC_NUMBER_OF_TRIGGERS 16
+
+/**
+ * \brief  Number of entries in the trace table
+ *
+ *  \par Description:
+ *       The number of command dispatches kept in the dump-only trace
+ *       table.  Once it is full, each new dispatch replaces the oldest.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 1.  Each entry takes 32 bytes
+ *       of table space.
+ */
+#define SC_TRACE_ENTRIES 1024
+
 #endif
@@ -85,6 +85,97 @@
  */
 #define SC_MAX_CMDS_PER_WAKEUP 8
 
+/**
+ * \brief  Number of wakeups per second
+ *
+ *  \par Description:
+ *       The rate at which #SC_WAKEUP_MID is scheduled.  It is used to
+ *       forecast whether a verified ATS or Append table asks for more
+ *       commands in one second than SC can send, which is
+ *       #SC_MAX_CMDS_PER_WAKEUP times this rate, and to count how many
+ *       wakeups late a timed RTS command is sent.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 1 and no more than 1000000.
+ */
+#define SC_WAKEUPS_PER_SECOND 1
+
+/**
+ * \brief  Reject ATS tables that would overload SC
+ *
+ *  \par Description:
+ *       When true, an ATS or Append table with more commands tagged in
+ *       any one second than SC can send in a second fails verification.
+ *       When false the table is accepted and the overloaded seconds are
+ *       reported in an event.  Either way they are reported in the
+ *       diagnostic packet.
+ *
+ *  \par Limits:
+ *       Must be true or false
+ */
+#define SC_FORECAST_REJECT false
+
+/**
+ * \brief  Count executing RTSs against the ATS load forecast
+ *
+ *  \par Description:
+ *       When true, the commands per second left for an ATS being verified
+ *       are reduced by one command per wakeup for each RTS executing at
+ *       the time.
+ *
+ *  \par Limits:
+ *       Must be true or false
+ */
+#define SC_FORECAST_RTS_DEMAND false
+
+/**
+ * \brief Max number of ATS entries activated per wakeup
+ *
+ *  \par Description:
+ *       A newly loaded ATS table is parsed and time sorted in steps
+ *       that are run at the end of each wakeup cycle.  This is the
+ *       maximum number of entries parsed, or heap sort steps run, by
+ *       each step.  An ATS holding N commands needs about
+ *       (2.5 * N) / SC_ATS_LOAD_ENTRIES_PER_WAKEUP wakeups before it can
+ *       be started.  A sort step compares at most 2 * log2(N) pairs of
+ *       time tags, so a wakeup compares at most
+ *       2 * log2(N) * SC_ATS_LOAD_ENTRIES_PER_WAKEUP pairs.
+ *
+ *  \par Limits:
+ *       Must be at least 1.  Larger values activate an ATS sooner but
+ *       lengthen the worst case wakeup processing time.
+ */
+#define SC_ATS_LOAD_ENTRIES_PER_WAKEUP 256
+
+/**
+ * \brief Max number of ATS commands summarized per wakeup
+ *
+ *  \par Description:
+ *       The ATS status summary requested by #SC_REPORT_ATS_STATUS_CC is
+ *       built in steps that are run at the end of each wakeup cycle.
+ *       This is the maximum number of ATS commands examined by each step.
+ *
+ *  \par Limits:
+ *       Must be at least 1.  Larger values finish a summary sooner but
+ *       lengthen the worst case wakeup processing time.
+ */
+#define SC_ATS_STATUS_ENTRIES_PER_WAKEUP 512
+
+/**
+ * \brief Max number of ATS window packets sent per query
+ *
+ *  \par Description:
+ *       A #SC_QUERY_ATS_WINDOW_CC command sends at most this many
+ *       #SC_AtsWindowTlm_t packets.  The commands of a larger window
+ *       are left out, and can be reported by a further query that
+ *       starts at the time of the last command received.
+ *
+ *  \par Limits:
+ *       Must be at least 1.  Larger values report larger windows in
+ *       one query but lengthen the telemetry burst it causes.
+ */
+#define SC_ATS_WINDOW_MAX_PKTS 8
+
 /**
  * \brief Max buffer size for an ATS in uint16s
  *
@@ -92,7 +183,7 @@
  *       The max sizeof an ATS buffer in words (not bytes)
  *  \par Limits:
  *       This parameter can't be larger than an unsigned 16 bit
- *       integer (65535).
+ *       integer (65535), unless #SC_CMD_INDEX_BITS is 32.
  */
 #define SC_ATS_BUFF_SIZE 8000
 
@@ -107,16 +198,49 @@
 #define SC_APPEND_BUFF_SIZE (SC_ATS_BUFF_SIZE / 2)
 
 /**
- * \brief Max buffer size for an RTS in uint16s
+ * \brief Nominal buffer size for an RTS in uint16s
  *
  *  \par Description:
- *       The max size of an RTS buffer in WORDS (not bytes)
+ *       The size in WORDS (not bytes) that a typical RTS is planned for.
+ *       It sets the default sizes of the RTS storage pool and of the
+ *       largest RTS, #SC_RTS_MAX_SIZE.
  *  \par Limits:
  *       This parameter can't be larger than an unsigned 16 bit
  *       integer (65535).
  */
 #define SC_RTS_BUFF_SIZE 150
 
+/**
+ * \brief Max size of a single RTS in uint16s
+ *
+ *  \par Description:
+ *       The size of the largest RTS in WORDS (not bytes).  Each RTS table
+ *       is registered at this size.  A loaded RTS is copied into the RTS
+ *       storage pool at the size its commands need, so this may be set
+ *       above #SC_RTS_BUFF_SIZE to allow long RTSs without growing the
+ *       pool.  Each RTS table buffer grows with it, however.
+ *  \par Limits:
+ *       This parameter can't be larger than an unsigned 16 bit
+ *       integer (65535) or than #SC_RTS_POOL_SIZE.
+ */
+#define SC_RTS_MAX_SIZE SC_RTS_BUFF_SIZE
+
+/**
+ * \brief Size of the RTS storage pool in uint16s
+ *
+ *  \par Description:
+ *       Loaded RTSs are copied out of their table buffers into a single
+ *       storage pool, each taking only the space its commands need plus
+ *       an end marker.  The pool is shared by all RTSs, so it can be sized
+ *       for the RTSs a mission actually loads rather than for
+ *       #SC_NUMBER_OF_RTS full RTS buffers.  The default assumes the
+ *       average RTS fills half of its nominal buffer.
+ *  \par Limits:
+ *       This parameter must be at least big enough to hold one command
+ *       (SC_PACKET_MIN_SIZE), and at least #SC_RTS_MAX_SIZE.
+ */
+#define SC_RTS_POOL_SIZE ((SC_NUMBER_OF_RTS * SC_RTS_BUFF_SIZE) / 2)
+
 /**
  * \brief Max number of commands in each ATS
  *
@@ -125,7 +249,7 @@
  *
  *  \par Limits:
  *       This parameter can't be larger than an unsigned 16 bit
- *       integer (65535).
+ *       integer (65535), unless #SC_CMD_INDEX_BITS is 32.
  */
 #define SC_MAX_ATS_CMDS 1000
 
@@ -141,6 +265,102 @@
  */
 #define SC_LAST_RTS_WITH_EVENTS 20
 
+/**
+ * \brief Max depth of nested RTS calls
+ *
+ *  \par Description:
+ *       An RTS may call another RTS with an #SC_CALL_RTS_CC entry, which
+ *       may in turn call another.  This is the maximum number of calls
+ *       that may be waiting to return at one time.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 1 and can't be larger than
+ *       #SC_NUMBER_OF_RTS - 1, since an RTS that is executing can't be
+ *       called again.
+ */
+#define SC_RTS_MAX_CALL_DEPTH 4
+
+/**
+ * \brief Max depth of nested RTS loops
+ *
+ *  \par Description:
+ *       The number of #SC_RTS_LOOP_CC loops that may be open at one time
+ *       in a single RTS.  Each level costs a word offset and a count in
+ *       every RTS info entry.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 1 and can't be larger than 255.
+ */
+#define SC_RTS_MAX_LOOP_DEPTH 4
+
+/**
+ * \brief Max RTS control entries between two commands
+ *
+ *  \par Description:
+ *       The RTP carries out loop, end loop and goto entries as it looks for
+ *       the next command of an RTS.  If it carries out this many of them in
+ *       a row without finding a command, the RTS is assumed to be stuck
+ *       (for example, an empty forever loop) and is stopped.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 1 and can't be larger than 255.
+ */
+#define SC_RTS_MAX_CTRL_STEPS 16
+
+/**
+ * \brief Max RTS patch entries for one command
+ *
+ *  \par Description:
+ *       The number of #SC_RTS_PATCH_CC entries that may come before a
+ *       single command in an RTS.  Each one costs a word offset in every
+ *       RTS info entry.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 1 and can't be larger than 255.
+ */
+#define SC_RTS_MAX_PATCHES 4
+
+/**
+ * \brief Number of RTS priority levels
+ *
+ *  \par Description:
+ *       Each RTS has a priority level from 0, the highest, up to one less
+ *       than this number, set with #SC_SET_RTS_PRIORITY_CC.  When more RTS
+ *       commands are due than a wakeup can send, the RTP sends those of
+ *       the highest level first, taking turns among the RTSs of one level.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 1 and can't be larger than 255.
+ */
+#define SC_RTS_PRIORITY_LEVELS 4
+
+/**
+ * \brief Priority level of an RTS at startup
+ *
+ *  \par Description:
+ *       The priority level every RTS has until it is changed by
+ *       #SC_SET_RTS_PRIORITY_CC.
+ *
+ *  \par Limits:
+ *       This parameter must be less than #SC_RTS_PRIORITY_LEVELS.
+ */
+#define SC_RTS_DEFAULT_PRIORITY 2
+
+/**
+ * \brief RTS priority levels that run ahead of the ATP
+ *
+ *  \par Description:
+ *       RTSs with a priority level below this number send their due
+ *       commands ahead of the ATP, so that critical RTSs such as safing
+ *       sequences are not held back by a busy ATS.  All other RTSs run
+ *       after the ATP has nothing more to send.  Zero keeps the ATP ahead
+ *       of every RTS.
+ *
+ *  \par Limits:
+ *       This parameter can't be larger than #SC_RTS_PRIORITY_LEVELS.
+ */
+#define SC_RTS_PRIORITY_OVER_ATP 1
+
 /**
  * \brief Command Pipe Depth
  *
@@ -155,6 +375,23 @@
  */
 #define SC_PIPE_DEPTH 12
 
+/**
+ * \brief Trigger Pipe Depth
+ *
+ *  \par Description:
+ *       Maximum number of trigger table messages that will be allowed in
+ *       the SC trigger pipe at one time.  Trigger messages have a pipe of
+ *       their own so a burst of them is dropped there rather than crowding
+ *       commands, wakeups and housekeeping requests out of the command
+ *       pipe.  At most this many trigger messages are handled each time
+ *       SC finishes with the command pipe.
+ *
+ *  \par Limits:
+ *       This parameter must be greater than zero and less than or equal to
+ *       OS_QUEUE_MAX_DEPTH.
+ */
+#define SC_TRIGGER_PIPE_DEPTH 4
+
 /**
  * \brief ATS Table Filenames
  *
@@ -191,6 +428,21 @@
  */
 #define SC_APPEND_FILE_NAME "/cf/sc_append.tbl"
 
+/**
+ * \brief Trigger Table Filename
+ *
+ *  \par Description:
+ *       This name describes the default trigger table filename loaded at
+ *       startup.  The default trigger table has no triggers in use.
+ *
+ *  \par Limits:
+ *       SC requires that this name be defined, but otherwise places no
+ *       limits on the definition.  If the named table file does not exist
+ *       at run time, or the table fails validation, then the table load
+ *       will fail.  Refer to #OS_MAX_PATH_LEN for filename length limits.
+ */
+#define SC_TRIGGER_FILE_NAME "/cf/sc_trig.tbl"
+
 /**
  * \brief RTS Table Filenames
  *
@@ -263,6 +515,21 @@
  */
 #define SC_RTS_TABLE_NAME "RTS_TBL"
 
+/**
+ * \brief Trigger Table Object Name
+ *
+ *  \par Description:
+ *       Unique table object names are required for each table registered
+ *       with cFE Table Services.  This is the table object name for the
+ *       trigger table.
+ *
+ *  \par Limits:
+ *       SC requires that this name be defined, but otherwise places no
+ *       limits on the definition.  Refer to #CFE_MISSION_TBL_MAX_NAME_LENGTH for
+ *       specific information on limits related to table object names.
+ */
+#define SC_TRIGGER_TABLE_NAME "TRIG_TBL"
+
 /**
  * \brief Name of the RTS Infomation Table
  *
@@ -313,6 +580,26 @@
  */
 #define SC_ATS_CTRL_TABLE_NAME "ATPCTR_TBL"
 
+/**
+ * \brief Name of the trace table
+ *
+ *  \par Description:
+ *       Name of the dump-only table of recent command dispatches
+ *  \par Limits:
+ *       Must be less than #CFE_MISSION_TBL_MAX_NAME_LENGTH
+ */
+#define SC_TRACE_TABLE_NAME "TRACE_TBL"
+
+/**
+ * \brief Name of the RTS statistics table
+ *
+ *  \par Description:
+ *       Name of the dump-only table of per-RTS execution statistics
+ *  \par Limits:
+ *       Must be less than #CFE_MISSION_TBL_MAX_NAME_LENGTH
+ */
+#define SC_RTS_STATS_TABLE_NAME "RTSSTA_TBL"
+
 /**
  * \brief Name Prefix of ATS Cmd Status Table
  *
@@ -338,6 +625,31 @@
  */
 #define SC_CONT_ON_FAILURE_START SC_AtsCont_TRUE
 
+/**
+ * \brief Defines default event reporting mode
+ *
+ *  \par Description:
+ *       This parameter specifies the event reporting mode SC starts in,
+ *       see #SC_SET_EVENT_MODE_CC
+ *
+ *  \par Limits:
+ *       Must be SC_EventMode_IMMEDIATE or SC_EventMode_DEFERRED
+ */
+#define SC_EVENT_MODE_START SC_EventMode_IMMEDIATE
+
+/**
+ * \brief Number of events that can be queued for a summary
+ *
+ *  \par Description:
+ *       The most events queued in #SC_EventMode_DEFERRED mode while
+ *       SC processes one message.  Events that do not fit in the queue
+ *       are sent as they happen.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 1 and no more than 65535.
+ */
+#define SC_DEFERRED_EVENT_DEPTH 64
+
 /**
  * \brief Defines the TIME SC should use for its commands
  *
@@ -37,6 +37,9 @@
 
 #define SC_NUMBER_OF_RTS_IN_UINT16 16 /**< \brief Number of RTS represented in a uint16 */
 
+/** \brief Number of uint16 words in a bitmask of all RTS */
+#define SC_RTS_SET_WORDS ((SC_NUMBER_OF_RTS + (SC_NUMBER_OF_RTS_IN_UINT16 - 1)) / SC_NUMBER_OF_RTS_IN_UINT16)
+
 /**
  * ATS/RTS Cmd Status Enumeratoion
  */
@@ -100,9 +103,42 @@ typedef uint8 SC_Process_Enum_t;
 /**\}*/
 #endif
 
+/**
+ * Enumeration for SC processing phases
+ * These index the phase statistics in the diagnostic packet
+ */
+enum SC_PhaseNum
+{
+    SC_Phase_WAKEUP       = 0, /**< \brief Wakeup command processing */
+    SC_Phase_ATP_DISPATCH = 1, /**< \brief ATP command dispatch */
+    SC_Phase_RTP_SCHEDULE = 2, /**< \brief Finding the next RTS to run */
+    SC_Phase_LOAD_ATS     = 3, /**< \brief ATS load */
+    SC_Phase_BUILD_INDEX  = 4, /**< \brief ATS time index build */
+    SC_Phase_VERIFY_ATS   = 5, /**< \brief ATS table verification */
+    SC_Phase_APPEND       = 6, /**< \brief ATS append processing */
+    SC_Phase_SEND_HK      = 7, /**< \brief Housekeeping packet */
+    SC_Phase_MAX               /**< \brief Number of phases */
+};
+
+typedef uint8 SC_Phase_Enum_t;
+
 #define SC_MAX_TIME 0xFFFFFFFF /**< \brief Maximum time in SC */
 #define SC_MAX_WAKEUP_CNT 0xFFFFFFFF /**< \brief Maximum wakeup count in SC */
 
+/**
+ * \name ATS status summary run encoding
+ *
+ * Each run of an ATS status summary is a 16-bit word.  The upper 4 bits
+ * hold the #SC_Status value shared by the run and the lower 12 bits hold
+ * the number of consecutive commands in the run.  Longer runs are split.
+ * \{
+ */
+#define SC_ATS_STATUS_RUN_STATUS_SHIFT 12     /**< \brief Bit position of the status in a run */
+#define SC_ATS_STATUS_RUN_MAX_LENGTH   0x0FFF /**< \brief Longest run, also the mask for the run length */
+/**\}*/
+
+#define SC_RTS_LOOP_FOREVER 0 /**< \brief Loop count for an RTS loop that repeats until the RTS is stopped */
+
 /**
  * Enumeration for ATS identifiers
  *
@@ -154,6 +190,21 @@ typedef uint8 SC_TimeRef_Enum_t;
 
 #define SC_INVALID_RTS_NUMBER 0 /**< \brief Invalid RTS number */
 
+/**
+ * Enumeration of ATS activation phases
+ *
+ * A newly loaded ATS table is activated over several wakeups.  The ATS
+ * cannot be started until the activation returns to idle.
+ */
+enum SC_AtsLoadPhase
+{
+    SC_AtsLoadPhase_IDLE,  /**< \brief No ATS activation in progress */
+    SC_AtsLoadPhase_PARSE, /**< \brief Walking the ATS buffer and recording command offsets */
+    SC_AtsLoadPhase_INDEX  /**< \brief Building the time index table */
+};
+
+typedef uint8 SC_AtsLoadPhase_Enum_t;
+
 /**
  * SC Continue After Failure Enumeration
  */
@@ -165,6 +216,17 @@ enum SC_AtsCont
 
 typedef uint8 SC_AtsCont_Enum_t;
 
+/**
+ * SC Event Reporting Mode Enumeration
+ */
+enum SC_EventMode
+{
+    SC_EventMode_IMMEDIATE = 0, /**< \brief Each event is sent as it happens */
+    SC_EventMode_DEFERRED  = 1  /**< \brief Some events are summarized after each message SC processes */
+};
+
+typedef uint8 SC_EventMode_Enum_t;
+
 #ifndef SC_OMIT_DEPRECATED
 /**
  * \name Old-style SC Continue Flags
@@ -175,6 +237,23 @@ typedef uint8 SC_AtsCont_Enum_t;
 /**\}*/
 #endif
 
+/**
+ * Enumeration for the Jump ATS reset policy
+ *
+ * Selects which commands are made eligible to run again when a
+ * #SC_JUMP_ATS_CC command moves the ATP back to an earlier time.  Only
+ * the commands between the jump time and the current ATP position are
+ * affected.
+ */
+enum SC_JumpAtsReset
+{
+    SC_JumpAtsReset_NONE    = 0, /**< \brief Leave command status alone, commands jumped back over are not resent */
+    SC_JumpAtsReset_SKIPPED = 1, /**< \brief Return SKIPPED commands to LOADED */
+    SC_JumpAtsReset_ALL     = 2  /**< \brief Return SKIPPED and EXECUTED commands to LOADED */
+};
+
+typedef uint8 SC_JumpAtsReset_Enum_t;
+
 /************************************************************************
  * Type Definitions
  ************************************************************************/
@@ -193,9 +272,9 @@ typedef struct
     SC_Status_Enum_t  AtpState;                 /**< \brief Current ATP state: 2 = IDLE, 5 = EXECUTING */
     SC_AtsCont_Enum_t ContinueAtsOnFailureFlag; /**< \brief Continue ATS execution on failure flag */
 
-    uint8 CmdErrCtr; /**< \brief Counts Request Errors */
-    uint8 CmdCtr;    /**< \brief Counts Ground Requests */
-    uint8 Padding8;  /**< \brief Structure padding */
+    uint8               CmdErrCtr; /**< \brief Counts Request Errors */
+    uint8               CmdCtr;    /**< \brief Counts Ground Requests */
+    SC_EventMode_Enum_t EventMode; /**< \brief Event reporting mode: 0 = IMMEDIATE, 1 = DEFERRED */
 
     uint16           SwitchPendFlag;  /**< \brief Switch pending flag: 0 = NO, 1 = YES */
     uint16           NumRtsActive;    /**< \brief Number of RTSs currently active */
@@ -207,19 +286,39 @@ typedef struct
     uint16           RtsCmdCtr;       /**< \brief Counts TOTAL rts cmds that were sent out from ALL active RTSs */
     uint16           RtsCmdErrCtr;    /**< \brief Counts TOTAL number of errs from ALL RTSs that are active */
     SC_AtsNum_t      LastAtsErrSeq;   /**< \brief Last ATS Errant Sequence Num Values: 1 or 2 */
+#if (SC_CMD_INDEX_BITS == 32)
+    uint16 Padding16a; /**< \brief Structure padding to align 32-bit command numbers */
+#endif
     SC_CommandNum_t  LastAtsErrCmd;   /**< \brief Last ATS Errant Command Num */
     SC_RtsNum_t      LastRtsErrSeq;   /**< \brief Last RTS Errant Sequence Num */
+#if (SC_CMD_INDEX_BITS == 32)
+    uint16 Padding16b; /**< \brief Structure padding to align 32-bit entry offsets */
+#endif
     SC_EntryOffset_t LastRtsErrCmd;   /**< \brief Offset in the RTS buffer for the last command error, in "words" */
 
-    SC_AtsNum_t AppendCmdArg;     /**< \brief ATS selection argument from most recent Append ATS command */
-    uint16      AppendEntryCount; /**< \brief Number of cmd entries in current Append ATS table */
-    uint16      AppendByteCount;  /**< \brief Size of cmd entries in current Append ATS table */
-    uint16      AppendLoadCount;  /**< \brief Total number of Append ATS table loads */
-    uint32      AtpCmdNumber;     /**< \brief Current command number */
+    SC_AtsNum_t    AppendCmdArg;     /**< \brief ATS selection argument from most recent Append ATS command */
+#if (SC_CMD_INDEX_BITS == 32)
+    uint16 Padding16c; /**< \brief Structure padding to align 32-bit append counts */
+#endif
+    SC_IndexBase_t AppendEntryCount; /**< \brief Number of cmd entries in current Append ATS table */
+    SC_IndexBase_t AppendByteCount;  /**< \brief Size of cmd entries in current Append ATS table */
+    uint16         AppendLoadCount;  /**< \brief Total number of Append ATS table loads */
+#if (SC_CMD_INDEX_BITS == 32)
+    uint16 Padding16d; /**< \brief Structure padding to align 32-bit fields */
+#endif
+    uint32 AtpCmdNumber; /**< \brief Current command number */
     uint32      AtpFreeBytes[SC_NUMBER_OF_ATS]; /**< \brief Free Bytes in each ATS  */
     uint32      NextRtsWakeupCnt;               /**< \brief Next RTS Command Absolute Wakeup Count */
     uint32      NextAtsTime;                    /**< \brief Next ATS Command Time (seconds) */
 
+    SC_AtsNum_t            AtsLoadAtsNum;   /**< \brief ATS being activated, 0 if no activation is in progress */
+    SC_AtsLoadPhase_Enum_t AtsLoadPhase;    /**< \brief ATS activation phase: 0 = IDLE, 1 = PARSE, 2 = INDEX */
+    uint8                  Padding8b;       /**< \brief Structure padding */
+    uint32                 AtsLoadProgress; /**< \brief Commands parsed or sort steps run in this activation phase */
+
+    uint32 RtsPoolFreeBytes; /**< \brief Free bytes in the RTS storage pool */
+    uint32 RtsPoolFragBytes; /**< \brief Free bytes in the RTS storage pool outside its largest free region */
+
     uint16 RtsExecutingStatus[(SC_NUMBER_OF_RTS + (SC_NUMBER_OF_RTS_IN_UINT16 - 1)) / SC_NUMBER_OF_RTS_IN_UINT16];
     /**< \brief RTS executing status bit map where each uint16 represents 16 RTS numbers.  Note: array
      index numbers and bit numbers use base zero indexing, but RTS numbers use base one indexing.  Thus,
@@ -235,6 +334,160 @@ typedef struct
      If an RTS is DISABLED, then the corresponding bit is one. */
 } SC_HkTlm_Payload_t;
 
+/**
+ *  \brief ATS Window Telemetry Command Entry
+ */
+typedef struct
+{
+    uint32           TimeTag; /**< \brief Absolute time tag of the command */
+    uint32           MsgId;   /**< \brief Message ID of the command */
+    SC_CommandNum_t  CmdNum;  /**< \brief ATS command number */
+    uint8            FcnCode; /**< \brief Function code of the command */
+    SC_Status_Enum_t Status;  /**< \brief Status of the command, see #SC_Status */
+#if (SC_CMD_INDEX_BITS == 32)
+    uint16 Padding; /**< \brief Structure padding to align 32-bit command numbers */
+#endif
+} SC_AtsWindowEntry_t;
+
+/**
+ *  \brief ATS Window Telemetry Payload
+ *
+ *  The commands of a window are numbered from zero in time order, this
+ *  packet holds the NumEntries commands starting at FirstEntry.  The last
+ *  packet of a series is the one where FirstEntry + NumEntries equals
+ *  TotalEntries.
+ */
+typedef struct
+{
+    SC_AtsNum_t         AtsNum;       /**< \brief ATS queried, 1 = ATS_A, 2 = ATS_B */
+    uint16              NumEntries;   /**< \brief Number of valid entries in this packet */
+    uint32              StartTime;    /**< \brief Window start time, inclusive */
+    uint32              EndTime;      /**< \brief Window end time, exclusive */
+    uint32              TotalEntries; /**< \brief Number of commands in the whole window */
+    uint32              FirstEntry;   /**< \brief Window position of the first entry in this packet */
+    SC_AtsWindowEntry_t Entry[SC_ATS_WINDOW_ENTRIES_PER_PKT]; /**< \brief Commands in the window */
+} SC_AtsWindowTlm_Payload_t;
+
+/**
+ *  \brief ATS Status Summary Telemetry Payload
+ *
+ *  A run never spans two packets, so each packet can be decoded on its own.
+ */
+typedef struct
+{
+    SC_AtsNum_t AtsNum;        /**< \brief ATS summarized, 1 = ATS_A, 2 = ATS_B */
+    uint16      PacketNum;     /**< \brief Packet number within the summary, starting at 0 */
+    uint16      NumRuns;       /**< \brief Number of valid runs in this packet */
+    uint8       LastPacket;    /**< \brief true in the last packet of the summary */
+    uint8       Padding;       /**< \brief Structure padding */
+    uint32      TotalCommands; /**< \brief Number of commands in the ATS when the summary was requested */
+    uint32      FirstCommand;  /**< \brief Time order position of the first command in this packet */
+    uint16      Run[SC_ATS_STATUS_RUNS_PER_PKT]; /**< \brief Status runs, in time order */
+} SC_AtsStatusTlm_Payload_t;
+
+/**
+ *  \brief Dispatch Latency Histogram
+ *
+ *  The latency of a command is the time from when it was scheduled to
+ *  when it was sent, in microseconds.  The bins are laid out as described
+ *  for #SC_LATENCY_HIST_BINS.
+ */
+typedef struct
+{
+    uint32 Count;                     /**< \brief Number of commands measured */
+    uint32 MinUsec;                   /**< \brief Smallest latency, 0 if none measured */
+    uint32 MaxUsec;                   /**< \brief Largest latency */
+    uint32 MeanUsec;                  /**< \brief Mean latency */
+    uint32 Bin[SC_LATENCY_HIST_BINS]; /**< \brief Number of commands in each latency bin */
+} SC_LatencyHist_t;
+
+/**
+ *  \brief Processing Phase Statistics
+ *
+ *  Elapsed times of one SC processing phase, in microseconds of MET
+ */
+typedef struct
+{
+    uint32 Count;    /**< \brief Number of times the phase ran */
+    uint32 LastUsec; /**< \brief Elapsed time of the last run */
+    uint32 MaxUsec;  /**< \brief Longest elapsed time */
+    uint32 MeanUsec; /**< \brief Mean elapsed time */
+} SC_PhaseStats_t;
+
+/**
+ *  \brief ATS Load Forecast Window
+ *
+ *  One second of an ATS that has more commands tagged in it than SC can send
+ */
+typedef struct
+{
+    uint32 TimeTag; /**< \brief Time tag of the second, in seconds */
+    uint32 NumCmds; /**< \brief Number of commands tagged in the second */
+} SC_ForecastWindow_t;
+
+/**
+ *  \brief ATS Load Forecast
+ *
+ *  The command density of the last ATS or Append table verified.  An
+ *  Append table is forecast on its own, without the commands of the ATS
+ *  it is later appended to.
+ */
+typedef struct
+{
+    uint32              NumCmds;                     /**< \brief Number of commands in the table */
+    uint32              Capacity;                    /**< \brief Commands per second SC could send for it */
+    uint32              PeakCmds;                    /**< \brief Most commands tagged in any one second */
+    uint32              NumOverloaded;               /**< \brief Number of seconds with more than Capacity */
+    SC_ForecastWindow_t Window[SC_FORECAST_WINDOWS]; /**< \brief Worst overloaded seconds, most commands first */
+} SC_LoadForecast_t;
+
+/**
+ *  \brief Diagnostic Telemetry Payload
+ *
+ *  Sent with each housekeeping packet.  The statistics are kept from
+ *  application start or the last #SC_RESET_DIAG_CC command.
+ */
+typedef struct
+{
+    SC_LatencyHist_t Latency[2];          /**< \brief Dispatch latency for the ATP (0) and the RTP (1) */
+    SC_PhaseStats_t   Phase[SC_Phase_MAX]; /**< \brief Processing phase statistics, indexed by phase */
+    SC_LoadForecast_t Forecast;            /**< \brief Load forecast of the last ATS or Append table verified */
+} SC_DiagTlm_Payload_t;
+
+/**
+ *  \brief Lookahead Telemetry Command Entry
+ *
+ *  An ATS command is due at its time tag.  An RTS command is due at a
+ *  wakeup count or, for a timed RTS, at a time.  DueDelta puts them on one
+ *  scale by converting wakeups to seconds with #SC_WAKEUPS_PER_SECOND,
+ *  rounded up.
+ */
+typedef struct
+{
+    uint32 DueDelta;  /**< \brief Seconds from the query until the command is due, 0 if already due */
+    uint32 DueTime;   /**< \brief Absolute time the command is due, 0 for a wakeup count driven RTS */
+    uint32 DueWakeup; /**< \brief Wakeup count the command is due at, 0 for an ATS or timed RTS command */
+    uint32 MsgId;     /**< \brief Message ID of the command */
+    uint32 CmdId;     /**< \brief ATS command number or RTS entry offset, in "words" */
+    uint16 SourceNum; /**< \brief ATS or RTS number the command comes from */
+    uint8  Process;   /**< \brief #SC_Process_ATP or #SC_Process_RTP */
+    uint8  FcnCode;   /**< \brief Function code of the command */
+} SC_LookaheadEntry_t;
+
+/**
+ *  \brief Lookahead Telemetry Payload
+ *
+ *  The next commands due, in the order they are expected to be sent.
+ */
+typedef struct
+{
+    uint32              CurrentTime;   /**< \brief SC time when the query was made */
+    uint32              CurrentWakeup; /**< \brief SC wakeup count when the query was made */
+    uint8               NumEntries;    /**< \brief Number of valid entries in this packet */
+    uint8               Padding[3];    /**< \brief Structure padding */
+    SC_LookaheadEntry_t Entry[SC_LOOKAHEAD_ENTRIES]; /**< \brief Commands due next */
+} SC_LookaheadTlm_Payload_t;
+
 /**\}*/
 
 /**
@@ -265,7 +518,10 @@ typedef struct
  */
 typedef struct
 {
-    uint32 NewTime; /**< \brief the time to 'jump' to */
+    uint32                 NewTime;     /**< \brief the time to 'jump' to */
+    SC_JumpAtsReset_Enum_t ResetPolicy; /**< \brief Status reset applied to commands jumped back over */
+    uint8                  Padding8;    /**< \brief Structure padding */
+    uint16                 Padding;     /**< \brief Structure padding */
 } SC_JumpAtsCmd_Payload_t;
 
 /**
@@ -295,6 +551,109 @@ typedef struct
     SC_RtsNum_t LastRtsNum;  /**< \brief ID of the last RTS to act on, 1 through #SC_NUMBER_OF_RTS */
 } SC_RtsGrpCmd_Payload_t;
 
+/**
+ *  \brief RTS Set Command Payload
+ */
+typedef struct
+{
+    uint16 RtsSet[SC_RTS_SET_WORDS]; /**< \brief Bitmask of the RTS to act on, RTS 1 is bit 0 of word 0 */
+} SC_RtsSetCmd_Payload_t;
+
+/**
+ *  \brief Set RTS Priority Command Payload
+ */
+typedef struct
+{
+    uint16 RtsSet[SC_RTS_SET_WORDS]; /**< \brief Bitmask of the RTS to act on, RTS 1 is bit 0 of word 0 */
+    uint16 Priority; /**< \brief Priority level to give them, 0 (highest) through #SC_RTS_PRIORITY_LEVELS - 1 */
+} SC_SetRtsPriorityCmd_Payload_t;
+
+/**
+ *  \brief Query ATS Window Command Payload
+ */
+typedef struct
+{
+    SC_AtsNum_t AtsNum;    /**< \brief The ID of the ATS to query, 1 = ATS_A, 2 = ATS_B */
+    uint16      Padding;   /**< \brief Structure padding */
+    uint32      StartTime; /**< \brief Window start time, inclusive */
+    uint32      EndTime;   /**< \brief Window end time, exclusive */
+} SC_QueryAtsWindowCmd_Payload_t;
+
+/**
+ *  \brief Report ATS Status Command Payload
+ */
+typedef struct
+{
+    SC_AtsNum_t AtsNum;  /**< \brief The ID of the ATS to summarize, 1 = ATS_A, 2 = ATS_B */
+    uint16      Padding; /**< \brief Structure padding */
+} SC_ReportAtsStatusCmd_Payload_t;
+
+/**
+ *  \brief Query Lookahead Command Payload
+ */
+typedef struct
+{
+    uint16 NumEntries; /**< \brief Number of commands to report, 1 through #SC_LOOKAHEAD_ENTRIES */
+    uint16 Padding;    /**< \brief Structure padding */
+} SC_QueryLookaheadCmd_Payload_t;
+
+/**
+ *  \brief Set Event Mode Command Payload
+ */
+typedef struct
+{
+    SC_EventMode_Enum_t Mode;       /**< \brief Event reporting mode, see #SC_EventMode */
+    uint8               Padding[3]; /**< \brief Structure padding */
+} SC_SetEventModeCmd_Payload_t;
+
+/**
+ *  \brief RTS Loop Entry Payload
+ */
+typedef struct
+{
+    uint16 LoopCount; /**< \brief Times to run the loop body, #SC_RTS_LOOP_FOREVER to repeat until stopped */
+    uint16 Padding;   /**< \brief Structure padding */
+} SC_RtsLoopCmd_Payload_t;
+
+/**
+ *  \brief RTS Goto Entry Payload
+ */
+typedef struct
+{
+    uint16 EntryOffset; /**< \brief Word offset of the RTS entry to continue from */
+    uint16 Padding;     /**< \brief Structure padding */
+} SC_RtsGotoCmd_Payload_t;
+
+/**
+ *  \brief Start RTS Instance Command Payload
+ */
+typedef struct
+{
+    SC_RtsNum_t RtsNum;         /**< \brief The ID of the loaded RTS to run, 1 through #SC_NUMBER_OF_RTS */
+    SC_RtsNum_t InstanceRtsNum; /**< \brief The ID of the empty RTS to run it in, 0 to use any */
+} SC_StartRtsInstanceCmd_Payload_t;
+
+/**
+ *  \brief Start RTS with Arguments Command Payload
+ */
+typedef struct
+{
+    SC_RtsNum_t RtsNum;                      /**< \brief The ID of the RTS to start, 1 through #SC_NUMBER_OF_RTS */
+    uint16      Padding;                     /**< \brief Structure padding */
+    uint8       Args[SC_RTS_ARG_BLOCK_SIZE]; /**< \brief Arguments for the #SC_RTS_PATCH_CC entries of the RTS */
+} SC_StartRtsParamCmd_Payload_t;
+
+/**
+ *  \brief RTS Patch Entry Payload
+ */
+typedef struct
+{
+    uint16 ArgOffset; /**< \brief Byte offset of the range in the RTS arguments */
+    uint16 MsgOffset; /**< \brief Byte offset in the next command to copy the range to */
+    uint16 Length;    /**< \brief Length of the range in bytes */
+    uint16 Padding;   /**< \brief Structure padding */
+} SC_RtsPatchCmd_Payload_t;
+
 /**\}*/
 
 #endif
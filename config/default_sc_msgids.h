@@ -40,7 +40,11 @@
  * \{
  */
 
-#define SC_HK_TLM_MID (0x08AA) /**< \brief Msg ID to send telemtry down on */
+#define SC_HK_TLM_MID         (0x08AA) /**< \brief Msg ID to send telemtry down on */
+#define SC_ATS_WINDOW_TLM_MID (0x08AB) /**< \brief Msg ID to send ATS window query results down on */
+#define SC_ATS_STATUS_TLM_MID (0x08AC) /**< \brief Msg ID to send ATS status summaries down on */
+#define SC_DIAG_TLM_MID       (0x08AD) /**< \brief Msg ID to send diagnostic telemetry down on */
+#define SC_LOOKAHEAD_TLM_MID  (0x08AE) /**< \brief Msg ID to send lookahead query results down on */
 
 /**\}*/
 
@@ -60,6 +60,50 @@ typedef struct
     SC_HkTlm_Payload_t        Payload;
 } SC_HkTlm_t;
 
+/**
+ *  \brief ATS Window Packet Structure
+ *
+ *  For details see #SC_QUERY_ATS_WINDOW_CC
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader;
+    SC_AtsWindowTlm_Payload_t Payload;
+} SC_AtsWindowTlm_t;
+
+/**
+ *  \brief ATS Status Summary Packet Structure
+ *
+ *  For details see #SC_REPORT_ATS_STATUS_CC
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader;
+    SC_AtsStatusTlm_Payload_t Payload;
+} SC_AtsStatusTlm_t;
+
+/**
+ *  \brief Diagnostic Packet Structure
+ *
+ *  For details see #SC_RESET_DIAG_CC
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader;
+    SC_DiagTlm_Payload_t      Payload;
+} SC_DiagTlm_t;
+
+/**
+ *  \brief Lookahead Packet Structure
+ *
+ *  For details see #SC_QUERY_LOOKAHEAD_CC
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader;
+    SC_LookaheadTlm_Payload_t Payload;
+} SC_LookaheadTlm_t;
+
 /**\}*/
 
 /**
@@ -151,6 +195,16 @@ typedef struct
     CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command Header */
 } SC_ResetCountersCmd_t;
 
+/**
+ *  \brief Reset Diagnostics Command
+ *
+ *  For command details see #SC_RESET_DIAG_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command Header */
+} SC_ResetDiagCmd_t;
+
 /**
  *  \brief Stop ATS Command
  *
@@ -281,6 +335,202 @@ typedef struct
     SC_RtsGrpCmd_Payload_t  Payload;
 } SC_EnableRtsGrpCmd_t;
 
+/**
+ *  \brief Query ATS Window Command
+ *
+ *  For command details see #SC_QUERY_ATS_WINDOW_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t        CommandHeader; /**< \brief Command Header */
+    SC_QueryAtsWindowCmd_Payload_t Payload;
+} SC_QueryAtsWindowCmd_t;
+
+/**
+ *  \brief Report ATS Status Command
+ *
+ *  For command details see #SC_REPORT_ATS_STATUS_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t         CommandHeader; /**< \brief Command Header */
+    SC_ReportAtsStatusCmd_Payload_t Payload;
+} SC_ReportAtsStatusCmd_t;
+
+/**
+ *  \brief Query Lookahead Command
+ *
+ *  For command details see #SC_QUERY_LOOKAHEAD_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t        CommandHeader; /**< \brief Command Header */
+    SC_QueryLookaheadCmd_Payload_t Payload;
+} SC_QueryLookaheadCmd_t;
+
+/**
+ *  \brief Set Event Mode Command
+ *
+ *  For command details see #SC_SET_EVENT_MODE_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t      CommandHeader; /**< \brief Command Header */
+    SC_SetEventModeCmd_Payload_t Payload;
+} SC_SetEventModeCmd_t;
+
+/**
+ *  \brief Call RTS Command
+ *
+ *  For command details see #SC_CALL_RTS_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command Header */
+    SC_RtsCmd_Payload_t     Payload;
+} SC_CallRtsCmd_t;
+
+/**
+ *  \brief Chain RTS Command
+ *
+ *  For command details see #SC_CHAIN_RTS_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command Header */
+    SC_RtsCmd_Payload_t     Payload;
+} SC_ChainRtsCmd_t;
+
+/**
+ *  \brief RTS Loop Entry
+ *
+ *  For command details see #SC_RTS_LOOP_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command Header */
+    SC_RtsLoopCmd_Payload_t Payload;
+} SC_RtsLoopCmd_t;
+
+/**
+ *  \brief RTS End Loop Entry
+ *
+ *  For command details see #SC_RTS_END_LOOP_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command Header */
+} SC_RtsEndLoopCmd_t;
+
+/**
+ *  \brief RTS Goto Entry
+ *
+ *  For command details see #SC_RTS_GOTO_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command Header */
+    SC_RtsGotoCmd_Payload_t Payload;
+} SC_RtsGotoCmd_t;
+
+/**
+ *  \brief Start RTS Instance Command
+ *
+ *  For command details see #SC_START_RTS_INSTANCE_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t          CommandHeader; /**< \brief Command Header */
+    SC_StartRtsInstanceCmd_Payload_t Payload;
+} SC_StartRtsInstanceCmd_t;
+
+/**
+ *  \brief Start RTS with Arguments Command
+ *
+ *  For command details see #SC_START_RTS_PARAM_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t       CommandHeader; /**< \brief Command Header */
+    SC_StartRtsParamCmd_Payload_t Payload;
+} SC_StartRtsParamCmd_t;
+
+/**
+ *  \brief RTS Patch Entry
+ *
+ *  For command details see #SC_RTS_PATCH_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t  CommandHeader; /**< \brief Command Header */
+    SC_RtsPatchCmd_Payload_t Payload;
+} SC_RtsPatchCmd_t;
+
+/**
+ *  \brief Start RTS Set Command
+ *
+ *  For command details see #SC_START_RTS_SET_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command Header */
+    SC_RtsSetCmd_Payload_t  Payload;
+} SC_StartRtsSetCmd_t;
+
+/**
+ *  \brief Stop RTS Set Command
+ *
+ *  For command details see #SC_STOP_RTS_SET_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command Header */
+    SC_RtsSetCmd_Payload_t  Payload;
+} SC_StopRtsSetCmd_t;
+
+/**
+ *  \brief Disable RTS Set Command
+ *
+ *  For command details see #SC_DISABLE_RTS_SET_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command Header */
+    SC_RtsSetCmd_Payload_t  Payload;
+} SC_DisableRtsSetCmd_t;
+
+/**
+ *  \brief Enable RTS Set Command
+ *
+ *  For command details see #SC_ENABLE_RTS_SET_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command Header */
+    SC_RtsSetCmd_Payload_t  Payload;
+} SC_EnableRtsSetCmd_t;
+
+/**
+ *  \brief RTS Timed Entry
+ *
+ *  For command details see #SC_RTS_TIMED_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command Header */
+} SC_RtsTimedCmd_t;
+
+/**
+ *  \brief Set RTS Priority Command
+ *
+ *  For command details see #SC_SET_RTS_PRIORITY_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t        CommandHeader; /**< \brief Command Header */
+    SC_SetRtsPriorityCmd_Payload_t Payload;
+} SC_SetRtsPriorityCmd_t;
+
 /**\}*/
 
 #endif
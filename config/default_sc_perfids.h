@@ -31,6 +31,15 @@
 
 #define SC_APPMAIN_PERF_ID 35 /**< \brief Application main performance ID */
 
+#define SC_WAKEUP_PERF_ID       36 /**< \brief Wakeup command processing performance ID */
+#define SC_ATP_DISPATCH_PERF_ID 37 /**< \brief ATP command dispatch performance ID */
+#define SC_RTP_SCHEDULE_PERF_ID 38 /**< \brief RTP scheduling (next RTS time) performance ID */
+#define SC_LOAD_ATS_PERF_ID     39 /**< \brief ATS load performance ID */
+#define SC_BUILD_INDEX_PERF_ID  40 /**< \brief ATS time index build performance ID */
+#define SC_VERIFY_ATS_PERF_ID   41 /**< \brief ATS table verification performance ID */
+#define SC_APPEND_PERF_ID       42 /**< \brief ATS append processing performance ID */
+#define SC_SEND_HK_PERF_ID      43 /**< \brief Housekeeping packet performance ID */
+
 /**\}*/
 
 #endif
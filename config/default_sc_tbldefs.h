@@ -40,14 +40,17 @@
  * \defgroup cfscstblids ID definitions for cFE Table Services manage table request command
  * \{
  */
-#define SC_TBL_ID_ATS_0     (1)                                  /**< \brief ATS 0 Table ID */
-#define SC_TBL_ID_APPEND    (SC_TBL_ID_ATS_0 + SC_NUMBER_OF_ATS) /**< \brief Append Table ID */
-#define SC_TBL_ID_RTS_0     (SC_TBL_ID_APPEND + 1)               /**< \brief RTS 0 Table ID */
-#define SC_TBL_ID_RTS_INFO  (SC_TBL_ID_RTS_0 + SC_NUMBER_OF_RTS) /**< \brief RTS Info Table ID */
-#define SC_TBL_ID_RTP_CTRL  (SC_TBL_ID_RTS_INFO + 1)             /**< \brief RTS Control Table ID */
-#define SC_TBL_ID_ATS_INFO  (SC_TBL_ID_RTP_CTRL + 1)             /**< \brief ATS Info Table ID */
-#define SC_TBL_ID_ATP_CTRL  (SC_TBL_ID_ATS_INFO + 1)             /**< \brief ATS Control Table ID */
-#define SC_TBL_ID_ATS_CMD_0 (SC_TBL_ID_ATP_CTRL + 1)             /**< \brief ATS 0 Command Table ID */
+#define SC_TBL_ID_ATS_0     (1)                                      /**< \brief ATS 0 Table ID */
+#define SC_TBL_ID_APPEND    (SC_TBL_ID_ATS_0 + SC_NUMBER_OF_ATS)     /**< \brief Append Table ID */
+#define SC_TBL_ID_RTS_0     (SC_TBL_ID_APPEND + 1)                   /**< \brief RTS 0 Table ID */
+#define SC_TBL_ID_RTS_INFO  (SC_TBL_ID_RTS_0 + SC_NUMBER_OF_RTS)     /**< \brief RTS Info Table ID */
+#define SC_TBL_ID_RTP_CTRL  (SC_TBL_ID_RTS_INFO + 1)                 /**< \brief RTS Control Table ID */
+#define SC_TBL_ID_ATS_INFO  (SC_TBL_ID_RTP_CTRL + 1)                 /**< \brief ATS Info Table ID */
+#define SC_TBL_ID_ATP_CTRL  (SC_TBL_ID_ATS_INFO + 1)                 /**< \brief ATS Control Table ID */
+#define SC_TBL_ID_ATS_CMD_0 (SC_TBL_ID_ATP_CTRL + 1)                 /**< \brief ATS 0 Command Table ID */
+#define SC_TBL_ID_TRIGGER   (SC_TBL_ID_ATS_CMD_0 + SC_NUMBER_OF_ATS) /**< \brief Trigger Table ID */
+#define SC_TBL_ID_TRACE     (SC_TBL_ID_TRIGGER + 1)                  /**< \brief Trace Table ID */
+#define SC_TBL_ID_RTS_STATS (SC_TBL_ID_TRACE + 1)                    /**< \brief RTS Statistics Table ID */
 /**\}*/
 
 /************************************************************************
@@ -69,7 +72,9 @@ typedef uint32 SC_RelWakeupCount_t;
  */
 typedef struct
 {
+#if (SC_CMD_INDEX_BITS != 32)
     uint16 Pad; /**< \brief Structure padding */
+#endif
 
     SC_CommandNum_t CmdNumber; /**< \brief command number, range = 1 to SC_MAX_ATS_CMDS */
 
@@ -115,4 +120,23 @@ typedef struct
     CFE_MSG_CommandHeader_t Msg;    /**< \brief Command Message to be sent */
 } SC_RtsEntry_t;
 
+/**
+ * \brief Trigger Table Entry Type
+ *
+ * Starts an RTS when a message with the given message ID arrives.  When
+ * MatchSize is not zero, the RTS is started only if the field of that many
+ * bytes at MatchOffset, masked by MatchMask, equals MatchValue.  The field
+ * is read in the byte order of the processor, like the rest of the payload.
+ */
+typedef struct
+{
+    uint32      MsgId;       /**< \brief Message ID value, 0 marks an unused entry */
+    SC_RtsNum_t RtsNum;      /**< \brief RTS to start */
+    uint16      MatchSize;   /**< \brief Size of the field to match: 0 (none), 1, 2 or 4 bytes */
+    uint16      MatchOffset; /**< \brief Byte offset of the field from the start of the message */
+    uint16      Padding;     /**< \brief Structure padding */
+    uint32      MatchMask;   /**< \brief Bits of the field to compare */
+    uint32      MatchValue;  /**< \brief Value of the masked field that fires the trigger */
+} SC_TriggerEntry_t;
+
 #endif
@@ -485,7 +485,9 @@
  *
  *  \par Cause:
  *  This event message is issued when an RTS command was about to be sent out,
- *  and #CFE_SB_TransmitMsg couldn't send the message
+ *  and #CFE_SB_TransmitMsg couldn't send the message.  In
+ *  #SC_EventMode_DEFERRED mode one event is sent listing all the RTSs
+ *  stopped this way while SC processed a message.
  */
 #define SC_RTS_DIST_ERR_EID 49
 
@@ -496,7 +498,9 @@
  *
  *  \par Cause:
  *  This event message is issued when an RTS command was about to be sent out,
- *  but the command failed checksum validation
+ *  but the command failed checksum validation.  In #SC_EventMode_DEFERRED
+ *  mode one event is sent listing all the RTSs stopped this way while SC
+ *  processed a message.
  */
 #define SC_RTS_CHKSUM_ERR_EID 50
 
@@ -681,7 +685,9 @@
  *  \par Type: INFORMATIONAL
  *
  *  \par Cause:
- *  This event message is issued when an RTS is started successfully
+ *  This event message is issued when an RTS is started successfully.  In
+ *  #SC_EventMode_DEFERRED mode one event is sent listing all the RTSs
+ *  started while SC processed a message.
  */
 #define SC_RTS_START_INF_EID 73
 
@@ -821,7 +827,9 @@
  *  \par Type: INFORMATIONAL
  *
  *  \par Cause:
- *  This event message is issued when an RTS completes execution
+ *  This event message is issued when an RTS completes execution.  In
+ *  #SC_EventMode_DEFERRED mode one event is sent listing all the RTSs
+ *  completed while SC processed a message.
  */
 #define SC_RTS_COMPL_INF_EID 86
 
@@ -1218,7 +1226,8 @@
  *
  *  \par Cause:
  *  This event message is issued when a #SC_START_RTS_GRP_CC command was received, but an
- *  RTS is marked as #SC_Status_LOADED
+ *  RTS is marked as #SC_Status_LOADED.  In #SC_EventMode_DEFERRED mode one event is sent
+ *  listing all the RTSs rejected this way.
  */
 #define SC_STARTRTSGRP_CMD_NOT_LDED_ERR_EID 126
 
@@ -1229,7 +1238,8 @@
  *
  *  \par Cause:
  *  This event message is issued when a #SC_START_RTS_GRP_CC command was received, but an
- *  RTS is disabled
+ *  RTS is disabled.  In #SC_EventMode_DEFERRED mode one event is sent listing all the
+ *  RTSs rejected this way.
  */
 #define SC_STARTRTSGRP_CMD_DISABLED_ERR_EID 127
 
@@ -1288,17 +1298,6 @@
  */
 #define SC_BUILD_TIME_IDXTBL_ERR_EID 132
 
-/**
- * \brief SC ATS Insert ATS Index Invalid Event ID
- *
- *  \par Type: ERROR
- *
- *  \par Cause:
- *  This event message is issued when an invalid ATS index is received
- *  in the SC_Insert function
- */
-#define SC_INSERTATS_INV_INDEX_ERR_EID 133
-
 /**
  * \brief SC ATS Table Initialization Error ATS Index Invalid Event ID
  *
@@ -1354,6 +1353,633 @@
  */
 #define SC_AUTOSTART_RTS_INV_ID_ERR_EID 138
 
+/**
+ * \brief SC ATS Jump Command Reset Policy Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *  This event message is issued when a #SC_JUMP_ATS_CC command was received
+ *  with a reset policy that is not one of the #SC_JumpAtsReset values
+ */
+#define SC_JUMPATS_CMD_POLICY_ERR_EID 139
+
+/**
+ * \brief SC ATS Jump Command Commands Reset Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *  A #SC_JUMP_ATS_CC command moved the ATP back to an earlier time and
+ *  some of the ATS commands were returned to LOADED by the reset policy
+ */
+#define SC_JUMP_ATS_RESET_DBG_EID 140
+
+/**
+ * \brief SC Query ATS Window Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *  This event message is issued when a #SC_QUERY_ATS_WINDOW_CC command was
+ *  executed successfully.  The event text includes the number of commands
+ *  reported, the number of commands in the window and the number of packets
+ *  sent.
+ */
+#define SC_QUERYATS_CMD_INF_EID 141
+
+/**
+ * \brief SC Query ATS Window Command Invalid ATS ID Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *  This event message is issued when a #SC_QUERY_ATS_WINDOW_CC command was
+ *  received with an invalid ATS ID
+ */
+#define SC_QUERYATS_CMD_INVLD_ID_ERR_EID 142
+
+/**
+ * \brief SC Query ATS Window Command ATS Not Loaded Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *  This event message is issued when a #SC_QUERY_ATS_WINDOW_CC command was
+ *  received for an ATS that is not loaded
+ */
+#define SC_QUERYATS_CMD_NOT_LDED_ERR_EID 143
+
+/**
+ * \brief SC Query ATS Window Command Invalid Window Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *  This event message is issued when a #SC_QUERY_ATS_WINDOW_CC command was
+ *  received with a window end time that is not after the window start time
+ */
+#define SC_QUERYATS_CMD_WINDOW_ERR_EID 144
+
+/**
+ * \brief SC Report ATS Status Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *  This event message is issued when a #SC_REPORT_ATS_STATUS_CC command was
+ *  accepted and the ATS status summary has been started
+ */
+#define SC_REPORTATS_CMD_INF_EID 145
+
+/**
+ * \brief SC Report ATS Status Command Invalid ATS ID Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *  This event message is issued when a #SC_REPORT_ATS_STATUS_CC command was
+ *  received with an invalid ATS ID
+ */
+#define SC_REPORTATS_CMD_INVLD_ID_ERR_EID 146
+
+/**
+ * \brief SC Report ATS Status Command ATS Not Loaded Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *  This event message is issued when a #SC_REPORT_ATS_STATUS_CC command was
+ *  received for an ATS that is not loaded
+ */
+#define SC_REPORTATS_CMD_NOT_LDED_ERR_EID 147
+
+/**
+ * \brief SC Report ATS Status Command Busy Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *  This event message is issued when a #SC_REPORT_ATS_STATUS_CC command was
+ *  received while the summary requested by an earlier one is still being built
+ */
+#define SC_REPORTATS_CMD_BUSY_ERR_EID 148
+
+/**
+ * \brief SC ATS Status Summary Complete Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *  This event message is issued when the last packet of an ATS status
+ *  summary has been sent.  The event text includes the number of commands
+ *  summarized and the number of packets used.
+ */
+#define SC_REPORTATS_DONE_DBG_EID 149
+
+/**
+ * \brief SC RTS Storage Pool Full Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *  This event message is issued when a newly loaded RTS does not fit in
+ *  the free space of the RTS storage pool.  The RTS is left unloaded.
+ */
+#define SC_LOADRTS_POOL_FULL_ERR_EID 150
+
+/**
+ * \brief SC RTS Storage Pool Compacted Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *  This event message is issued when the RTS storage pool was compacted
+ *  to make room for a newly loaded RTS.
+ */
+#define SC_RTS_POOL_COMPACT_DBG_EID 151
+
+/**
+ * \brief SC RTS Called Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *  This event message is issued when an RTS has started another RTS with
+ *  an #SC_CALL_RTS_CC entry
+ */
+#define SC_RTS_CALL_DBG_EID 152
+
+/**
+ * \brief SC RTS Chained Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *  This event message is issued when an RTS has ended and started another
+ *  RTS in its place with an #SC_CHAIN_RTS_CC entry
+ */
+#define SC_RTS_CHAIN_DBG_EID 153
+
+/**
+ * \brief SC RTS Call Or Chain Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *  This event message is issued when an #SC_CALL_RTS_CC or #SC_CHAIN_RTS_CC
+ *  entry has an invalid length or RTS ID, or names an RTS that is disabled,
+ *  not loaded or already executing.  The RTS holding the entry is stopped.
+ */
+#define SC_RTS_CALL_ERR_EID 154
+
+/**
+ * \brief SC RTS Call Depth Exceeded Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *  This event message is issued when an #SC_CALL_RTS_CC entry is reached
+ *  while #SC_RTS_MAX_CALL_DEPTH calls are already waiting to return.  The
+ *  RTS holding the entry is stopped.
+ */
+#define SC_RTS_CALL_DEPTH_ERR_EID 155
+
+/**
+ * \brief SC ATS Table Verification Invalid SC Command Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *  This event message is issued when an ATS or Append ATS table entry is a
+ *  command to SC with an invalid command code, or a length that does not
+ *  match its command code
+ */
+#define SC_VERIFY_ATS_LOCAL_ERR_EID 156
+
+/**
+ * \brief SC RTS Table Invalid SC Command Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *  This event message is issued when an RTS table entry is a command to SC
+ *  with an invalid command code, or a length that does not match its
+ *  command code
+ */
+#define SC_RTS_LOCAL_CMD_ERR_EID 157
+
+/**
+ * \brief SC RTS Loop Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *  This event message is issued when an #SC_RTS_LOOP_CC entry is reached
+ *  with #SC_RTS_MAX_LOOP_DEPTH loops already open, or an #SC_RTS_END_LOOP_CC
+ *  entry is reached with no loop open.  The RTS is stopped.
+ */
+#define SC_RTS_LOOP_ERR_EID 158
+
+/**
+ * \brief SC RTS Too Many Control Entries Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *  This event message is issued when the RTP carries out
+ *  #SC_RTS_MAX_CTRL_STEPS loop, end loop or goto entries in a row without
+ *  finding a command to send.  The RTS is stopped.
+ */
+#define SC_RTS_CTRL_STEPS_ERR_EID 159
+
+/**
+ * \brief SC RTS Table Invalid Goto Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *  This event message is issued when an #SC_RTS_GOTO_CC entry in an RTS
+ *  table gives an offset that is not the start of an entry in the table
+ */
+#define SC_RTS_GOTO_ERR_EID 160
+
+/**
+ * \brief SC Start RTS Instance Command Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *  This event message is issued when an #SC_START_RTS_INSTANCE_CC command
+ *  starts an instance of a loaded RTS
+ */
+#define SC_STARTRTS_INSTANCE_INF_EID 161
+
+/**
+ * \brief SC Start RTS Instance Rejected Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *  This event message is issued when an #SC_START_RTS_INSTANCE_CC command
+ *  gives an invalid RTS ID, names an RTS to run that is disabled, not
+ *  loaded or has an invalid first command, or names an instance RTS that
+ *  is not empty, or when no RTS is empty
+ */
+#define SC_STARTRTS_INSTANCE_ERR_EID 162
+
+/**
+ * \brief SC RTS Patch Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *  This event message is issued when an RTS has more than
+ *  #SC_RTS_MAX_PATCHES #SC_RTS_PATCH_CC entries before one command, or
+ *  when a patch entry gives a range outside the RTS arguments or outside
+ *  the command past its header.  The RTS is stopped.
+ */
+#define SC_RTS_PATCH_ERR_EID 163
+
+/**
+ * \brief SC Start RTS Set Command Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *  This event message is issued following the successful execution of
+ *  a #SC_START_RTS_SET_CC command, with counts for the whole set.
+ */
+#define SC_STARTRTSSET_CMD_INF_EID 164
+
+/**
+ * \brief SC Stop RTS Set Command Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *  This event message is issued following the successful execution of
+ *  a #SC_STOP_RTS_SET_CC command, with counts for the whole set.
+ */
+#define SC_STOPRTSSET_CMD_INF_EID 165
+
+/**
+ * \brief SC Disable RTS Set Command Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *  This event message is issued following the successful execution of
+ *  a #SC_DISABLE_RTS_SET_CC command, with counts for the whole set.
+ */
+#define SC_DISRTSSET_CMD_INF_EID 166
+
+/**
+ * \brief SC Enable RTS Set Command Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *  This event message is issued following the successful execution of
+ *  a #SC_ENABLE_RTS_SET_CC command, with counts for the whole set.
+ */
+#define SC_ENARTSSET_CMD_INF_EID 167
+
+/**
+ * \brief SC RTS Set Invalid Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *  This event message is issued when a #SC_START_RTS_SET_CC,
+ *  #SC_STOP_RTS_SET_CC, #SC_DISABLE_RTS_SET_CC or #SC_ENABLE_RTS_SET_CC
+ *  command was rejected because the set was empty or had bits set past
+ *  RTS #SC_NUMBER_OF_RTS
+ */
+#define SC_RTSSET_CMD_ERR_EID 168
+
+/**
+ * \brief SC Trigger Table Registration Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *  This event message is issued when the trigger table fails to register
+ *  with cFE Table Services during initialization
+ */
+#define SC_REGISTER_TRIGGER_TBL_ERR_EID 169
+
+/**
+ * \brief SC Trigger Table Get Address Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *  This event message is issued when getting the address of the trigger
+ *  table fails during initialization
+ */
+#define SC_GET_ADDRESS_TRIGGER_ERR_EID 170
+
+/**
+ * \brief SC Trigger Table Manage Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *  This event message is issued when cFE Table Services returns an
+ *  unexpected result while SC manages the trigger table
+ */
+#define SC_TABLE_MANAGE_TRIGGER_ERR_EID 171
+
+/**
+ * \brief SC Trigger Table Verification Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *  This event message is issued when a trigger table load fails validation
+ *  because an entry names an invalid RTS, an invalid match field, or one of
+ *  the message IDs SC already subscribes to
+ */
+#define SC_TRIGGER_TBL_VERIFY_ERR_EID 172
+
+/**
+ * \brief SC Trigger Table Updated Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *  This event message is issued when a new trigger table has been made
+ *  active and SC has subscribed to the message IDs it names
+ */
+#define SC_UPDATE_TRIGGER_INF_EID 173
+
+/**
+ * \brief SC Trigger Subscribe Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *  This event message is issued when SC fails to subscribe to a message ID
+ *  named in the trigger table.  The triggers on that message ID never fire.
+ */
+#define SC_TRIGGER_SUBSCRIBE_ERR_EID 174
+
+/**
+ * \brief SC Trigger Started RTS Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *  This event message is issued when a message matching a trigger table
+ *  entry arrives and its RTS is started
+ */
+#define SC_TRIGGER_RTS_STARTED_DBG_EID 175
+
+/**
+ * \brief SC Trigger Skipped RTS Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *  This event message is issued when a message matching a trigger table
+ *  entry arrives but its RTS is disabled, not loaded or already executing
+ */
+#define SC_TRIGGER_RTS_SKIPPED_DBG_EID 176
+
+/**
+ * \brief SC Set RTS Priority Command Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *  This event message is issued when a #SC_SET_RTS_PRIORITY_CC command
+ *  has given a set of RTS a new priority level
+ */
+#define SC_SET_RTS_PRIORITY_INF_EID 177
+
+/**
+ * \brief SC Set RTS Priority Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *  This event message is issued when a #SC_SET_RTS_PRIORITY_CC command
+ *  has a set that is empty or names an RTS over #SC_NUMBER_OF_RTS, or a
+ *  priority level that is not less than #SC_RTS_PRIORITY_LEVELS
+ */
+#define SC_SET_RTS_PRIORITY_ERR_EID 178
+
+/**
+ * \brief SC Reset Diagnostics Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *  This event message is issued when the #SC_RESET_DIAG_CC command was
+ *  received
+ */
+#define SC_RESET_DIAG_INF_EID 179
+
+/**
+ * \brief SC Trace Table Registration Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *  This event message is issued when the trace table fails table
+ *  registration
+ */
+#define SC_REGISTER_TRACE_TABLE_ERR_EID 180
+
+/**
+ * \brief SC Trace Table Get Address Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *  This event message is issued when getting the address of the trace
+ *  table failed
+ */
+#define SC_GET_ADDRESS_TRACE_ERR_EID 181
+
+/**
+ * \brief SC RTS Statistics Table Registration Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *  This event message is issued when the RTS statistics table fails
+ *  table registration
+ */
+#define SC_REGISTER_RTS_STATS_TABLE_ERR_EID 182
+
+/**
+ * \brief SC RTS Statistics Table Get Address Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *  This event message is issued when getting the address of the RTS
+ *  statistics table failed
+ */
+#define SC_GET_ADDRESS_RTS_STATS_ERR_EID 183
+
+/**
+ * \brief SC Query Lookahead Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *  This event message is issued when a #SC_QUERY_LOOKAHEAD_CC command was
+ *  received and the lookahead packet was sent
+ */
+#define SC_LOOKAHEAD_CMD_INF_EID 184
+
+/**
+ * \brief SC Query Lookahead Invalid Count Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *  This event message is issued when a #SC_QUERY_LOOKAHEAD_CC command was
+ *  received asking for 0 commands or more than #SC_LOOKAHEAD_ENTRIES
+ */
+#define SC_LOOKAHEAD_CMD_ERR_EID 185
+
+/**
+ * \brief SC Set Event Mode Invalid Mode Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *  This event message is issued when a #SC_SET_EVENT_MODE_CC command was
+ *  received, but the mode in the command was invalid
+ */
+#define SC_EVENT_MODE_CMD_ERR_EID 186
+
+/**
+ * \brief SC Set Event Mode Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *  This event message is issued when a #SC_SET_EVENT_MODE_CC command was
+ *  received and the mode was changed
+ */
+#define SC_EVENT_MODE_CMD_INF_EID 187
+
+/**
+ * \brief SC ATS Table Load Rejected Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *  This event message is issued when an ATS or Append table has more
+ *  commands tagged in some second than SC can send in a second, and
+ *  #SC_FORECAST_REJECT is true.  The worst seconds are listed as
+ *  commands\@time tag.  An Append table is counted alone, without the
+ *  commands of the ATS it is later appended to.  The text says "after
+ *  executing RTSs" when #SC_FORECAST_RTS_DEMAND takes the executing RTSs
+ *  out of the commands per second, and "in table alone" when it does not.
+ */
+#define SC_VERIFY_ATS_LOAD_ERR_EID 188
+
+/**
+ * \brief SC ATS Table Load Overloaded Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *  This event message is issued when an ATS or Append table has more
+ *  commands tagged in some second than SC can send in a second, and
+ *  #SC_FORECAST_REJECT is false.  The table is accepted but those
+ *  commands will be sent late.  The worst seconds are listed as
+ *  commands\@time tag.  An Append table is counted alone, without the
+ *  commands of the ATS it is later appended to.  The text says "after
+ *  executing RTSs" when #SC_FORECAST_RTS_DEMAND takes the executing RTSs
+ *  out of the commands per second, and "in table alone" when it does not.
+ */
+#define SC_VERIFY_ATS_LOAD_INF_EID 189
+
+/**
+ * \brief SC ATS Status Summary Stopped Event ID
+ *
+ *  \par Type: INFORMATION
+ *
+ *  \par Cause:
+ *  This event message is issued when an ATS is reloaded or appended to
+ *  while a status summary of it is being sent.  The summary ends with
+ *  the packet sent with this event.  The event text includes the number
+ *  of commands summarized out of the number requested.
+ */
+#define SC_REPORTATS_STOP_INF_EID 190
+
+/**
+ * \brief SC RTS Table Invalid Patch Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *  This event message is issued when an #SC_RTS_PATCH_CC entry in an RTS
+ *  table copies a range outside the arguments, onto the command header,
+ *  or past the end of the command that directly follows it
+ */
+#define SC_RTS_PATCH_LOAD_ERR_EID 191
+
+/**
+ * \brief SC Trigger Table Load Failed Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *  This event message is issued when the trigger table fails to load at
+ *  startup.  No triggers are in use until one is loaded by command.
+ *
+ *  The event text includes the result of the #CFE_TBL_Load call.
+ */
+#define SC_TRIGGER_LOAD_FAIL_DBG_EID 192
+
 /**\}*/
 
 #endif
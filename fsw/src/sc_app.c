@@ -36,6 +36,7 @@
 #include "sc_utils.h"
 #include "sc_dispatch.h"
 #include "sc_loads.h"
+#include "sc_rtsrq.h"
 #include "sc_events.h"
 #include "sc_msgids.h"
 #include "sc_perfids.h"
@@ -110,6 +111,12 @@ void SC_AppMain(void)
             /* Exit main process loop */
             RunStatus = CFE_ES_RunStatus_APP_ERROR;
         }
+
+        /* Start the RTSs of any trigger messages that came in meanwhile */
+        if (RunStatus == CFE_ES_RunStatus_APP_RUN)
+        {
+            SC_ProcessTriggerPipe();
+        }
     }
 
     /* Check for "fatal" process error */
@@ -150,6 +157,9 @@ CFE_Status_t SC_AppInit(void)
     /* Continue ATS execution if ATS command checksum fails */
     SC_OperData.HkPacket.Payload.ContinueAtsOnFailureFlag = SC_CONT_ON_FAILURE_START;
 
+    /* Send high rate events as they happen or summarized */
+    SC_OperData.HkPacket.Payload.EventMode = SC_EVENT_MODE_START;
+
     SC_AppData.EnableHeaderUpdate = SC_PLATFORM_ENABLE_HEADER_UPDATE;
 
     /* assign the time ref accessor from the compile-time option */
@@ -160,10 +170,30 @@ CFE_Status_t SC_AppInit(void)
     /* SAD: SC_Process_RTP is 1, within the valid index range of NextCmdTime array, which has 2 elements */
     SC_AppData.NextCmdTime[SC_Process_RTP] = SC_MAX_WAKEUP_CNT;
 
+    /* The RTS storage pool starts out empty */
+    SC_AppData.RtsPoolFreeWords   = SC_RTS_POOL_SIZE32;
+    SC_AppData.RtsPoolLargestFree = SC_RTS_POOL_SIZE32;
+
     /* Initialize the SC housekeeping packet */
     CFE_MSG_Init(CFE_MSG_PTR(SC_OperData.HkPacket.TelemetryHeader), CFE_SB_ValueToMsgId(SC_HK_TLM_MID),
                  sizeof(SC_HkTlm_t));
 
+    /* Initialize the SC ATS window query packet */
+    CFE_MSG_Init(CFE_MSG_PTR(SC_OperData.AtsWindowPacket.TelemetryHeader), CFE_SB_ValueToMsgId(SC_ATS_WINDOW_TLM_MID),
+                 sizeof(SC_AtsWindowTlm_t));
+
+    /* Initialize the SC ATS status summary packet */
+    CFE_MSG_Init(CFE_MSG_PTR(SC_OperData.AtsStatusPacket.TelemetryHeader), CFE_SB_ValueToMsgId(SC_ATS_STATUS_TLM_MID),
+                 sizeof(SC_AtsStatusTlm_t));
+
+    /* Initialize the SC diagnostic packet */
+    CFE_MSG_Init(CFE_MSG_PTR(SC_OperData.DiagPacket.TelemetryHeader), CFE_SB_ValueToMsgId(SC_DIAG_TLM_MID),
+                 sizeof(SC_DiagTlm_t));
+
+    /* Initialize the SC lookahead packet */
+    CFE_MSG_Init(CFE_MSG_PTR(SC_OperData.LookaheadPacket.TelemetryHeader), CFE_SB_ValueToMsgId(SC_LOOKAHEAD_TLM_MID),
+                 sizeof(SC_LookaheadTlm_t));
+
     /* Select auto-exec RTS to start during first HK request */
     if (CFE_ES_GetResetType(NULL) == CFE_PSP_RST_TYPE_POWERON)
     {
@@ -218,6 +248,15 @@ CFE_Status_t SC_AppInit(void)
         return Result;
     }
 
+    /* Must be able to create the pipe the trigger table subscribes to */
+    Result = CFE_SB_CreatePipe(&SC_OperData.TriggerPipe, SC_TRIGGER_PIPE_DEPTH, SC_TRIGGER_PIPE_NAME);
+    if (Result != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(SC_CR_PIPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Software Bus Create Trigger Pipe returned: 0x%08X", (unsigned int)Result);
+        return Result;
+    }
+
     /* Must be able to create and initialize tables */
     Result = SC_InitTables();
     if (Result != CFE_SUCCESS)
@@ -267,8 +306,13 @@ CFE_Status_t SC_InitTables(void)
 
     /* RTP control block status table */
     SC_OperData.RtsCtrlBlckAddr->NumRtsActive = 0;
+    SC_OperData.HkPacket.Payload.NumRtsActive = 0;
     SC_OperData.RtsCtrlBlckAddr->CurrRtsNum   = SC_RTS_NUM_NULL;
 
+    /* trace and RTS statistics tables start out empty */
+    memset(SC_OperData.TraceTblAddr, 0, sizeof(SC_TraceTable_t));
+    memset(SC_OperData.RtsStatsTblAddr, 0, sizeof(SC_RtsStatsEntry_t) * SC_NUMBER_OF_RTS);
+
     /* ATS command status table(s) */
     for (i = 0; i < SC_NUMBER_OF_ATS; i++)
     {
@@ -278,6 +322,8 @@ CFE_Status_t SC_InitTables(void)
 
             StatusEntryPtr->Status = SC_Status_EMPTY;
         }
+
+        SC_SetAtsSize(SC_ATS_IDX_C(i), 0);
     }
 
     /* RTS information table */
@@ -287,8 +333,16 @@ CFE_Status_t SC_InitTables(void)
 
         RtsInfoPtr->NextCommandTgtWakeup = SC_MAX_WAKEUP_CNT;
         RtsInfoPtr->NextCommandPtr  = SC_ENTRY_OFFSET_FIRST;
-        RtsInfoPtr->RtsStatus       = SC_Status_EMPTY;
-        RtsInfoPtr->DisabledFlag    = true;
+        RtsInfoPtr->Priority        = SC_RTS_DEFAULT_PRIORITY;
+
+        SC_SetRtsStatus(SC_RTS_IDX_C(i), SC_Status_EMPTY);
+        SC_SetRtsDisabled(SC_RTS_IDX_C(i), true);
+    }
+
+    /* the first turn at each priority level goes to the lowest numbered RTS */
+    for (i = 0; i < SC_RTS_PRIORITY_LEVELS; i++)
+    {
+        SC_AppData.RtsLastServed[i] = SC_RTS_IDX_C(SC_NUMBER_OF_RTS - 1);
     }
 
     /* Load default RTS tables */
@@ -379,6 +433,26 @@ CFE_Status_t SC_RegisterDumpOnlyTables(void)
         }
     }
 
+    /* Register dump only trace table */
+    Result = CFE_TBL_Register(&SC_OperData.TraceTblHandle, SC_TRACE_TABLE_NAME, sizeof(SC_TraceTable_t),
+                              TableOptions, NULL);
+    if (Result != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(SC_REGISTER_TRACE_TABLE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Trace table register failed, returned: 0x%08X", (unsigned int)Result);
+        return Result;
+    }
+
+    /* Register dump only RTS statistics table */
+    Result = CFE_TBL_Register(&SC_OperData.RtsStatsHandle, SC_RTS_STATS_TABLE_NAME,
+                              sizeof(SC_RtsStatsEntry_t) * SC_NUMBER_OF_RTS, TableOptions, NULL);
+    if (Result != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(SC_REGISTER_RTS_STATS_TABLE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "RTS statistics table register failed, returned: 0x%08X", (unsigned int)Result);
+        return Result;
+    }
+
     return CFE_SUCCESS;
 }
 
@@ -393,7 +467,7 @@ CFE_Status_t SC_RegisterLoadableTables(void)
     const char *      StrFormat[2]    = {"%s%03d", "%s%d"};
     const char *      Name[2]         = {SC_RTS_TABLE_NAME, SC_ATS_TABLE_NAME};
     CFE_TBL_Handle_t *TblHandlePtr[2] = {SC_OperData.RtsTblHandle, SC_OperData.AtsTblHandle};
-    int32             TableSize[2]    = {SC_RTS_BUFF_SIZE32 * SC_BYTES_IN_WORD, SC_ATS_BUFF_SIZE32 * SC_BYTES_IN_WORD};
+    int32             TableSize[2]    = {SC_RTS_MAX_SIZE32 * SC_BYTES_IN_WORD, SC_ATS_BUFF_SIZE32 * SC_BYTES_IN_WORD};
     uint16            TableOptions[2] = {(CFE_TBL_OPT_DEFAULT | CFE_TBL_OPT_SNGL_BUFFER), CFE_TBL_OPT_DBL_BUFFER};
     uint16            EventID[2]      = {SC_REGISTER_RTS_TBL_ERR_EID, SC_REGISTER_ATS_TBL_ERR_EID};
     const char *      Spec[2]         = {"RTS", "ATS"};
@@ -429,6 +503,17 @@ CFE_Status_t SC_RegisterLoadableTables(void)
         return Result;
     }
 
+    /* Register loadable trigger table */
+    Result = CFE_TBL_Register(&SC_OperData.TriggerTblHandle, SC_TRIGGER_TABLE_NAME,
+                              sizeof(SC_TriggerEntry_t) * SC_NUMBER_OF_TRIGGERS, CFE_TBL_OPT_DBL_BUFFER,
+                              SC_ValidateTriggers);
+    if (Result != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(SC_REGISTER_TRIGGER_TBL_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Trigger Table Registration Failed, returned: 0x%08X", (unsigned int)Result);
+        return Result;
+    }
+
     return CFE_SUCCESS;
 }
 
@@ -474,6 +559,24 @@ CFE_Status_t SC_GetDumpTablePointers(void)
         }
     }
 
+    /* Get buffer address for dump only trace table */
+    Result = CFE_TBL_GetAddress((void **)&SC_OperData.TraceTblAddr, SC_OperData.TraceTblHandle);
+    if (Result != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(SC_GET_ADDRESS_TRACE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Trace table failed Getting Address, returned: 0x%08X", (unsigned int)Result);
+        return Result;
+    }
+
+    /* Get buffer address for dump only RTS statistics table */
+    Result = CFE_TBL_GetAddress((void **)&SC_OperData.RtsStatsTblAddr, SC_OperData.RtsStatsHandle);
+    if (Result != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(SC_GET_ADDRESS_RTS_STATS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "RTS statistics table failed Getting Address, returned: 0x%08X", (unsigned int)Result);
+        return Result;
+    }
+
     return CFE_SUCCESS;
 }
 
@@ -511,6 +614,22 @@ CFE_Status_t SC_GetLoadTablePointers(void)
         return Result;
     }
 
+    /* Get buffer address for loadable trigger table */
+    Result = CFE_TBL_GetAddress((void **)&SC_OperData.TriggerTblAddr, SC_OperData.TriggerTblHandle);
+
+    if ((Result != CFE_TBL_ERR_NEVER_LOADED) && (Result != CFE_TBL_INFO_UPDATED))
+    {
+        CFE_EVS_SendEvent(SC_GET_ADDRESS_TRIGGER_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Trigger table failed Getting Address, returned: 0x%08X", (unsigned int)Result);
+        return Result;
+    }
+
+    /* Subscribe to the message IDs of a trigger table loaded before a restart */
+    if (Result == CFE_TBL_INFO_UPDATED)
+    {
+        SC_UpdateTriggers();
+    }
+
     /* Get buffer address for loadable RTS tables */
     for (i = 0; i < SC_NUMBER_OF_RTS; i++)
     {
@@ -547,7 +666,8 @@ void SC_LoadDefaultTables(void)
     int32 Status;
 
     /*
-    ** Currently, only RTS tables are loaded during initialization.
+    ** Currently, only RTS tables and the trigger table are loaded
+    ** during initialization.
     **
     ** ATS and ATS Append tables must be loaded by command.
     */
@@ -570,6 +690,14 @@ void SC_LoadDefaultTables(void)
     /* Display startup RTS not loaded count */
     CFE_EVS_SendEvent(SC_RTS_LOAD_FAIL_COUNT_INFO_EID, CFE_EVS_EventType_INFORMATION,
                       "RTS table files not loaded at initialization = %d of %d", (int)NotLoadedCount, SC_NUMBER_OF_RTS);
+
+    /* The trigger table is subscribed to once its address is first taken */
+    Status = CFE_TBL_Load(SC_OperData.TriggerTblHandle, CFE_TBL_SRC_FILE, SC_TRIGGER_FILE_NAME);
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(SC_TRIGGER_LOAD_FAIL_DBG_EID, CFE_EVS_EventType_DEBUG,
+                          "Trigger table failed to load, returned: 0x%08lX", (unsigned long)Status);
+    }
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -582,13 +710,14 @@ void SC_RegisterManageCmds(void)
 {
     int32 i;
 
-    CFE_TBL_Handle_t TblHandles[5] = {SC_OperData.RtsInfoHandle, SC_OperData.RtsCtrlBlckHandle,
-                                      SC_OperData.AtsInfoHandle, SC_OperData.AtsCtrlBlckHandle,
-                                      SC_OperData.AppendTblHandle};
-    uint32           params[5]     = {SC_TBL_ID_RTS_INFO, SC_TBL_ID_RTP_CTRL, SC_TBL_ID_ATS_INFO, SC_TBL_ID_ATP_CTRL,
-                        SC_TBL_ID_APPEND};
+    CFE_TBL_Handle_t TblHandles[8] = {SC_OperData.RtsInfoHandle,   SC_OperData.RtsCtrlBlckHandle,
+                                      SC_OperData.AtsInfoHandle,   SC_OperData.AtsCtrlBlckHandle,
+                                      SC_OperData.AppendTblHandle, SC_OperData.TriggerTblHandle,
+                                      SC_OperData.TraceTblHandle,  SC_OperData.RtsStatsHandle};
+    uint32           params[8]     = {SC_TBL_ID_RTS_INFO, SC_TBL_ID_RTP_CTRL, SC_TBL_ID_ATS_INFO, SC_TBL_ID_ATP_CTRL,
+                        SC_TBL_ID_APPEND, SC_TBL_ID_TRIGGER, SC_TBL_ID_TRACE, SC_TBL_ID_RTS_STATS};
 
-    for (i = 0; i < 5; i++)
+    for (i = 0; i < 8; i++)
     {
         CFE_TBL_NotifyByMessage(TblHandles[i], CFE_SB_ValueToMsgId(SC_CMD_MID), SC_MANAGE_TABLE_CC, params[i]);
     }
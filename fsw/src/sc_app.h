@@ -34,6 +34,7 @@
 #include "sc_tbldefs.h"
 #include "sc_msgdefs.h"
 #include "sc_msg.h"
+#include <assert.h>
 
 /**
  * SC time accessor object
@@ -66,9 +67,12 @@ typedef struct
  */
 typedef struct
 {
-    uint16 AtsUseCtr;        /**< \brief How many times it has been used */
-    uint16 NumberOfCommands; /**< \brief number of commands in the ATS */
-    uint32 AtsSize;          /**< \brief size of the ATS */
+    uint16 AtsUseCtr; /**< \brief How many times it has been used */
+#if (SC_CMD_INDEX_BITS == 32)
+    uint16 Padding; /**< \brief Structure padding to align 32-bit command counts */
+#endif
+    SC_IndexBase_t NumberOfCommands; /**< \brief number of commands in the ATS */
+    uint32         AtsSize;          /**< \brief size of the ATS */
 } SC_AtsInfoTable_t;
 
 /**
@@ -84,20 +88,125 @@ typedef struct
     SC_RtsNum_t CurrRtsNum;   /**< \brief next RTS number */
 } SC_RtpControlBlock_t;
 
+/**
+ *  \brief Bytes of data in an RTS info table entry, without its padding
+ */
+#define SC_RTS_INFO_ENTRY_DATA_SIZE                                                                     \
+    (sizeof(CFE_TIME_SysTime_t) + (2 * sizeof(uint32)) +                                                \
+     ((1 + SC_RTS_MAX_LOOP_DEPTH + SC_RTS_MAX_PATCHES) * sizeof(SC_EntryOffset_t)) +                    \
+     ((8 + SC_RTS_MAX_LOOP_DEPTH) * sizeof(uint16)) + 6 + SC_RTS_ARG_BLOCK_SIZE)
+
+/**
+ *  \brief Bytes of padding that end an RTS info table entry on a 32 bit boundary
+ *
+ *  Always at least one, as C has no empty arrays.
+ */
+#define SC_RTS_INFO_ENTRY_PAD_SIZE (4 - (SC_RTS_INFO_ENTRY_DATA_SIZE % 4))
+
 /**
  *  \brief RTS info table entry type -One of these records is kept for each RTS
+ *
+ *  The table is dumped to the ground, so every field has a fixed width and
+ *  the fields go from widest to narrowest, leaving the compiler no padding
+ *  of its own to add.
  */
 typedef struct
 {
-    SC_Status_Enum_t RtsStatus;            /**< \brief status of the RTS */
-    bool             DisabledFlag;         /**< \brief disabled/enabled flag */
-    uint8            CmdCtr;               /**< \brief Cmds executed in current rts */
-    uint8            CmdErrCtr;            /**< \brief errs in current RTS */
-    uint32           NextCommandTgtWakeup; /**< \brief target wakeup count for next RTS command */
-    SC_EntryOffset_t NextCommandPtr;       /**< \brief where next rts cmd is */
-    uint16           UseCtr;               /**< \brief how many times RTS is run */
+    CFE_TIME_SysTime_t NextCommandTime;      /**< \brief time the next command is due, if TimedFlag is set */
+    uint32             NextCommandTgtWakeup; /**< \brief target wakeup count for next RTS command */
+    uint32             MaxLateWakeups;       /**< \brief most wakeups a cmd of the current run was sent late */
+
+    SC_EntryOffset_t NextCommandPtr;                  /**< \brief where next rts cmd is */
+    SC_EntryOffset_t LoopStart[SC_RTS_MAX_LOOP_DEPTH]; /**< \brief where each open loop body begins */
+    SC_EntryOffset_t PatchEntry[SC_RTS_MAX_PATCHES];   /**< \brief where each patch entry for the next command is */
+
+    uint16      UseCtr;                           /**< \brief how many times RTS is run */
+    uint16      CallDepth;                        /**< \brief number of calls waiting on this RTS to return */
+    SC_RtsNum_t CallerRtsNum;                     /**< \brief RTS this one returns to, 0 if not called */
+    SC_RtsNum_t CalleeRtsNum;                     /**< \brief RTS this one is waiting on, 0 if none */
+    SC_RtsNum_t SourceRtsNum;                     /**< \brief RTS whose commands this instance runs, 0 if its own */
+    uint16      LoopDepth;                        /**< \brief number of loops open in this RTS */
+    uint16      LoopCount[SC_RTS_MAX_LOOP_DEPTH]; /**< \brief runs left for each open loop, 0 if forever */
+    uint16      PatchCount;                       /**< \brief number of patch entries found for the next command */
+    uint16      LateCmdCtr;                       /**< \brief cmds of the current run sent after their wakeup */
+
+    SC_Status_Enum_t RtsStatus;    /**< \brief status of the RTS */
+    uint8            DisabledFlag; /**< \brief disabled/enabled flag, true if disabled */
+    uint8            CmdCtr;       /**< \brief Cmds executed in current rts */
+    uint8            CmdErrCtr;    /**< \brief errs in current RTS */
+    uint8            TimedFlag;    /**< \brief true once an #SC_RTS_TIMED_CC entry is reached */
+    uint8            Priority;     /**< \brief priority level of the RTS, 0 is the highest */
+    uint8            Args[SC_RTS_ARG_BLOCK_SIZE]; /**< \brief arguments the RTS was started with */
+
+    uint8 Padding[SC_RTS_INFO_ENTRY_PAD_SIZE]; /**< \brief Structure padding to a 32 bit boundary */
 } SC_RtsInfoEntry_t;
 
+CompileTimeAssert(sizeof(SC_RtsInfoEntry_t) == SC_RTS_INFO_ENTRY_DATA_SIZE + SC_RTS_INFO_ENTRY_PAD_SIZE,
+                  SC_RtsInfoEntry_HasImplicitPadding);
+
+/**
+ *  \brief RTS statistics table entry type - One of these records is kept for each RTS
+ *
+ *  Unlike the RTS info table, these are kept across runs and are only
+ *  cleared when the application starts.
+ */
+typedef struct
+{
+    uint32             UseCtr;          /**< \brief runs started */
+    uint32             CmdCtr;          /**< \brief cmds executed, over all runs */
+    uint32             CmdErrCtr;       /**< \brief cmd errors, over all runs */
+    uint32             LateCmdCtr;      /**< \brief cmds sent after their wakeup, over all runs */
+    uint32             MaxLateWakeups;  /**< \brief most wakeups any cmd was sent late */
+    uint32             StartWakeup;     /**< \brief wakeup count the last run started at */
+    uint32             LastRunWakeups;  /**< \brief wakeups the last completed run took */
+    uint32             MaxRunWakeups;   /**< \brief most wakeups any run took */
+    uint32             TotalRunWakeups; /**< \brief wakeups taken by all completed runs */
+    uint32             LastRunUsec;     /**< \brief time the last completed run took */
+    uint32             MaxRunUsec;      /**< \brief longest time any run took */
+    uint32             Padding;         /**< \brief Structure padding to align the total time */
+    uint64             TotalRunUsec;    /**< \brief time taken by all completed runs */
+    CFE_TIME_SysTime_t LastStartTime;   /**< \brief time the last run started */
+    CFE_TIME_SysTime_t LastStopTime;    /**< \brief time the last run stopped */
+} SC_RtsStatsEntry_t;
+
+/**
+ *  \brief Trace table entry type - One of these records is written for each command dispatched
+ */
+typedef struct
+{
+    CFE_TIME_SysTime_t ScheduledTime; /**< \brief time the command was due */
+    CFE_TIME_SysTime_t ActualTime;    /**< \brief time the command was dispatched */
+    uint32             MsgId;         /**< \brief message ID value of the command, 0 if it was not read */
+    uint32             CmdId;         /**< \brief ATS command number or RTS entry offset, in "words" */
+    uint16             SourceNum;     /**< \brief ATS or RTS number the command came from */
+    uint8              Process;       /**< \brief #SC_Process_ATP or #SC_Process_RTP */
+    uint8              FcnCode;       /**< \brief function code of the command */
+    SC_Status_Enum_t   Status;        /**< \brief what became of the command: executed, skipped or failed */
+    uint8              Padding[3];    /**< \brief Structure padding to align to 32-bit boundaries */
+} SC_TraceEntry_t;
+
+/**
+ *  \brief Deferred event record - One of these is queued for each event held for a summary
+ */
+typedef struct
+{
+    uint16 EventID; /**< \brief ID of the event, 0 once it has been summarized */
+    uint16 Num;     /**< \brief RTS number the event is about */
+} SC_DeferredEvent_t;
+
+/**
+ *  \brief Trace table type
+ *
+ *  A ring of the most recent command dispatches.  Only the dispatch path
+ *  writes it, filling in an entry before moving NextEntry past it.
+ */
+typedef struct
+{
+    uint32          NextEntry;               /**< \brief entry written next, the oldest once the ring is full */
+    uint32          EntryCount;              /**< \brief entries written since the table was cleared */
+    SC_TraceEntry_t Entry[SC_TRACE_ENTRIES]; /**< \brief the ring of entries */
+} SC_TraceTable_t;
+
 /**
  * \brief Wakeup for SC
  *
@@ -251,10 +360,22 @@ void SC_RegisterManageCmds(void);
 #define SC_ATS_BUFF_SIZE32    (SC_ATS_BUFF_SIZE / 2)    /**< \brief ATS buffer number of 32-bit elements */
 #define SC_RTS_BUFF_SIZE32    (SC_RTS_BUFF_SIZE / 2)    /**< \brief RTS buffer number of 32-bit elements */
 #define SC_APPEND_BUFF_SIZE32 (SC_APPEND_BUFF_SIZE / 2) /**< \brief Append buffer number of 32-bit elements */
+#define SC_RTS_POOL_SIZE32    (SC_RTS_POOL_SIZE / 2)    /**< \brief RTS storage pool number of 32-bit elements */
+#define SC_RTS_MAX_SIZE32     (SC_RTS_MAX_SIZE / 2)     /**< \brief Largest RTS number of 32-bit elements */
+
+/** \brief RTS patch buffer number of 32-bit elements, enough for the largest command */
+#define SC_RTS_PATCH_BUF_SIZE32 ((SC_PACKET_MAX_SIZE + SC_BYTES_IN_WORD - 1) / SC_BYTES_IN_WORD)
+
+/** \brief Local command buffer number of 32-bit elements, enough for the largest command */
+#define SC_LOCAL_CMD_BUF_SIZE32 ((SC_PACKET_MAX_SIZE + SC_BYTES_IN_WORD - 1) / SC_BYTES_IN_WORD)
+
+/** \brief Microseconds between wakeups */
+#define SC_WAKEUP_PERIOD_USEC (1000000 / SC_WAKEUPS_PER_SECOND)
 
 #define SC_ERROR -1 /**< \brief SC error return value */
 
-#define SC_CMD_PIPE_NAME "SC_CMD_PIPE" /**< \brief Command pipe name */
+#define SC_CMD_PIPE_NAME     "SC_CMD_PIPE"  /**< \brief Command pipe name */
+#define SC_TRIGGER_PIPE_NAME "SC_TRIG_PIPE" /**< \brief Trigger pipe name */
 
 /** \brief ATS header + minimum packet size in "words" */
 #define SC_ATS_HDR_WORDS ((SC_ATS_HEADER_SIZE + SC_PACKET_MIN_SIZE) / SC_BYTES_IN_WORD)
@@ -294,7 +415,8 @@ typedef struct SC_AtsCmdStatusEntry
  */
 typedef struct
 {
-    CFE_SB_PipeId_t CmdPipe; /**< \brief Command pipe ID */
+    CFE_SB_PipeId_t CmdPipe;     /**< \brief Command pipe ID */
+    CFE_SB_PipeId_t TriggerPipe; /**< \brief Trigger pipe ID, for the messages named by the trigger table */
 
     CFE_TBL_Handle_t AtsTblHandle[SC_NUMBER_OF_ATS]; /**< \brief Table handles for all ATS tables    */
     uint32 *         AtsTblAddr[SC_NUMBER_OF_ATS];   /**< \brief Table Addresses for all ATS tables  */
@@ -305,6 +427,9 @@ typedef struct
     CFE_TBL_Handle_t RtsTblHandle[SC_NUMBER_OF_RTS]; /**< \brief Table handles for all RTS tables    */
     uint32 *         RtsTblAddr[SC_NUMBER_OF_RTS];   /**< \brief Table addresses for all RTS tables  */
 
+    CFE_TBL_Handle_t   TriggerTblHandle; /**< \brief Table handle for the trigger table  */
+    SC_TriggerEntry_t *TriggerTblAddr;   /**< \brief Table address for the trigger table */
+
     CFE_TBL_Handle_t   AtsInfoHandle;  /**< \brief Table handle the for ATS Info Table */
     SC_AtsInfoTable_t *AtsInfoTblAddr; /**< \brief Table address for the ATS Info Table*/
 
@@ -317,14 +442,25 @@ typedef struct
     CFE_TBL_Handle_t      AtsCtrlBlckHandle; /**< \brief Table handle for the ATP ctrl block */
     SC_AtpControlBlock_t *AtsCtrlBlckAddr;   /**< \brief Table address for the ATP ctrl block*/
 
+    CFE_TBL_Handle_t TraceTblHandle; /**< \brief Table handle for the trace table  */
+    SC_TraceTable_t *TraceTblAddr;   /**< \brief Table address for the trace table */
+
+    CFE_TBL_Handle_t    RtsStatsHandle;  /**< \brief Table handle for the RTS statistics table  */
+    SC_RtsStatsEntry_t *RtsStatsTblAddr; /**< \brief Table address for the RTS statistics table */
+
     CFE_TBL_Handle_t        AtsCmdStatusHandle[SC_NUMBER_OF_ATS];  /**< \brief ATS Cmd Status table handle     */
     SC_AtsCmdStatusEntry_t *AtsCmdStatusTblAddr[SC_NUMBER_OF_ATS]; /**< \brief ATS Cmd Status table address    */
 
-    int32 AtsDupTestArray[SC_MAX_ATS_CMDS]; /**< \brief ATS test for duplicate cmd numbers  */
+    int32           AtsDupTestArray[SC_MAX_ATS_CMDS]; /**< \brief ATS test for duplicate cmd numbers  */
+    SC_AbsTimeTag_t ForecastTimes[SC_MAX_ATS_CMDS];   /**< \brief ATS time tags for the load forecast */
 
     uint16 NumCmdsWakeup; /**< \brief the num of cmds that have gone out in this wakeup cycle */
 
-    SC_HkTlm_t HkPacket; /**< \brief SC Housekeeping structure */
+    SC_HkTlm_t        HkPacket;        /**< \brief SC Housekeeping structure */
+    SC_AtsWindowTlm_t AtsWindowPacket; /**< \brief ATS window query results structure */
+    SC_AtsStatusTlm_t AtsStatusPacket; /**< \brief ATS status summary structure */
+    SC_DiagTlm_t      DiagPacket;      /**< \brief Diagnostic statistics structure */
+    SC_LookaheadTlm_t LookaheadPacket; /**< \brief Lookahead query results structure */
 } SC_OperData_t;
 
 /**
@@ -347,6 +483,51 @@ typedef struct SC_AtsCmdNumRecord
     SC_CommandNum_t CmdNum;
 } SC_AtsCmdNumRecord_t;
 
+/**
+ *  \brief ATS activation job
+ *
+ *  Tracks a newly loaded ATS table as it is parsed and time sorted over
+ *  several wakeups.  The number of commands in the ATS info table is left
+ *  at zero until the job completes, so the ATS cannot be started, switched
+ *  to or appended to while it is partially built.  An ATS loaded while
+ *  another one is being activated is cleared and queued until that job ends.
+ */
+typedef struct
+{
+    SC_AtsLoadPhase_Enum_t Phase;                     /**< \brief Current phase, IDLE when no job is active */
+    SC_AtsIndex_t          AtsIndex;                  /**< \brief ATS being activated */
+    SC_EntryOffset_t       EntryOffset;               /**< \brief Offset of the next ATS entry to parse */
+    uint32                 CmdCount;                  /**< \brief Number of commands found by the parse phase */
+    uint32                 SortStep;                  /**< \brief Next time index sort step to run */
+    bool                   Pending[SC_NUMBER_OF_ATS]; /**< \brief ATS tables waiting for their activation */
+} SC_AtsLoadJob_t;
+
+/**
+ *  \brief ATS status summary job
+ *
+ *  Tracks an ATS status summary as it is built over several wakeups.  The
+ *  runs gathered so far are held in the status summary packet itself.
+ */
+typedef struct
+{
+    bool          Active;      /**< \brief true while a summary is being built */
+    SC_AtsIndex_t AtsIndex;    /**< \brief ATS being summarized */
+    uint32        SeqIndex;    /**< \brief Next time index table entry to summarize */
+    uint32        NumCommands; /**< \brief Number of commands in the ATS when the summary began */
+} SC_AtsStatusJob_t;
+
+/**
+ *  \brief RTS storage pool block
+ *
+ *  Locates the copy of an RTS in the RTS storage pool.  A size of zero
+ *  means no space is allocated to the RTS.
+ */
+typedef struct
+{
+    uint32 Offset; /**< \brief Start of the block in the pool, in words */
+    uint32 Size;   /**< \brief Size of the block, in words */
+} SC_RtsPoolBlock_t;
+
 /**
  *  \brief SC Application Data Structure
  *  This structure is used by the application to process time ordered commands.
@@ -364,15 +545,52 @@ typedef struct
          These offsets correspond to the addresses of ATS commands located in the ATS table.
          The index used is the ATS command index with values from 0 to SC_MAX_ATS_CMDS-1 */
 
+    uint32 RtsPool[SC_RTS_POOL_SIZE32];
+    /**< \brief  Storage pool holding the commands of every loaded RTS.  Each
+         RTS takes a block sized to fit, see RtsPoolBlock. */
+
+    SC_RtsPoolBlock_t RtsPoolBlock[SC_NUMBER_OF_RTS]; /**< \brief Pool block of each RTS */
+    uint32            RtsPoolFreeWords;               /**< \brief Free words in the RTS storage pool */
+    uint32            RtsPoolLargestFree;             /**< \brief Largest free region of the pool, in words */
+
     SC_TimeAccessor_t TimeRef; /**< \brief Configured time reference */
 
     bool EnableHeaderUpdate; /**< \brief whether to update headers in outgoing messages */
 
     uint32            NextCmdTime[2];     /**< \brief The overall next command time for ATP (0) and command wakeup count for RTP (1) */
     SC_AbsTimeTag_t   CurrentTime;        /**< \brief this is the current time for SC */
+    CFE_TIME_SysTime_t CurrentSysTime;    /**< \brief the current time for SC with subseconds, for timed RTSs */
     uint32            CurrentWakeupCount; /**< \brief this is the current wakeup count for SC */
+    bool              InWakeup;           /**< \brief true while a wakeup is being processed */
     SC_RtsNum_t       AutoStartRTS;       /**< \brief Start selected auto-exec RTS after init */
-    uint16            AppendWordCount;    /**< \brief Size of cmd entries in current Append ATS table */
+    SC_IndexBase_t    AppendWordCount;    /**< \brief Size of cmd entries in current Append ATS table */
+    SC_AtsLoadJob_t   AtsLoadJob;         /**< \brief ATS activation in progress, if any */
+    SC_AtsStatusJob_t AtsStatusJob;       /**< \brief ATS status summary in progress, if any */
+
+    uint32 RtsPatchBuf[SC_RTS_PATCH_BUF_SIZE32];
+    /**< \brief  Copy of the RTS command being sent, with the arguments of
+         its RTS patched in.  The RTS in the pool is never changed. */
+
+    uint32 LocalCmdBuf[SC_LOCAL_CMD_BUF_SIZE32];
+    /**< \brief  Copy of the SC command from an ATS or RTS being processed.
+         Processing it may reload the ATS table or compact the RTS pool. */
+
+    CFE_SB_MsgId_t TriggerMsgId[SC_NUMBER_OF_TRIGGERS];
+    /**< \brief  Distinct message IDs named by the trigger table, which the
+         trigger pipe is subscribed to.  The first TriggerMsgIdCount entries are used. */
+    uint16 TriggerMsgIdCount; /**< \brief Number of trigger message IDs subscribed to */
+
+    SC_RtsIndex_t RtsLastServed[SC_RTS_PRIORITY_LEVELS];
+    /**< \brief  RTS that last sent a command at each priority level, the
+         RTSs of a level take turns starting after it */
+
+    uint64 LatencySumUsec[2]; /**< \brief Sum of the dispatch latencies of the ATP (0) and RTP (1), for the mean */
+
+    uint64             PhaseSumUsec[SC_Phase_MAX];   /**< \brief Sum of the elapsed times of each phase, for the mean */
+    CFE_TIME_SysTime_t PhaseStartTime[SC_Phase_MAX]; /**< \brief MET when each phase last began */
+
+    SC_DeferredEvent_t DeferredEvent[SC_DEFERRED_EVENT_DEPTH]; /**< \brief Events queued for a summary */
+    uint16             NumDeferredEvents;                      /**< \brief Number of events in the queue */
 } SC_AppData_t;
 
 /************************************************************************
@@ -392,6 +610,38 @@ static inline SC_RtsInfoEntry_t *SC_GetRtsInfoObject(SC_RtsIndex_t RtsIndex)
     return &SC_OperData.RtsInfoTblAddr[SC_IDX_AS_UINT(RtsIndex)];
 }
 
+/**
+ * @brief Locates the statistics object associated with the given RTS index
+ *
+ * @param RtsIndex The RTS index
+ * @returns The statistics object for the given RTS
+ */
+static inline SC_RtsStatsEntry_t *SC_GetRtsStatsObject(SC_RtsIndex_t RtsIndex)
+{
+    return &SC_OperData.RtsStatsTblAddr[SC_IDX_AS_UINT(RtsIndex)];
+}
+
+/**
+ * @brief Gets the priority level an RTS runs at
+ *
+ * An RTS running as an instance of another RTS runs at the level of
+ * that RTS, any other RTS at its own
+ *
+ * @param RtsIndex The RTS index
+ * @returns The priority level for the given RTS
+ */
+static inline uint8 SC_GetRtsPriority(SC_RtsIndex_t RtsIndex)
+{
+    SC_RtsNum_t SourceRtsNum = SC_GetRtsInfoObject(RtsIndex)->SourceRtsNum;
+
+    if (SC_RtsNumIsValid(SourceRtsNum))
+    {
+        RtsIndex = SC_RtsNumToIndex(SourceRtsNum);
+    }
+
+    return SC_GetRtsInfoObject(RtsIndex)->Priority;
+}
+
 /**
  * @brief Locates the Info object associated with the given ATS index
  *
@@ -403,10 +653,139 @@ static inline SC_AtsInfoTable_t *SC_GetAtsInfoObject(SC_AtsIndex_t AtsIndex)
     return &SC_OperData.AtsInfoTblAddr[SC_IDX_AS_UINT(AtsIndex)];
 }
 
+/**
+ * @brief Sets the status of an RTS and its bit in the HK executing mask
+ *
+ * The HK status masks are kept current at every transition so that
+ * building the HK packet does not need to scan the RTS info table.
+ *
+ * @param RtsIndex The RTS index
+ * @param Status   The new RTS status
+ */
+static inline void SC_SetRtsStatus(SC_RtsIndex_t RtsIndex, SC_Status_Enum_t Status)
+{
+    uint16 Word = SC_IDX_AS_UINT(RtsIndex) / SC_NUMBER_OF_RTS_IN_UINT16;
+    uint16 Mask = 1 << (SC_IDX_AS_UINT(RtsIndex) % SC_NUMBER_OF_RTS_IN_UINT16);
+
+    SC_GetRtsInfoObject(RtsIndex)->RtsStatus = Status;
+
+    if (Status == SC_Status_EXECUTING)
+    {
+        SC_OperData.HkPacket.Payload.RtsExecutingStatus[Word] |= Mask;
+    }
+    else
+    {
+        SC_OperData.HkPacket.Payload.RtsExecutingStatus[Word] &= ~Mask;
+    }
+}
+
+/**
+ * @brief Sets the disabled flag of an RTS and its bit in the HK disabled mask
+ *
+ * @param RtsIndex     The RTS index
+ * @param DisabledFlag true if the RTS is disabled
+ */
+static inline void SC_SetRtsDisabled(SC_RtsIndex_t RtsIndex, bool DisabledFlag)
+{
+    uint16 Word = SC_IDX_AS_UINT(RtsIndex) / SC_NUMBER_OF_RTS_IN_UINT16;
+    uint16 Mask = 1 << (SC_IDX_AS_UINT(RtsIndex) % SC_NUMBER_OF_RTS_IN_UINT16);
+
+    SC_GetRtsInfoObject(RtsIndex)->DisabledFlag = DisabledFlag;
+
+    if (DisabledFlag)
+    {
+        SC_OperData.HkPacket.Payload.RtsDisabledStatus[Word] |= Mask;
+    }
+    else
+    {
+        SC_OperData.HkPacket.Payload.RtsDisabledStatus[Word] &= ~Mask;
+    }
+}
+
+/**
+ * @brief Counts the RTS named in one word of an RTS bitmask
+ *
+ * @param Bits One word of an RTS set or of an HK status mask
+ * @returns The number of bits set in the word
+ */
+static inline uint16 SC_CountRtsBits(uint16 Bits)
+{
+    uint16 Count = 0;
+
+    /* each pass clears the lowest set bit */
+    for (; Bits != 0; Bits &= (uint16)(Bits - 1))
+    {
+        Count++;
+    }
+
+    return Count;
+}
+
+/**
+ * @brief Counts a command executed by an RTS
+ *
+ * Counts it for the current run in the RTS info table and
+ * over all runs in the RTS statistics table.
+ *
+ * @param RtsIndex The RTS index
+ */
+static inline void SC_CountRtsCmd(SC_RtsIndex_t RtsIndex)
+{
+    SC_GetRtsInfoObject(RtsIndex)->CmdCtr++;
+    SC_GetRtsStatsObject(RtsIndex)->CmdCtr++;
+}
+
+/**
+ * @brief Counts a command error in an RTS
+ *
+ * @param RtsIndex The RTS index
+ */
+static inline void SC_CountRtsCmdErr(SC_RtsIndex_t RtsIndex)
+{
+    SC_GetRtsInfoObject(RtsIndex)->CmdErrCtr++;
+    SC_GetRtsStatsObject(RtsIndex)->CmdErrCtr++;
+}
+
+/**
+ * @brief Sets the size of an ATS and the matching HK free byte count
+ *
+ * @param AtsIndex The ATS index
+ * @param AtsSize  The ATS size in 32-bit words
+ */
+static inline void SC_SetAtsSize(SC_AtsIndex_t AtsIndex, uint32 AtsSize)
+{
+    SC_GetAtsInfoObject(AtsIndex)->AtsSize = AtsSize;
+
+    SC_OperData.HkPacket.Payload.AtpFreeBytes[SC_IDX_AS_UINT(AtsIndex)] =
+        (SC_ATS_BUFF_SIZE32 - AtsSize) * SC_BYTES_IN_WORD;
+}
+
+/**
+ * @brief Locates the RTS pool block an RTS executes from
+ *
+ * An RTS running as an instance of another RTS uses the pool block of
+ * that RTS, any other RTS uses its own
+ *
+ * @param RtsIndex The RTS index
+ * @returns The pool block for the given RTS
+ */
+static inline SC_RtsPoolBlock_t *SC_GetRtsPoolBlock(SC_RtsIndex_t RtsIndex)
+{
+    SC_RtsNum_t SourceRtsNum = SC_GetRtsInfoObject(RtsIndex)->SourceRtsNum;
+
+    if (SC_RtsNumIsValid(SourceRtsNum))
+    {
+        RtsIndex = SC_RtsNumToIndex(SourceRtsNum);
+    }
+
+    return &SC_AppData.RtsPoolBlock[SC_IDX_AS_UINT(RtsIndex)];
+}
+
 /**
  * @brief Locates a specific entry within an RTS
  *
- * The entry is specified via its offset (in words) from the start of the RTS
+ * The entry is specified via its offset (in words) from the start of the RTS,
+ * and is found in the RTS copy held in the RTS storage pool
  *
  * @param RtsIndex The RTS index
  * @param EntryOffset The offset from the start of the RTS, in words
@@ -414,7 +793,23 @@ static inline SC_AtsInfoTable_t *SC_GetAtsInfoObject(SC_AtsIndex_t AtsIndex)
  */
 static inline SC_RtsEntry_t *SC_GetRtsEntryAtOffset(SC_RtsIndex_t RtsIndex, SC_EntryOffset_t EntryOffset)
 {
-    return (SC_RtsEntry_t *)&SC_OperData.RtsTblAddr[SC_IDX_AS_UINT(RtsIndex)][SC_IDX_AS_UINT(EntryOffset)];
+    uint32 PoolOffset = SC_GetRtsPoolBlock(RtsIndex)->Offset + SC_IDX_AS_UINT(EntryOffset);
+
+    /* callers keep the offset within the RTS, so it is always within the pool */
+    assert(PoolOffset < SC_RTS_POOL_SIZE32);
+
+    return (SC_RtsEntry_t *)&SC_AppData.RtsPool[PoolOffset];
+}
+
+/**
+ * @brief Gets the size of the RTS copy held in the RTS storage pool
+ *
+ * @param RtsIndex The RTS index
+ * @returns Size of the RTS, in words
+ */
+static inline uint32 SC_GetRtsSize(SC_RtsIndex_t RtsIndex)
+{
+    return SC_GetRtsPoolBlock(RtsIndex)->Size;
 }
 
 /**
@@ -172,7 +172,7 @@ bool SC_BeginAts(SC_AtsIndex_t AtsIndex, uint16 TimeOffset)
     SC_CommandIndex_t             CmdIndex;        /* ATS command index */
     bool                          ReturnCode;
     SC_AbsTimeTag_t               TimeToStartAts; /* the REAL time to start the ATS */
-    uint16                        CmdsSkipped = 0;
+    uint32                        CmdsSkipped = 0;
     SC_AtsInfoTable_t *           AtsInfoPtr;
     SC_AtsCmdStatusEntry_t *      StatusEntryPtr;
 
@@ -255,7 +255,7 @@ bool SC_BeginAts(SC_AtsIndex_t AtsIndex, uint16 TimeOffset)
 
         /* send an event for number of commands skipped */
         CFE_EVS_SendEvent(SC_ATS_ERR_SKP_DBG_EID, CFE_EVS_EventType_DEBUG, "ATS started, skipped %d commands",
-                          CmdsSkipped);
+                          (int)CmdsSkipped);
         /*
          ** Set the next command time for the ATP
          */
@@ -502,80 +502,122 @@ bool SC_InlineSwitch(void)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void SC_JumpAtsCmd(const SC_JumpAtsCmd_t *Cmd)
 {
-    SC_AtsEntryHeader_t *         Entry;        /* ATS table entry pointer */
-    SC_AtsCmdEntryOffsetRecord_t *CmdOffsetRec; /* ATS entry location in table */
-    SC_AbsTimeTag_t               JumpTime;     /* the time to jump to in the ATS */
-    SC_AbsTimeTag_t               ListCmdTime;  /* list entry execution time */
-    SC_AtsIndex_t                 AtsIndex;     /* index of the ATS that is running */
-    SC_SeqIndex_t                 TimeIndex;    /* the current time buffer index */
-    SC_CommandIndex_t             CmdIndex;     /* ATS command index (cmd num - 1) */
+    SC_AtsEntryHeader_t *         Entry;           /* ATS table entry pointer */
+    SC_AtsCmdEntryOffsetRecord_t *CmdOffsetRec;    /* ATS entry location in table */
+    SC_AbsTimeTag_t               JumpTime;        /* the time to jump to in the ATS */
+    SC_AbsTimeTag_t               ListCmdTime = 0; /* list entry execution time */
+    SC_AtsIndex_t                 AtsIndex;        /* index of the ATS that is running */
+    SC_SeqIndex_t                 CurrIndex;       /* the time buffer index the ATP is at */
+    SC_SeqIndex_t                 TimeIndex;       /* the time buffer index to jump to */
+    SC_SeqIndex_t                 WindowIndex;     /* time buffer index between the two */
+    SC_CommandIndex_t             CmdIndex = SC_COMMAND_IDX_C(0); /* ATS command index (cmd num - 1) */
     char                          TimeBuffer[CFE_TIME_PRINTED_STRING_SIZE];
     CFE_TIME_SysTime_t            NewTime;
-    uint16                        NumSkipped;
+    uint32                        NumSkipped = 0;
+    uint32                        NumReset   = 0;
+    SC_JumpAtsReset_Enum_t        ResetPolicy;
     SC_AtsInfoTable_t *           AtsInfoPtr;
     SC_AtsCmdStatusEntry_t *      StatusEntryPtr;
 
-    if (SC_OperData.AtsCtrlBlckAddr->AtpState == SC_Status_EXECUTING)
+    ResetPolicy = Cmd->Payload.ResetPolicy;
+
+    if (ResetPolicy != SC_JumpAtsReset_NONE && ResetPolicy != SC_JumpAtsReset_SKIPPED &&
+        ResetPolicy != SC_JumpAtsReset_ALL)
+    {
+        CFE_EVS_SendEvent(SC_JUMPATS_CMD_POLICY_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "ATS Jump Failed: invalid reset policy: %u", (unsigned int)ResetPolicy);
+        SC_OperData.HkPacket.Payload.CmdErrCtr++;
+    }
+    else if (SC_OperData.AtsCtrlBlckAddr->AtpState == SC_Status_EXECUTING)
     {
         JumpTime   = Cmd->Payload.NewTime;
         AtsIndex   = SC_AtsNumToIndex(SC_OperData.AtsCtrlBlckAddr->CurrAtsNum);
         AtsInfoPtr = SC_GetAtsInfoObject(AtsIndex);
 
         /*
-         ** Loop through the commands until a time tag is found
-         ** that has a time greater than or equal to the current time OR
-         ** all of the commands have been skipped
+         ** The time index table is sorted, so the new position is found by
+         ** comparing the jump time to the entry the ATP is at now and then
+         ** searching only the part of the table on that side of it
          */
-        TimeIndex  = SC_SEQUENCE_IDX_FIRST;
-        CmdIndex   = SC_COMMAND_IDX_C(0); /* updated in loop */
-        NumSkipped = 0;
-
-        while (SC_IDX_WITHIN_LIMIT(TimeIndex, AtsInfoPtr->NumberOfCommands))
+        CurrIndex = SC_OperData.AtsCtrlBlckAddr->TimeIndexPtr;
+        if (SC_IDX_WITHIN_LIMIT(CurrIndex, AtsInfoPtr->NumberOfCommands))
         {
-            /* first get the cmd index at this list entry */
-            CmdIndex = SC_CommandNumToIndex(SC_GetAtsCommandNumAtSeq(AtsIndex, TimeIndex)->CmdNum);
-            if (!SC_AtsCommandIndexIsValid(CmdIndex))
-            {
-                SC_IDX_INCREMENT(TimeIndex);
-                continue;
-            }
+            TimeIndex = SC_FindAtsSeqForTime(AtsIndex, JumpTime, CurrIndex, SC_IDX_AS_UINT(CurrIndex) + 1);
+        }
+        else
+        {
+            CurrIndex = SC_SEQUENCE_IDX_C(AtsInfoPtr->NumberOfCommands);
+            TimeIndex = CurrIndex;
+        }
 
-            /* then get the entry index from the cmd index table */
-            CmdOffsetRec = SC_GetAtsEntryOffsetForCmd(AtsIndex, CmdIndex);
-            /* then get a pointer to the ATS entry data */
-            Entry = &SC_GetAtsEntryAtOffset(AtsIndex, CmdOffsetRec->Offset)->Header;
-            /* then get cmd execution time from the ATS entry */
-            ListCmdTime = SC_GetAtsEntryTime(Entry);
+        if (!SC_IDX_EQUAL(TimeIndex, CurrIndex))
+        {
+            /* jump forward, the jump time is later than the current entry */
+            TimeIndex = SC_FindAtsSeqForTime(AtsIndex, JumpTime, TimeIndex, AtsInfoPtr->NumberOfCommands);
 
-            /* compare ATS jump time to this list entry time */
-            if (SC_CompareAbsTime(JumpTime, ListCmdTime))
+            /*
+             ** If an ATS command that is jumped over is loaded and ready to run,
+             **  then mark the command as being skipped
+             **  if the command has any other status, SC_Status_SKIPPED, SC_Status_EXECUTED,
+             **   etc, then leave the status alone.
+             */
+            for (WindowIndex = CurrIndex; SC_IDX_WITHIN_LIMIT(WindowIndex, SC_IDX_AS_UINT(TimeIndex));
+                 SC_IDX_INCREMENT(WindowIndex))
             {
-                /* jump time is greater than this list entry time */
-
-                /*
-                ** If the ATS command is loaded and ready to run, then
-                **  mark the command as being skipped
-                **  if the command has any other status, SC_Status_SKIPPED, SC_Status_EXECUTED,
-                **   etc, then leave the status alone.
-                */
-                StatusEntryPtr = SC_GetAtsStatusEntryForCommand(AtsIndex, CmdIndex);
-                if (StatusEntryPtr->Status == SC_Status_LOADED)
+                CmdIndex = SC_CommandNumToIndex(SC_GetAtsCommandNumAtSeq(AtsIndex, WindowIndex)->CmdNum);
+                if (SC_AtsCommandIndexIsValid(CmdIndex))
                 {
-                    StatusEntryPtr->Status = SC_Status_SKIPPED;
-                    NumSkipped++;
+                    StatusEntryPtr = SC_GetAtsStatusEntryForCommand(AtsIndex, CmdIndex);
+                    if (StatusEntryPtr->Status == SC_Status_LOADED)
+                    {
+                        StatusEntryPtr->Status = SC_Status_SKIPPED;
+                        NumSkipped++;
+                    }
                 }
-
-                SC_IDX_INCREMENT(TimeIndex);
             }
-            else
+        }
+        else
+        {
+            /* jump back, or stay, the jump time is at or before the current entry */
+            TimeIndex = SC_FindAtsSeqForTime(AtsIndex, JumpTime, SC_SEQUENCE_IDX_FIRST, SC_IDX_AS_UINT(CurrIndex));
+
+            /*
+             ** Commands jumped back over have already been processed, make them
+             ** eligible to run again as selected by the reset policy
+             */
+            if (ResetPolicy != SC_JumpAtsReset_NONE)
             {
-                /* jump time is less than or equal to this list entry */
-                CFE_EVS_SendEvent(SC_JUMPATS_CMD_LIST_INF_EID, CFE_EVS_EventType_INFORMATION,
-                                  "Jump Cmd: Jump time less than or equal to list entry %u", SC_IDX_AS_UINT(CmdIndex));
-                break;
+                for (WindowIndex = TimeIndex; SC_IDX_WITHIN_LIMIT(WindowIndex, SC_IDX_AS_UINT(CurrIndex));
+                     SC_IDX_INCREMENT(WindowIndex))
+                {
+                    CmdIndex = SC_CommandNumToIndex(SC_GetAtsCommandNumAtSeq(AtsIndex, WindowIndex)->CmdNum);
+                    if (SC_AtsCommandIndexIsValid(CmdIndex))
+                    {
+                        StatusEntryPtr = SC_GetAtsStatusEntryForCommand(AtsIndex, CmdIndex);
+                        if (StatusEntryPtr->Status == SC_Status_SKIPPED ||
+                            (ResetPolicy == SC_JumpAtsReset_ALL && StatusEntryPtr->Status == SC_Status_EXECUTED))
+                        {
+                            StatusEntryPtr->Status = SC_Status_LOADED;
+                            NumReset++;
+                        }
+                    }
+                }
             }
         }
 
+        if (SC_IDX_WITHIN_LIMIT(TimeIndex, AtsInfoPtr->NumberOfCommands))
+        {
+            /* get the command and execution time at the new position */
+            CmdIndex     = SC_CommandNumToIndex(SC_GetAtsCommandNumAtSeq(AtsIndex, TimeIndex)->CmdNum);
+            CmdOffsetRec = SC_GetAtsEntryOffsetForCmd(AtsIndex, CmdIndex);
+            Entry        = &SC_GetAtsEntryAtOffset(AtsIndex, CmdOffsetRec->Offset)->Header;
+            ListCmdTime  = SC_GetAtsEntryTime(Entry);
+
+            /* jump time is less than or equal to this list entry */
+            CFE_EVS_SendEvent(SC_JUMPATS_CMD_LIST_INF_EID, CFE_EVS_EventType_INFORMATION,
+                              "Jump Cmd: Jump time less than or equal to list entry %u", SC_IDX_AS_UINT(CmdIndex));
+        }
+
         /*
          ** Check to see if the whole ATS was skipped
          */
@@ -617,7 +659,12 @@ void SC_JumpAtsCmd(const SC_JumpAtsCmd_t *Cmd)
             {
                 /* We skipped come commands, but not all of them */
                 CFE_EVS_SendEvent(SC_JUMP_ATS_SKIPPED_DBG_EID, CFE_EVS_EventType_DEBUG,
-                                  "Jump Cmd: Skipped %d ATS commands", NumSkipped);
+                                  "Jump Cmd: Skipped %d ATS commands", (int)NumSkipped);
+            }
+            if (NumReset > 0)
+            {
+                CFE_EVS_SendEvent(SC_JUMP_ATS_RESET_DBG_EID, CFE_EVS_EventType_DEBUG,
+                                  "Jump Cmd: Reset %d ATS commands to LOADED", (int)NumReset);
             }
 
         } /* end if */
@@ -632,6 +679,53 @@ void SC_JumpAtsCmd(const SC_JumpAtsCmd_t *Cmd)
     } /* end if */
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Find the first ATS time index entry at or after a given time    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+SC_SeqIndex_t SC_FindAtsSeqForTime(SC_AtsIndex_t AtsIndex, SC_AbsTimeTag_t SearchTime, SC_SeqIndex_t First,
+                                   uint32 Limit)
+{
+    SC_AtsEntryHeader_t *         Entry;        /* ATS table entry pointer */
+    SC_AtsCmdEntryOffsetRecord_t *CmdOffsetRec; /* ATS entry location in table */
+    SC_CommandIndex_t             CmdIndex;     /* ATS command index */
+    uint32                        Low;
+    uint32                        High;
+    uint32                        Middle;
+
+    Low  = SC_IDX_AS_UINT(First);
+    High = Limit;
+
+    /*
+     ** Binary search of the time ordered list for the first entry whose
+     ** time is greater than or equal to the search time.  Entries that do
+     ** not reference a valid command are passed over as if already due.
+     */
+    while (Low < High)
+    {
+        Middle   = Low + ((High - Low) / 2);
+        CmdIndex = SC_CommandNumToIndex(SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_C(Middle))->CmdNum);
+
+        if (SC_AtsCommandIndexIsValid(CmdIndex))
+        {
+            CmdOffsetRec = SC_GetAtsEntryOffsetForCmd(AtsIndex, CmdIndex);
+            Entry        = &SC_GetAtsEntryAtOffset(AtsIndex, CmdOffsetRec->Offset)->Header;
+
+            if (!SC_CompareAbsTime(SearchTime, SC_GetAtsEntryTime(Entry)))
+            {
+                /* search time is less than or equal to this list entry */
+                High = Middle;
+                continue;
+            }
+        }
+
+        Low = Middle + 1;
+    }
+
+    return SC_SEQUENCE_IDX_C(Low);
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Continue ATS on Checksum Failure Cmd                            */
@@ -726,6 +820,333 @@ void SC_AppendAtsCmd(const SC_AppendAtsCmd_t *Cmd)
 
         CFE_EVS_SendEvent(SC_APPEND_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
                           "Append ATS %c command: %d ATS entries appended", SC_IDX_AS_CHAR(AtsIndex),
-                          SC_OperData.HkPacket.Payload.AppendEntryCount);
+                          (int)SC_OperData.HkPacket.Payload.AppendEntryCount);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Report the ATS commands scheduled in a time window              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_QueryAtsWindowCmd(const SC_QueryAtsWindowCmd_t *Cmd)
+{
+    SC_AtsIndex_t                 AtsIndex; /* index (not ID) of target ATS */
+    SC_AtsInfoTable_t *           AtsInfoPtr;
+    SC_SeqIndex_t                 FirstIndex; /* first time buffer index in the window */
+    SC_SeqIndex_t                 EndIndex;   /* time buffer index just past the window */
+    SC_SeqIndex_t                 TimeIndex;
+    SC_CommandIndex_t             CmdIndex;
+    SC_AtsCmdEntryOffsetRecord_t *CmdOffsetRec;
+    SC_AtsEntry_t *               AtsEntry;
+    SC_AtsWindowTlm_Payload_t *   Payload;
+    SC_AtsWindowEntry_t *         WindowEntry;
+    CFE_SB_MsgId_t                MessageID   = CFE_SB_INVALID_MSG_ID;
+    CFE_MSG_FcnCode_t             CommandCode = 0;
+    uint32                        NumPackets  = 0;
+
+    if (!SC_AtsNumIsValid(Cmd->Payload.AtsNum))
+    {
+        SC_OperData.HkPacket.Payload.CmdErrCtr++;
+
+        CFE_EVS_SendEvent(SC_QUERYATS_CMD_INVLD_ID_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Query ATS Window error: invalid ATS ID = %u", SC_IDNUM_AS_UINT(Cmd->Payload.AtsNum));
+
+        return;
     }
+
+    AtsIndex   = SC_AtsNumToIndex(Cmd->Payload.AtsNum);
+    AtsInfoPtr = SC_GetAtsInfoObject(AtsIndex);
+
+    if (AtsInfoPtr->NumberOfCommands == 0)
+    {
+        SC_OperData.HkPacket.Payload.CmdErrCtr++;
+
+        CFE_EVS_SendEvent(SC_QUERYATS_CMD_NOT_LDED_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Query ATS Window error: ATS %c Not Loaded", SC_IDX_AS_CHAR(AtsIndex));
+    }
+    else if (!SC_CompareAbsTime(Cmd->Payload.EndTime, Cmd->Payload.StartTime))
+    {
+        SC_OperData.HkPacket.Payload.CmdErrCtr++;
+
+        CFE_EVS_SendEvent(SC_QUERYATS_CMD_WINDOW_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Query ATS Window error: end time %lu is not after start time %lu",
+                          (unsigned long)Cmd->Payload.EndTime, (unsigned long)Cmd->Payload.StartTime);
+    }
+    else
+    {
+        /* the time index table is sorted, so the window is a contiguous range of it */
+        FirstIndex = SC_FindAtsSeqForTime(AtsIndex, Cmd->Payload.StartTime, SC_SEQUENCE_IDX_FIRST,
+                                          AtsInfoPtr->NumberOfCommands);
+        EndIndex   = SC_FindAtsSeqForTime(AtsIndex, Cmd->Payload.EndTime, FirstIndex, AtsInfoPtr->NumberOfCommands);
+
+        Payload               = &SC_OperData.AtsWindowPacket.Payload;
+        Payload->AtsNum       = Cmd->Payload.AtsNum;
+        Payload->StartTime    = Cmd->Payload.StartTime;
+        Payload->EndTime      = Cmd->Payload.EndTime;
+        Payload->TotalEntries = SC_IDX_AS_UINT(EndIndex) - SC_IDX_AS_UINT(FirstIndex);
+        Payload->FirstEntry   = 0;
+        Payload->NumEntries   = 0;
+
+        /* large windows are cut short to bound the telemetry burst */
+        for (TimeIndex = FirstIndex;
+             SC_IDX_WITHIN_LIMIT(TimeIndex, SC_IDX_AS_UINT(EndIndex)) && (NumPackets < SC_ATS_WINDOW_MAX_PKTS);
+             SC_IDX_INCREMENT(TimeIndex))
+        {
+            WindowEntry = &Payload->Entry[Payload->NumEntries];
+            CmdIndex    = SC_CommandNumToIndex(SC_GetAtsCommandNumAtSeq(AtsIndex, TimeIndex)->CmdNum);
+
+            memset(WindowEntry, 0, sizeof(*WindowEntry));
+
+            if (SC_AtsCommandIndexIsValid(CmdIndex))
+            {
+                CmdOffsetRec = SC_GetAtsEntryOffsetForCmd(AtsIndex, CmdIndex);
+                AtsEntry     = SC_GetAtsEntryAtOffset(AtsIndex, CmdOffsetRec->Offset);
+
+                CFE_MSG_GetMsgId(CFE_MSG_PTR(AtsEntry->Msg), &MessageID);
+                CFE_MSG_GetFcnCode(CFE_MSG_PTR(AtsEntry->Msg), &CommandCode);
+
+                WindowEntry->TimeTag = SC_GetAtsEntryTime(&AtsEntry->Header);
+                WindowEntry->MsgId   = CFE_SB_MsgIdToValue(MessageID);
+                WindowEntry->CmdNum  = SC_CommandIndexToNum(CmdIndex);
+                WindowEntry->FcnCode = CommandCode;
+                WindowEntry->Status  = SC_GetAtsStatusEntryForCommand(AtsIndex, CmdIndex)->Status;
+            }
+
+            Payload->NumEntries++;
+
+            if (Payload->NumEntries == SC_ATS_WINDOW_ENTRIES_PER_PKT)
+            {
+                SC_SendAtsWindowPacket();
+                NumPackets++;
+
+                Payload->FirstEntry += Payload->NumEntries;
+                Payload->NumEntries = 0;
+            }
+        }
+
+        /* send the partly filled last packet, or a single empty one for an empty window */
+        if (Payload->NumEntries > 0 || NumPackets == 0)
+        {
+            SC_SendAtsWindowPacket();
+            NumPackets++;
+        }
+
+        SC_OperData.HkPacket.Payload.CmdCtr++;
+
+        CFE_EVS_SendEvent(SC_QUERYATS_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "Query ATS %c Window: %lu of %lu commands sent in %lu packets", SC_IDX_AS_CHAR(AtsIndex),
+                          (unsigned long)(Payload->FirstEntry + Payload->NumEntries),
+                          (unsigned long)Payload->TotalEntries, (unsigned long)NumPackets);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Send the ATS window packet                                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_SendAtsWindowPacket(void)
+{
+    size_t PacketSize;
+
+    /* only the filled in entries are sent */
+    PacketSize = offsetof(SC_AtsWindowTlm_t, Payload.Entry) +
+                 (SC_OperData.AtsWindowPacket.Payload.NumEntries * sizeof(SC_AtsWindowEntry_t));
+
+    CFE_MSG_SetSize(CFE_MSG_PTR(SC_OperData.AtsWindowPacket.TelemetryHeader), PacketSize);
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(SC_OperData.AtsWindowPacket.TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(SC_OperData.AtsWindowPacket.TelemetryHeader), true);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Start a summary of the ATS command status                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_ReportAtsStatusCmd(const SC_ReportAtsStatusCmd_t *Cmd)
+{
+    SC_AtsIndex_t              AtsIndex; /* index (not ID) of target ATS */
+    SC_AtsInfoTable_t *        AtsInfoPtr;
+    SC_AtsStatusTlm_Payload_t *Payload;
+
+    if (!SC_AtsNumIsValid(Cmd->Payload.AtsNum))
+    {
+        SC_OperData.HkPacket.Payload.CmdErrCtr++;
+
+        CFE_EVS_SendEvent(SC_REPORTATS_CMD_INVLD_ID_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Report ATS Status error: invalid ATS ID = %u", SC_IDNUM_AS_UINT(Cmd->Payload.AtsNum));
+
+        return;
+    }
+
+    AtsIndex   = SC_AtsNumToIndex(Cmd->Payload.AtsNum);
+    AtsInfoPtr = SC_GetAtsInfoObject(AtsIndex);
+
+    if (SC_AppData.AtsStatusJob.Active)
+    {
+        SC_OperData.HkPacket.Payload.CmdErrCtr++;
+
+        CFE_EVS_SendEvent(SC_REPORTATS_CMD_BUSY_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Report ATS Status error: summary of ATS %c in progress",
+                          SC_IDX_AS_CHAR(SC_AppData.AtsStatusJob.AtsIndex));
+    }
+    else if (AtsInfoPtr->NumberOfCommands == 0)
+    {
+        SC_OperData.HkPacket.Payload.CmdErrCtr++;
+
+        CFE_EVS_SendEvent(SC_REPORTATS_CMD_NOT_LDED_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Report ATS Status error: ATS %c Not Loaded", SC_IDX_AS_CHAR(AtsIndex));
+    }
+    else
+    {
+        SC_AppData.AtsStatusJob.Active      = true;
+        SC_AppData.AtsStatusJob.AtsIndex    = AtsIndex;
+        SC_AppData.AtsStatusJob.SeqIndex    = 0;
+        SC_AppData.AtsStatusJob.NumCommands = AtsInfoPtr->NumberOfCommands;
+
+        Payload                = &SC_OperData.AtsStatusPacket.Payload;
+        Payload->AtsNum        = Cmd->Payload.AtsNum;
+        Payload->PacketNum     = 0;
+        Payload->NumRuns       = 0;
+        Payload->LastPacket    = false;
+        Payload->TotalCommands = AtsInfoPtr->NumberOfCommands;
+        Payload->FirstCommand  = 0;
+
+        SC_OperData.HkPacket.Payload.CmdCtr++;
+
+        CFE_EVS_SendEvent(SC_REPORTATS_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "Report ATS %c Status: summarizing %lu commands", SC_IDX_AS_CHAR(AtsIndex),
+                          (unsigned long)Payload->TotalCommands);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Build part of the ATS command status summary                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_ProcessAtsStatusSummary(uint32 MaxEntries)
+{
+    SC_AtsStatusJob_t *        Job     = &SC_AppData.AtsStatusJob;
+    SC_AtsStatusTlm_Payload_t *Payload = &SC_OperData.AtsStatusPacket.Payload;
+    SC_AtsInfoTable_t *        AtsInfoPtr;
+    SC_CommandIndex_t          CmdIndex;
+    SC_Status_Enum_t           Status;
+    uint16                     LastRun;
+    uint32                     Limit;
+    uint32                     Count;
+
+    if (!Job->Active)
+    {
+        return;
+    }
+
+    AtsInfoPtr = SC_GetAtsInfoObject(Job->AtsIndex);
+
+    /* never read past the commands in the time index */
+    Limit = Job->NumCommands;
+    if (AtsInfoPtr->NumberOfCommands < Limit)
+    {
+        Limit = AtsInfoPtr->NumberOfCommands;
+    }
+
+    for (Count = 0; Count < MaxEntries && Job->SeqIndex < Limit; Count++)
+    {
+        CmdIndex = SC_CommandNumToIndex(
+            SC_GetAtsCommandNumAtSeq(Job->AtsIndex, SC_SEQUENCE_IDX_C(Job->SeqIndex))->CmdNum);
+
+        if (SC_AtsCommandIndexIsValid(CmdIndex))
+        {
+            Status = SC_GetAtsStatusEntryForCommand(Job->AtsIndex, CmdIndex)->Status;
+        }
+        else
+        {
+            Status = SC_Status_EMPTY;
+        }
+
+        LastRun = 0;
+        if (Payload->NumRuns > 0)
+        {
+            LastRun = Payload->Run[Payload->NumRuns - 1];
+        }
+
+        if (Payload->NumRuns > 0 && (LastRun >> SC_ATS_STATUS_RUN_STATUS_SHIFT) == Status &&
+            (LastRun & SC_ATS_STATUS_RUN_MAX_LENGTH) < SC_ATS_STATUS_RUN_MAX_LENGTH)
+        {
+            /* same status as the run in progress */
+            Payload->Run[Payload->NumRuns - 1]++;
+        }
+        else
+        {
+            /* start a new run, in a new packet if this one is full */
+            if (Payload->NumRuns == SC_ATS_STATUS_RUNS_PER_PKT)
+            {
+                SC_SendAtsStatusPacket();
+
+                Payload->PacketNum++;
+                Payload->FirstCommand = Job->SeqIndex;
+                Payload->NumRuns      = 0;
+            }
+
+            Payload->Run[Payload->NumRuns] = (uint16)((Status << SC_ATS_STATUS_RUN_STATUS_SHIFT) | 1);
+            Payload->NumRuns++;
+        }
+
+        Job->SeqIndex++;
+    }
+
+    if (Job->SeqIndex >= Limit)
+    {
+        Payload->LastPacket = true;
+        SC_SendAtsStatusPacket();
+
+        Job->Active = false;
+
+        CFE_EVS_SendEvent(SC_REPORTATS_DONE_DBG_EID, CFE_EVS_EventType_DEBUG,
+                          "ATS %c Status summary sent: %lu commands in %u packets", SC_IDX_AS_CHAR(Job->AtsIndex),
+                          (unsigned long)Job->SeqIndex, (unsigned int)Payload->PacketNum + 1);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Stop the ATS command status summary of a changed ATS            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_StopAtsStatusSummary(SC_AtsIndex_t AtsIndex)
+{
+    SC_AtsStatusJob_t *        Job     = &SC_AppData.AtsStatusJob;
+    SC_AtsStatusTlm_Payload_t *Payload = &SC_OperData.AtsStatusPacket.Payload;
+
+    if (Job->Active && SC_IDX_EQUAL(Job->AtsIndex, AtsIndex))
+    {
+        Payload->LastPacket = true;
+        SC_SendAtsStatusPacket();
+
+        Job->Active = false;
+
+        CFE_EVS_SendEvent(SC_REPORTATS_STOP_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "ATS %c Status summary stopped by ATS change: %lu of %lu commands sent",
+                          SC_IDX_AS_CHAR(AtsIndex), (unsigned long)Job->SeqIndex,
+                          (unsigned long)Payload->TotalCommands);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Send the ATS status summary packet                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_SendAtsStatusPacket(void)
+{
+    size_t PacketSize;
+
+    /* only the filled in runs are sent */
+    PacketSize = offsetof(SC_AtsStatusTlm_t, Payload.Run) +
+                 (SC_OperData.AtsStatusPacket.Payload.NumRuns * sizeof(SC_OperData.AtsStatusPacket.Payload.Run[0]));
+
+    CFE_MSG_SetSize(CFE_MSG_PTR(SC_OperData.AtsStatusPacket.TelemetryHeader), PacketSize);
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(SC_OperData.AtsStatusPacket.TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(SC_OperData.AtsStatusPacket.TelemetryHeader), true);
 }
@@ -29,6 +29,7 @@
 #include "cfe.h"
 #include "sc_index_types.h"
 #include "sc_msg.h"
+#include "sc_tbldefs.h"
 
 /**
  * \brief Starts an ATS
@@ -165,22 +166,33 @@ void SC_ServiceSwitchPend(void);
  *         restart the ATS at the time given in the command. Because
  *         there is no restriction on the time given in the command,
  *         the ATP may try to restart the ATS at any time before or
- *         after the current time. In the case of the time tag being
- *         before the current time, ( a backwards jump ) the ATP will
- *         simply skip the commands that have been executed ( or failed
- *         execution ) and end up at the same location as before. In the
- *         case of the jump time being after the current time, the ATP
- *         will skip all commands with time tags less than the jump time
- *         and start executing the ATS at the time equal to the jump
- *         time. If there are no commands with time tags equal to the
- *         jump time, the ATP will set up the ATS to wait for the first
- *         command after the jump time. When a command is skipped while
- *         doing the jump, the command's status is marked as SKIPPED unless
- *         it has already been marked as EXECUTED, FAILED_DISTRIBUTION,
- *         or FAILED_CHECKSUM.
+ *         after the current time. The new position is located with a
+ *         binary search of the time index table, so no part of the ATS
+ *         is reloaded or resorted. In the case of the jump time being
+ *         after the current time, the ATP will skip all commands with
+ *         time tags less than the jump time and start executing the ATS
+ *         at the time equal to the jump time. If there are no commands
+ *         with time tags equal to the jump time, the ATP will set up the
+ *         ATS to wait for the first command after the jump time. When a
+ *         command is skipped while doing the jump, the command's status
+ *         is marked as SKIPPED unless it has already been marked as
+ *         EXECUTED, FAILED_DISTRIBUTION, or FAILED_CHECKSUM.
+ *
+ *         In the case of the time tag being before the current time,
+ *         ( a backwards jump ) the ATP is moved back to the first command
+ *         at or after the jump time. The commands between there and the
+ *         previous ATP position are handled according to the reset policy
+ *         in the command: with #SC_JumpAtsReset_NONE their status is left
+ *         alone and the ATP will simply skip the commands that have been
+ *         executed ( or failed execution ), #SC_JumpAtsReset_SKIPPED
+ *         returns SKIPPED commands to LOADED, and #SC_JumpAtsReset_ALL
+ *         returns both SKIPPED and EXECUTED commands to LOADED so they
+ *         are sent again.
  *
  *  \par Assumptions, External Events, and Notes:
- *        None
+ *        Commands that are reset by a backwards jump have time tags in
+ *        the past, so the ATP sends them as fast as the per-wakeup
+ *        command limit allows.
  *
  *  \param[in] Cmd Pointer to Software Bus buffer
  *
@@ -188,6 +200,28 @@ void SC_ServiceSwitchPend(void);
  */
 void SC_JumpAtsCmd(const SC_JumpAtsCmd_t *Cmd);
 
+/**
+ * \brief Find the position of a time in an ATS
+ *
+ *  \par Description
+ *         Binary searches the time index table of an ATS for the first
+ *         command with a time tag greater than or equal to the given time.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        The time index table entries from First up to Limit are in
+ *        time order
+ *
+ *  \param[in] AtsIndex   ATS array index
+ *  \param[in] SearchTime Absolute time to search for
+ *  \param[in] First      First time index table entry to consider
+ *  \param[in] Limit      One past the last time index table entry to consider
+ *
+ *  \return Time index table entry of the first command at or after
+ *          SearchTime, Limit if there is no such command
+ */
+SC_SeqIndex_t SC_FindAtsSeqForTime(SC_AtsIndex_t AtsIndex, SC_AbsTimeTag_t SearchTime, SC_SeqIndex_t First,
+                                   uint32 Limit);
+
 /**
  * \brief Lets an ATS continue if a command failed the checksum
  *
@@ -223,4 +257,96 @@ void SC_ContinueAtsOnFailureCmd(const SC_ContinueAtsOnFailureCmd_t *Cmd);
  */
 void SC_AppendAtsCmd(const SC_AppendAtsCmd_t *Cmd);
 
+/**
+ * \brief  Query ATS Window Command
+ *
+ *  \par Description
+ *         This function reports the commands of the selected ATS whose
+ *         time tags fall within [StartTime, EndTime).  The window is
+ *         located with a binary search of the ATS time index table and
+ *         its commands are sent in time order as a series of ATS window
+ *         telemetry packets.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        None
+ *
+ *  \param[in] Cmd Pointer to Software Bus buffer
+ *
+ *  \sa #SC_QUERY_ATS_WINDOW_CC
+ */
+void SC_QueryAtsWindowCmd(const SC_QueryAtsWindowCmd_t *Cmd);
+
+/**
+ * \brief  Send the ATS window packet
+ *
+ *  \par Description
+ *         Sends the ATS window telemetry packet, sized to hold only the
+ *         entries that have been filled in.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        None
+ */
+void SC_SendAtsWindowPacket(void);
+
+/**
+ * \brief Report ATS Status Command
+ *
+ *  \par Description
+ *         Starts a run-length encoded summary of the command status of
+ *         every command in the selected ATS, in time order. The summary
+ *         is built and sent a bounded number of entries at a time by
+ *         #SC_ProcessAtsStatusSummary on subsequent wakeups.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        Only one summary may be in progress at a time
+ *
+ *  \param[in] Cmd Pointer to Software Bus buffer
+ *
+ *  \sa #SC_REPORT_ATS_STATUS_CC
+ */
+void SC_ReportAtsStatusCmd(const SC_ReportAtsStatusCmd_t *Cmd);
+
+/**
+ * \brief  Continue an ATS status summary
+ *
+ *  \par Description
+ *         Encodes the status of up to MaxEntries more commands of the ATS
+ *         being summarized, sending each packet as its runs fill up. The
+ *         last packet is flagged and sent once every command is covered.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        Does nothing when no summary is in progress
+ *
+ *  \param[in] MaxEntries Maximum number of commands to encode
+ */
+void SC_ProcessAtsStatusSummary(uint32 MaxEntries);
+
+/**
+ * \brief  Stop an ATS status summary
+ *
+ *  \par Description
+ *         Ends the ATS status summary in progress, if it is of the given
+ *         ATS.  The runs gathered so far are sent in a packet flagged as
+ *         the last one, so the ground is not left waiting for the rest
+ *         of a summary of commands that have since been replaced.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        Called whenever the ATS is reloaded or appended to
+ *
+ *  \param[in] AtsIndex ATS array index
+ */
+void SC_StopAtsStatusSummary(SC_AtsIndex_t AtsIndex);
+
+/**
+ * \brief  Send the ATS status packet
+ *
+ *  \par Description
+ *         Sends the ATS status telemetry packet, sized to hold only the
+ *         runs that have been filled in.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        None
+ */
+void SC_SendAtsStatusPacket(void);
+
 #endif
@@ -34,6 +34,7 @@
 #include "sc_app.h"
 #include "sc_cmds.h"
 #include "sc_atsrq.h"
+#include "sc_dispatch.h"
 #include "sc_rtsrq.h"
 #include "sc_loads.h"
 #include "sc_utils.h"
@@ -41,6 +42,7 @@
 #include "sc_msgids.h"
 #include "sc_events.h"
 #include "sc_version.h"
+#include <string.h>
 
 /**************************************************************************
  **
@@ -65,6 +67,12 @@ void SC_ProcessAtpCmd(void)
     bool                          ChecksumValid;
     SC_AtsCmdEntryOffsetRecord_t *CmdOffsetRec; /* ATS entry location in table */
     SC_AtsCmdStatusEntry_t       *StatusEntryPtr;
+    const CFE_SB_Buffer_t        *LocalCmdPtr = NULL;
+    CFE_TIME_SysTime_t            ScheduledTime;
+    uint8                         CmdErrCtr;
+    SC_Status_Enum_t              LocalStatus;
+
+    SC_BeginPhase(SC_Phase_ATP_DISPATCH);
 
     /*
      ** The following conditions must be met before the ATS command will be
@@ -90,6 +98,10 @@ void SC_ProcessAtpCmd(void)
          */
         if (StatusEntryPtr->Status == SC_Status_LOADED)
         {
+            /* ATS commands are scheduled to the second */
+            ScheduledTime.Seconds    = SC_GetAtsEntryTime(&EntryPtr->Header);
+            ScheduledTime.Subseconds = 0;
+
             /*
              ** Make sure the command number matches what the command
              ** number is supposed to be
@@ -117,8 +129,7 @@ void SC_ProcessAtpCmd(void)
                     /*
                      **  First check to see if the command is a switch command,
                      **  if it is, then execute the command now instead of sending
-                     **  it out on the Software Bus (this is the only exception to
-                     **  way stored commands are sent out).
+                     **  it out on the Software Bus.
                      **  A switch command located within an ATS is handled differently
                      **  than a switch command by the ground controller. If the switch
                      **  command is by the ground controller, SC waits until the next
@@ -143,6 +154,7 @@ void SC_ProcessAtpCmd(void)
                              */
                             StatusEntryPtr->Status = SC_Status_EXECUTED;
                             SC_OperData.HkPacket.Payload.AtsCmdCtr++;
+                            SC_RecordDispatchLatency(SC_Process_ATP, ScheduledTime);
                         }
                         else
                         { /* the switch failed for some reason */
@@ -154,6 +166,19 @@ void SC_ProcessAtpCmd(void)
 
                         } /* end if */
                     }
+                    else if (CFE_SB_MsgIdToValue(MessageID) == SC_CMD_MID)
+                    {
+                        /*
+                         ** Any other command for SC is not sent out on the Software
+                         ** Bus either. Its length was checked when the ATS was loaded,
+                         ** and it is processed once the ATP has moved on to the next
+                         ** command, just as if it had come back through the pipe.
+                         ** It is executing until its handler has run.
+                         */
+                        StatusEntryPtr->Status = SC_Status_EXECUTING;
+
+                        LocalCmdPtr = SC_CopyLocalCmd(CFE_MSG_PTR(EntryPtr->Msg));
+                    }
                     else
                     {
                         Result = CFE_SB_TransmitMsg(CFE_MSG_PTR(EntryPtr->Msg), SC_AppData.EnableHeaderUpdate);
@@ -163,6 +188,7 @@ void SC_ProcessAtpCmd(void)
                             /* The command sent OK */
                             StatusEntryPtr->Status = SC_Status_EXECUTED;
                             SC_OperData.HkPacket.Payload.AtsCmdCtr++;
+                            SC_RecordDispatchLatency(SC_Process_ATP, ScheduledTime);
                         }
                         else
                         { /* the command had Software Bus problems */
@@ -236,6 +262,14 @@ void SC_ProcessAtpCmd(void)
                 /* Mark this ATS for abortion */
                 AbortATS = true;
             } /* end if  the command number does not match */
+
+            /* a local command is traced once its handler has run */
+            if (LocalCmdPtr == NULL)
+            {
+                SC_RecordTrace(SC_Process_ATP, SC_IDNUM_AS_UINT(SC_AtsIndexToNum(AtsIndex)),
+                               SC_IDNUM_AS_UINT(SC_CommandIndexToNum(CmdIndex)), MessageID, CommandCode,
+                               ScheduledTime, StatusEntryPtr->Status);
+            }
         }
         else /* command isn't marked as loaded */
         {
@@ -277,7 +311,43 @@ void SC_ProcessAtpCmd(void)
             SC_GetNextAtsCommand();
         }
 
+        if (LocalCmdPtr != NULL)
+        {
+            CmdErrCtr = SC_OperData.HkPacket.Payload.CmdErrCtr;
+
+            SC_ProcessCommand(LocalCmdPtr);
+
+            /*
+             ** The handler counts a rejected command as a command error.
+             ** The status is left alone if the handler reloaded the ATS.
+             */
+            if (SC_OperData.HkPacket.Payload.CmdErrCtr == CmdErrCtr)
+            {
+                LocalStatus = SC_Status_EXECUTED;
+                SC_OperData.HkPacket.Payload.AtsCmdCtr++;
+                SC_RecordDispatchLatency(SC_Process_ATP, ScheduledTime);
+            }
+            else
+            {
+                LocalStatus = SC_Status_FAILED_DISTRIB;
+                SC_OperData.HkPacket.Payload.AtsCmdErrCtr++;
+                SC_OperData.HkPacket.Payload.LastAtsErrSeq = SC_AtsIndexToNum(AtsIndex);
+                SC_OperData.HkPacket.Payload.LastAtsErrCmd = SC_CommandIndexToNum(CmdIndex);
+            }
+
+            if (StatusEntryPtr->Status == SC_Status_EXECUTING)
+            {
+                StatusEntryPtr->Status = LocalStatus;
+            }
+
+            SC_RecordTrace(SC_Process_ATP, SC_IDNUM_AS_UINT(SC_AtsIndexToNum(AtsIndex)),
+                           SC_IDNUM_AS_UINT(SC_CommandIndexToNum(CmdIndex)), MessageID, CommandCode, ScheduledTime,
+                           LocalStatus);
+        }
+
     } /* end if next ATS command time */
+
+    SC_EndPhase(SC_Phase_ATP_DISPATCH);
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -288,12 +358,20 @@ void SC_ProcessAtpCmd(void)
 
 void SC_ProcessRtpCommand(void)
 {
-    SC_RtsEntry_t     *EntryPtr;  /* a pointer to an RTS entry header */
-    SC_RtsIndex_t      RtsIndex;  /* the RTS index for the cmd */
-    SC_EntryOffset_t   CmdOffset; /* the location of the cmd    */
-    CFE_Status_t       Result;
-    bool               ChecksumValid;
-    SC_RtsInfoEntry_t *RtsInfoPtr;
+    SC_RtsEntry_t      *EntryPtr;  /* a pointer to an RTS entry header */
+    SC_RtsIndex_t       RtsIndex;  /* the RTS index for the cmd */
+    SC_EntryOffset_t    CmdOffset; /* the location of the cmd    */
+    CFE_MSG_Message_t  *MsgPtr;    /* the cmd to send, patched or as stored */
+    CFE_Status_t        Result;
+    bool                ChecksumValid;
+    bool                PatchValid = true;
+    SC_RtsInfoEntry_t  *RtsInfoPtr;
+    SC_RtsStatsEntry_t *RtsStatsPtr;
+    uint32              LateWakeups;
+    CFE_SB_MsgId_t      MessageID   = CFE_SB_INVALID_MSG_ID;
+    CFE_MSG_FcnCode_t   CommandCode = 0;
+    CFE_TIME_SysTime_t  ScheduledTime;
+    SC_Status_Enum_t    TraceStatus = SC_Status_EXECUTED;
 
     /*
      ** The following conditions must be met before a RTS command is executed:
@@ -319,6 +397,58 @@ void SC_ProcessRtpCommand(void)
          */
         SC_OperData.NumCmdsWakeup++;
 
+        /*
+         ** Note how late the command is, and let the other RTSs
+         ** of its priority level have their turns before it again.
+         ** A timed command is late by the whole wakeups since its
+         ** time, any other by the wakeups since its wakeup count.
+         */
+        LateWakeups = 0;
+        if (RtsInfoPtr->TimedFlag)
+        {
+            LateWakeups =
+                SC_ElapsedUsec(RtsInfoPtr->NextCommandTime, SC_AppData.CurrentSysTime) / SC_WAKEUP_PERIOD_USEC;
+        }
+        else if (SC_AppData.CurrentWakeupCount > RtsInfoPtr->NextCommandTgtWakeup)
+        {
+            LateWakeups = SC_AppData.CurrentWakeupCount - RtsInfoPtr->NextCommandTgtWakeup;
+        }
+
+        if (LateWakeups != 0)
+        {
+            RtsStatsPtr = SC_GetRtsStatsObject(RtsIndex);
+
+            RtsInfoPtr->LateCmdCtr++;
+            RtsStatsPtr->LateCmdCtr++;
+            if (LateWakeups > RtsInfoPtr->MaxLateWakeups)
+            {
+                RtsInfoPtr->MaxLateWakeups = LateWakeups;
+            }
+            if (LateWakeups > RtsStatsPtr->MaxLateWakeups)
+            {
+                RtsStatsPtr->MaxLateWakeups = LateWakeups;
+            }
+        }
+
+        SC_AppData.RtsLastServed[SC_GetRtsPriority(RtsIndex)] = RtsIndex;
+
+        /*
+         ** A timed RTS command is due at its own time, any other
+         ** is due at the start of the wakeup of its wakeup count
+         */
+        if (RtsInfoPtr->TimedFlag)
+        {
+            ScheduledTime = RtsInfoPtr->NextCommandTime;
+        }
+        else if (LateWakeups != 0)
+        {
+            ScheduledTime = CFE_TIME_Subtract(SC_AppData.CurrentSysTime, SC_WakeupsToTime(LateWakeups));
+        }
+        else
+        {
+            ScheduledTime = SC_AppData.CurrentSysTime;
+        }
+
         /*
          ** Get the Command offset within the RTS
          */
@@ -335,19 +465,77 @@ void SC_ProcessRtpCommand(void)
             /* If header update is NOT enabled, confirm this table entry has a valid checksum already */
             CFE_MSG_ValidateChecksum(CFE_MSG_PTR(EntryPtr->Msg), &ChecksumValid);
         }
-        if (ChecksumValid)
+
+        /*
+         ** A command with patch entries before it is sent from a
+         ** patched copy, so the RTS stays as it was loaded
+         */
+        MsgPtr = CFE_MSG_PTR(EntryPtr->Msg);
+        if (ChecksumValid && RtsInfoPtr->PatchCount != 0)
+        {
+            MsgPtr     = (CFE_MSG_Message_t *)SC_AppData.RtsPatchBuf;
+            PatchValid = SC_PatchRtsCommand(RtsIndex, CFE_MSG_PTR(EntryPtr->Msg), MsgPtr);
+        }
+
+        if (ChecksumValid && PatchValid)
+        {
+            CFE_MSG_GetMsgId(MsgPtr, &MessageID);
+            CFE_MSG_GetFcnCode(MsgPtr, &CommandCode);
+        }
+
+        if (!PatchValid)
+        {
+            /* the event was sent by the patch, stop the RTS */
+            SC_OperData.HkPacket.Payload.RtsCmdErrCtr++;
+            SC_CountRtsCmdErr(RtsIndex);
+            SC_OperData.HkPacket.Payload.LastRtsErrSeq = SC_OperData.RtsCtrlBlckAddr->CurrRtsNum;
+            SC_OperData.HkPacket.Payload.LastRtsErrCmd = CmdOffset;
+            TraceStatus                                = SC_Status_SKIPPED;
+
+            SC_KillRts(RtsIndex);
+        }
+        else if (ChecksumValid && CFE_SB_MsgIdToValue(MessageID) == SC_CMD_MID &&
+                 (CommandCode == SC_CALL_RTS_CC || CommandCode == SC_CHAIN_RTS_CC))
+        {
+            /*
+             ** Calls and chains between RTSs are carried out here
+             ** rather than taking a trip through the Software Bus.
+             ** A failed one has stopped the RTS, as a failed send would.
+             */
+            if (!SC_ProcessRtsCall(RtsIndex, CommandCode, (const SC_CallRtsCmd_t *)MsgPtr))
+            {
+                TraceStatus = SC_Status_FAILED_DISTRIB;
+            }
+        }
+        else if (ChecksumValid && CFE_SB_MsgIdToValue(MessageID) == SC_CMD_MID)
+        {
+            /*
+             ** Any other command for SC is processed directly, once the
+             ** RTS has moved on to its next command, just as if it had come
+             ** back through the pipe. Its length was checked at load time.
+             */
+            SC_OperData.HkPacket.Payload.RtsCmdCtr++;
+            SC_CountRtsCmd(RtsIndex);
+            SC_RecordDispatchLatency(SC_Process_RTP, ScheduledTime);
+
+            SC_GetNextRtsCommand();
+
+            SC_ProcessCommand(SC_CopyLocalCmd(MsgPtr));
+        }
+        else if (ChecksumValid)
         {
             /*
              ** Try Sending the command on the Software Bus
              */
 
-            Result = CFE_SB_TransmitMsg(CFE_MSG_PTR(EntryPtr->Msg), SC_AppData.EnableHeaderUpdate);
+            Result = CFE_SB_TransmitMsg(MsgPtr, SC_AppData.EnableHeaderUpdate);
 
             if (Result == CFE_SUCCESS)
             {
                 /* the command was sent OK */
                 SC_OperData.HkPacket.Payload.RtsCmdCtr++;
-                RtsInfoPtr->CmdCtr++;
+                SC_CountRtsCmd(RtsIndex);
+                SC_RecordDispatchLatency(SC_Process_RTP, ScheduledTime);
 
                 /*
                  ** Get the next command.
@@ -360,14 +548,18 @@ void SC_ProcessRtpCommand(void)
                 /*
                  ** Send an event message to report the invalid command status
                  */
-                CFE_EVS_SendEvent(SC_RTS_DIST_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "RTS %03u Command Distribution Failed: RTS Stopped. SB returned 0x%08X",
-                                  SC_IDNUM_AS_UINT(SC_OperData.RtsCtrlBlckAddr->CurrRtsNum), (unsigned int)Result);
+                if (!SC_DeferEvent(SC_RTS_DIST_ERR_EID, SC_IDNUM_AS_UINT(SC_OperData.RtsCtrlBlckAddr->CurrRtsNum)))
+                {
+                    CFE_EVS_SendEvent(SC_RTS_DIST_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "RTS %03u Command Distribution Failed: RTS Stopped. SB returned 0x%08X",
+                                      SC_IDNUM_AS_UINT(SC_OperData.RtsCtrlBlckAddr->CurrRtsNum), (unsigned int)Result);
+                }
 
                 SC_OperData.HkPacket.Payload.RtsCmdErrCtr++;
-                RtsInfoPtr->CmdErrCtr++;
+                SC_CountRtsCmdErr(RtsIndex);
                 SC_OperData.HkPacket.Payload.LastRtsErrSeq = SC_OperData.RtsCtrlBlckAddr->CurrRtsNum;
                 SC_OperData.HkPacket.Payload.LastRtsErrCmd = CmdOffset;
+                TraceStatus                                = SC_Status_FAILED_DISTRIB;
 
                 /*
                  ** Stop the RTS from executing
@@ -382,47 +574,107 @@ void SC_ProcessRtpCommand(void)
             /*
              ** Send an event message to report the invalid command status
              */
-            CFE_EVS_SendEvent(SC_RTS_CHKSUM_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "RTS %03u Command Failed Checksum: RTS Stopped",
-                              SC_IDNUM_AS_UINT(SC_OperData.RtsCtrlBlckAddr->CurrRtsNum));
+            if (!SC_DeferEvent(SC_RTS_CHKSUM_ERR_EID, SC_IDNUM_AS_UINT(SC_OperData.RtsCtrlBlckAddr->CurrRtsNum)))
+            {
+                CFE_EVS_SendEvent(SC_RTS_CHKSUM_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "RTS %03u Command Failed Checksum: RTS Stopped",
+                                  SC_IDNUM_AS_UINT(SC_OperData.RtsCtrlBlckAddr->CurrRtsNum));
+            }
             /*
             ** Update the RTS command error counter and last RTS error info
             */
             SC_OperData.HkPacket.Payload.RtsCmdErrCtr++;
-            RtsInfoPtr->CmdErrCtr++;
+            SC_CountRtsCmdErr(RtsIndex);
             SC_OperData.HkPacket.Payload.LastRtsErrSeq = SC_OperData.RtsCtrlBlckAddr->CurrRtsNum;
             SC_OperData.HkPacket.Payload.LastRtsErrCmd = CmdOffset;
+            TraceStatus                                = SC_Status_FAILED_CHECKSUM;
 
             /*
              ** Stop the RTS from executing
              */
             SC_KillRts(RtsIndex);
         } /* end if */
-    }     /* end if */
+
+        SC_RecordTrace(SC_Process_RTP, SC_IDNUM_AS_UINT(SC_RtsIndexToNum(RtsIndex)), SC_IDX_AS_UINT(CmdOffset),
+                       MessageID, CommandCode, ScheduledTime, TraceStatus);
+    } /* end if */
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/*  Sends Housekeeping Data                                        */
+/* Patch the arguments of an RTS into its next command             */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void SC_SendHkPacket(void)
+bool SC_PatchRtsCommand(SC_RtsIndex_t RtsIndex, const CFE_MSG_Message_t *Msg, CFE_MSG_Message_t *PatchedMsg)
 {
-    uint16             i;
-    SC_AtsInfoTable_t *AtsInfoPtr;
-    SC_RtsInfoEntry_t *RtsInfoPtr;
+    SC_RtsInfoEntry_t *             RtsInfoPtr;
+    const SC_RtsPatchCmd_t *        PatchCmd;
+    const SC_RtsPatchCmd_Payload_t *PatchPtr;
+    CFE_MSG_Size_t                  CmdLength = 0;
+    uint16                          i;
+    bool                            Success = true;
 
-    /*
-     ** fill in the free bytes in each ATS
-     */
-    for (i = 0; i < SC_NUMBER_OF_ATS; ++i)
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    CFE_MSG_GetSize(Msg, &CmdLength);
+    memcpy(PatchedMsg, Msg, CmdLength);
+
+    for (i = 0; Success && i < RtsInfoPtr->PatchCount; i++)
     {
-        AtsInfoPtr = SC_GetAtsInfoObject(SC_ATS_IDX_C(i));
+        PatchCmd = (const SC_RtsPatchCmd_t *)&SC_GetRtsEntryAtOffset(RtsIndex, RtsInfoPtr->PatchEntry[i])->Msg;
+        PatchPtr = &PatchCmd->Payload;
+
+        /* the command header is left alone, so a patch can't change what the command is */
+        if (PatchPtr->Length == 0 || (PatchPtr->ArgOffset + PatchPtr->Length) > SC_RTS_ARG_BLOCK_SIZE ||
+            PatchPtr->MsgOffset < sizeof(CFE_MSG_CommandHeader_t) ||
+            (PatchPtr->MsgOffset + PatchPtr->Length) > CmdLength)
+        {
+            CFE_EVS_SendEvent(SC_RTS_PATCH_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "RTS %03u Aborted: Invalid Patch at Offset %u, Arg Offset %u, Cmd Offset %u, Length %u",
+                              SC_IDNUM_AS_UINT(SC_RtsIndexToNum(RtsIndex)),
+                              (unsigned int)SC_IDX_AS_UINT(RtsInfoPtr->PatchEntry[i]),
+                              (unsigned int)PatchPtr->ArgOffset, (unsigned int)PatchPtr->MsgOffset,
+                              (unsigned int)PatchPtr->Length);
+            Success = false;
+        }
+        else
+        {
+            memcpy((uint8 *)PatchedMsg + PatchPtr->MsgOffset, &RtsInfoPtr->Args[PatchPtr->ArgOffset], PatchPtr->Length);
+        }
+    }
 
-        SC_OperData.HkPacket.Payload.AtpFreeBytes[i] =
-            (SC_ATS_BUFF_SIZE32 * SC_BYTES_IN_WORD) - (AtsInfoPtr->AtsSize * SC_BYTES_IN_WORD);
+    if (Success)
+    {
+        CFE_MSG_GenerateChecksum(PatchedMsg);
     }
 
+    return Success;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Copy an SC command out of its ATS or RTS to be processed        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+const CFE_SB_Buffer_t *SC_CopyLocalCmd(const CFE_MSG_Message_t *Msg)
+{
+    CFE_MSG_Size_t CmdLength = 0;
+
+    CFE_MSG_GetSize(Msg, &CmdLength);
+    memcpy(SC_AppData.LocalCmdBuf, Msg, CmdLength);
+
+    return (const CFE_SB_Buffer_t *)SC_AppData.LocalCmdBuf;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/*  Sends Housekeeping Data                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_SendHkPacket(void)
+{
+    SC_BeginPhase(SC_Phase_SEND_HK);
+
     /*
      **
      ** fill in the ATP Control Block information
@@ -438,43 +690,53 @@ void SC_SendHkPacket(void)
     SC_OperData.HkPacket.Payload.NextAtsTime = SC_AppData.NextCmdTime[SC_Process_ATP];
 
     /*
-     ** Fill out the RTP control block information
+     ** Fill out the ATS activation progress
      */
+    SC_OperData.HkPacket.Payload.AtsLoadPhase = SC_AppData.AtsLoadJob.Phase;
 
-    SC_OperData.HkPacket.Payload.NumRtsActive      = SC_OperData.RtsCtrlBlckAddr->NumRtsActive;
-    SC_OperData.HkPacket.Payload.RtsNum            = SC_OperData.RtsCtrlBlckAddr->CurrRtsNum;
-    SC_OperData.HkPacket.Payload.NextRtsWakeupCnt  = SC_AppData.NextCmdTime[SC_Process_RTP];
-
-    /*
-     ** Fill out the RTS status bit mask
-     ** First clear out the status mask
-     */
-    for (i = 0; i < (SC_NUMBER_OF_RTS + (SC_NUMBER_OF_RTS_IN_UINT16 - 1)) / SC_NUMBER_OF_RTS_IN_UINT16; i++)
+    if (SC_AppData.AtsLoadJob.Phase == SC_AtsLoadPhase_IDLE)
     {
-        SC_OperData.HkPacket.Payload.RtsExecutingStatus[i] = 0;
-        SC_OperData.HkPacket.Payload.RtsDisabledStatus[i]  = 0;
-
-    } /* end for */
-
-    for (i = 0; i < SC_NUMBER_OF_RTS; i++)
+        SC_OperData.HkPacket.Payload.AtsLoadAtsNum   = SC_ATS_NUM_NULL;
+        SC_OperData.HkPacket.Payload.AtsLoadProgress = 0;
+    }
+    else
     {
-        RtsInfoPtr = SC_GetRtsInfoObject(SC_RTS_IDX_C(i));
+        SC_OperData.HkPacket.Payload.AtsLoadAtsNum = SC_AtsIndexToNum(SC_AppData.AtsLoadJob.AtsIndex);
 
-        if (RtsInfoPtr->DisabledFlag == true)
+        if (SC_AppData.AtsLoadJob.Phase == SC_AtsLoadPhase_PARSE)
         {
-            SC_OperData.HkPacket.Payload.RtsDisabledStatus[i / SC_NUMBER_OF_RTS_IN_UINT16] |=
-                (1 << (i % SC_NUMBER_OF_RTS_IN_UINT16));
+            SC_OperData.HkPacket.Payload.AtsLoadProgress = SC_AppData.AtsLoadJob.CmdCount;
         }
-        if (RtsInfoPtr->RtsStatus == SC_Status_EXECUTING)
+        else
         {
-            SC_OperData.HkPacket.Payload.RtsExecutingStatus[i / SC_NUMBER_OF_RTS_IN_UINT16] |=
-                (1 << (i % SC_NUMBER_OF_RTS_IN_UINT16));
+            SC_OperData.HkPacket.Payload.AtsLoadProgress = SC_AppData.AtsLoadJob.SortStep;
         }
-    } /* end for */
+    }
+
+    /*
+     ** Fill out the RTS storage pool usage
+     */
+    SC_OperData.HkPacket.Payload.RtsPoolFreeBytes = SC_AppData.RtsPoolFreeWords * SC_BYTES_IN_WORD;
+    SC_OperData.HkPacket.Payload.RtsPoolFragBytes =
+        (SC_AppData.RtsPoolFreeWords - SC_AppData.RtsPoolLargestFree) * SC_BYTES_IN_WORD;
+
+    /*
+     ** Fill out the RTP control block information
+     */
+
+    SC_OperData.HkPacket.Payload.RtsNum            = SC_OperData.RtsCtrlBlckAddr->CurrRtsNum;
+    SC_OperData.HkPacket.Payload.NextRtsWakeupCnt  = SC_AppData.NextCmdTime[SC_Process_RTP];
+
+    /*
+     ** The ATS free bytes, active RTS count and RTS status masks are
+     ** updated as they change, so there is nothing to scan here
+     */
 
     /* send the status packet */
     CFE_SB_TimeStampMsg(CFE_MSG_PTR(SC_OperData.HkPacket.TelemetryHeader));
     CFE_SB_TransmitMsg(CFE_MSG_PTR(SC_OperData.HkPacket.TelemetryHeader), true);
+
+    SC_EndPhase(SC_Phase_SEND_HK);
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -494,7 +756,7 @@ void SC_SendHkCmd(const SC_SendHkCmd_t *Cmd)
         /* make sure the selected auto-exec RTS is enabled */
         if (RtsInfoPtr->RtsStatus == SC_Status_LOADED)
         {
-            RtsInfoPtr->DisabledFlag = false;
+            SC_SetRtsDisabled(SC_RtsNumToIndex(SC_AppData.AutoStartRTS), false);
         }
 
         /* send ground cmd to have SC start the RTS */
@@ -506,6 +768,55 @@ void SC_SendHkCmd(const SC_SendHkCmd_t *Cmd)
 
     /* request from health and safety for housekeeping status */
     SC_SendHkPacket();
+
+    /* the diagnostic statistics go out at the same rate */
+    SC_SendDiagPacket();
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/*  Sends Diagnostic Data                                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_SendDiagPacket(void)
+{
+    uint16            i;
+    SC_LatencyHist_t *HistPtr;
+    SC_PhaseStats_t  *StatsPtr;
+
+    /*
+     ** The mean is only worked out here, from the running sum
+     */
+    for (i = 0; i < 2; i++)
+    {
+        HistPtr = &SC_OperData.DiagPacket.Payload.Latency[i];
+
+        if (HistPtr->Count != 0)
+        {
+            HistPtr->MeanUsec = (uint32)(SC_AppData.LatencySumUsec[i] / HistPtr->Count);
+        }
+        else
+        {
+            HistPtr->MeanUsec = 0;
+        }
+    }
+
+    for (i = 0; i < SC_Phase_MAX; i++)
+    {
+        StatsPtr = &SC_OperData.DiagPacket.Payload.Phase[i];
+
+        if (StatsPtr->Count != 0)
+        {
+            StatsPtr->MeanUsec = (uint32)(SC_AppData.PhaseSumUsec[i] / StatsPtr->Count);
+        }
+        else
+        {
+            StatsPtr->MeanUsec = 0;
+        }
+    }
+
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(SC_OperData.DiagPacket.TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(SC_OperData.DiagPacket.TelemetryHeader), true);
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -528,6 +839,242 @@ void SC_ResetCountersCmd(const SC_ResetCountersCmd_t *Cmd)
     SC_OperData.HkPacket.Payload.RtsActiveErrCtr = 0;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Reset Diagnostics Command                                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_ResetDiagCmd(const SC_ResetDiagCmd_t *Cmd)
+{
+    memset(&SC_OperData.DiagPacket.Payload, 0, sizeof(SC_OperData.DiagPacket.Payload));
+    memset(SC_AppData.LatencySumUsec, 0, sizeof(SC_AppData.LatencySumUsec));
+    memset(SC_AppData.PhaseSumUsec, 0, sizeof(SC_AppData.PhaseSumUsec));
+
+    SC_OperData.HkPacket.Payload.CmdCtr++;
+
+    CFE_EVS_SendEvent(SC_RESET_DIAG_INF_EID, CFE_EVS_EventType_INFORMATION, "Reset diagnostics command");
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Report the next commands due across the ATP and RTP             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_QueryLookaheadCmd(const SC_QueryLookaheadCmd_t *Cmd)
+{
+    SC_LookaheadTlm_Payload_t *Payload;
+    SC_LookaheadEntry_t        Entry;
+    SC_AtsIndex_t              AtsIndex;
+    SC_AtsInfoTable_t *        AtsInfoPtr;
+    SC_SeqIndex_t              TimeIndex;
+    SC_CommandIndex_t          CmdIndex;
+    SC_AtsEntry_t *            AtsEntry;
+    SC_RtsIndex_t              RtsIndex;
+    SC_RtsInfoEntry_t *        RtsInfoPtr;
+    SC_RtsEntry_t *            RtsEntry;
+    CFE_SB_MsgId_t             MessageID;
+    CFE_MSG_FcnCode_t          CommandCode;
+    size_t                     PacketSize;
+    uint32                     WakeupDelta;
+    uint16                     NumEntries;
+    uint16                     i;
+
+    NumEntries = Cmd->Payload.NumEntries;
+
+    if (NumEntries == 0 || NumEntries > SC_LOOKAHEAD_ENTRIES)
+    {
+        SC_OperData.HkPacket.Payload.CmdErrCtr++;
+
+        CFE_EVS_SendEvent(SC_LOOKAHEAD_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Query Lookahead error: %u commands asked for, must be 1 to %d", (unsigned int)NumEntries,
+                          SC_LOOKAHEAD_ENTRIES);
+    }
+    else
+    {
+        Payload                = &SC_OperData.LookaheadPacket.Payload;
+        Payload->CurrentTime   = SC_AppData.CurrentTime;
+        Payload->CurrentWakeup = SC_AppData.CurrentWakeupCount;
+        Payload->NumEntries    = 0;
+
+        /*
+         ** The ATS time index table is in time order, so only as many
+         ** commands as were asked for are needed from it, starting at
+         ** the one the ATP sends next. Commands the ATP would skip are
+         ** left out.
+         */
+        if (SC_OperData.AtsCtrlBlckAddr->AtpState == SC_Status_EXECUTING)
+        {
+            AtsIndex   = SC_AtsNumToIndex(SC_OperData.AtsCtrlBlckAddr->CurrAtsNum);
+            AtsInfoPtr = SC_GetAtsInfoObject(AtsIndex);
+
+            for (TimeIndex = SC_OperData.AtsCtrlBlckAddr->TimeIndexPtr;
+                 SC_IDX_WITHIN_LIMIT(TimeIndex, AtsInfoPtr->NumberOfCommands) && Payload->NumEntries < NumEntries;
+                 SC_IDX_INCREMENT(TimeIndex))
+            {
+                CmdIndex = SC_CommandNumToIndex(SC_GetAtsCommandNumAtSeq(AtsIndex, TimeIndex)->CmdNum);
+
+                if (SC_AtsCommandIndexIsValid(CmdIndex) &&
+                    SC_GetAtsStatusEntryForCommand(AtsIndex, CmdIndex)->Status == SC_Status_LOADED)
+                {
+                    AtsEntry = SC_GetAtsEntryAtOffset(AtsIndex, SC_GetAtsEntryOffsetForCmd(AtsIndex, CmdIndex)->Offset);
+
+                    MessageID   = CFE_SB_INVALID_MSG_ID;
+                    CommandCode = 0;
+                    CFE_MSG_GetMsgId(CFE_MSG_PTR(AtsEntry->Msg), &MessageID);
+                    CFE_MSG_GetFcnCode(CFE_MSG_PTR(AtsEntry->Msg), &CommandCode);
+
+                    memset(&Entry, 0, sizeof(Entry));
+                    Entry.DueTime   = SC_GetAtsEntryTime(&AtsEntry->Header);
+                    Entry.MsgId     = CFE_SB_MsgIdToValue(MessageID);
+                    Entry.CmdId     = SC_IDNUM_AS_UINT(SC_CommandIndexToNum(CmdIndex));
+                    Entry.SourceNum = SC_IDNUM_AS_UINT(SC_OperData.AtsCtrlBlckAddr->CurrAtsNum);
+                    Entry.Process   = SC_Process_ATP;
+                    Entry.FcnCode   = CommandCode;
+
+                    if (Entry.DueTime > SC_AppData.CurrentTime)
+                    {
+                        Entry.DueDelta = Entry.DueTime - SC_AppData.CurrentTime;
+                    }
+
+                    SC_InsertLookaheadEntry(&Entry, NumEntries);
+                }
+            }
+        }
+
+        /*
+         ** Each executing RTS adds the command it sends next, which
+         ** SC_SeekRtsCommand has already found along with when it is
+         ** due. An RTS waiting on an RTS it called has nothing due.
+         */
+        for (i = 0; i < SC_NUMBER_OF_RTS; i++)
+        {
+            RtsIndex   = SC_RTS_IDX_C(i);
+            RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+            if (RtsInfoPtr->RtsStatus == SC_Status_EXECUTING && RtsInfoPtr->NextCommandTgtWakeup != SC_MAX_WAKEUP_CNT)
+            {
+                RtsEntry = SC_GetRtsEntryAtOffset(RtsIndex, RtsInfoPtr->NextCommandPtr);
+
+                MessageID   = CFE_SB_INVALID_MSG_ID;
+                CommandCode = 0;
+                CFE_MSG_GetMsgId(CFE_MSG_PTR(RtsEntry->Msg), &MessageID);
+                CFE_MSG_GetFcnCode(CFE_MSG_PTR(RtsEntry->Msg), &CommandCode);
+
+                memset(&Entry, 0, sizeof(Entry));
+                Entry.MsgId     = CFE_SB_MsgIdToValue(MessageID);
+                Entry.CmdId     = SC_IDX_AS_UINT(RtsInfoPtr->NextCommandPtr);
+                Entry.SourceNum = SC_IDNUM_AS_UINT(SC_RtsIndexToNum(RtsIndex));
+                Entry.Process   = SC_Process_RTP;
+                Entry.FcnCode   = CommandCode;
+
+                if (RtsInfoPtr->TimedFlag)
+                {
+                    Entry.DueTime = RtsInfoPtr->NextCommandTime.Seconds;
+                    if (Entry.DueTime > SC_AppData.CurrentTime)
+                    {
+                        Entry.DueDelta = Entry.DueTime - SC_AppData.CurrentTime;
+                    }
+                }
+                else
+                {
+                    Entry.DueWakeup = RtsInfoPtr->NextCommandTgtWakeup;
+                    if (Entry.DueWakeup > SC_AppData.CurrentWakeupCount)
+                    {
+                        /* in seconds like the other entries, a part of a second still to go counts as one */
+                        WakeupDelta    = Entry.DueWakeup - SC_AppData.CurrentWakeupCount;
+                        Entry.DueDelta = WakeupDelta / SC_WAKEUPS_PER_SECOND;
+                        if ((WakeupDelta % SC_WAKEUPS_PER_SECOND) != 0)
+                        {
+                            Entry.DueDelta++;
+                        }
+                    }
+                }
+
+                SC_InsertLookaheadEntry(&Entry, NumEntries);
+            }
+        }
+
+        /* only the filled in entries are sent */
+        PacketSize = offsetof(SC_LookaheadTlm_t, Payload.Entry) + (Payload->NumEntries * sizeof(SC_LookaheadEntry_t));
+
+        CFE_MSG_SetSize(CFE_MSG_PTR(SC_OperData.LookaheadPacket.TelemetryHeader), PacketSize);
+        CFE_SB_TimeStampMsg(CFE_MSG_PTR(SC_OperData.LookaheadPacket.TelemetryHeader));
+        CFE_SB_TransmitMsg(CFE_MSG_PTR(SC_OperData.LookaheadPacket.TelemetryHeader), true);
+
+        SC_OperData.HkPacket.Payload.CmdCtr++;
+
+        CFE_EVS_SendEvent(SC_LOOKAHEAD_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "Query Lookahead: %u commands sent", (unsigned int)Payload->NumEntries);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Add a command to the lookahead packet in due order              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_InsertLookaheadEntry(const SC_LookaheadEntry_t *Entry, uint16 MaxEntries)
+{
+    SC_LookaheadTlm_Payload_t *Payload;
+    uint16                     Position;
+    uint16                     NumMoved;
+
+    Payload = &SC_OperData.LookaheadPacket.Payload;
+
+    /* go past every entry due no later, so ties keep the order they were added in */
+    Position = Payload->NumEntries;
+    while (Position > 0 && Payload->Entry[Position - 1].DueDelta > Entry->DueDelta)
+    {
+        Position--;
+    }
+
+    if (Position < MaxEntries)
+    {
+        /* when the packet is full the last entry falls off the end */
+        if (Payload->NumEntries < MaxEntries)
+        {
+            NumMoved = Payload->NumEntries - Position;
+            Payload->NumEntries++;
+        }
+        else
+        {
+            NumMoved = MaxEntries - 1 - Position;
+        }
+
+        memmove(&Payload->Entry[Position + 1], &Payload->Entry[Position], NumMoved * sizeof(SC_LookaheadEntry_t));
+        Payload->Entry[Position] = *Entry;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Set Event Mode Command                                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_SetEventModeCmd(const SC_SetEventModeCmd_t *Cmd)
+{
+    SC_EventMode_Enum_t Mode;
+
+    Mode = Cmd->Payload.Mode;
+
+    if (Mode != SC_EventMode_IMMEDIATE && Mode != SC_EventMode_DEFERRED)
+    {
+        SC_OperData.HkPacket.Payload.CmdErrCtr++;
+
+        CFE_EVS_SendEvent(SC_EVENT_MODE_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Set Event Mode command failed, invalid mode: %lu", (unsigned long)Mode);
+    }
+    else
+    {
+        SC_OperData.HkPacket.Payload.EventMode = Mode;
+
+        SC_OperData.HkPacket.Payload.CmdCtr++;
+
+        CFE_EVS_SendEvent(SC_EVENT_MODE_CMD_INF_EID, CFE_EVS_EventType_INFORMATION, "Set Event Mode command, Mode: %lu",
+                          (unsigned long)Mode);
+    }
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Wakeup Command                                                  */
@@ -536,7 +1083,12 @@ void SC_ResetCountersCmd(const SC_ResetCountersCmd_t *Cmd)
 void SC_WakeupCmd(const SC_WakeupCmd_t *Cmd)
 {
     uint32 CurrentNumCmds;
+    bool   RtpFirst;
+
+    SC_BeginPhase(SC_Phase_WAKEUP);
+
     SC_AppData.CurrentWakeupCount++;
+    SC_AppData.InWakeup = true;
 
     /*
      * Time to execute a command in the SC memory
@@ -553,12 +1105,33 @@ void SC_WakeupCmd(const SC_WakeupCmd_t *Cmd)
             SC_ServiceSwitchPend();
         }
 
-        SC_ProcessAtpCmd();
+        SC_GetNextRtsTime();
+
+        /*
+         * An RTS at a priority level over the ATP goes first,
+         * any other only when the ATP has nothing to send
+         */
+        RtpFirst = false;
+#if (SC_RTS_PRIORITY_OVER_ATP > 0)
+        if (SC_RtsNumIsValid(SC_OperData.RtsCtrlBlckAddr->CurrRtsNum))
+        {
+            RtpFirst = (SC_GetRtsPriority(SC_RtsNumToIndex(SC_OperData.RtsCtrlBlckAddr->CurrRtsNum)) <
+                        SC_RTS_PRIORITY_OVER_ATP);
+        }
+#endif
+
+        if (RtpFirst)
+        {
+            SC_ProcessRtpCommand();
+        }
+
+        if (CurrentNumCmds == SC_OperData.NumCmdsWakeup)
+        {
+            SC_ProcessAtpCmd();
+        }
 
         if (CurrentNumCmds == SC_OperData.NumCmdsWakeup)
         {
-            SC_GetNextRtsTime();
-            
             SC_ProcessRtpCommand();
         }
         
@@ -571,7 +1144,20 @@ void SC_WakeupCmd(const SC_WakeupCmd_t *Cmd)
         }
     }
 
+    /*
+     * Use the rest of the wakeup to activate a newly loaded ATS
+     */
+    SC_ProcessAtsLoad(SC_ATS_LOAD_ENTRIES_PER_WAKEUP);
+
+    /*
+     * Continue any ATS status summary that was requested
+     */
+    SC_ProcessAtsStatusSummary(SC_ATS_STATUS_ENTRIES_PER_WAKEUP);
+
     SC_OperData.NumCmdsWakeup = 0;
+    SC_AppData.InWakeup       = false;
+
+    SC_EndPhase(SC_Phase_WAKEUP);
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -607,6 +1193,10 @@ void SC_ManageTableCmd(const SC_ManageTableCmd_t *Cmd)
     {
         SC_ManageTable(APPEND, -1);
     }
+    else if (TableID == SC_TBL_ID_TRIGGER)
+    {
+        SC_ManageTable(TRIGGER, -1);
+    }
     else if ((TableID >= SC_TBL_ID_RTS_0) && (TableID < (SC_TBL_ID_RTS_0 + SC_NUMBER_OF_RTS)))
     {
         ArrayIndex = TableID - SC_TBL_ID_RTS_0;
@@ -638,6 +1228,16 @@ void SC_ManageTableCmd(const SC_ManageTableCmd_t *Cmd)
         ArrayIndex = TableID - SC_TBL_ID_ATS_CMD_0;
         CFE_TBL_Manage(SC_OperData.AtsCmdStatusHandle[ArrayIndex]);
     }
+    else if (TableID == SC_TBL_ID_TRACE)
+    {
+        /* No need to release dump only table pointer */
+        CFE_TBL_Manage(SC_OperData.TraceTblHandle);
+    }
+    else if (TableID == SC_TBL_ID_RTS_STATS)
+    {
+        /* No need to release dump only table pointer */
+        CFE_TBL_Manage(SC_OperData.RtsStatsHandle);
+    }
     else
     {
         /* Invalid table ID */
@@ -698,6 +1298,7 @@ void SC_ManageTable(SC_TableType type, int32 ArrayIndex)
     CFE_TBL_Handle_t TblHandle;
     uint32         **TblAddr;
     void            *TblPtrNew;
+    SC_AtsIndex_t    AtsIndex;
 
     switch (type)
     {
@@ -709,6 +1310,10 @@ void SC_ManageTable(SC_TableType type, int32 ArrayIndex)
             TblHandle = SC_OperData.RtsTblHandle[ArrayIndex];
             TblAddr   = &SC_OperData.RtsTblAddr[ArrayIndex];
             break;
+        case TRIGGER:
+            TblHandle = SC_OperData.TriggerTblHandle;
+            TblAddr   = (uint32 **)&SC_OperData.TriggerTblAddr;
+            break;
         case APPEND:
         default:
             TblHandle = SC_OperData.AppendTblHandle;
@@ -730,12 +1335,29 @@ void SC_ManageTable(SC_TableType type, int32 ArrayIndex)
         /* Process new table data */
         if (type == ATS)
         {
-            SC_LoadAts(SC_ATS_IDX_C(ArrayIndex));
+            AtsIndex = SC_ATS_IDX_C(ArrayIndex);
+
+            /* the ATP must never see a partially built ATS, so one it is using is activated right away */
+            if ((SC_OperData.AtsCtrlBlckAddr->AtpState != SC_Status_IDLE) &&
+                (SC_IDNUM_EQUAL(SC_OperData.AtsCtrlBlckAddr->CurrAtsNum, SC_AtsIndexToNum(AtsIndex)) ||
+                 (SC_OperData.AtsCtrlBlckAddr->SwitchPendFlag && SC_IDX_EQUAL(SC_ToggleAtsIndex(), AtsIndex))))
+            {
+                SC_LoadAts(AtsIndex);
+            }
+            else
+            {
+                /* the ATS is activated during the following wakeups */
+                SC_BeginAtsLoad(AtsIndex);
+            }
         }
         else if (type == RTS)
         {
             SC_LoadRts(SC_RTS_IDX_C(ArrayIndex));
         }
+        else if (type == TRIGGER)
+        {
+            SC_UpdateTriggers();
+        }
         else
         {
             SC_UpdateAppend();
@@ -756,6 +1378,11 @@ void SC_ManageTable(SC_TableType type, int32 ArrayIndex)
                               "RTS table manage process error: RTS = %u, Result = 0x%X",
                               SC_IDNUM_AS_UINT(SC_RtsIndexToNum(SC_RTS_IDX_C(ArrayIndex))), (unsigned int)Result);
         }
+        else if (type == TRIGGER)
+        {
+            CFE_EVS_SendEvent(SC_TABLE_MANAGE_TRIGGER_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Trigger table manage process error: Result = 0x%X", (unsigned int)Result);
+        }
         else
         {
             CFE_EVS_SendEvent(SC_TABLE_MANAGE_APPEND_ERR_EID, CFE_EVS_EventType_ERROR,
@@ -26,13 +26,15 @@
 #define SC_CMDS_H
 
 #include "common_types.h"
+#include "sc_index_types.h"
 #include "sc_msg.h"
 
 typedef enum
 {
     ATS,
     RTS,
-    APPEND
+    APPEND,
+    TRIGGER
 } SC_TableType;
 
 /**
@@ -139,6 +141,73 @@ void SC_NoopCmd(const SC_NoopCmd_t *Cmd);
  */
 void SC_ResetCountersCmd(const SC_ResetCountersCmd_t *Cmd);
 
+/**
+ * \brief Reset Diagnostics Command
+ *
+ *  \par Description
+ *       Clears the dispatch latency statistics of the diagnostic packet
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        None
+ *
+ *  \param[in] Cmd Pointer to Software Bus buffer
+ *
+ *  \sa #SC_RESET_DIAG_CC
+ */
+void SC_ResetDiagCmd(const SC_ResetDiagCmd_t *Cmd);
+
+/**
+ * \brief Query Lookahead Command
+ *
+ *  \par Description
+ *       Reports the next commands due from the executing ATS and
+ *       RTSs, in the order they are due, in the lookahead packet
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        The packet is built from the ATP control block, the ATS time
+ *        index table and the RTS info table, nothing is copied
+ *
+ *  \param[in] Cmd Pointer to Software Bus buffer
+ *
+ *  \sa #SC_QUERY_LOOKAHEAD_CC
+ */
+void SC_QueryLookaheadCmd(const SC_QueryLookaheadCmd_t *Cmd);
+
+/**
+ * \brief Add a command to the lookahead packet
+ *
+ *  \par Description
+ *       Inserts the command among the lookahead packet entries so they
+ *       stay in the order they are due.  Commands due at the same time
+ *       stay in the order they were added.  When MaxEntries are already
+ *       held, the last one is dropped to make room, or the command is
+ *       not added if it is due after all of them.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        None
+ *
+ *  \param[in] Entry      The command to add
+ *  \param[in] MaxEntries The most entries the packet is to hold
+ */
+void SC_InsertLookaheadEntry(const SC_LookaheadEntry_t *Entry, uint16 MaxEntries);
+
+/**
+ * \brief Set Event Mode Command
+ *
+ *  \par Description
+ *       Selects whether RTS start and completion events are sent as
+ *       they happen or summarized
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        Events already queued are still summarized when SC finishes
+ *        with this command
+ *
+ *  \param[in] Cmd Pointer to Software Bus buffer
+ *
+ *  \sa #SC_SET_EVENT_MODE_CC
+ */
+void SC_SetEventModeCmd(const SC_SetEventModeCmd_t *Cmd);
+
 /**
  * \brief Send Hk Packet to the ground
  *
@@ -152,6 +221,18 @@ void SC_ResetCountersCmd(const SC_ResetCountersCmd_t *Cmd);
  */
 void SC_SendHkPacket(void);
 
+/**
+ * \brief Send Diagnostic Packet to the ground
+ *
+ *  \par Description
+ *       This routine works out the mean dispatch latencies and sends
+ *       the diagnostic packet over the software bus.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        None
+ */
+void SC_SendDiagPacket(void);
+
 void SC_SendHkCmd(const SC_SendHkCmd_t *Cmd);
 void SC_WakeupCmd(const SC_WakeupCmd_t *Cmd);
 
@@ -186,4 +267,45 @@ void SC_ProcessAtpCmd(void);
  */
 void SC_ProcessRtpCommand(void);
 
+/**
+ * \brief Patch the arguments of an RTS into its next command
+ *
+ *  \par Description
+ *        Copies the command into the RTS patch buffer, applies the
+ *        #SC_RTS_PATCH_CC entries found before it to the copy, and
+ *        computes the checksum of the copy again.  The RTS itself is
+ *        not changed.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        The command length is known to be valid.
+ *
+ *  \param [in]    RtsIndex   RTS index the command belongs to (base zero)
+ *  \param [in]    Msg        The command as stored in the RTS
+ *  \param [out]   PatchedMsg Buffer for the patched command, at least
+ *                            #SC_PACKET_MAX_SIZE bytes
+ *
+ *  \return Boolean success
+ *  \retval true  PatchedMsg holds the patched command
+ *  \retval false A patch entry was out of range, an event was sent
+ */
+bool SC_PatchRtsCommand(SC_RtsIndex_t RtsIndex, const CFE_MSG_Message_t *Msg, CFE_MSG_Message_t *PatchedMsg);
+
+/**
+ * \brief Copy an SC command out of its ATS or RTS to be processed
+ *
+ *  \par Description
+ *        Copies an SC command found in an ATS or RTS into the local
+ *        command buffer, so it can be processed directly.  Processing
+ *        it may reload the ATS table or compact the RTS storage pool it
+ *        came from, which would change the command under its handler.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        The command length was checked when its ATS or RTS was loaded.
+ *
+ *  \param [in]    Msg        The command as stored in the ATS or RTS
+ *
+ *  \return Pointer to the copy of the command
+ */
+const CFE_SB_Buffer_t *SC_CopyLocalCmd(const CFE_MSG_Message_t *Msg);
+
 #endif
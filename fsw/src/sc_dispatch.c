@@ -78,6 +78,141 @@ bool SC_VerifyCmdLength(const CFE_MSG_Message_t *Msg, size_t ExpectedLength)
     return (Result);
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* SC Get the expected length of a command                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+size_t SC_GetCmdLength(CFE_MSG_FcnCode_t CommandCode)
+{
+    size_t ExpectedLength;
+
+    switch (CommandCode)
+    {
+        case SC_NOOP_CC:
+            ExpectedLength = sizeof(SC_NoopCmd_t);
+            break;
+
+        case SC_RESET_COUNTERS_CC:
+            ExpectedLength = sizeof(SC_ResetCountersCmd_t);
+            break;
+
+        case SC_START_ATS_CC:
+            ExpectedLength = sizeof(SC_StartAtsCmd_t);
+            break;
+
+        case SC_STOP_ATS_CC:
+            ExpectedLength = sizeof(SC_StopAtsCmd_t);
+            break;
+
+        case SC_START_RTS_CC:
+            ExpectedLength = sizeof(SC_StartRtsCmd_t);
+            break;
+
+        case SC_STOP_RTS_CC:
+            ExpectedLength = sizeof(SC_StopRtsCmd_t);
+            break;
+
+        case SC_DISABLE_RTS_CC:
+            ExpectedLength = sizeof(SC_DisableRtsCmd_t);
+            break;
+
+        case SC_ENABLE_RTS_CC:
+            ExpectedLength = sizeof(SC_EnableRtsCmd_t);
+            break;
+
+        case SC_SWITCH_ATS_CC:
+            ExpectedLength = sizeof(SC_SwitchAtsCmd_t);
+            break;
+
+        case SC_JUMP_ATS_CC:
+            ExpectedLength = sizeof(SC_JumpAtsCmd_t);
+            break;
+
+        case SC_CONTINUE_ATS_ON_FAILURE_CC:
+            ExpectedLength = sizeof(SC_ContinueAtsOnFailureCmd_t);
+            break;
+
+        case SC_APPEND_ATS_CC:
+            ExpectedLength = sizeof(SC_AppendAtsCmd_t);
+            break;
+
+        case SC_MANAGE_TABLE_CC:
+            ExpectedLength = sizeof(SC_ManageTableCmd_t);
+            break;
+
+        case SC_START_RTS_GRP_CC:
+            ExpectedLength = sizeof(SC_StartRtsGrpCmd_t);
+            break;
+
+        case SC_STOP_RTS_GRP_CC:
+            ExpectedLength = sizeof(SC_StopRtsGrpCmd_t);
+            break;
+
+        case SC_DISABLE_RTS_GRP_CC:
+            ExpectedLength = sizeof(SC_DisableRtsGrpCmd_t);
+            break;
+
+        case SC_ENABLE_RTS_GRP_CC:
+            ExpectedLength = sizeof(SC_EnableRtsGrpCmd_t);
+            break;
+
+        case SC_QUERY_ATS_WINDOW_CC:
+            ExpectedLength = sizeof(SC_QueryAtsWindowCmd_t);
+            break;
+
+        case SC_REPORT_ATS_STATUS_CC:
+            ExpectedLength = sizeof(SC_ReportAtsStatusCmd_t);
+            break;
+
+        case SC_START_RTS_INSTANCE_CC:
+            ExpectedLength = sizeof(SC_StartRtsInstanceCmd_t);
+            break;
+
+        case SC_START_RTS_PARAM_CC:
+            ExpectedLength = sizeof(SC_StartRtsParamCmd_t);
+            break;
+
+        case SC_START_RTS_SET_CC:
+            ExpectedLength = sizeof(SC_StartRtsSetCmd_t);
+            break;
+
+        case SC_STOP_RTS_SET_CC:
+            ExpectedLength = sizeof(SC_StopRtsSetCmd_t);
+            break;
+
+        case SC_DISABLE_RTS_SET_CC:
+            ExpectedLength = sizeof(SC_DisableRtsSetCmd_t);
+            break;
+
+        case SC_ENABLE_RTS_SET_CC:
+            ExpectedLength = sizeof(SC_EnableRtsSetCmd_t);
+            break;
+
+        case SC_SET_RTS_PRIORITY_CC:
+            ExpectedLength = sizeof(SC_SetRtsPriorityCmd_t);
+            break;
+
+        case SC_RESET_DIAG_CC:
+            ExpectedLength = sizeof(SC_ResetDiagCmd_t);
+            break;
+
+        case SC_QUERY_LOOKAHEAD_CC:
+            ExpectedLength = sizeof(SC_QueryLookaheadCmd_t);
+            break;
+
+        case SC_SET_EVENT_MODE_CC:
+            ExpectedLength = sizeof(SC_SetEventModeCmd_t);
+            break;
+
+        default:
+            ExpectedLength = 0;
+            break;
+    } /* end switch */
+
+    return ExpectedLength;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /*  Process Requests                                               */
@@ -123,6 +258,11 @@ void SC_ProcessRequest(const CFE_SB_Buffer_t *BufPtr)
             SC_OperData.HkPacket.Payload.CmdErrCtr++;
             break;
     } /* end switch */
+
+    /*
+     ** Report the events queued while handling this message
+     */
+    SC_FlushDeferredEvents();
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -134,139 +274,150 @@ void SC_ProcessCommand(const CFE_SB_Buffer_t *BufPtr)
 {
     CFE_MSG_FcnCode_t CommandCode = 0;
     CFE_SB_MsgId_t    MessageID   = CFE_SB_INVALID_MSG_ID;
+    size_t            ExpectedLength;
 
     CFE_MSG_GetMsgId(&BufPtr->Msg, &MessageID);
     CFE_MSG_GetFcnCode(&BufPtr->Msg, &CommandCode);
 
-    switch (CommandCode)
+    /* the lengths are kept in one place, the same one an ATS or RTS load is checked against */
+    ExpectedLength = SC_GetCmdLength(CommandCode);
+
+    if (ExpectedLength == 0)
     {
-        case SC_NOOP_CC:
-            if (SC_VerifyCmdLength(&BufPtr->Msg, sizeof(SC_NoopCmd_t)))
-            {
+        CFE_EVS_SendEvent(SC_CC_ERR_EID, CFE_EVS_EventType_ERROR, "Invalid Command Code: MID =  0x%08lX CC =  %d",
+                          (unsigned long)CFE_SB_MsgIdToValue(MessageID), CommandCode);
+        SC_OperData.HkPacket.Payload.CmdErrCtr++;
+    }
+    else if (!SC_VerifyCmdLength(&BufPtr->Msg, ExpectedLength))
+    {
+        if (CommandCode == SC_START_RTS_CC)
+        {
+            SC_OperData.HkPacket.Payload.RtsActiveErrCtr++;
+        }
+    }
+    else
+    {
+        switch (CommandCode)
+        {
+            case SC_NOOP_CC:
                 SC_NoopCmd((const SC_NoopCmd_t *)BufPtr);
-            }
-            break;
+                break;
 
-        case SC_RESET_COUNTERS_CC:
-            if (SC_VerifyCmdLength(&BufPtr->Msg, sizeof(SC_ResetCountersCmd_t)))
-            {
+            case SC_RESET_COUNTERS_CC:
                 SC_ResetCountersCmd((const SC_ResetCountersCmd_t *)BufPtr);
-            }
-            break;
+                break;
 
-        case SC_START_ATS_CC:
-            if (SC_VerifyCmdLength(&BufPtr->Msg, sizeof(SC_StartAtsCmd_t)))
-            {
+            case SC_START_ATS_CC:
                 SC_StartAtsCmd((const SC_StartAtsCmd_t *)BufPtr);
-            }
-            break;
+                break;
 
-        case SC_STOP_ATS_CC:
-            if (SC_VerifyCmdLength(&BufPtr->Msg, sizeof(SC_StopAtsCmd_t)))
-            {
+            case SC_STOP_ATS_CC:
                 SC_StopAtsCmd((const SC_StopAtsCmd_t *)BufPtr);
-            }
-            break;
+                break;
 
-        case SC_START_RTS_CC:
-            if (SC_VerifyCmdLength(&BufPtr->Msg, sizeof(SC_StartRtsCmd_t)))
-            {
+            case SC_START_RTS_CC:
                 SC_StartRtsCmd((const SC_StartRtsCmd_t *)BufPtr);
-            }
-            else
-            {
-                SC_OperData.HkPacket.Payload.RtsActiveErrCtr++;
-            }
-            break;
+                break;
 
-        case SC_STOP_RTS_CC:
-            if (SC_VerifyCmdLength(&BufPtr->Msg, sizeof(SC_StopRtsCmd_t)))
-            {
+            case SC_STOP_RTS_CC:
                 SC_StopRtsCmd((const SC_StopRtsCmd_t *)BufPtr);
-            }
-            break;
+                break;
 
-        case SC_DISABLE_RTS_CC:
-            if (SC_VerifyCmdLength(&BufPtr->Msg, sizeof(SC_DisableRtsCmd_t)))
-            {
+            case SC_DISABLE_RTS_CC:
                 SC_DisableRtsCmd((const SC_DisableRtsCmd_t *)BufPtr);
-            }
-            break;
+                break;
 
-        case SC_ENABLE_RTS_CC:
-            if (SC_VerifyCmdLength(&BufPtr->Msg, sizeof(SC_EnableRtsCmd_t)))
-            {
+            case SC_ENABLE_RTS_CC:
                 SC_EnableRtsCmd((const SC_EnableRtsCmd_t *)BufPtr);
-            }
-            break;
+                break;
 
-        case SC_SWITCH_ATS_CC:
-            if (SC_VerifyCmdLength(&BufPtr->Msg, sizeof(SC_SwitchAtsCmd_t)))
-            {
+            case SC_SWITCH_ATS_CC:
                 SC_SwitchAtsCmd((const SC_SwitchAtsCmd_t *)BufPtr);
-            }
-            break;
+                break;
 
-        case SC_JUMP_ATS_CC:
-            if (SC_VerifyCmdLength(&BufPtr->Msg, sizeof(SC_JumpAtsCmd_t)))
-            {
+            case SC_JUMP_ATS_CC:
                 SC_JumpAtsCmd((const SC_JumpAtsCmd_t *)BufPtr);
-            }
-            break;
+                break;
 
-        case SC_CONTINUE_ATS_ON_FAILURE_CC:
-            if (SC_VerifyCmdLength(&BufPtr->Msg, sizeof(SC_ContinueAtsOnFailureCmd_t)))
-            {
+            case SC_CONTINUE_ATS_ON_FAILURE_CC:
                 SC_ContinueAtsOnFailureCmd((const SC_ContinueAtsOnFailureCmd_t *)BufPtr);
-            }
-            break;
+                break;
 
-        case SC_APPEND_ATS_CC:
-            if (SC_VerifyCmdLength(&BufPtr->Msg, sizeof(SC_AppendAtsCmd_t)))
-            {
+            case SC_APPEND_ATS_CC:
                 SC_AppendAtsCmd((const SC_AppendAtsCmd_t *)BufPtr);
-            }
-            break;
+                break;
 
-        case SC_MANAGE_TABLE_CC:
-            if (SC_VerifyCmdLength(&BufPtr->Msg, sizeof(SC_ManageTableCmd_t)))
-            {
+            case SC_MANAGE_TABLE_CC:
                 SC_ManageTableCmd((const SC_ManageTableCmd_t *)BufPtr);
-            }
-            break;
+                break;
 
-        case SC_START_RTS_GRP_CC:
-            if (SC_VerifyCmdLength(&BufPtr->Msg, sizeof(SC_StartRtsGrpCmd_t)))
-            {
+            case SC_START_RTS_GRP_CC:
                 SC_StartRtsGrpCmd((const SC_StartRtsGrpCmd_t *)BufPtr);
-            }
-            break;
+                break;
 
-        case SC_STOP_RTS_GRP_CC:
-            if (SC_VerifyCmdLength(&BufPtr->Msg, sizeof(SC_StopRtsGrpCmd_t)))
-            {
+            case SC_STOP_RTS_GRP_CC:
                 SC_StopRtsGrpCmd((const SC_StopRtsGrpCmd_t *)BufPtr);
-            }
-            break;
+                break;
 
-        case SC_DISABLE_RTS_GRP_CC:
-            if (SC_VerifyCmdLength(&BufPtr->Msg, sizeof(SC_DisableRtsGrpCmd_t)))
-            {
+            case SC_DISABLE_RTS_GRP_CC:
                 SC_DisableRtsGrpCmd((const SC_DisableRtsGrpCmd_t *)BufPtr);
-            }
-            break;
+                break;
 
-        case SC_ENABLE_RTS_GRP_CC:
-            if (SC_VerifyCmdLength(&BufPtr->Msg, sizeof(SC_EnableRtsGrpCmd_t)))
-            {
+            case SC_ENABLE_RTS_GRP_CC:
                 SC_EnableRtsGrpCmd((const SC_EnableRtsGrpCmd_t *)BufPtr);
-            }
-            break;
+                break;
 
-        default:
-            CFE_EVS_SendEvent(SC_CC_ERR_EID, CFE_EVS_EventType_ERROR, "Invalid Command Code: MID =  0x%08lX CC =  %d",
-                              (unsigned long)CFE_SB_MsgIdToValue(MessageID), CommandCode);
-            SC_OperData.HkPacket.Payload.CmdErrCtr++;
-            break;
-    } /* end switch */
+            case SC_QUERY_ATS_WINDOW_CC:
+                SC_QueryAtsWindowCmd((const SC_QueryAtsWindowCmd_t *)BufPtr);
+                break;
+
+            case SC_REPORT_ATS_STATUS_CC:
+                SC_ReportAtsStatusCmd((const SC_ReportAtsStatusCmd_t *)BufPtr);
+                break;
+
+            case SC_START_RTS_INSTANCE_CC:
+                SC_StartRtsInstanceCmd((const SC_StartRtsInstanceCmd_t *)BufPtr);
+                break;
+
+            case SC_START_RTS_PARAM_CC:
+                SC_StartRtsParamCmd((const SC_StartRtsParamCmd_t *)BufPtr);
+                break;
+
+            case SC_START_RTS_SET_CC:
+                SC_StartRtsSetCmd((const SC_StartRtsSetCmd_t *)BufPtr);
+                break;
+
+            case SC_STOP_RTS_SET_CC:
+                SC_StopRtsSetCmd((const SC_StopRtsSetCmd_t *)BufPtr);
+                break;
+
+            case SC_DISABLE_RTS_SET_CC:
+                SC_DisableRtsSetCmd((const SC_DisableRtsSetCmd_t *)BufPtr);
+                break;
+
+            case SC_ENABLE_RTS_SET_CC:
+                SC_EnableRtsSetCmd((const SC_EnableRtsSetCmd_t *)BufPtr);
+                break;
+
+            case SC_SET_RTS_PRIORITY_CC:
+                SC_SetRtsPriorityCmd((const SC_SetRtsPriorityCmd_t *)BufPtr);
+                break;
+
+            case SC_RESET_DIAG_CC:
+                SC_ResetDiagCmd((const SC_ResetDiagCmd_t *)BufPtr);
+                break;
+
+            case SC_QUERY_LOOKAHEAD_CC:
+                SC_QueryLookaheadCmd((const SC_QueryLookaheadCmd_t *)BufPtr);
+                break;
+
+            case SC_SET_EVENT_MODE_CC:
+                SC_SetEventModeCmd((const SC_SetEventModeCmd_t *)BufPtr);
+                break;
+
+            default:
+                /* every command code with a length has a handler */
+                break;
+        } /* end switch */
+    }
 }
@@ -50,6 +50,24 @@
  */
 bool SC_VerifyCmdLength(const CFE_MSG_Message_t *Msg, size_t ExpectedLength);
 
+/**
+ * \brief Get the expected length of an SC command
+ *
+ *  \par Description
+ *       Returns the length that a command sent to #SC_CMD_MID with
+ *       the given command code must have to be accepted by
+ *       #SC_ProcessCommand.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   CommandCode      The command code
+ *
+ *  \return Expected length of the command in bytes, 0 if the
+ *          command code is not valid
+ */
+size_t SC_GetCmdLength(CFE_MSG_FcnCode_t CommandCode);
+
 /**
  * \brief Routes commands to be processed
  *
@@ -70,7 +88,8 @@ void SC_ProcessRequest(const CFE_SB_Buffer_t *BufPtr);
  *
  *  \par Description
  *       Process commands. Commands can be from external sources or from SC
- *       itself.
+ *       itself.  Each command is checked against the length given by
+ *       #SC_GetCmdLength before its handler is called.
  *
  *  \par Assumptions, External Events, and Notes:
  *        None
@@ -76,7 +76,7 @@ typedef uint16 SC_AtsIndex_t;
  *
  * The valid range is [0..SC_MAX_ATS_CMDS-1]
  */
-typedef uint16 SC_CommandIndex_t;
+typedef SC_IndexBase_t SC_CommandIndex_t;
 
 /**
  * @brief A sequence number for commands.
@@ -93,7 +93,7 @@ typedef uint16 SC_CommandIndex_t;
  *
  * The valid range is [0..SC_MAX_ATS_CMDS-1]
  */
-typedef uint16 SC_SeqIndex_t;
+typedef SC_IndexBase_t SC_SeqIndex_t;
 
 /*
  * ------------------------------------------------
@@ -124,7 +124,7 @@ typedef uint16 SC_SeqIndex_t;
  * This is mainly intended for initializing values from literals or integers
  * This is the inverse macro of SC_IDX_AS_UINT()
  */
-#define SC_IDX_FROM_UINT(arg) ((uint16)(arg))
+#define SC_IDX_FROM_UINT(arg) ((SC_IndexBase_t)(arg))
 /**
  * Increment an index value
  * This works with any index type that follows the pattern
@@ -34,8 +34,11 @@
 #include "sc_app.h"
 #include "sc_loads.h"
 #include "sc_atsrq.h"
+#include "sc_dispatch.h"
+#include "sc_rtsrq.h"
 #include "sc_utils.h"
 #include "sc_events.h"
+#include "sc_msgids.h"
 #include <string.h>
 
 /**************************************************************************
@@ -51,16 +54,34 @@
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void SC_LoadAts(SC_AtsIndex_t AtsIndex)
 {
-    SC_CommandNum_t               AtsCmdNum;         /* current ats entry command number */
-    SC_EntryOffset_t              AtsEntryIndex;     /* index into the load for current ats entry */
-    SC_EntryOffset_t              PendingEntryIndex; /* index into the load for current ats entry */
-    SC_AtsEntry_t *               EntryPtr;          /* a pointer to an ats entry */
-    CFE_MSG_Size_t                MessageSize     = 0;
-    int32                         Result          = CFE_SUCCESS;
-    bool                          StillProcessing = true;
-    SC_AtsInfoTable_t *           AtsInfoPtr;
-    SC_AtsCmdStatusEntry_t *      StatusEntryPtr;
-    SC_AtsCmdEntryOffsetRecord_t *CmdOffsetRec; /* ATS entry location in table */
+    SC_AtsLoadJob_t *Job = &SC_AppData.AtsLoadJob;
+
+    /* this ATS is needed now, so another ATS being activated goes back in the queue */
+    if ((Job->Phase != SC_AtsLoadPhase_IDLE) && !SC_IDX_EQUAL(Job->AtsIndex, AtsIndex))
+    {
+        Job->Pending[SC_IDX_AS_UINT(Job->AtsIndex)] = true;
+        Job->Phase                                  = SC_AtsLoadPhase_IDLE;
+    }
+
+    /* the activation steps time themselves */
+    SC_BeginAtsLoad(AtsIndex);
+
+    /* run the activation job of this ATS to completion */
+    while (Job->Phase != SC_AtsLoadPhase_IDLE)
+    {
+        /* every call makes progress, so this loop ends */
+        SC_ProcessAtsLoad(SC_MAX_ATS_CMDS);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Start activating a newly loaded ATS                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_BeginAtsLoad(SC_AtsIndex_t AtsIndex)
+{
+    SC_AtsLoadJob_t *Job = &SC_AppData.AtsLoadJob;
 
     /* validate ATS array index */
     if (!SC_AtsIndexIsValid(AtsIndex))
@@ -70,54 +91,152 @@ void SC_LoadAts(SC_AtsIndex_t AtsIndex)
         return;
     }
 
+    SC_BeginPhase(SC_Phase_LOAD_ATS);
+
+    if ((Job->Phase != SC_AtsLoadPhase_IDLE) && !SC_IDX_EQUAL(Job->AtsIndex, AtsIndex))
+    {
+        /*
+         ** Only one ATS is activated at a time.  The old contents of this
+         ** one no longer match its table, so clear them while it waits.
+         */
+        SC_InitAtsTables(AtsIndex);
+
+        Job->Pending[SC_IDX_AS_UINT(AtsIndex)] = true;
+    }
+    else
+    {
+        SC_StartAtsLoadJob(AtsIndex);
+    }
+
+    SC_EndPhase(SC_Phase_LOAD_ATS);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Set up the activation job for an ATS                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_StartAtsLoadJob(SC_AtsIndex_t AtsIndex)
+{
+    SC_AtsLoadJob_t *Job = &SC_AppData.AtsLoadJob;
+
     /*
      ** Initialize all structures
      */
     SC_InitAtsTables(AtsIndex);
 
-    /* initialize pointers and counters */
-    AtsInfoPtr    = SC_GetAtsInfoObject(AtsIndex);
-    AtsEntryIndex = SC_ENTRY_OFFSET_FIRST;
+    Job->Phase                             = SC_AtsLoadPhase_PARSE;
+    Job->AtsIndex                          = AtsIndex;
+    Job->EntryOffset                       = SC_ENTRY_OFFSET_FIRST;
+    Job->CmdCount                          = 0;
+    Job->SortStep                          = 0;
+    Job->Pending[SC_IDX_AS_UINT(AtsIndex)] = false;
+}
 
-    while (StillProcessing)
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Advance the ATS activation job                                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool SC_ProcessAtsLoad(uint32 MaxEntries)
+{
+    SC_AtsLoadJob_t *Job        = &SC_AppData.AtsLoadJob;
+    uint32           EntryCount = 0;
+    uint32           i;
+
+    /* start the next queued ATS once the one before it is done */
+    for (i = 0; (i < SC_NUMBER_OF_ATS) && (Job->Phase == SC_AtsLoadPhase_IDLE); i++)
     {
-        /*
-         ** Make sure that the pointer as well as the primary packet
-         ** header fit in the buffer, so a G.P fault is not caused.
-         */
-        if (SC_IDX_WITHIN_LIMIT(AtsEntryIndex, SC_ATS_BUFF_SIZE32))
+        if (Job->Pending[i])
         {
-            /* get a pointer to the ats command in the table */
-            EntryPtr = SC_GetAtsEntryAtOffset(AtsIndex, AtsEntryIndex);
+            SC_BeginPhase(SC_Phase_LOAD_ATS);
+            SC_StartAtsLoadJob(SC_ATS_IDX_C(i));
+            SC_EndPhase(SC_Phase_LOAD_ATS);
+        }
+    }
 
-            /* get the next command number from the buffer */
-            AtsCmdNum = EntryPtr->Header.CmdNumber;
+    /* parse steps are timed as part of loading the ATS */
+    if ((Job->Phase == SC_AtsLoadPhase_PARSE) && (EntryCount < MaxEntries))
+    {
+        SC_BeginPhase(SC_Phase_LOAD_ATS);
 
-            if (SC_IDNUM_IS_NULL(AtsCmdNum))
-            {
-                /* end of the load reached */
-                Result = CFE_SUCCESS;
-                break;
-            }
+        while ((Job->Phase == SC_AtsLoadPhase_PARSE) && (EntryCount < MaxEntries))
+        {
+            SC_ParseAtsLoadEntry();
+            EntryCount++;
+        }
 
-            if (!SC_AtsCommandNumIsValid(AtsCmdNum))
-            {
-                /* the cmd number is invalid */
-                Result = SC_ERROR;
-                break;
-            }
+        SC_EndPhase(SC_Phase_LOAD_ATS);
+    }
 
-            /* make sure the CmdPtr can fit in a whole Ats Cmd Header at the very least */
-            if (!SC_IDX_WITHIN_LIMIT(AtsEntryIndex,
-                                     1 + (SC_ATS_BUFF_SIZE32 - SC_ATS_HDR_WORDS))) /* jphfix - revisit? */
-            {
-                /* even the smallest command will not fit in the buffer */
-                Result = SC_ERROR;
-                break;
-            }
+    /* and sort steps as part of building the time index */
+    if ((Job->Phase == SC_AtsLoadPhase_INDEX) && (EntryCount < MaxEntries))
+    {
+        SC_BeginPhase(SC_Phase_BUILD_INDEX);
+
+        while ((Job->Phase == SC_AtsLoadPhase_INDEX) && (EntryCount < MaxEntries))
+        {
+            SC_IndexAtsLoadEntry();
+            EntryCount++;
+        }
+
+        SC_EndPhase(SC_Phase_BUILD_INDEX);
+    }
+
+    return (Job->Phase == SC_AtsLoadPhase_IDLE);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Parse the next entry of the ATS being activated                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_ParseAtsLoadEntry(void)
+{
+    SC_AtsLoadJob_t *             Job = &SC_AppData.AtsLoadJob;
+    SC_CommandNum_t               AtsCmdNum;         /* current ats entry command number */
+    SC_EntryOffset_t              AtsEntryIndex;     /* index into the load for current ats entry */
+    SC_EntryOffset_t              PendingEntryIndex; /* index into the load for current ats entry */
+    SC_AtsEntry_t *               EntryPtr;          /* a pointer to an ats entry */
+    CFE_MSG_Size_t                MessageSize = 0;
+    int32                         Result      = CFE_SUCCESS;
+    bool                          EndOfLoad   = false;
+    SC_AtsCmdStatusEntry_t *      StatusEntryPtr;
+    SC_AtsCmdEntryOffsetRecord_t *CmdOffsetRec; /* ATS entry location in table */
+
+    AtsEntryIndex = Job->EntryOffset;
+
+    /*
+     ** Make sure that the pointer as well as the primary packet
+     ** header fit in the buffer, so a G.P fault is not caused.
+     */
+    if (SC_IDX_WITHIN_LIMIT(AtsEntryIndex, SC_ATS_BUFF_SIZE32))
+    {
+        /* get a pointer to the ats command in the table */
+        EntryPtr = SC_GetAtsEntryAtOffset(Job->AtsIndex, AtsEntryIndex);
 
-            StatusEntryPtr = SC_GetAtsStatusEntryForCommand(AtsIndex, SC_CommandNumToIndex(AtsCmdNum));
-            CmdOffsetRec   = SC_GetAtsEntryOffsetForCmd(AtsIndex, SC_CommandNumToIndex(AtsCmdNum));
+        /* get the next command number from the buffer */
+        AtsCmdNum = EntryPtr->Header.CmdNumber;
+
+        if (SC_IDNUM_IS_NULL(AtsCmdNum))
+        {
+            /* end of the load reached */
+            EndOfLoad = true;
+        }
+        else if (!SC_AtsCommandNumIsValid(AtsCmdNum))
+        {
+            /* the cmd number is invalid */
+            Result = SC_ERROR;
+        }
+        else if (!SC_IDX_WITHIN_LIMIT(AtsEntryIndex, 1 + (SC_ATS_BUFF_SIZE32 - SC_ATS_HDR_WORDS)))
+        {
+            /* even the smallest command will not fit in the buffer */
+            Result = SC_ERROR;
+        }
+        else
+        {
+            StatusEntryPtr = SC_GetAtsStatusEntryForCommand(Job->AtsIndex, SC_CommandNumToIndex(AtsCmdNum));
+            CmdOffsetRec   = SC_GetAtsEntryOffsetForCmd(Job->AtsIndex, SC_CommandNumToIndex(AtsCmdNum));
 
             if (StatusEntryPtr->Status == SC_Status_EMPTY)
             {
@@ -141,65 +260,87 @@ void SC_LoadAts(SC_AtsIndex_t AtsIndex)
                         /* set the command status to loaded in the command status table */
                         StatusEntryPtr->Status = SC_Status_LOADED;
 
+                        /* add the command to the time index, sorted once all are loaded */
+                        SC_GetAtsCommandNumAtSeq(Job->AtsIndex, SC_SEQUENCE_IDX_C(Job->CmdCount))->CmdNum = AtsCmdNum;
+
                         /* increment the number of commands loaded */
-                        AtsInfoPtr->NumberOfCommands++;
+                        Job->CmdCount++;
 
                         /* increment the ats_entry index to the next ats entry */
-                        AtsEntryIndex = PendingEntryIndex;
+                        Job->EntryOffset = PendingEntryIndex;
                     }
                     else
                     { /* the command runs off the end of the buffer */
-                        Result          = SC_ERROR;
-                        StillProcessing = false;
+                        Result = SC_ERROR;
                     } /* end if */
                 }
                 else
                 { /* the command length was invalid */
-                    Result          = SC_ERROR;
-                    StillProcessing = false;
+                    Result = SC_ERROR;
                 } /* end if */
             }
             else
             { /* the cmd number is invalid */
-                Result          = SC_ERROR;
-                StillProcessing = false;
+                Result = SC_ERROR;
             } /* end if */
         }
-        else
-        {
-            /*
-             ** We encountered a load exactly as long as the buffer.
-             ** AtsEntryIndex cannot exceed SC_ATS_BUFF_SIZE32 here.
-             ** A command pointer over the end of the buffer will be
-             ** identified above before AtsEntryIndex is incremented.
-             ** Consequently this block does not require verifying
-             ** AtsEntryIndex >= SC_ATS_BUFF_SIZE32.
-             */
-
-            Result          = CFE_SUCCESS;
-            StillProcessing = false;
-        } /*end else */
-    }     /* end while */
+    }
+    else
+    {
+        /*
+         ** We encountered a load exactly as long as the buffer.
+         ** AtsEntryIndex cannot exceed SC_ATS_BUFF_SIZE32 here.
+         ** A command pointer over the end of the buffer will be
+         ** identified above before AtsEntryIndex is incremented.
+         ** Consequently this block does not require verifying
+         ** AtsEntryIndex >= SC_ATS_BUFF_SIZE32.
+         */
+        EndOfLoad = true;
+    } /*end else */
 
     /*
      **   Now the commands are parsed through, need to build the tables
      **   if the load was a success, need to build the tables
      */
-    /* if the load finished without errors and there was at least one command */
-    if ((Result == CFE_SUCCESS) && (AtsInfoPtr->NumberOfCommands > 0))
+    if ((Result != CFE_SUCCESS) || (EndOfLoad && (Job->CmdCount == 0)))
+    { /* there was an error, or there were no commands */
+        SC_InitAtsTables(Job->AtsIndex);
+
+        Job->Phase = SC_AtsLoadPhase_IDLE;
+    }
+    else if (EndOfLoad)
     {
         /* record the size of the load in the ATS info table */
-        AtsInfoPtr->AtsSize = SC_IDX_AS_UINT(AtsEntryIndex); /* size in 32-bit WORDS */
+        SC_SetAtsSize(Job->AtsIndex, SC_IDX_AS_UINT(AtsEntryIndex)); /* size in 32-bit WORDS */
 
         /* build the time index table */
-        SC_BuildTimeIndexTable(AtsIndex);
-    }
-    else
-    { /* there was an error */
-        SC_InitAtsTables(AtsIndex);
+        Job->Phase = SC_AtsLoadPhase_INDEX;
     } /* end if */
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Run the next time sort step of the ATS being activated          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_IndexAtsLoadEntry(void)
+{
+    SC_AtsLoadJob_t *Job = &SC_AppData.AtsLoadJob;
+
+    SC_SortAtsTimeIndexStep(Job->AtsIndex, Job->CmdCount, Job->SortStep);
+
+    Job->SortStep++;
+
+    /* the rest of the time index was cleared when the job started */
+    if ((Job->SortStep + 1) >= ((Job->CmdCount / 2) + Job->CmdCount))
+    {
+        /* the ATS can be started from now on */
+        SC_GetAtsInfoObject(Job->AtsIndex)->NumberOfCommands = Job->CmdCount;
+
+        Job->Phase = SC_AtsLoadPhase_IDLE;
+    }
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Builds the time table for the ATS buffer                        */
@@ -207,8 +348,9 @@ void SC_LoadAts(SC_AtsIndex_t AtsIndex)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void SC_BuildTimeIndexTable(SC_AtsIndex_t AtsIndex)
 {
-    int32                 i;
-    int32                 ListLength;
+    uint32                i;
+    uint32                ListLength;
+    uint32                Step;
     SC_CommandIndex_t     CmdIdx;
     SC_AtsCmdNumRecord_t *AtsCmdNumRec;
 
@@ -220,107 +362,155 @@ void SC_BuildTimeIndexTable(SC_AtsIndex_t AtsIndex)
         return;
     }
 
+    SC_BeginPhase(SC_Phase_BUILD_INDEX);
+
     /* initialize sorted list length */
     ListLength = 0;
 
-    /* initialize sorted list contents */
+    /* collect the in-use command entries in command number order */
     for (i = 0; i < SC_MAX_ATS_CMDS; i++)
     {
-        AtsCmdNumRec         = SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_C(i));
-        AtsCmdNumRec->CmdNum = SC_INVALID_CMD_NUMBER;
-
-        /* add in-use command entries to time sorted list */
         CmdIdx = SC_COMMAND_IDX_C(i);
         if (!SC_IDX_EQUAL(SC_GetAtsEntryOffsetForCmd(AtsIndex, CmdIdx)->Offset, SC_ENTRY_OFFSET_INVALID))
         {
-            SC_Insert(AtsIndex, CmdIdx, ListLength);
+            AtsCmdNumRec         = SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_C(ListLength));
+            AtsCmdNumRec->CmdNum = SC_CommandIndexToNum(CmdIdx);
             ListLength++;
         }
     }
+
+    /* clear the rest of the list */
+    for (i = ListLength; i < SC_MAX_ATS_CMDS; i++)
+    {
+        AtsCmdNumRec         = SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_C(i));
+        AtsCmdNumRec->CmdNum = SC_INVALID_CMD_NUMBER;
+    }
+
+    /* then sort it by execution time */
+    for (Step = 0; (Step + 1) < ((ListLength / 2) + ListLength); Step++)
+    {
+        SC_SortAtsTimeIndexStep(AtsIndex, ListLength, Step);
+    }
+
+    SC_EndPhase(SC_Phase_BUILD_INDEX);
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/*  Inserts and element into a sorted list                         */
+/*  Run one step of the heap sort of the ATS time index            */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void SC_Insert(SC_AtsIndex_t AtsIndex, SC_CommandIndex_t NewCmdIndex, uint32 ListLength)
+void SC_SortAtsTimeIndexStep(SC_AtsIndex_t AtsIndex, uint32 ListLength, uint32 Step)
 {
-    SC_AtsEntryHeader_t *         EntryHeader;    /* ATS table entry pointer */
-    SC_AbsTimeTag_t               NewCmdTime = 0; /* new command execution time */
-    SC_AbsTimeTag_t               ListCmdTime;    /* list entry execution time */
-    SC_CommandIndex_t             CmdIndex;       /* ATS command index (cmd num - 1) */
-    SC_SeqIndex_t                 TimeBufIndex;
-    SC_SeqIndex_t                 NextIndex;
-    SC_AtsCmdEntryOffsetRecord_t *CmdOffsetRec; /* ATS entry location in table */
-    SC_AtsCmdNumRecord_t *        AtsCmdNumRec;
+    uint32                HeapNodes = ListLength / 2; /* list entries with at least one child */
+    uint32                LastIndex;
+    SC_AtsCmdNumRecord_t *FirstRec;
+    SC_AtsCmdNumRecord_t *LastRec;
+    SC_CommandNum_t       CmdNum;
 
-    /* validate ATS array index */
-    if (!SC_AtsIndexIsValid(AtsIndex))
+    if (Step < HeapNodes)
     {
-        CFE_EVS_SendEvent(SC_INSERTATS_INV_INDEX_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "ATS insert error: invalid ATS index %u", SC_IDX_AS_UINT(AtsIndex));
-        return;
+        /* build the heap, from the last entry with children back to the first */
+        SC_SiftAtsTimeIndex(AtsIndex, HeapNodes - 1 - Step, ListLength);
     }
-
-    /* get execution time for new list entry */
-    if (ListLength > 0)
+    else if ((Step - HeapNodes) < ListLength)
     {
-        /* first get the entry index in the selected ATS table for the new command */
-        CmdOffsetRec = SC_GetAtsEntryOffsetForCmd(AtsIndex, NewCmdIndex);
-        /* then get a pointer to the ATS entry */
-        EntryHeader = &SC_GetAtsEntryAtOffset(AtsIndex, CmdOffsetRec->Offset)->Header;
-        /* then get the execution time from the ATS entry for the new command */
-        NewCmdTime = SC_GetAtsEntryTime(EntryHeader);
-    }
+        /* move the latest command left in the heap in front of the sorted part */
+        LastIndex = ListLength - 1 - (Step - HeapNodes);
+
+        FirstRec = SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_C(0));
+        LastRec  = SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_C(LastIndex));
 
-    /* start at last element in the sorted by time list */
-    TimeBufIndex = SC_SEQUENCE_IDX_C(ListLength - 1);
+        CmdNum           = LastRec->CmdNum;
+        LastRec->CmdNum  = FirstRec->CmdNum;
+        FirstRec->CmdNum = CmdNum;
 
-    while (SC_IDX_WITHIN_LIMIT(TimeBufIndex, ListLength))
+        SC_SiftAtsTimeIndex(AtsIndex, 0, LastIndex);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/*  Move a time index entry down the heap to its place             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_SiftAtsTimeIndex(SC_AtsIndex_t AtsIndex, uint32 Node, uint32 HeapSize)
+{
+    uint32                Child;
+    SC_AtsCmdNumRecord_t *NodeRec;
+    SC_AtsCmdNumRecord_t *ChildRec;
+    SC_CommandNum_t       CmdNum;
+    bool                  Done = false;
+
+    /* each pass moves one level down, so at most log2(HeapSize) passes are made */
+    while (!Done && (Node < (HeapSize / 2)))
     {
-        /* first get the cmd index for this list entry */
-        CmdIndex = SC_CommandNumToIndex(SC_GetAtsCommandNumAtSeq(AtsIndex, TimeBufIndex)->CmdNum);
-        /* then get the entry index from the ATS table */
-        CmdOffsetRec = SC_GetAtsEntryOffsetForCmd(AtsIndex, CmdIndex);
-        /* then get a pointer to the ATS entry data */
-        EntryHeader = &SC_GetAtsEntryAtOffset(AtsIndex, CmdOffsetRec->Offset)->Header;
-        /* then get cmd execution time from the ATS entry */
-        ListCmdTime = SC_GetAtsEntryTime(EntryHeader);
+        /* pick the later of the one or two children */
+        Child    = (2 * Node) + 1;
+        ChildRec = SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_C(Child));
 
-        /* compare time for this list entry to time for new cmd */
-        if (SC_CompareAbsTime(ListCmdTime, NewCmdTime))
+        if (((Child + 1) < HeapSize) &&
+            SC_AtsCmdIsLater(AtsIndex, SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_C(Child + 1))->CmdNum,
+                             ChildRec->CmdNum))
         {
-            /* new cmd will execute before this list entry */
+            Child++;
+            ChildRec = SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_C(Child));
+        }
 
-            /* move this list entry to make room for new cmd */
-            NextIndex = TimeBufIndex;
-            SC_IDX_INCREMENT(NextIndex);
+        NodeRec = SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_C(Node));
 
-            SC_GetAtsCommandNumAtSeq(AtsIndex, NextIndex)->CmdNum =
-                SC_GetAtsCommandNumAtSeq(AtsIndex, TimeBufIndex)->CmdNum;
+        if (SC_AtsCmdIsLater(AtsIndex, ChildRec->CmdNum, NodeRec->CmdNum))
+        {
+            CmdNum           = NodeRec->CmdNum;
+            NodeRec->CmdNum  = ChildRec->CmdNum;
+            ChildRec->CmdNum = CmdNum;
 
-            /* back up to previous list entry (ok if -1) */
-            SC_IDX_DECREMENT(TimeBufIndex);
+            Node = Child;
         }
         else
         {
-            /* new cmd will execute at same time or after this list entry */
-            break;
+            /* the entry is already later than its children */
+            Done = true;
         }
     }
+}
 
-    /*
-    ** TimeBufIndex is now one slot before the target slot...
-    **   if new cmd time is earlier than all other entries
-    **     then TimeBufIndex is -1 and all others have been moved
-    **   else only entries with later times have been moved
-    ** In either case, there is an empty slot next to TimeBufIndex
-    */
-    SC_IDX_INCREMENT(TimeBufIndex);
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/*  Check whether one ATS command sorts after another by time      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool SC_AtsCmdIsLater(SC_AtsIndex_t AtsIndex, SC_CommandNum_t CmdNum1, SC_CommandNum_t CmdNum2)
+{
+    SC_AtsCmdEntryOffsetRecord_t *CmdOffsetRec; /* ATS entry location in table */
+    SC_AtsEntryHeader_t *         EntryHeader;  /* ATS table entry pointer */
+    SC_AbsTimeTag_t               CmdTime1;
+    SC_AbsTimeTag_t               CmdTime2;
+    bool                          IsLater;
+
+    CmdOffsetRec = SC_GetAtsEntryOffsetForCmd(AtsIndex, SC_CommandNumToIndex(CmdNum1));
+    EntryHeader  = &SC_GetAtsEntryAtOffset(AtsIndex, CmdOffsetRec->Offset)->Header;
+    CmdTime1     = SC_GetAtsEntryTime(EntryHeader);
+
+    CmdOffsetRec = SC_GetAtsEntryOffsetForCmd(AtsIndex, SC_CommandNumToIndex(CmdNum2));
+    EntryHeader  = &SC_GetAtsEntryAtOffset(AtsIndex, CmdOffsetRec->Offset)->Header;
+    CmdTime2     = SC_GetAtsEntryTime(EntryHeader);
+
+    if (SC_CompareAbsTime(CmdTime1, CmdTime2))
+    {
+        IsLater = true;
+    }
+    else if (SC_CompareAbsTime(CmdTime2, CmdTime1))
+    {
+        IsLater = false;
+    }
+    else
+    {
+        /* commands due at the same time are sent in command number order */
+        IsLater = (SC_IDNUM_AS_UINT(CmdNum1) > SC_IDNUM_AS_UINT(CmdNum2));
+    }
 
-    AtsCmdNumRec         = SC_GetAtsCommandNumAtSeq(AtsIndex, TimeBufIndex);
-    AtsCmdNumRec->CmdNum = SC_CommandIndexToNum(NewCmdIndex);
+    return IsLater;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -344,6 +534,9 @@ void SC_InitAtsTables(SC_AtsIndex_t AtsIndex)
         return;
     }
 
+    /* a summary of the old commands would mix in the new ones */
+    SC_StopAtsStatusSummary(AtsIndex);
+
     /* loop through and set the ATS tables to zero */
     for (i = 0; i < SC_MAX_ATS_CMDS; i++)
     {
@@ -358,8 +551,8 @@ void SC_InitAtsTables(SC_AtsIndex_t AtsIndex)
 
     /* initialize the pointers and counters   */
     AtsInfoPtr                   = SC_GetAtsInfoObject(AtsIndex);
-    AtsInfoPtr->AtsSize          = 0;
     AtsInfoPtr->NumberOfCommands = 0;
+    SC_SetAtsSize(AtsIndex, 0);
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -370,6 +563,7 @@ void SC_InitAtsTables(SC_AtsIndex_t AtsIndex)
 void SC_LoadRts(SC_RtsIndex_t RtsIndex)
 {
     SC_RtsInfoEntry_t *RtsInfoPtr;
+    uint32             Length;
 
     /* validate RTS array index */
     if (SC_RtsIndexIsValid(RtsIndex))
@@ -377,7 +571,44 @@ void SC_LoadRts(SC_RtsIndex_t RtsIndex)
         /* Clear out the RTS info table */
         RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
 
-        RtsInfoPtr->RtsStatus            = SC_Status_LOADED;
+        /*
+         ** Instances of the old commands can't go on, and neither can
+         ** the RTS itself, whether it is running its old commands or
+         ** another RTS as an instance.  Stopping it also stops any
+         ** caller waiting on it, before its pool block is reused.
+         */
+        SC_KillRtsInstances(RtsIndex);
+        if (RtsInfoPtr->RtsStatus == SC_Status_EXECUTING)
+        {
+            SC_KillRts(RtsIndex);
+        }
+
+        /*
+         ** Copy the RTS into the storage pool, followed by an empty
+         ** entry that marks the end of the RTS
+         */
+        Length = SC_GetRtsLength(SC_OperData.RtsTblAddr[SC_IDX_AS_UINT(RtsIndex)]);
+
+        if (SC_AllocRtsBlock(RtsIndex, Length + SC_RTS_HDR_WORDS))
+        {
+            memcpy(SC_GetRtsEntryAtOffset(RtsIndex, SC_ENTRY_OFFSET_FIRST),
+                   SC_OperData.RtsTblAddr[SC_IDX_AS_UINT(RtsIndex)], Length * SC_BYTES_IN_WORD);
+            memset(SC_GetRtsEntryAtOffset(RtsIndex, SC_ENTRY_OFFSET_C(Length)), 0,
+                   SC_RTS_HDR_WORDS * SC_BYTES_IN_WORD);
+
+            SC_SetRtsStatus(RtsIndex, SC_Status_LOADED);
+        }
+        else
+        {
+            SC_SetRtsStatus(RtsIndex, SC_Status_EMPTY);
+
+            CFE_EVS_SendEvent(SC_LOADRTS_POOL_FULL_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "RTS %03u not loaded, needs %lu bytes of RTS storage with %lu free",
+                              SC_IDNUM_AS_UINT(SC_RtsIndexToNum(RtsIndex)),
+                              (unsigned long)((Length + SC_RTS_HDR_WORDS) * SC_BYTES_IN_WORD),
+                              (unsigned long)(SC_AppData.RtsPoolFreeWords * SC_BYTES_IN_WORD));
+        }
+
         RtsInfoPtr->UseCtr               = 0;
         RtsInfoPtr->CmdCtr               = 0;
         RtsInfoPtr->CmdErrCtr            = 0;
@@ -385,7 +616,7 @@ void SC_LoadRts(SC_RtsIndex_t RtsIndex)
         RtsInfoPtr->NextCommandPtr       = SC_ENTRY_OFFSET_FIRST;
 
         /* Make sure the RTS is disabled */
-        RtsInfoPtr->DisabledFlag = true;
+        SC_SetRtsDisabled(RtsIndex, true);
     }
     else
     {
@@ -395,6 +626,226 @@ void SC_LoadRts(SC_RtsIndex_t RtsIndex)
     }
 } /* SC_LoadRts */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get the length of the commands in an RTS table                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 SC_GetRtsLength(uint32 Buffer32[])
+{
+    uint32         i;
+    SC_RtsEntry_t *EntryPtr;
+    CFE_MSG_Size_t CmdSize = 0;
+    bool           Done    = false;
+
+    /* The table has been validated, so only the end of the RTS needs to be found */
+    i = 0;
+    while (Done == false && i <= (SC_RTS_MAX_SIZE32 - SC_RTS_HDR_WORDS))
+    {
+        EntryPtr = (SC_RtsEntry_t *)&Buffer32[i];
+
+        CFE_MSG_GetSize(CFE_MSG_PTR(EntryPtr->Msg), &CmdSize);
+
+        /* a command shorter than a packet header is the end of the RTS, as in SC_GetNextRtsCommand */
+        if (CmdSize < SC_PACKET_MIN_SIZE)
+        {
+            Done = true;
+        }
+        else
+        {
+            i += (CmdSize + SC_RTS_HEADER_SIZE + SC_ROUND_UP_BYTES) / SC_BYTES_IN_WORD;
+        }
+    }
+
+    if (i > SC_RTS_MAX_SIZE32)
+    {
+        i = SC_RTS_MAX_SIZE32;
+    }
+
+    return i;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Allocate space for an RTS in the RTS storage pool               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool SC_AllocRtsBlock(SC_RtsIndex_t RtsIndex, uint32 Size)
+{
+    SC_RtsPoolBlock_t *Block     = &SC_AppData.RtsPoolBlock[SC_IDX_AS_UINT(RtsIndex)];
+    bool               Allocated = false;
+
+    /* Release the space held by the previous copy of the RTS, if any */
+    Block->Size = 0;
+    SC_UpdateRtsPoolStats();
+
+    if (SC_AppData.RtsPoolFreeWords >= Size)
+    {
+        if (SC_AppData.RtsPoolLargestFree < Size)
+        {
+            /* there is enough space in total, but no free region is big enough on its own */
+            SC_CompactRtsPool();
+
+            CFE_EVS_SendEvent(SC_RTS_POOL_COMPACT_DBG_EID, CFE_EVS_EventType_DEBUG,
+                              "RTS storage pool compacted for RTS %03u, %lu bytes free",
+                              SC_IDNUM_AS_UINT(SC_RtsIndexToNum(RtsIndex)),
+                              (unsigned long)(SC_AppData.RtsPoolFreeWords * SC_BYTES_IN_WORD));
+        }
+
+        Block->Offset = SC_FindRtsPoolGap(Size);
+        Block->Size   = Size;
+        Allocated     = true;
+
+        SC_UpdateRtsPoolStats();
+    }
+
+    return Allocated;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* List the allocated RTS storage pool blocks in address order     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 SC_SortRtsPoolBlocks(uint16 Order[])
+{
+    uint32 Count = 0;
+    uint32 i;
+    uint16 RtsIdx;
+
+    for (RtsIdx = 0; RtsIdx < SC_NUMBER_OF_RTS; RtsIdx++)
+    {
+        if (SC_AppData.RtsPoolBlock[RtsIdx].Size > 0)
+        {
+            /* insertion sort, there are few blocks and they are only sorted on a load */
+            i = Count;
+            while (i > 0 && SC_AppData.RtsPoolBlock[Order[i - 1]].Offset > SC_AppData.RtsPoolBlock[RtsIdx].Offset)
+            {
+                Order[i] = Order[i - 1];
+                i--;
+            }
+
+            Order[i] = RtsIdx;
+            Count++;
+        }
+    }
+
+    return Count;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Find the first free region of the RTS storage pool that fits    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 SC_FindRtsPoolGap(uint32 Size)
+{
+    uint16             Order[SC_NUMBER_OF_RTS];
+    SC_RtsPoolBlock_t *Block;
+    uint32             Count;
+    uint32             i;
+    uint32             Pos = 0;
+
+    Count = SC_SortRtsPoolBlocks(Order);
+
+    for (i = 0; i < Count; i++)
+    {
+        Block = &SC_AppData.RtsPoolBlock[Order[i]];
+
+        if ((Block->Offset - Pos) >= Size)
+        {
+            break;
+        }
+
+        Pos = Block->Offset + Block->Size;
+    }
+
+    if (i == Count && (SC_RTS_POOL_SIZE32 - Pos) < Size)
+    {
+        Pos = SC_RTS_POOL_SIZE32;
+    }
+
+    return Pos;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Move the RTS storage pool blocks together                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_CompactRtsPool(void)
+{
+    uint16             Order[SC_NUMBER_OF_RTS];
+    SC_RtsPoolBlock_t *Block;
+    uint32             Count;
+    uint32             i;
+    uint32             Pos = 0;
+
+    Count = SC_SortRtsPoolBlocks(Order);
+
+    /*
+     ** RTSs are located by offset, so a block can be moved
+     ** even while its RTS is executing
+     */
+    for (i = 0; i < Count; i++)
+    {
+        Block = &SC_AppData.RtsPoolBlock[Order[i]];
+
+        if (Block->Offset != Pos)
+        {
+            memmove(&SC_AppData.RtsPool[Pos], &SC_AppData.RtsPool[Block->Offset],
+                    Block->Size * sizeof(SC_AppData.RtsPool[0]));
+            Block->Offset = Pos;
+        }
+
+        Pos += Block->Size;
+    }
+
+    SC_UpdateRtsPoolStats();
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Update the RTS storage pool free space statistics               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_UpdateRtsPoolStats(void)
+{
+    uint16             Order[SC_NUMBER_OF_RTS];
+    SC_RtsPoolBlock_t *Block;
+    uint32             Count;
+    uint32             i;
+    uint32             Gap;
+    uint32             Pos = 0;
+
+    SC_AppData.RtsPoolFreeWords   = 0;
+    SC_AppData.RtsPoolLargestFree = 0;
+
+    Count = SC_SortRtsPoolBlocks(Order);
+
+    /* the last pass covers the free space after the last block */
+    for (i = 0; i <= Count; i++)
+    {
+        if (i < Count)
+        {
+            Block = &SC_AppData.RtsPoolBlock[Order[i]];
+            Gap   = Block->Offset - Pos;
+            Pos   = Block->Offset + Block->Size;
+        }
+        else
+        {
+            Gap = SC_RTS_POOL_SIZE32 - Pos;
+        }
+
+        SC_AppData.RtsPoolFreeWords += Gap;
+
+        if (Gap > SC_AppData.RtsPoolLargestFree)
+        {
+            SC_AppData.RtsPoolLargestFree = Gap;
+        }
+    }
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /*  Validate ATS table data                                        */
@@ -432,7 +883,7 @@ bool SC_ParseRts(uint32 Buffer32[])
         /*
          ** Check to see if a minimum command fits within an RTS
          */
-        if (i <= (SC_RTS_BUFF_SIZE32 - SC_RTS_HDR_WORDS))
+        if (i <= (SC_RTS_MAX_SIZE32 - SC_RTS_HDR_WORDS))
         {
             /*
              ** Cast a header to the RTS buffer current location
@@ -471,14 +922,22 @@ bool SC_ParseRts(uint32 Buffer32[])
                     Error = true; /* Length error */
                 }
 
-                else if ((i + IndexDelta) > SC_RTS_BUFF_SIZE32)
+                else if (!SC_VerifyLocalCmd(CFE_MSG_PTR(EntryPtr->Msg), CmdSize, true))
+                {
+                    CFE_EVS_SendEvent(SC_RTS_LOCAL_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "RTS SC cmd loaded with invalid code or length at %d, len: %d", i, (int)CmdSize);
+
+                    Error = true; /* SC command that would be rejected */
+                }
+
+                else if ((i + IndexDelta) > SC_RTS_MAX_SIZE32)
                 {
                     CFE_EVS_SendEvent(SC_RTS_LEN_BUFFER_ERR_EID, CFE_EVS_EventType_ERROR,
                                       "RTS cmd at %d runs off end of buffer", i);
                     Error = true; /* command runs off of the end of the buffer */
                 }
 
-                else if ((i + IndexDelta) == SC_RTS_BUFF_SIZE32)
+                else if ((i + IndexDelta) == SC_RTS_MAX_SIZE32)
                 {
                     Done = true;
                 }
@@ -512,6 +971,19 @@ bool SC_ParseRts(uint32 Buffer32[])
 
     } /* endwhile */
 
+    /*
+     ** With the entries known to be sound, check where the gotos lead
+     */
+    if (Error == false)
+    {
+        Error = !SC_VerifyRtsGotos(Buffer32);
+    }
+
+    if (Error == false)
+    {
+        Error = !SC_VerifyRtsPatches(Buffer32);
+    }
+
     /*
      ** finished, report results
      */
@@ -628,6 +1100,119 @@ void SC_UpdateAppend(void)
                       (int)EntryIndex * SC_BYTES_IN_WORD);
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Validate trigger table data                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 SC_ValidateTriggers(void *TableData)
+{
+    SC_TriggerEntry_t *TriggerPtr = (SC_TriggerEntry_t *)TableData;
+    CFE_SB_MsgId_t     MsgId;
+    const char *       Problem = NULL;
+    int32              Result  = CFE_SUCCESS;
+    int32              i;
+
+    for (i = 0; (i < SC_NUMBER_OF_TRIGGERS) && (Problem == NULL); i++)
+    {
+        /* entries with no message ID are unused */
+        if (TriggerPtr[i].MsgId != 0)
+        {
+            MsgId = CFE_SB_ValueToMsgId(TriggerPtr[i].MsgId);
+
+            if (!SC_RtsNumIsValid(TriggerPtr[i].RtsNum))
+            {
+                Problem = "invalid RTS number";
+            }
+            else if ((TriggerPtr[i].MatchSize != 0) && (TriggerPtr[i].MatchSize != sizeof(uint8)) &&
+                     (TriggerPtr[i].MatchSize != sizeof(uint16)) && (TriggerPtr[i].MatchSize != sizeof(uint32)))
+            {
+                Problem = "invalid match size";
+            }
+            else if ((TriggerPtr[i].MatchOffset + TriggerPtr[i].MatchSize) > CFE_MISSION_SB_MAX_SB_MSG_SIZE)
+            {
+                Problem = "match field past largest message";
+            }
+            else if (CFE_SB_MsgId_Equal(MsgId, CFE_SB_ValueToMsgId(SC_CMD_MID)) ||
+                     CFE_SB_MsgId_Equal(MsgId, CFE_SB_ValueToMsgId(SC_SEND_HK_MID)) ||
+                     CFE_SB_MsgId_Equal(MsgId, CFE_SB_ValueToMsgId(SC_WAKEUP_MID)))
+            {
+                /* SC already subscribes to these, and they are never triggers */
+                Problem = "message ID is an SC input";
+            }
+        }
+    }
+
+    if (Problem != NULL)
+    {
+        /* the loop went one past the entry in error */
+        CFE_EVS_SendEvent(SC_TRIGGER_TBL_VERIFY_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Trigger table verify error: entry %d, %s", (int)(i - 1), Problem);
+        Result = SC_ERROR;
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Have new trigger table data, update trigger subscriptions       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_UpdateTriggers(void)
+{
+    CFE_SB_MsgId_t MsgId;
+    CFE_Status_t   Result;
+    bool           Subscribed;
+    int32          TriggerCount = 0;
+    int32          i;
+    int32          j;
+
+    /* drop the message IDs of the previous table */
+    for (i = 0; i < SC_AppData.TriggerMsgIdCount; i++)
+    {
+        CFE_SB_Unsubscribe(SC_AppData.TriggerMsgId[i], SC_OperData.TriggerPipe);
+    }
+
+    SC_AppData.TriggerMsgIdCount = 0;
+
+    for (i = 0; i < SC_NUMBER_OF_TRIGGERS; i++)
+    {
+        if (SC_OperData.TriggerTblAddr[i].MsgId != 0)
+        {
+            MsgId = CFE_SB_ValueToMsgId(SC_OperData.TriggerTblAddr[i].MsgId);
+            TriggerCount++;
+
+            /* several triggers may share a message ID, subscribe once */
+            Subscribed = false;
+            for (j = 0; j < SC_AppData.TriggerMsgIdCount; j++)
+            {
+                Subscribed |= CFE_SB_MsgId_Equal(SC_AppData.TriggerMsgId[j], MsgId);
+            }
+
+            if (!Subscribed)
+            {
+                Result = CFE_SB_Subscribe(MsgId, SC_OperData.TriggerPipe);
+                if (Result == CFE_SUCCESS)
+                {
+                    SC_AppData.TriggerMsgId[SC_AppData.TriggerMsgIdCount] = MsgId;
+                    SC_AppData.TriggerMsgIdCount++;
+                }
+                else
+                {
+                    CFE_EVS_SendEvent(SC_TRIGGER_SUBSCRIBE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "Trigger subscribe to message ID 0x%08lX returned: 0x%08X",
+                                      (unsigned long)CFE_SB_MsgIdToValue(MsgId), (unsigned int)Result);
+                }
+            }
+        }
+    }
+
+    CFE_EVS_SendEvent(SC_UPDATE_TRIGGER_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "Update Trigger Table: trigger count = %d, message ID count = %d", (int)TriggerCount,
+                      (int)SC_AppData.TriggerMsgIdCount);
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Append contents of Append ATS table to indicated ATS table      */
@@ -638,7 +1223,7 @@ void SC_ProcessAppend(SC_AtsIndex_t AtsIndex)
     SC_AtsEntry_t *               EntryPtr;
     CFE_MSG_Size_t                CommandBytes = 0;
     SC_EntryOffset_t              EntryIndex;
-    int32                         i;
+    uint32                        i;
     SC_CommandIndex_t             CmdIndex;
     SC_AtsInfoTable_t *           AtsInfoPtr;
     SC_AtsCmdStatusEntry_t *      StatusEntryPtr;
@@ -652,6 +1237,11 @@ void SC_ProcessAppend(SC_AtsIndex_t AtsIndex)
         return;
     }
 
+    SC_BeginPhase(SC_Phase_APPEND);
+
+    /* the summary of the ATS in progress, if any, is out of date */
+    SC_StopAtsStatusSummary(AtsIndex);
+
     /* save index of free area at end of ATS table data */
     AtsInfoPtr = SC_GetAtsInfoObject(AtsIndex);
     EntryIndex = SC_ENTRY_OFFSET_C(AtsInfoPtr->AtsSize);
@@ -661,7 +1251,7 @@ void SC_ProcessAppend(SC_AtsIndex_t AtsIndex)
            SC_AppData.AppendWordCount * SC_BYTES_IN_WORD);
 
     /* update size of ATS table data */
-    AtsInfoPtr->AtsSize += SC_AppData.AppendWordCount;
+    SC_SetAtsSize(AtsIndex, AtsInfoPtr->AtsSize + SC_AppData.AppendWordCount);
 
     /* add appended entries to ats process tables */
     for (i = 0; i < SC_OperData.HkPacket.Payload.AppendEntryCount; i++)
@@ -710,6 +1300,8 @@ void SC_ProcessAppend(SC_AtsIndex_t AtsIndex)
 
     /* notify cFE that we have modified the ats table */
     CFE_TBL_Modified(SC_OperData.AtsTblHandle[SC_IDX_AS_UINT(AtsIndex)]);
+
+    SC_EndPhase(SC_Phase_APPEND);
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -719,13 +1311,16 @@ void SC_ProcessAppend(SC_AtsIndex_t AtsIndex)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 int32 SC_VerifyAtsTable(uint32 *Buffer32, int32 BufferWords)
 {
-    int32 Result       = CFE_SUCCESS;
-    int32 BufferIndex  = 0;
-    int32 CommandCount = 0;
-    int32 i;
+    SC_AtsEntry_t *EntryPtr;
+    int32          Result       = CFE_SUCCESS;
+    int32          BufferIndex  = 0;
+    int32          CommandCount = 0;
+    int32          i;
 
     bool StillProcessing = true;
 
+    SC_BeginPhase(SC_Phase_VERIFY_ATS);
+
     /* Initialize all command numbers as unused */
     for (i = 0; i < SC_MAX_ATS_CMDS; i++)
     {
@@ -749,6 +1344,11 @@ int32 SC_VerifyAtsTable(uint32 *Buffer32, int32 BufferWords)
         }
         else
         {
+            /* Keep the time tag for the load forecast */
+            EntryPtr = (SC_AtsEntry_t *)&Buffer32[BufferIndex];
+
+            SC_OperData.ForecastTimes[CommandCount] = SC_GetAtsEntryTime(&EntryPtr->Header);
+
             /* Result is size (in words) of this entry */
             BufferIndex += Result;
             CommandCount++;
@@ -765,6 +1365,11 @@ int32 SC_VerifyAtsTable(uint32 *Buffer32, int32 BufferWords)
             CFE_EVS_SendEvent(SC_VERIFY_ATS_MPT_ERR_EID, CFE_EVS_EventType_ERROR,
                               "Verify ATS Table error: table is empty");
         }
+        else if (!SC_ForecastAtsLoad(CommandCount))
+        {
+            /* Table asks for more commands in a second than SC can send */
+            Result = SC_ERROR;
+        }
         else
         {
             CFE_EVS_SendEvent(SC_VERIFY_ATS_EID, CFE_EVS_EventType_INFORMATION,
@@ -773,6 +1378,8 @@ int32 SC_VerifyAtsTable(uint32 *Buffer32, int32 BufferWords)
         }
     }
 
+    SC_EndPhase(SC_Phase_VERIFY_ATS);
+
     return Result;
 }
 
@@ -861,6 +1468,15 @@ int32 SC_VerifyAtsEntry(uint32 *Buffer32, int32 EntryIndex, int32 BufferWords)
                               "Verify ATS Table error: buffer overflow: buf index = %d, cmd num = %u, pkt len = %d",
                               (int)EntryIndex, SC_IDNUM_AS_UINT(EntryPtr->Header.CmdNumber), (int)CommandBytes);
         }
+        else if (!SC_VerifyLocalCmd(CFE_MSG_PTR(EntryPtr->Msg), CommandBytes, false))
+        {
+            /* Error -- SC command that SC would reject when it comes due */
+            Result = SC_ERROR;
+
+            CFE_EVS_SendEvent(SC_VERIFY_ATS_LOCAL_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Verify ATS Table error: invalid SC cmd: buf index = %d, cmd num = %u, pkt len = %d",
+                              (int)EntryIndex, SC_IDNUM_AS_UINT(EntryPtr->Header.CmdNumber), (int)CommandBytes);
+        }
         else if (SC_OperData.AtsDupTestArray[SC_CommandNumToIndex(EntryPtr->Header.CmdNumber)] != SC_DUP_TEST_UNUSED)
         {
             /* Entry with duplicate command number is invalid */
@@ -883,3 +1499,386 @@ int32 SC_VerifyAtsEntry(uint32 *Buffer32, int32 EntryIndex, int32 BufferWords)
 
     return Result;
 }
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Forecast the command load of a verified ATS table               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool SC_ForecastAtsLoad(uint32 NumCmds)
+{
+    SC_LoadForecast_t *Forecast;
+    SC_AbsTimeTag_t *  Times;
+    SC_AbsTimeTag_t    TimeTag;
+    char               List[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    const char *       Basis;
+    size_t             Length;
+    uint32             RtsDemand;
+    uint32             Count;
+    uint32             i;
+    uint16             w;
+    bool               Accepted = true;
+
+    Forecast = &SC_OperData.DiagPacket.Payload.Forecast;
+    Times    = SC_OperData.ForecastTimes;
+
+    memset(Forecast, 0, sizeof(*Forecast));
+
+    /* Each wakeup sends at most SC_MAX_CMDS_PER_WAKEUP commands for the ATP and RTP together */
+    Forecast->NumCmds  = NumCmds;
+    Forecast->Capacity = SC_MAX_CMDS_PER_WAKEUP * SC_WAKEUPS_PER_SECOND;
+
+    if (SC_FORECAST_RTS_DEMAND)
+    {
+        /* Assume each executing RTS takes one command per wakeup */
+        RtsDemand = SC_OperData.RtsCtrlBlckAddr->NumRtsActive * SC_WAKEUPS_PER_SECOND;
+
+        Forecast->Capacity = (RtsDemand < Forecast->Capacity) ? (Forecast->Capacity - RtsDemand) : 0;
+    }
+
+    /* Heap sort the time tags, which may be in any order */
+    for (i = NumCmds / 2; i > 0; i--)
+    {
+        SC_SiftForecastTimes(i - 1, NumCmds);
+    }
+
+    for (i = NumCmds; i > 1; i--)
+    {
+        /* move the latest time tag left in the heap to the end of the list */
+        TimeTag      = Times[0];
+        Times[0]     = Times[i - 1];
+        Times[i - 1] = TimeTag;
+
+        SC_SiftForecastTimes(0, i - 1);
+    }
+
+    /* Count the commands in each second */
+    for (i = 0; i < NumCmds; i += Count)
+    {
+        Count = 1;
+        while ((i + Count) < NumCmds && Times[i + Count] == Times[i])
+        {
+            Count++;
+        }
+
+        if (Count > Forecast->PeakCmds)
+        {
+            Forecast->PeakCmds = Count;
+        }
+
+        if (Count > Forecast->Capacity)
+        {
+            Forecast->NumOverloaded++;
+
+            /* Keep the worst seconds, most commands first and the earlier of equals first */
+            for (w = SC_FORECAST_WINDOWS; w > 0 && Forecast->Window[w - 1].NumCmds < Count; w--)
+            {
+                if (w < SC_FORECAST_WINDOWS)
+                {
+                    Forecast->Window[w] = Forecast->Window[w - 1];
+                }
+            }
+
+            if (w < SC_FORECAST_WINDOWS)
+            {
+                Forecast->Window[w].TimeTag = Times[i];
+                Forecast->Window[w].NumCmds = Count;
+            }
+        }
+    }
+
+    if (Forecast->NumOverloaded > 0)
+    {
+        /* Say whether the capacity left room for the executing RTSs */
+        Basis = SC_FORECAST_RTS_DEMAND ? "after executing RTSs" : "in table alone";
+
+        /* List the worst seconds as commands@time tag, as many as fit */
+        Length  = 0;
+        List[0] = '\0';
+
+        for (w = 0; w < SC_FORECAST_WINDOWS && Forecast->Window[w].NumCmds > 0 && (Length + 20) < sizeof(List); w++)
+        {
+            Length += snprintf(&List[Length], sizeof(List) - Length, " %u@%lu",
+                               (unsigned int)Forecast->Window[w].NumCmds,
+                               (unsigned long)Forecast->Window[w].TimeTag);
+        }
+
+        if (SC_FORECAST_REJECT)
+        {
+            Accepted = false;
+
+            CFE_EVS_SendEvent(SC_VERIFY_ATS_LOAD_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Verify ATS Table error: %lu secs over %lu cmds/sec %s, worst:%s",
+                              (unsigned long)Forecast->NumOverloaded, (unsigned long)Forecast->Capacity, Basis, List);
+        }
+        else
+        {
+            CFE_EVS_SendEvent(SC_VERIFY_ATS_LOAD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                              "Verify ATS Table: %lu secs over %lu cmds/sec %s, worst:%s",
+                              (unsigned long)Forecast->NumOverloaded, (unsigned long)Forecast->Capacity, Basis, List);
+        }
+    }
+
+    return Accepted;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Move a forecast time tag down the heap to its place             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_SiftForecastTimes(uint32 Node, uint32 HeapSize)
+{
+    SC_AbsTimeTag_t *Times = SC_OperData.ForecastTimes;
+    SC_AbsTimeTag_t  TimeTag;
+    uint32           Child;
+    bool             Done = false;
+
+    /* each pass moves one level down, so at most log2(HeapSize) passes are made */
+    while (!Done && (Node < (HeapSize / 2)))
+    {
+        /* pick the later of the one or two children */
+        Child = (2 * Node) + 1;
+
+        if (((Child + 1) < HeapSize) && (Times[Child + 1] > Times[Child]))
+        {
+            Child++;
+        }
+
+        if (Times[Child] > Times[Node])
+        {
+            TimeTag      = Times[Node];
+            Times[Node]  = Times[Child];
+            Times[Child] = TimeTag;
+
+            Node = Child;
+        }
+        else
+        {
+            /* the time tag is already later than its children */
+            Done = true;
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify a stored command that SC will process itself             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool SC_VerifyLocalCmd(const CFE_MSG_Message_t *Msg, CFE_MSG_Size_t CommandBytes, bool InRts)
+{
+    CFE_SB_MsgId_t    MessageID   = CFE_SB_INVALID_MSG_ID;
+    CFE_MSG_FcnCode_t CommandCode = 0;
+    size_t            ExpectedLength;
+    bool              Result = true;
+
+    CFE_MSG_GetMsgId(Msg, &MessageID);
+
+    if (CFE_SB_MsgIdToValue(MessageID) == SC_CMD_MID)
+    {
+        CFE_MSG_GetFcnCode(Msg, &CommandCode);
+
+        if (InRts && (CommandCode == SC_CALL_RTS_CC || CommandCode == SC_CHAIN_RTS_CC))
+        {
+            ExpectedLength = sizeof(SC_CallRtsCmd_t);
+        }
+        else if (InRts && CommandCode == SC_RTS_LOOP_CC)
+        {
+            ExpectedLength = sizeof(SC_RtsLoopCmd_t);
+        }
+        else if (InRts && CommandCode == SC_RTS_END_LOOP_CC)
+        {
+            ExpectedLength = sizeof(SC_RtsEndLoopCmd_t);
+        }
+        else if (InRts && CommandCode == SC_RTS_GOTO_CC)
+        {
+            ExpectedLength = sizeof(SC_RtsGotoCmd_t);
+        }
+        else if (InRts && CommandCode == SC_RTS_PATCH_CC)
+        {
+            ExpectedLength = sizeof(SC_RtsPatchCmd_t);
+        }
+        else if (InRts && CommandCode == SC_RTS_TIMED_CC)
+        {
+            ExpectedLength = sizeof(SC_RtsTimedCmd_t);
+        }
+        else
+        {
+            ExpectedLength = SC_GetCmdLength(CommandCode);
+        }
+
+        Result = (ExpectedLength != 0 && CommandBytes == ExpectedLength);
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify the goto entries of an RTS                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool SC_VerifyRtsGotos(uint32 Buffer32[])
+{
+    SC_RtsEntry_t *   EntryPtr;
+    CFE_SB_MsgId_t    MessageID;
+    CFE_MSG_FcnCode_t CommandCode;
+    uint16            i;
+    uint16            Words;
+    uint16            Target;
+    uint16            TargetWords;
+    uint16            j;
+    bool              Result = true;
+
+    i     = 0;
+    Words = SC_RtsEntryWords(Buffer32, i);
+    while (Result && Words != 0)
+    {
+        EntryPtr    = (SC_RtsEntry_t *)&Buffer32[i];
+        MessageID   = CFE_SB_INVALID_MSG_ID;
+        CommandCode = 0;
+
+        CFE_MSG_GetMsgId(CFE_MSG_PTR(EntryPtr->Msg), &MessageID);
+        CFE_MSG_GetFcnCode(CFE_MSG_PTR(EntryPtr->Msg), &CommandCode);
+
+        if (CFE_SB_MsgIdToValue(MessageID) == SC_CMD_MID && CommandCode == SC_RTS_GOTO_CC)
+        {
+            Target = ((SC_RtsGotoCmd_t *)&EntryPtr->Msg)->Payload.EntryOffset;
+
+            /* walk the entries up to the target to see if it is one of them */
+            j           = 0;
+            TargetWords = SC_RtsEntryWords(Buffer32, j);
+            while (j < Target && TargetWords != 0)
+            {
+                j += TargetWords;
+                TargetWords = SC_RtsEntryWords(Buffer32, j);
+            }
+
+            if (j != Target || TargetWords == 0)
+            {
+                CFE_EVS_SendEvent(SC_RTS_GOTO_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "RTS goto at %d leads to %d, which is not an entry", i, Target);
+                Result = false;
+            }
+        }
+
+        i += Words;
+        Words = SC_RtsEntryWords(Buffer32, i);
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify the patch entries of an RTS                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool SC_VerifyRtsPatches(uint32 Buffer32[])
+{
+    SC_RtsEntry_t *                 EntryPtr;
+    const SC_RtsPatchCmd_Payload_t *PatchPtr;
+    CFE_SB_MsgId_t                  MessageID;
+    CFE_MSG_FcnCode_t               CommandCode;
+    CFE_MSG_Size_t                  CmdSize;
+    uint16                          i;
+    uint16                          Words;
+    uint16                          PatchEnd;
+    uint16                          PatchOffset = 0;
+    bool                            Result      = true;
+
+    /* the furthest byte of the next command written by the patches before it */
+    PatchEnd = 0;
+
+    i     = 0;
+    Words = SC_RtsEntryWords(Buffer32, i);
+    while (Result && Words != 0)
+    {
+        EntryPtr    = (SC_RtsEntry_t *)&Buffer32[i];
+        MessageID   = CFE_SB_INVALID_MSG_ID;
+        CommandCode = 0;
+        CmdSize     = 0;
+
+        CFE_MSG_GetMsgId(CFE_MSG_PTR(EntryPtr->Msg), &MessageID);
+        if (CFE_SB_MsgIdToValue(MessageID) == SC_CMD_MID)
+        {
+            CFE_MSG_GetFcnCode(CFE_MSG_PTR(EntryPtr->Msg), &CommandCode);
+        }
+
+        if (CFE_SB_MsgIdToValue(MessageID) == SC_CMD_MID && CommandCode == SC_RTS_PATCH_CC)
+        {
+            PatchPtr = &((SC_RtsPatchCmd_t *)&EntryPtr->Msg)->Payload;
+
+            if (PatchPtr->Length == 0 || (PatchPtr->ArgOffset + PatchPtr->Length) > SC_RTS_ARG_BLOCK_SIZE ||
+                PatchPtr->MsgOffset < sizeof(CFE_MSG_CommandHeader_t) ||
+                (PatchPtr->MsgOffset + PatchPtr->Length) > SC_PACKET_MAX_SIZE)
+            {
+                CFE_EVS_SendEvent(SC_RTS_PATCH_LOAD_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "RTS patch at %d is invalid: Arg Offset %u, Cmd Offset %u, Length %u", i,
+                                  (unsigned int)PatchPtr->ArgOffset, (unsigned int)PatchPtr->MsgOffset,
+                                  (unsigned int)PatchPtr->Length);
+                Result = false;
+            }
+            else if ((PatchPtr->MsgOffset + PatchPtr->Length) > PatchEnd)
+            {
+                PatchEnd    = PatchPtr->MsgOffset + PatchPtr->Length;
+                PatchOffset = i;
+            }
+        }
+        else if (CFE_SB_MsgIdToValue(MessageID) == SC_CMD_MID &&
+                 (CommandCode == SC_RTS_LOOP_CC || CommandCode == SC_RTS_END_LOOP_CC ||
+                  CommandCode == SC_RTS_GOTO_CC || CommandCode == SC_RTS_TIMED_CC))
+        {
+            /* which command the patches land in depends on the run, the RTP checks it when sending */
+            PatchEnd = 0;
+        }
+        else
+        {
+            CFE_MSG_GetSize(CFE_MSG_PTR(EntryPtr->Msg), &CmdSize);
+
+            if (PatchEnd > CmdSize)
+            {
+                CFE_EVS_SendEvent(SC_RTS_PATCH_LOAD_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "RTS patch at %d writes past the end of the command at %d", PatchOffset, i);
+                Result = false;
+            }
+
+            PatchEnd = 0;
+        }
+
+        i += Words;
+        Words = SC_RtsEntryWords(Buffer32, i);
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get the size of an RTS entry                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint16 SC_RtsEntryWords(uint32 Buffer32[], uint16 Offset)
+{
+    SC_RtsEntry_t *EntryPtr;
+    CFE_SB_MsgId_t MessageID = CFE_SB_INVALID_MSG_ID;
+    CFE_MSG_Size_t CmdSize   = 0;
+    uint16         Words     = 0;
+
+    /* the entries end where either SC_ParseRts or the RTP would stop */
+    if (Offset <= (SC_RTS_MAX_SIZE32 - SC_RTS_HDR_WORDS))
+    {
+        EntryPtr = (SC_RtsEntry_t *)&Buffer32[Offset];
+
+        CFE_MSG_GetMsgId(CFE_MSG_PTR(EntryPtr->Msg), &MessageID);
+        CFE_MSG_GetSize(CFE_MSG_PTR(EntryPtr->Msg), &CmdSize);
+
+        if (CFE_SB_IsValidMsgId(MessageID) && CmdSize >= SC_PACKET_MIN_SIZE)
+        {
+            Words = (CmdSize + SC_RTS_HEADER_SIZE + SC_ROUND_UP_BYTES) / sizeof(Buffer32[0]);
+        }
+    }
+
+    return Words;
+}
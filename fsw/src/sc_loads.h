@@ -65,20 +65,64 @@ bool SC_ParseRts(uint32 Buffer32[]);
 void SC_BuildTimeIndexTable(SC_AtsIndex_t AtsIndex);
 
 /**
- * \brief Inserts an item in a sorted list
+ * \brief Runs one step of the heap sort of an ATS time index
  *
  *  \par Description
- *        This function will insert a new element into the list of
- *        ATS commands sorted by execution time.
+ *        Sorts the command numbers in the first ListLength entries of
+ *        the ATS time index by execution time, one step at a time.
+ *        Steps 0 to (ListLength / 2) - 1 build a heap of the entries,
+ *        and each following step moves the latest entry left in the
+ *        heap to the end of the list.  The list is sorted once steps 0
+ *        to (ListLength / 2) + ListLength - 2 have been run in order.
+ *        Each step compares at most 2 * log2(ListLength) pairs of
+ *        time tags.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        Steps past the end of the sort do nothing
+ *
+ *  \param [in]    AtsIndex        ATS array index
+ *  \param [in]    ListLength      Number of commands in the time index
+ *  \param [in]    Step            Sort step to run
+ */
+void SC_SortAtsTimeIndexStep(SC_AtsIndex_t AtsIndex, uint32 ListLength, uint32 Step);
+
+/**
+ * \brief Moves an ATS time index entry down a heap
+ *
+ *  \par Description
+ *        Swaps the time index entry at Node with its later child until
+ *        it is later than both its children or reaches the bottom of
+ *        the heap held in the first HeapSize entries.
  *
  *  \par Assumptions, External Events, and Notes:
  *        None
  *
- *  \param [in]    AtsIndex        ATS array index selection
- *  \param [in]    NewCmdIndex     ATS command index for new list element
- *  \param [in]    ListLength      Number of elements currently in list
+ *  \param [in]    AtsIndex        ATS array index
+ *  \param [in]    Node            Time index entry to move
+ *  \param [in]    HeapSize        Number of time index entries in the heap
+ */
+void SC_SiftAtsTimeIndex(SC_AtsIndex_t AtsIndex, uint32 Node, uint32 HeapSize);
+
+/**
+ * \brief Checks whether one ATS command runs after another
+ *
+ *  \par Description
+ *        Compares the execution times of two loaded ATS commands.
+ *        Commands with the same time are ordered by command number,
+ *        so that the order of the time index is always the same.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        Both commands must be loaded
+ *
+ *  \param [in]    AtsIndex        ATS array index
+ *  \param [in]    CmdNum1         First ATS command number
+ *  \param [in]    CmdNum2         Second ATS command number
+ *
+ *  \return Boolean comparison result
+ *  \retval true   CmdNum1 runs after CmdNum2
+ *  \retval false  CmdNum1 runs before CmdNum2
  */
-void SC_Insert(SC_AtsIndex_t AtsIndex, SC_CommandIndex_t NewCmdIndex, uint32 ListLength);
+bool SC_AtsCmdIsLater(SC_AtsIndex_t AtsIndex, SC_CommandNum_t CmdNum1, SC_CommandNum_t CmdNum2);
 
 /**
  * \brief Initializes ATS tables before a load starts
@@ -127,18 +171,228 @@ int32 SC_VerifyAtsTable(uint32 *Buffer32, int32 BufferWords);
 int32 SC_VerifyAtsEntry(uint32 *Buffer32, int32 EntryIndex, int32 BufferWords);
 
 /**
- * \brief Loads an ATS into the data structures in SC
+ * \brief Forecast the command load of a verified ATS table
  *
  *  \par Description
- *        This routine is called when the SC app gets a new ATS table.
+ *       Counts the commands tagged in each second of the table and
+ *       compares the counts against the commands SC can send in a
+ *       second.  The results go in the diagnostic packet and the
+ *       worst seconds are reported in an event.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        The time tags of the table commands are in
+ *        SC_OperData.ForecastTimes, which this function heap sorts.
+ *        Only the table itself is forecast.  The ATS an Append table
+ *        will be appended to is not known until the append command,
+ *        so its commands are not counted with the Append table's.
+ *
+ *  \param [in]    NumCmds    Number of commands in the table
+ *
+ *  \return Whether the table is accepted
+ *  \retval true  No second is overloaded or #SC_FORECAST_REJECT is false
+ *  \retval false Some second is overloaded and #SC_FORECAST_REJECT is true
+ */
+bool SC_ForecastAtsLoad(uint32 NumCmds);
+
+/**
+ * \brief Moves a forecast time tag down a heap
+ *
+ *  \par Description
+ *        Swaps the time tag at Node of SC_OperData.ForecastTimes with
+ *        its later child until it is later than both its children or
+ *        reaches the bottom of the heap held in the first HeapSize
+ *        time tags.
  *
  *  \par Assumptions, External Events, and Notes:
  *        None
  *
+ *  \param [in]    Node            Time tag to move
+ *  \param [in]    HeapSize        Number of time tags in the heap
+ */
+void SC_SiftForecastTimes(uint32 Node, uint32 HeapSize);
+
+/**
+ * \brief Verify a stored command that SC will process itself
+ *
+ *  \par Description
+ *        Stored commands addressed to #SC_CMD_MID are processed by SC
+ *        directly rather than sent on the Software Bus, so their command
+ *        codes and lengths are checked once here, when the table is loaded.
+ *        Commands for other applications always pass.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        The packet length has already been checked against the
+ *        minimum and maximum packet sizes
+ *
+ *  \param [in]    Msg          Pointer to the stored command
+ *  \param [in]    CommandBytes Length of the stored command
+ *  \param [in]    InRts        true if the command is in an RTS, where
+ *                              #SC_CALL_RTS_CC, #SC_CHAIN_RTS_CC and the
+ *                              loop, end loop and goto entries are also
+ *                              allowed
+ *
+ *  \return Boolean command valid status
+ *  \retval true  Command is not for SC, or is a valid SC command
+ *  \retval false Command is for SC and its code or length is invalid
+ */
+bool SC_VerifyLocalCmd(const CFE_MSG_Message_t *Msg, CFE_MSG_Size_t CommandBytes, bool InRts);
+
+/**
+ * \brief Verify the goto entries of an RTS
+ *
+ *  \par Description
+ *        Checks that every #SC_RTS_GOTO_CC entry in an RTS buffer leads
+ *        to the start of an entry in the same buffer, so the RTP never
+ *        has to check where a goto lands.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        The buffer has already been parsed by #SC_ParseRts
+ *
+ *  \param [in]    Buffer32 Pointer to the RTS buffer
+ *
+ *  \return Boolean goto valid status
+ *  \retval true  All gotos lead to an entry
+ *  \retval false A goto leads somewhere else
+ */
+bool SC_VerifyRtsGotos(uint32 Buffer32[]);
+
+/**
+ * \brief Verify the patch entries of an RTS
+ *
+ *  \par Description
+ *        Checks that every #SC_RTS_PATCH_CC entry in an RTS buffer copies
+ *        a range that is inside the arguments and inside a command past
+ *        its header.  When the patches are followed directly by a
+ *        command, the range must also fit in that command.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        The buffer has already been parsed by #SC_ParseRts.  Patches
+ *        followed by a loop, end loop, goto or timed entry land in a
+ *        command that depends on the run, so their fit is only checked
+ *        by the RTP when the command is sent.
+ *
+ *  \param [in]    Buffer32 Pointer to the RTS buffer
+ *
+ *  \return Boolean patch valid status
+ *  \retval true  All patches are valid
+ *  \retval false A patch is outside the arguments or its command
+ */
+bool SC_VerifyRtsPatches(uint32 Buffer32[]);
+
+/**
+ * \brief Get the size of an RTS entry
+ *
+ *  \par Description
+ *        Returns the number of words used by the RTS entry at the given
+ *        word offset, or 0 if the entries of the buffer end before it.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        The buffer has already been parsed by #SC_ParseRts
+ *
+ *  \param [in]    Buffer32 Pointer to the RTS buffer
+ *  \param [in]    Offset   Word offset of the entry
+ *
+ *  \return Number of words in the entry, 0 if there is no entry
+ */
+uint16 SC_RtsEntryWords(uint32 Buffer32[], uint16 Offset);
+
+/**
+ * \brief Loads an ATS into the data structures in SC
+ *
+ *  \par Description
+ *        This routine starts an ATS activation job and runs it to
+ *        completion before returning.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        The ATS is needed right away, so the job of any other ATS
+ *        being activated is put back in the queue and restarted later.
+ *
  *  \param [in]    AtsIndex            ATS table array index (base zero)
  */
 void SC_LoadAts(SC_AtsIndex_t AtsIndex);
 
+/**
+ * \brief Starts activating a newly loaded ATS
+ *
+ *  \par Description
+ *        This routine is called when the SC app gets a new ATS table.
+ *        It clears the ATS data structures and sets up the activation
+ *        job, which is then advanced by #SC_ProcessAtsLoad.  The set up
+ *        is timed as #SC_Phase_LOAD_ATS.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        Only one ATS is activated at a time.  If another ATS is still
+ *        being activated, this one is queued and its job is started by
+ *        #SC_ProcessAtsLoad once the other job ends.
+ *
+ *  \param [in]    AtsIndex            ATS table array index (base zero)
+ */
+void SC_BeginAtsLoad(SC_AtsIndex_t AtsIndex);
+
+/**
+ * \brief Sets up the activation job for an ATS
+ *
+ *  \par Description
+ *        This routine clears the ATS data structures and makes the ATS
+ *        the one being activated, taking it out of the queue.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        Any job in progress has already ended or been queued again.
+ *
+ *  \param [in]    AtsIndex            ATS table array index (base zero)
+ */
+void SC_StartAtsLoadJob(SC_AtsIndex_t AtsIndex);
+
+/**
+ * \brief Advances the ATS activation job
+ *
+ *  \par Description
+ *        This routine starts the next queued ATS if no job is active,
+ *        then parses ATS entries and adds commands to the
+ *        time index table, up to the given number of steps.  The ATS
+ *        command count is set when the job completes, which is what
+ *        makes the ATS startable.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        The parse steps of each call are timed as #SC_Phase_LOAD_ATS
+ *        and the time index steps as #SC_Phase_BUILD_INDEX, so a load
+ *        spread over several wakeups is counted once per call.
+ *
+ *  \param [in]    MaxEntries          Maximum number of entries to process
+ *
+ *  \return Whether the activation job is complete
+ *  \retval true  No activation is in progress
+ *  \retval false The activation needs more steps
+ */
+bool SC_ProcessAtsLoad(uint32 MaxEntries);
+
+/**
+ * \brief Parses the next entry of the ATS being activated
+ *
+ *  \par Description
+ *        Records the offset of the next ATS entry, marks the command
+ *        as loaded and adds it to the end of the time index.  At the end of the ATS data the job moves on to
+ *        building the time index table.  If the entry is invalid, or
+ *        the ATS is empty, the ATS tables are cleared and the job ends.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        The activation job must be in the PARSE phase
+ */
+void SC_ParseAtsLoadEntry(void);
+
+/**
+ * \brief Runs the next time sort step of the ATS being activated
+ *
+ *  \par Description
+ *        Runs the next #SC_SortAtsTimeIndexStep on the commands added
+ *        to the time index by the parse phase.  Once the index is
+ *        sorted the job ends and the ATS command count is updated.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        The activation job must be in the INDEX phase
+ */
+void SC_IndexAtsLoadEntry(void);
+
 /**
  * \brief Validation function for an ATS
  *
@@ -185,6 +439,38 @@ int32 SC_ValidateAppend(void *TableData);
  */
 void SC_UpdateAppend(void);
 
+/**
+ * \brief Validation function for the trigger table
+ *
+ *  \par Description
+ *        This routine is called from the cFE Table Services as part of
+ *        the table load/validate/commit process.  The function pointer
+ *        is passed as a parameter in the cFE Table Registration call.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        None
+ *
+ *  \return Table validation result
+ *  \retval #CFE_SUCCESS Table validation success
+ *  \retval #SC_ERROR    Table not valid
+ */
+int32 SC_ValidateTriggers(void *TableData);
+
+/**
+ * \brief Updates the trigger subscriptions per new contents of the trigger table
+ *
+ *  \par Description
+ *        This routine is called when the SC app receives notification
+ *        from cFE Table Services that the trigger table contents have
+ *        been updated.  It unsubscribes from the message IDs of the
+ *        previous table and subscribes once to each message ID the new
+ *        table names.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        None
+ */
+void SC_UpdateTriggers(void);
+
 /**
  * \brief Appends contents of Append ATS table to indicated ATS table
  *
@@ -213,6 +499,93 @@ void SC_ProcessAppend(SC_AtsIndex_t AtsIndex);
  */
 void SC_LoadRts(SC_RtsIndex_t RtsIndex);
 
+/**
+ * \brief Gets the length of the commands in an RTS table
+ *
+ *  \par Description
+ *        Walks the commands of a validated RTS table to find where the
+ *        RTS ends.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        The table has passed #SC_ValidateRts
+ *
+ *  \param [in]    Buffer32            Pointer to the RTS table data
+ *
+ *  \return Length of the RTS commands, in words
+ */
+uint32 SC_GetRtsLength(uint32 Buffer32[]);
+
+/**
+ * \brief Allocates space for an RTS in the RTS storage pool
+ *
+ *  \par Description
+ *        Releases the space held by the RTS, then allocates a block of
+ *        the requested size from the first free region big enough to
+ *        hold it.  If no single free region is big enough but the total
+ *        free space is, the pool is compacted first.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        None
+ *
+ *  \param [in]    RtsIndex            RTS table array index (base zero)
+ *  \param [in]    Size                Size of the block, in words
+ *
+ *  \return Boolean allocation result
+ *  \retval true  The block was allocated
+ *  \retval false The pool does not have enough free space, no block is
+ *                allocated to the RTS
+ */
+bool SC_AllocRtsBlock(SC_RtsIndex_t RtsIndex, uint32 Size);
+
+/**
+ * \brief Lists the allocated RTS storage pool blocks in address order
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        None
+ *
+ *  \param [out]   Order               RTS indexes of the allocated blocks,
+ *                                     must hold #SC_NUMBER_OF_RTS entries
+ *
+ *  \return Number of allocated blocks
+ */
+uint32 SC_SortRtsPoolBlocks(uint16 Order[]);
+
+/**
+ * \brief Finds the first free region of the RTS storage pool that fits
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        None
+ *
+ *  \param [in]    Size                Size needed, in words
+ *
+ *  \return Offset of the free region, or #SC_RTS_POOL_SIZE32 if none fits
+ */
+uint32 SC_FindRtsPoolGap(uint32 Size);
+
+/**
+ * \brief Compacts the RTS storage pool
+ *
+ *  \par Description
+ *        Moves the allocated blocks to the start of the pool, leaving all
+ *        of the free space in one region at the end.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        None
+ */
+void SC_CompactRtsPool(void);
+
+/**
+ * \brief Updates the RTS storage pool free space statistics
+ *
+ *  \par Description
+ *        Recomputes the total free space and the largest free region of
+ *        the pool, which are reported in housekeeping telemetry.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        None
+ */
+void SC_UpdateRtsPoolStats(void);
+
 /**
  * \brief Validation function for an RTS
  *
@@ -33,9 +33,11 @@
 #include "cfe.h"
 #include "sc_app.h"
 #include "sc_rtsrq.h"
+#include "sc_state.h"
 #include "sc_utils.h"
 #include "sc_events.h"
 #include "sc_msgids.h"
+#include <string.h>
 
 /**************************************************************************
  **
@@ -88,30 +90,17 @@ void SC_StartRtsCmd(const SC_StartRtsCmd_t *Cmd)
                     /*
                      **  Initialize the RTS info table entry
                      */
-                    RtsInfoPtr->RtsStatus      = SC_Status_EXECUTING;
-                    RtsInfoPtr->CmdCtr         = 0;
-                    RtsInfoPtr->CmdErrCtr      = 0;
-                    RtsInfoPtr->NextCommandPtr = SC_ENTRY_OFFSET_FIRST;
-                    RtsInfoPtr->UseCtr++;
+                    SC_BeginRts(RtsIndex, SC_RTS_NUM_NULL, 0);
 
-                    /*
-                     ** Get the absolute wakeup count for the RTS's next_command_tgt_wakeup
-                     ** using the current wakeup count and the relative wakeup count.
-                     */
-                    RtsInfoPtr->NextCommandTgtWakeup = SC_ComputeAbsWakeup(RtsEntryPtr->WakeupCount);
-
-                    /*
-                     ** Last, Increment some global counters associated with the
-                     ** starting of the RTS
-                     */
-                    SC_OperData.RtsCtrlBlckAddr->NumRtsActive++;
-                    SC_OperData.HkPacket.Payload.RtsActiveCtr++;
                     SC_OperData.HkPacket.Payload.CmdCtr++;
 
                     if (Cmd->Payload.RtsNum <= SC_LAST_RTS_WITH_EVENTS)
                     {
-                        CFE_EVS_SendEvent(SC_RTS_START_INF_EID, CFE_EVS_EventType_INFORMATION,
-                                          "RTS Number %03u Started", SC_IDNUM_AS_UINT(RtsNum));
+                        if (!SC_DeferEvent(SC_RTS_START_INF_EID, SC_IDNUM_AS_UINT(RtsNum)))
+                        {
+                            CFE_EVS_SendEvent(SC_RTS_START_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                              "RTS Number %03u Started", SC_IDNUM_AS_UINT(RtsNum));
+                        }
                     }
                     else
                     {
@@ -162,6 +151,39 @@ void SC_StartRtsCmd(const SC_StartRtsCmd_t *Cmd)
     }
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Starts an RTS with arguments                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_StartRtsParamCmd(const SC_StartRtsParamCmd_t *Cmd)
+{
+    SC_StartRtsCmd_t   StartCmd; /* the same start, without arguments */
+    SC_RtsInfoEntry_t *RtsInfoPtr = NULL;
+    bool               WasLoaded  = false;
+
+    memset(&StartCmd, 0, sizeof(StartCmd));
+    StartCmd.Payload.RtsNum = Cmd->Payload.RtsNum;
+
+    if (SC_RtsNumIsValid(Cmd->Payload.RtsNum))
+    {
+        RtsInfoPtr = SC_GetRtsInfoObject(SC_RtsNumToIndex(Cmd->Payload.RtsNum));
+        WasLoaded  = (RtsInfoPtr->RtsStatus == SC_Status_LOADED);
+    }
+
+    /* the checks, counters and events are those of a plain start */
+    SC_StartRtsCmd(&StartCmd);
+
+    /*
+     ** Only an RTS this command started gets the arguments, one that
+     ** was already executing keeps its own
+     */
+    if (WasLoaded && RtsInfoPtr->RtsStatus == SC_Status_EXECUTING)
+    {
+        memcpy(RtsInfoPtr->Args, Cmd->Payload.Args, sizeof(RtsInfoPtr->Args));
+    }
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Start a group of RTS                                            */
@@ -197,29 +219,21 @@ void SC_StartRtsGrpCmd(const SC_StartRtsGrpCmd_t *Cmd)
                 if (RtsInfoPtr->RtsStatus == SC_Status_LOADED)
                 {
                     /* initialize the RTS info table entry */
-                    RtsInfoPtr->RtsStatus      = SC_Status_EXECUTING;
-                    RtsInfoPtr->CmdCtr         = 0;
-                    RtsInfoPtr->CmdErrCtr      = 0;
-                    RtsInfoPtr->NextCommandPtr = SC_ENTRY_OFFSET_FIRST;
-                    RtsInfoPtr->UseCtr++;
-
-                    /* get absolute wakeup count for 1st cmd in the RTS */
-                    RtsInfoPtr->NextCommandTgtWakeup =
-                        SC_ComputeAbsWakeup(SC_GetRtsEntryAtOffset(RtsIndex, SC_ENTRY_OFFSET_FIRST)->Header.WakeupCount);
-
-                    /* maintain counters associated with starting RTS */
-                    SC_OperData.RtsCtrlBlckAddr->NumRtsActive++;
-                    SC_OperData.HkPacket.Payload.RtsActiveCtr++;
+                    SC_BeginRts(RtsIndex, SC_RTS_NUM_NULL, 0);
 
                     /* count the RTS that were actually started */
                     StartCount++;
                 }
                 else
                 { /* Cannot use the RTS now */
-                    CFE_EVS_SendEvent(
-                        SC_STARTRTSGRP_CMD_NOT_LDED_ERR_EID, CFE_EVS_EventType_ERROR,
-                        "Start RTS group error: rejected RTS ID %03u, RTS Not Loaded or In Use, Status: %lu",
-                        SC_IDNUM_AS_UINT(SC_RtsIndexToNum(RtsIndex)), (unsigned long)RtsInfoPtr->RtsStatus);
+                    if (!SC_DeferEvent(SC_STARTRTSGRP_CMD_NOT_LDED_ERR_EID,
+                                       SC_IDNUM_AS_UINT(SC_RtsIndexToNum(RtsIndex))))
+                    {
+                        CFE_EVS_SendEvent(
+                            SC_STARTRTSGRP_CMD_NOT_LDED_ERR_EID, CFE_EVS_EventType_ERROR,
+                            "Start RTS group error: rejected RTS ID %03u, RTS Not Loaded or In Use, Status: %lu",
+                            SC_IDNUM_AS_UINT(SC_RtsIndexToNum(RtsIndex)), (unsigned long)RtsInfoPtr->RtsStatus);
+                    }
 
                     SC_OperData.HkPacket.Payload.RtsActiveErrCtr++;
 
@@ -227,9 +241,12 @@ void SC_StartRtsGrpCmd(const SC_StartRtsGrpCmd_t *Cmd)
             }
             else
             { /* the RTS is disabled */
-                CFE_EVS_SendEvent(SC_STARTRTSGRP_CMD_DISABLED_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "Start RTS group error: rejected RTS ID %03u, RTS Disabled",
-                                  SC_IDNUM_AS_UINT(SC_RtsIndexToNum(RtsIndex)));
+                if (!SC_DeferEvent(SC_STARTRTSGRP_CMD_DISABLED_ERR_EID, SC_IDNUM_AS_UINT(SC_RtsIndexToNum(RtsIndex))))
+                {
+                    CFE_EVS_SendEvent(SC_STARTRTSGRP_CMD_DISABLED_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "Start RTS group error: rejected RTS ID %03u, RTS Disabled",
+                                      SC_IDNUM_AS_UINT(SC_RtsIndexToNum(RtsIndex)));
+                }
 
                 SC_OperData.HkPacket.Payload.RtsActiveErrCtr++;
 
@@ -348,9 +365,8 @@ void SC_StopRtsGrpCmd(const SC_StopRtsGrpCmd_t *Cmd)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void SC_DisableRtsCmd(const SC_DisableRtsCmd_t *Cmd)
 {
-    SC_RtsNum_t        RtsNum;   /* RTS number */
-    SC_RtsIndex_t      RtsIndex; /* RTS array index */
-    SC_RtsInfoEntry_t *RtsInfoPtr;
+    SC_RtsNum_t   RtsNum;   /* RTS number */
+    SC_RtsIndex_t RtsIndex; /* RTS array index */
 
     RtsNum = Cmd->Payload.RtsNum;
 
@@ -358,11 +374,10 @@ void SC_DisableRtsCmd(const SC_DisableRtsCmd_t *Cmd)
     if (SC_RtsNumIsValid(RtsNum))
     {
         /* convert RTS ID to RTS array index */
-        RtsIndex   = SC_RtsNumToIndex(RtsNum);
-        RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+        RtsIndex = SC_RtsNumToIndex(RtsNum);
 
         /* disable the RTS */
-        RtsInfoPtr->DisabledFlag = true;
+        SC_SetRtsDisabled(RtsIndex, true);
 
         /* update the command status */
         SC_OperData.HkPacket.Payload.CmdCtr++;
@@ -413,7 +428,7 @@ void SC_DisableRtsGrpCmd(const SC_DisableRtsGrpCmd_t *Cmd)
             if (RtsInfoPtr->DisabledFlag == false)
             {
                 DisableCount++;
-                RtsInfoPtr->DisabledFlag = true;
+                SC_SetRtsDisabled(RtsIndex, true);
             }
         }
 
@@ -439,9 +454,8 @@ void SC_DisableRtsGrpCmd(const SC_DisableRtsGrpCmd_t *Cmd)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void SC_EnableRtsCmd(const SC_EnableRtsCmd_t *Cmd)
 {
-    SC_RtsNum_t        RtsNum;   /* RTS number */
-    SC_RtsIndex_t      RtsIndex; /* RTS array index */
-    SC_RtsInfoEntry_t *RtsInfoPtr;
+    SC_RtsNum_t   RtsNum;   /* RTS number */
+    SC_RtsIndex_t RtsIndex; /* RTS array index */
 
     RtsNum = Cmd->Payload.RtsNum;
 
@@ -449,11 +463,10 @@ void SC_EnableRtsCmd(const SC_EnableRtsCmd_t *Cmd)
     if (SC_RtsNumIsValid(RtsNum))
     {
         /* convert RTS ID to RTS array index */
-        RtsIndex   = SC_RtsNumToIndex(RtsNum);
-        RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+        RtsIndex = SC_RtsNumToIndex(RtsNum);
 
         /* re-enable the RTS */
-        RtsInfoPtr->DisabledFlag = false;
+        SC_SetRtsDisabled(RtsIndex, false);
 
         /* update the command status */
         SC_OperData.HkPacket.Payload.CmdCtr++;
@@ -505,7 +518,7 @@ void SC_EnableRtsGrpCmd(const SC_EnableRtsGrpCmd_t *Cmd)
             if (RtsInfoPtr->DisabledFlag == true)
             {
                 EnableCount++;
-                RtsInfoPtr->DisabledFlag = false;
+                SC_SetRtsDisabled(RtsIndex, false);
             }
         }
 
@@ -524,6 +537,294 @@ void SC_EnableRtsGrpCmd(const SC_EnableRtsGrpCmd_t *Cmd)
     }
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Start a set of RTS                                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_StartRtsSetCmd(const SC_StartRtsSetCmd_t *Cmd)
+{
+    SC_RtsIndex_t RtsIndex;
+    uint16        Word;
+    uint16        Bits;
+    uint16        SetCount      = 0;
+    uint16        StartCount    = 0;
+    uint16        DisabledCount = 0;
+    uint16        InUseCount    = 0;
+
+    if (SC_RtsSetIsValid(Cmd->Payload.RtsSet))
+    {
+        for (Word = 0; Word < SC_RTS_SET_WORDS; Word++)
+        {
+            Bits = Cmd->Payload.RtsSet[Word];
+            SetCount += SC_CountRtsBits(Bits);
+
+            /* disabled and executing RTS are counted a word at a time from the HK masks */
+            DisabledCount += SC_CountRtsBits(Bits & SC_OperData.HkPacket.Payload.RtsDisabledStatus[Word]);
+            Bits &= (uint16)~SC_OperData.HkPacket.Payload.RtsDisabledStatus[Word];
+            InUseCount += SC_CountRtsBits(Bits & SC_OperData.HkPacket.Payload.RtsExecutingStatus[Word]);
+            Bits &= (uint16)~SC_OperData.HkPacket.Payload.RtsExecutingStatus[Word];
+
+            /* only the RTS left need their info entry, to tell loaded from empty */
+            RtsIndex = SC_RTS_IDX_C(Word * SC_NUMBER_OF_RTS_IN_UINT16);
+            for (; Bits != 0; Bits >>= 1)
+            {
+                if ((Bits & 1) != 0)
+                {
+                    if (SC_GetRtsInfoObject(RtsIndex)->RtsStatus != SC_Status_LOADED)
+                    {
+                        InUseCount++;
+                    }
+                    else
+                    {
+                        SC_BeginRts(RtsIndex, SC_RTS_NUM_NULL, 0);
+                        StartCount++;
+                    }
+                }
+
+                SC_IDX_INCREMENT(RtsIndex);
+            }
+        }
+
+        /* one event for the whole set, rather than one for each rejected RTS */
+        SC_OperData.HkPacket.Payload.RtsActiveErrCtr += DisabledCount + InUseCount;
+
+        CFE_EVS_SendEvent(SC_STARTRTSSET_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "Start RTS set: Requested=%u, Started=%u, Disabled=%u, Not Loaded or In Use=%u",
+                          (unsigned int)SetCount, (unsigned int)StartCount, (unsigned int)DisabledCount,
+                          (unsigned int)InUseCount);
+        SC_OperData.HkPacket.Payload.CmdCtr++;
+    }
+    else
+    {
+        CFE_EVS_SendEvent(SC_RTSSET_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Start RTS set error: set is empty or names an RTS over %d", SC_NUMBER_OF_RTS);
+        SC_OperData.HkPacket.Payload.CmdErrCtr++;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Stop a set of RTS                                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_StopRtsSetCmd(const SC_StopRtsSetCmd_t *Cmd)
+{
+    SC_RtsIndex_t RtsIndex;
+    uint16        Word;
+    uint16        Bits;
+    uint16        SetCount  = 0;
+    uint16        StopCount = 0;
+
+    if (SC_RtsSetIsValid(Cmd->Payload.RtsSet))
+    {
+        for (Word = 0; Word < SC_RTS_SET_WORDS; Word++)
+        {
+            SetCount += SC_CountRtsBits(Cmd->Payload.RtsSet[Word]);
+
+            /* only the executing RTS in the set are visited */
+            RtsIndex = SC_RTS_IDX_C(Word * SC_NUMBER_OF_RTS_IN_UINT16);
+            for (Bits = Cmd->Payload.RtsSet[Word] & SC_OperData.HkPacket.Payload.RtsExecutingStatus[Word]; Bits != 0;
+                 Bits >>= 1)
+            {
+                /* stopping a caller may already have stopped an RTS it called */
+                if ((Bits & 1) != 0 && SC_GetRtsInfoObject(RtsIndex)->RtsStatus == SC_Status_EXECUTING)
+                {
+                    SC_KillRts(RtsIndex);
+                    StopCount++;
+                }
+
+                SC_IDX_INCREMENT(RtsIndex);
+            }
+        }
+
+        CFE_EVS_SendEvent(SC_STOPRTSSET_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "Stop RTS set: Requested=%u, Stopped=%u", (unsigned int)SetCount, (unsigned int)StopCount);
+        SC_OperData.HkPacket.Payload.CmdCtr++;
+    }
+    else
+    {
+        CFE_EVS_SendEvent(SC_RTSSET_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Stop RTS set error: set is empty or names an RTS over %d", SC_NUMBER_OF_RTS);
+        SC_OperData.HkPacket.Payload.CmdErrCtr++;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Disable a set of RTS                                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_DisableRtsSetCmd(const SC_DisableRtsSetCmd_t *Cmd)
+{
+    SC_RtsIndex_t RtsIndex;
+    uint16        Word;
+    uint16        Bits;
+    uint16        SetCount     = 0;
+    uint16        DisableCount = 0;
+
+    if (SC_RtsSetIsValid(Cmd->Payload.RtsSet))
+    {
+        for (Word = 0; Word < SC_RTS_SET_WORDS; Word++)
+        {
+            SetCount += SC_CountRtsBits(Cmd->Payload.RtsSet[Word]);
+
+            /* the HK disabled mask picks out the entries that are actually disabled */
+            Bits = Cmd->Payload.RtsSet[Word] & (uint16)~SC_OperData.HkPacket.Payload.RtsDisabledStatus[Word];
+            DisableCount += SC_CountRtsBits(Bits);
+
+            RtsIndex = SC_RTS_IDX_C(Word * SC_NUMBER_OF_RTS_IN_UINT16);
+            for (; Bits != 0; Bits >>= 1)
+            {
+                if ((Bits & 1) != 0)
+                {
+                    SC_SetRtsDisabled(RtsIndex, true);
+                }
+
+                SC_IDX_INCREMENT(RtsIndex);
+            }
+        }
+
+        CFE_EVS_SendEvent(SC_DISRTSSET_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "Disable RTS set: Requested=%u, Modified=%u", (unsigned int)SetCount,
+                          (unsigned int)DisableCount);
+        SC_OperData.HkPacket.Payload.CmdCtr++;
+    }
+    else
+    {
+        CFE_EVS_SendEvent(SC_RTSSET_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Disable RTS set error: set is empty or names an RTS over %d", SC_NUMBER_OF_RTS);
+        SC_OperData.HkPacket.Payload.CmdErrCtr++;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Enable a set of RTS                                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_EnableRtsSetCmd(const SC_EnableRtsSetCmd_t *Cmd)
+{
+    SC_RtsIndex_t RtsIndex;
+    uint16        Word;
+    uint16        Bits;
+    uint16        SetCount    = 0;
+    uint16        EnableCount = 0;
+
+    if (SC_RtsSetIsValid(Cmd->Payload.RtsSet))
+    {
+        for (Word = 0; Word < SC_RTS_SET_WORDS; Word++)
+        {
+            SetCount += SC_CountRtsBits(Cmd->Payload.RtsSet[Word]);
+
+            /* the HK disabled mask picks out the entries that are actually enabled */
+            Bits = Cmd->Payload.RtsSet[Word] & SC_OperData.HkPacket.Payload.RtsDisabledStatus[Word];
+            EnableCount += SC_CountRtsBits(Bits);
+
+            RtsIndex = SC_RTS_IDX_C(Word * SC_NUMBER_OF_RTS_IN_UINT16);
+            for (; Bits != 0; Bits >>= 1)
+            {
+                if ((Bits & 1) != 0)
+                {
+                    SC_SetRtsDisabled(RtsIndex, false);
+                }
+
+                SC_IDX_INCREMENT(RtsIndex);
+            }
+        }
+
+        CFE_EVS_SendEvent(SC_ENARTSSET_CMD_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "Enable RTS set: Requested=%u, Modified=%u", (unsigned int)SetCount,
+                          (unsigned int)EnableCount);
+        SC_OperData.HkPacket.Payload.CmdCtr++;
+    }
+    else
+    {
+        CFE_EVS_SendEvent(SC_RTSSET_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Enable RTS set error: set is empty or names an RTS over %d", SC_NUMBER_OF_RTS);
+        SC_OperData.HkPacket.Payload.CmdErrCtr++;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Set the priority level of a set of RTS                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_SetRtsPriorityCmd(const SC_SetRtsPriorityCmd_t *Cmd)
+{
+    SC_RtsIndex_t RtsIndex;
+    uint16        Word;
+    uint16        Bits;
+    uint16        Priority = Cmd->Payload.Priority;
+    uint16        SetCount = 0;
+
+    if (!SC_RtsSetIsValid(Cmd->Payload.RtsSet))
+    {
+        CFE_EVS_SendEvent(SC_SET_RTS_PRIORITY_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Set RTS priority error: set is empty or names an RTS over %d", SC_NUMBER_OF_RTS);
+        SC_OperData.HkPacket.Payload.CmdErrCtr++;
+    }
+    else if (Priority >= SC_RTS_PRIORITY_LEVELS)
+    {
+        CFE_EVS_SendEvent(SC_SET_RTS_PRIORITY_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Set RTS priority error: level %u is not below %d", (unsigned int)Priority,
+                          SC_RTS_PRIORITY_LEVELS);
+        SC_OperData.HkPacket.Payload.CmdErrCtr++;
+    }
+    else
+    {
+        for (Word = 0; Word < SC_RTS_SET_WORDS; Word++)
+        {
+            RtsIndex = SC_RTS_IDX_C(Word * SC_NUMBER_OF_RTS_IN_UINT16);
+            for (Bits = Cmd->Payload.RtsSet[Word]; Bits != 0; Bits >>= 1)
+            {
+                if ((Bits & 1) != 0)
+                {
+                    SC_GetRtsInfoObject(RtsIndex)->Priority = Priority;
+                    SetCount++;
+                }
+
+                SC_IDX_INCREMENT(RtsIndex);
+            }
+        }
+
+        CFE_EVS_SendEvent(SC_SET_RTS_PRIORITY_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "Set RTS priority: Level=%u, Requested=%u", (unsigned int)Priority, (unsigned int)SetCount);
+        SC_OperData.HkPacket.Payload.CmdCtr++;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Check the bitmask of an RTS set command                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool SC_RtsSetIsValid(const uint16 RtsSet[])
+{
+    uint16 Word;
+    uint16 AnySet = 0;
+    bool   Result;
+
+    for (Word = 0; Word < SC_RTS_SET_WORDS; Word++)
+    {
+        AnySet |= RtsSet[Word];
+    }
+
+    Result = (AnySet != 0);
+
+    /* the last word may have bits past the last RTS, which must be clear */
+    if ((SC_NUMBER_OF_RTS % SC_NUMBER_OF_RTS_IN_UINT16) != 0)
+    {
+        if ((RtsSet[SC_RTS_SET_WORDS - 1] >> (SC_NUMBER_OF_RTS % SC_NUMBER_OF_RTS_IN_UINT16)) != 0)
+        {
+            Result = false;
+        }
+    }
+
+    return Result;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /*  Kill an RTS and clear out its data                             */
@@ -531,7 +832,13 @@ void SC_EnableRtsGrpCmd(const SC_EnableRtsGrpCmd_t *Cmd)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void SC_KillRts(SC_RtsIndex_t RtsIndex)
 {
-    SC_RtsInfoEntry_t *RtsInfoPtr;
+    SC_RtsInfoEntry_t  *RtsInfoPtr;
+    SC_RtsInfoEntry_t  *CallerInfoPtr;
+    SC_RtsStatsEntry_t *RtsStatsPtr;
+    SC_RtsIndex_t       CallerIndex;
+    SC_RtsNum_t         CallerRtsNum;
+    uint32              RunWakeups;
+    uint32              RunUsec;
 
     RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
 
@@ -546,9 +853,40 @@ void SC_KillRts(SC_RtsIndex_t RtsIndex)
         /*
         ** Stop the RTS from executing
         */
-        RtsInfoPtr->RtsStatus       = SC_Status_LOADED;
+        SC_SetRtsStatus(RtsIndex, SC_Status_LOADED);
         RtsInfoPtr->NextCommandTgtWakeup = SC_MAX_WAKEUP_CNT;
 
+        /* an instance has nothing loaded of its own */
+        if (SC_RtsNumIsValid(RtsInfoPtr->SourceRtsNum))
+        {
+            SC_SetRtsStatus(RtsIndex, SC_Status_EMPTY);
+            RtsInfoPtr->SourceRtsNum = SC_RTS_NUM_NULL;
+        }
+
+        /*
+        ** Close out this run in the statistics table, measured in
+        ** wakeups and in time from the matching SC_BeginRts
+        */
+        RtsStatsPtr = SC_GetRtsStatsObject(RtsIndex);
+        RunWakeups  = SC_AppData.CurrentWakeupCount - RtsStatsPtr->StartWakeup;
+        RunUsec     = SC_ElapsedUsec(RtsStatsPtr->LastStartTime, SC_AppData.CurrentSysTime);
+
+        RtsStatsPtr->LastRunWakeups = RunWakeups;
+        RtsStatsPtr->TotalRunWakeups += RunWakeups;
+        if (RunWakeups > RtsStatsPtr->MaxRunWakeups)
+        {
+            RtsStatsPtr->MaxRunWakeups = RunWakeups;
+        }
+
+        RtsStatsPtr->LastRunUsec = RunUsec;
+        RtsStatsPtr->TotalRunUsec += RunUsec;
+        if (RunUsec > RtsStatsPtr->MaxRunUsec)
+        {
+            RtsStatsPtr->MaxRunUsec = RunUsec;
+        }
+
+        RtsStatsPtr->LastStopTime = SC_AppData.CurrentSysTime;
+
         /*
         ** Note: the rest of the fields are left alone
         ** to provide information on where the
@@ -559,6 +897,349 @@ void SC_KillRts(SC_RtsIndex_t RtsIndex)
         {
             SC_OperData.RtsCtrlBlckAddr->NumRtsActive--;
         }
+        SC_OperData.HkPacket.Payload.NumRtsActive = SC_OperData.RtsCtrlBlckAddr->NumRtsActive;
+
+        /*
+        ** An RTS that was called and did not run to completion
+        ** takes the RTS waiting on it down with it
+        */
+        CallerRtsNum             = RtsInfoPtr->CallerRtsNum;
+        RtsInfoPtr->CallerRtsNum = SC_RTS_NUM_NULL;
+        RtsInfoPtr->CalleeRtsNum = SC_RTS_NUM_NULL;
+
+        if (SC_RtsNumIsValid(CallerRtsNum))
+        {
+            CallerIndex   = SC_RtsNumToIndex(CallerRtsNum);
+            CallerInfoPtr = SC_GetRtsInfoObject(CallerIndex);
+
+            if (SC_IDNUM_EQUAL(CallerInfoPtr->CalleeRtsNum, SC_RtsIndexToNum(RtsIndex)))
+            {
+                SC_KillRts(CallerIndex);
+            }
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Set up an RTS to begin executing at its first command           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_BeginRts(SC_RtsIndex_t RtsIndex, SC_RtsNum_t CallerRtsNum, uint16 CallDepth)
+{
+    SC_RtsInfoEntry_t  *RtsInfoPtr;
+    SC_RtsStatsEntry_t *RtsStatsPtr;
+
+    RtsInfoPtr  = SC_GetRtsInfoObject(RtsIndex);
+    RtsStatsPtr = SC_GetRtsStatsObject(RtsIndex);
+
+    /*
+     **  Initialize the RTS info table entry
+     */
+    SC_SetRtsStatus(RtsIndex, SC_Status_EXECUTING);
+    RtsInfoPtr->CmdCtr         = 0;
+    RtsInfoPtr->CmdErrCtr      = 0;
+    RtsInfoPtr->NextCommandPtr = SC_ENTRY_OFFSET_FIRST;
+    RtsInfoPtr->CallDepth      = CallDepth;
+    RtsInfoPtr->CallerRtsNum   = CallerRtsNum;
+    RtsInfoPtr->CalleeRtsNum   = SC_RTS_NUM_NULL;
+    RtsInfoPtr->LoopDepth      = 0;
+    RtsInfoPtr->TimedFlag      = false;
+    RtsInfoPtr->LateCmdCtr     = 0;
+    RtsInfoPtr->MaxLateWakeups = 0;
+    RtsInfoPtr->UseCtr++;
+
+    /* the statistics entry keeps its counters across runs */
+    RtsStatsPtr->UseCtr++;
+    RtsStatsPtr->StartWakeup   = SC_AppData.CurrentWakeupCount;
+    RtsStatsPtr->LastStartTime = SC_AppData.CurrentSysTime;
+
+    /* an RTS has no arguments unless it is started with them */
+    memset(RtsInfoPtr->Args, 0, sizeof(RtsInfoPtr->Args));
+
+    /*
+     ** Increment some global counters associated with the
+     ** starting of the RTS
+     */
+    SC_OperData.RtsCtrlBlckAddr->NumRtsActive++;
+    SC_OperData.HkPacket.Payload.NumRtsActive = SC_OperData.RtsCtrlBlckAddr->NumRtsActive;
+    SC_OperData.HkPacket.Payload.RtsActiveCtr++;
+
+    /*
+     ** Last, find the first command and set its absolute wakeup count
+     ** from the current wakeup count and the relative wakeup count.
+     */
+    SC_SeekRtsCommand(RtsIndex, SC_ENTRY_OFFSET_FIRST);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Carry out a call or chain entry found in an RTS                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool SC_ProcessRtsCall(SC_RtsIndex_t RtsIndex, CFE_MSG_FcnCode_t CommandCode, const SC_CallRtsCmd_t *Cmd)
+{
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+    SC_RtsInfoEntry_t *TargetInfoPtr;
+    SC_RtsInfoEntry_t *CallerInfoPtr;
+    SC_RtsIndex_t      TargetIndex;
+    SC_RtsNum_t        RtsNum;
+    SC_RtsNum_t        TargetNum;
+    SC_RtsNum_t        CallerRtsNum;
+    SC_RtsNum_t        SourceRtsNum;
+    uint16             CallDepth;
+    CFE_MSG_Size_t     MsgSize   = 0;
+    CFE_MSG_Size_t     CmdLength = 0;
+    bool               IsChain;
+    bool               Success = false;
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+    RtsNum     = SC_RtsIndexToNum(RtsIndex);
+    TargetNum  = Cmd->Payload.RtsNum;
+    IsChain    = (CommandCode == SC_CHAIN_RTS_CC);
+
+    CFE_MSG_GetSize(CFE_MSG_PTR(Cmd->CommandHeader), &MsgSize);
+
+    if (MsgSize != sizeof(*Cmd))
+    {
+        CFE_EVS_SendEvent(SC_RTS_CALL_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "RTS %03u Call Failed: Invalid Length %lu, Expected %lu: RTS Stopped",
+                          SC_IDNUM_AS_UINT(RtsNum), (unsigned long)MsgSize, (unsigned long)sizeof(*Cmd));
+    }
+    else if (!SC_RtsNumIsValid(TargetNum))
+    {
+        CFE_EVS_SendEvent(SC_RTS_CALL_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "RTS %03u Call Failed: Invalid RTS ID %03u: RTS Stopped", SC_IDNUM_AS_UINT(RtsNum),
+                          SC_IDNUM_AS_UINT(TargetNum));
+    }
+    else if (!IsChain && RtsInfoPtr->CallDepth >= SC_RTS_MAX_CALL_DEPTH)
+    {
+        CFE_EVS_SendEvent(SC_RTS_CALL_DEPTH_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "RTS %03u Call Failed: Call Depth %u Reached: RTS Stopped", SC_IDNUM_AS_UINT(RtsNum),
+                          (unsigned int)RtsInfoPtr->CallDepth);
+    }
+    else
+    {
+        TargetIndex   = SC_RtsNumToIndex(TargetNum);
+        TargetInfoPtr = SC_GetRtsInfoObject(TargetIndex);
+
+        CFE_MSG_GetSize(CFE_MSG_PTR(SC_GetRtsEntryAtOffset(TargetIndex, SC_ENTRY_OFFSET_FIRST)->Msg), &CmdLength);
+
+        /* same conditions as a start RTS command, except an RTS may chain to itself */
+        if (TargetInfoPtr->DisabledFlag || CmdLength < SC_PACKET_MIN_SIZE || CmdLength > SC_PACKET_MAX_SIZE ||
+            (TargetInfoPtr->RtsStatus != SC_Status_LOADED && !(IsChain && SC_IDX_EQUAL(TargetIndex, RtsIndex))))
+        {
+            CFE_EVS_SendEvent(SC_RTS_CALL_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "RTS %03u Call Failed: RTS %03u Not Startable, Status: %lu, Disabled: %u: RTS Stopped",
+                              SC_IDNUM_AS_UINT(RtsNum), SC_IDNUM_AS_UINT(TargetNum),
+                              (unsigned long)TargetInfoPtr->RtsStatus, (unsigned int)TargetInfoPtr->DisabledFlag);
+        }
+        else
+        {
+            Success = true;
+
+            SC_OperData.HkPacket.Payload.RtsCmdCtr++;
+            SC_CountRtsCmd(RtsIndex);
+
+            if (IsChain)
+            {
+                /* the new RTS takes over this one's place in the call chain */
+                CallerRtsNum             = RtsInfoPtr->CallerRtsNum;
+                CallDepth                = RtsInfoPtr->CallDepth;
+                SourceRtsNum             = RtsInfoPtr->SourceRtsNum;
+                RtsInfoPtr->CallerRtsNum = SC_RTS_NUM_NULL;
+
+                SC_KillRts(RtsIndex);
+
+                /* an instance chaining to itself starts over as the same instance */
+                if (SC_IDX_EQUAL(TargetIndex, RtsIndex))
+                {
+                    TargetInfoPtr->SourceRtsNum = SourceRtsNum;
+                }
+
+                if (SC_RtsNumIsValid(CallerRtsNum))
+                {
+                    CallerInfoPtr               = SC_GetRtsInfoObject(SC_RtsNumToIndex(CallerRtsNum));
+                    CallerInfoPtr->CalleeRtsNum = TargetNum;
+                }
+
+                SC_BeginRts(TargetIndex, CallerRtsNum, CallDepth);
+
+                CFE_EVS_SendEvent(SC_RTS_CHAIN_DBG_EID, CFE_EVS_EventType_DEBUG, "RTS %03u Chained to RTS %03u",
+                                  SC_IDNUM_AS_UINT(RtsNum), SC_IDNUM_AS_UINT(TargetNum));
+            }
+            else
+            {
+                /* hold this RTS at the call entry until the called RTS returns */
+                RtsInfoPtr->CalleeRtsNum         = TargetNum;
+                RtsInfoPtr->NextCommandTgtWakeup = SC_MAX_WAKEUP_CNT;
+
+                SC_BeginRts(TargetIndex, RtsNum, RtsInfoPtr->CallDepth + 1);
+
+                CFE_EVS_SendEvent(SC_RTS_CALL_DBG_EID, CFE_EVS_EventType_DEBUG, "RTS %03u Called RTS %03u",
+                                  SC_IDNUM_AS_UINT(RtsNum), SC_IDNUM_AS_UINT(TargetNum));
+            }
+        }
+    }
+
+    if (!Success)
+    {
+        SC_OperData.HkPacket.Payload.RtsCmdErrCtr++;
+        SC_CountRtsCmdErr(RtsIndex);
+        SC_OperData.HkPacket.Payload.LastRtsErrSeq = RtsNum;
+        SC_OperData.HkPacket.Payload.LastRtsErrCmd = RtsInfoPtr->NextCommandPtr;
+
+        SC_KillRts(RtsIndex);
+    }
+
+    return Success;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* End an RTS that ran to completion and resume its caller         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_ReturnFromRts(SC_RtsIndex_t RtsIndex)
+{
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+    SC_RtsInfoEntry_t *CallerInfoPtr;
+    SC_RtsNum_t        CallerRtsNum;
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    /* detach from the caller first so stopping this RTS does not stop the caller */
+    CallerRtsNum             = RtsInfoPtr->CallerRtsNum;
+    RtsInfoPtr->CallerRtsNum = SC_RTS_NUM_NULL;
+
+    SC_KillRts(RtsIndex);
+
+    if (SC_RtsNumIsValid(CallerRtsNum))
+    {
+        CallerInfoPtr = SC_GetRtsInfoObject(SC_RtsNumToIndex(CallerRtsNum));
+
+        if (CallerInfoPtr->RtsStatus == SC_Status_EXECUTING &&
+            SC_IDNUM_EQUAL(CallerInfoPtr->CalleeRtsNum, SC_RtsIndexToNum(RtsIndex)))
+        {
+            CallerInfoPtr->CalleeRtsNum = SC_RTS_NUM_NULL;
+
+            /* step the caller past its call entry, timed from now */
+            SC_OperData.RtsCtrlBlckAddr->CurrRtsNum = CallerRtsNum;
+            SC_GetNextRtsCommand();
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Start an instance of an RTS                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_StartRtsInstanceCmd(const SC_StartRtsInstanceCmd_t *Cmd)
+{
+    SC_RtsNum_t        RtsNum;
+    SC_RtsNum_t        InstanceRtsNum;
+    SC_RtsIndex_t      RtsIndex;
+    SC_RtsIndex_t      InstanceIndex;
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+    SC_RtsInfoEntry_t *InstanceInfoPtr;
+    CFE_MSG_Size_t     CmdLength = 0;
+    uint16             i;
+
+    RtsNum         = Cmd->Payload.RtsNum;
+    InstanceRtsNum = Cmd->Payload.InstanceRtsNum;
+
+    if (SC_RtsNumIsValid(RtsNum) && SC_IDNUM_EQUAL(InstanceRtsNum, SC_RTS_NUM_NULL))
+    {
+        /* the highest numbered RTS are the least likely to be wanted for loads */
+        for (i = SC_NUMBER_OF_RTS; i > 0 && SC_IDNUM_EQUAL(InstanceRtsNum, SC_RTS_NUM_NULL); i--)
+        {
+            if (SC_GetRtsInfoObject(SC_RTS_IDX_C(i - 1))->RtsStatus == SC_Status_EMPTY)
+            {
+                InstanceRtsNum = SC_RTS_NUM_C(i);
+            }
+        }
+    }
+
+    if (!SC_RtsNumIsValid(RtsNum) || !SC_RtsNumIsValid(InstanceRtsNum))
+    {
+        CFE_EVS_SendEvent(SC_STARTRTS_INSTANCE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Start RTS %03u Instance Rejected: Invalid RTS ID or No Empty RTS, Instance RTS %03u",
+                          SC_IDNUM_AS_UINT(RtsNum), SC_IDNUM_AS_UINT(InstanceRtsNum));
+
+        SC_OperData.HkPacket.Payload.CmdErrCtr++;
+        SC_OperData.HkPacket.Payload.RtsActiveErrCtr++;
+    }
+    else
+    {
+        RtsIndex        = SC_RtsNumToIndex(RtsNum);
+        RtsInfoPtr      = SC_GetRtsInfoObject(RtsIndex);
+        InstanceIndex   = SC_RtsNumToIndex(InstanceRtsNum);
+        InstanceInfoPtr = SC_GetRtsInfoObject(InstanceIndex);
+
+        CFE_MSG_GetSize(CFE_MSG_PTR(SC_GetRtsEntryAtOffset(RtsIndex, SC_ENTRY_OFFSET_FIRST)->Msg), &CmdLength);
+
+        /* the RTS may already be running, itself or as another instance */
+        if (RtsInfoPtr->DisabledFlag ||
+            (RtsInfoPtr->RtsStatus != SC_Status_LOADED && RtsInfoPtr->RtsStatus != SC_Status_EXECUTING) ||
+            CmdLength < SC_PACKET_MIN_SIZE || CmdLength > SC_PACKET_MAX_SIZE)
+        {
+            CFE_EVS_SendEvent(SC_STARTRTS_INSTANCE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Start RTS %03u Instance Rejected: Status: %lu, Disabled: %u, 1st Cmd Length: %lu",
+                              SC_IDNUM_AS_UINT(RtsNum), (unsigned long)RtsInfoPtr->RtsStatus,
+                              (unsigned int)RtsInfoPtr->DisabledFlag, (unsigned long)CmdLength);
+
+            SC_OperData.HkPacket.Payload.CmdErrCtr++;
+            SC_OperData.HkPacket.Payload.RtsActiveErrCtr++;
+        }
+        else if (InstanceInfoPtr->RtsStatus != SC_Status_EMPTY)
+        {
+            CFE_EVS_SendEvent(SC_STARTRTS_INSTANCE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Start RTS %03u Instance Rejected: Instance RTS %03u Not Empty, Status: %lu",
+                              SC_IDNUM_AS_UINT(RtsNum), SC_IDNUM_AS_UINT(InstanceRtsNum),
+                              (unsigned long)InstanceInfoPtr->RtsStatus);
+
+            SC_OperData.HkPacket.Payload.CmdErrCtr++;
+            SC_OperData.HkPacket.Payload.RtsActiveErrCtr++;
+        }
+        else
+        {
+            /* an instance of an instance runs the commands of the RTS they both came from */
+            if (SC_RtsNumIsValid(RtsInfoPtr->SourceRtsNum))
+            {
+                InstanceInfoPtr->SourceRtsNum = RtsInfoPtr->SourceRtsNum;
+            }
+            else
+            {
+                InstanceInfoPtr->SourceRtsNum = RtsNum;
+            }
+
+            SC_BeginRts(InstanceIndex, SC_RTS_NUM_NULL, 0);
+
+            SC_OperData.HkPacket.Payload.CmdCtr++;
+
+            CFE_EVS_SendEvent(SC_STARTRTS_INSTANCE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                              "RTS %03u Started as Instance RTS %03u", SC_IDNUM_AS_UINT(RtsNum),
+                              SC_IDNUM_AS_UINT(InstanceRtsNum));
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Stop every instance running the commands of an RTS              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_KillRtsInstances(SC_RtsIndex_t RtsIndex)
+{
+    uint16 i;
+
+    for (i = 0; i < SC_NUMBER_OF_RTS; i++)
+    {
+        if (SC_IDNUM_EQUAL(SC_GetRtsInfoObject(SC_RTS_IDX_C(i))->SourceRtsNum, SC_RtsIndexToNum(RtsIndex)))
+        {
+            SC_KillRts(SC_RTS_IDX_C(i));
+        }
     }
 }
 
@@ -599,3 +1280,136 @@ void SC_AutoStartRts(SC_RtsNum_t RtsNum)
                           "RTS autostart error: invalid RTS ID %u", SC_IDNUM_AS_UINT(RtsNum));
     }
 }
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Handle the messages waiting on the trigger pipe                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_ProcessTriggerPipe(void)
+{
+    CFE_SB_Buffer_t *BufPtr = NULL;
+    CFE_Status_t     Result = CFE_SUCCESS;
+    int32            i;
+
+    /* no more than the pipe holds, so a steady stream can't keep SC from its command pipe */
+    for (i = 0; (i < SC_TRIGGER_PIPE_DEPTH) && (Result == CFE_SUCCESS); i++)
+    {
+        Result = CFE_SB_ReceiveBuffer(&BufPtr, SC_OperData.TriggerPipe, CFE_SB_POLL);
+        if (Result == CFE_SUCCESS)
+        {
+            SC_GetCurrentTime();
+
+            /* a message of a trigger just loaded over may still be queued, and is dropped */
+            SC_ProcessTriggers(BufPtr);
+
+            SC_FlushDeferredEvents();
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Start the RTSs of the triggers on a message                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool SC_ProcessTriggers(const CFE_SB_Buffer_t *BufPtr)
+{
+    CFE_SB_MsgId_t     MessageID = CFE_SB_INVALID_MSG_ID;
+    CFE_MSG_Size_t     MsgSize   = 0;
+    SC_TriggerEntry_t *TriggerPtr;
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+    SC_RtsIndex_t      RtsIndex;
+    bool               IsTrigger = false;
+    int32              i;
+
+    CFE_MSG_GetMsgId(&BufPtr->Msg, &MessageID);
+    CFE_MSG_GetSize(&BufPtr->Msg, &MsgSize);
+
+    /* only message IDs subscribed to for the trigger table are triggers */
+    for (i = 0; i < SC_AppData.TriggerMsgIdCount; i++)
+    {
+        IsTrigger |= CFE_SB_MsgId_Equal(SC_AppData.TriggerMsgId[i], MessageID);
+    }
+
+    if (IsTrigger && (SC_OperData.TriggerTblAddr != NULL))
+    {
+        for (i = 0; i < SC_NUMBER_OF_TRIGGERS; i++)
+        {
+            TriggerPtr = &SC_OperData.TriggerTblAddr[i];
+
+            if ((TriggerPtr->MsgId != 0) && CFE_SB_MsgId_Equal(CFE_SB_ValueToMsgId(TriggerPtr->MsgId), MessageID) &&
+                SC_TriggerMatches(TriggerPtr, &BufPtr->Msg, MsgSize))
+            {
+                /* the table is validated on load, so the RTS number is in range */
+                RtsIndex   = SC_RtsNumToIndex(TriggerPtr->RtsNum);
+                RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+                /* events are debug only, a trigger may fire every cycle */
+                if ((RtsInfoPtr->DisabledFlag == false) && (RtsInfoPtr->RtsStatus == SC_Status_LOADED))
+                {
+                    SC_BeginRts(RtsIndex, SC_RTS_NUM_NULL, 0);
+
+                    CFE_EVS_SendEvent(SC_TRIGGER_RTS_STARTED_DBG_EID, CFE_EVS_EventType_DEBUG,
+                                      "Trigger %d started RTS %03u", (int)i, SC_IDNUM_AS_UINT(TriggerPtr->RtsNum));
+                }
+                else
+                {
+                    SC_OperData.HkPacket.Payload.RtsActiveErrCtr++;
+
+                    CFE_EVS_SendEvent(SC_TRIGGER_RTS_SKIPPED_DBG_EID, CFE_EVS_EventType_DEBUG,
+                                      "Trigger %d skipped RTS %03u: RTS Status = %d, Disabled = %d", (int)i,
+                                      SC_IDNUM_AS_UINT(TriggerPtr->RtsNum), RtsInfoPtr->RtsStatus,
+                                      RtsInfoPtr->DisabledFlag);
+                }
+            }
+        }
+    }
+
+    return IsTrigger;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Check the field match of a trigger against a message            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool SC_TriggerMatches(const SC_TriggerEntry_t *TriggerPtr, const CFE_MSG_Message_t *Msg, CFE_MSG_Size_t MsgSize)
+{
+    const uint8 *FieldPtr;
+    uint16       Field16;
+    uint32       Field32;
+    bool         Result = true;
+
+    if (TriggerPtr->MatchSize != 0)
+    {
+        if ((TriggerPtr->MatchOffset + TriggerPtr->MatchSize) > MsgSize)
+        {
+            /* a message too short to hold the field never matches */
+            Result = false;
+        }
+        else
+        {
+            /* the field may not be aligned in the message */
+            FieldPtr = (const uint8 *)Msg + TriggerPtr->MatchOffset;
+
+            if (TriggerPtr->MatchSize == sizeof(uint8))
+            {
+                Field32 = *FieldPtr;
+            }
+            else if (TriggerPtr->MatchSize == sizeof(uint16))
+            {
+                memcpy(&Field16, FieldPtr, sizeof(Field16));
+                Field32 = Field16;
+            }
+            else
+            {
+                memcpy(&Field32, FieldPtr, sizeof(Field32));
+            }
+
+            Result = ((Field32 & TriggerPtr->MatchMask) == TriggerPtr->MatchValue);
+        }
+    }
+
+    return Result;
+}
@@ -26,9 +26,10 @@
 #ifndef SC_RTSRQ_H
 #define SC_RTSRQ_H
 
-#include "common_types.h"
+#include "cfe.h"
 #include "sc_index_types.h"
 #include "sc_msg.h"
+#include "sc_tbldefs.h"
 
 /**
  * \brief Start an RTS Command
@@ -45,6 +46,23 @@
  */
 void SC_StartRtsCmd(const SC_StartRtsCmd_t *Cmd);
 
+/**
+ * \brief Start an RTS with Arguments Command
+ *
+ *  \par Description
+ *             This routine starts the execution of an RTS as
+ *             #SC_StartRtsCmd does, and gives it the arguments from
+ *             the command for its patch entries.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        None
+ *
+ *  \param [in]         Cmd      Pointer to Software Bus buffer
+ *
+ *  \sa #SC_START_RTS_PARAM_CC
+ */
+void SC_StartRtsParamCmd(const SC_StartRtsParamCmd_t *Cmd);
+
 /**
  * \brief Start a group of RTS Command
  *
@@ -150,6 +168,101 @@ void SC_EnableRtsCmd(const SC_EnableRtsCmd_t *Cmd);
  */
 void SC_EnableRtsGrpCmd(const SC_EnableRtsGrpCmd_t *Cmd);
 
+/**
+ * \brief Start a set of RTS Command
+ *
+ *  \par Description
+ *             This routine starts the execution of each RTS in a
+ *             bitmask of RTS.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        None
+ *
+ *  \param [in]         Cmd      Pointer to Software Bus buffer
+ *
+ *  \sa #SC_START_RTS_SET_CC
+ */
+void SC_StartRtsSetCmd(const SC_StartRtsSetCmd_t *Cmd);
+
+/**
+ * \brief Stop a set of RTS Command
+ *
+ *  \par Description
+ *             This routine stops each executing RTS in a bitmask of RTS.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        None
+ *
+ *  \param [in]         Cmd      Pointer to Software Bus buffer
+ *
+ *  \sa #SC_STOP_RTS_SET_CC
+ */
+void SC_StopRtsSetCmd(const SC_StopRtsSetCmd_t *Cmd);
+
+/**
+ * \brief Disable a set of RTS Command
+ *
+ *  \par Description
+ *             This routine disables each RTS in a bitmask of RTS.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        None
+ *
+ *  \param [in]         Cmd      Pointer to Software Bus buffer
+ *
+ *  \sa #SC_DISABLE_RTS_SET_CC
+ */
+void SC_DisableRtsSetCmd(const SC_DisableRtsSetCmd_t *Cmd);
+
+/**
+ * \brief Enable a set of RTS Command
+ *
+ *  \par Description
+ *             This routine enables each RTS in a bitmask of RTS.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        None
+ *
+ *  \param [in]         Cmd      Pointer to Software Bus buffer
+ *
+ *  \sa #SC_ENABLE_RTS_SET_CC
+ */
+void SC_EnableRtsSetCmd(const SC_EnableRtsSetCmd_t *Cmd);
+
+/**
+ * \brief Set RTS Priority Command
+ *
+ *  \par Description
+ *             This routine gives each RTS in a bitmask of RTS a new
+ *             priority level for the RTP.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        None
+ *
+ *  \param [in]         Cmd      Pointer to Software Bus buffer
+ *
+ *  \sa #SC_SET_RTS_PRIORITY_CC
+ */
+void SC_SetRtsPriorityCmd(const SC_SetRtsPriorityCmd_t *Cmd);
+
+/**
+ * \brief Check the bitmask of an RTS set command
+ *
+ *  \par Description
+ *             Checks that a bitmask of RTS names at least one RTS, and
+ *             no RTS past #SC_NUMBER_OF_RTS.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        None
+ *
+ *  \param [in]         RtsSet   Bitmask of #SC_RTS_SET_WORDS words
+ *
+ *  \return Boolean validity
+ *  \retval true  The set may be acted on
+ *  \retval false The set is empty or names an invalid RTS
+ */
+bool SC_RtsSetIsValid(const uint16 RtsSet[]);
+
 /**
  * \brief Stops an RTS & clears out data
  *
@@ -163,6 +276,91 @@ void SC_EnableRtsGrpCmd(const SC_EnableRtsGrpCmd_t *Cmd);
  */
 void SC_KillRts(SC_RtsIndex_t RtsIndex);
 
+/**
+ * \brief Start an RTS Instance Command
+ *
+ *  \par Description
+ *             This routine starts an empty RTS executing the commands
+ *             of a loaded RTS, which may itself be executing.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        None
+ *
+ *  \param [in]         Cmd      Pointer to Software Bus buffer
+ *
+ *  \sa #SC_START_RTS_INSTANCE_CC
+ */
+void SC_StartRtsInstanceCmd(const SC_StartRtsInstanceCmd_t *Cmd);
+
+/**
+ * \brief Stop the instances of an RTS
+ *
+ *  \par Description
+ *      Stops every RTS executing as an instance of the given RTS, as
+ *      when the commands of the RTS are about to be replaced.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        None
+ *
+ *  \param [in]         RtsIndex       RTS index whose instances to stop (base zero)
+ */
+void SC_KillRtsInstances(SC_RtsIndex_t RtsIndex);
+
+/**
+ * \brief Sets up an RTS to begin executing
+ *
+ *  \par Description
+ *      Initializes the RTS info entry, counts the RTS as active and
+ *      finds its first command, carrying out any control entries before
+ *      it.  The RTS may complete or be stopped before this returns.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        The caller has already checked that the RTS may be started.
+ *        A calling RTS must already be waiting on this one.
+ *
+ *  \param [in]         RtsIndex       RTS index to start (base zero)
+ *  \param [in]         CallerRtsNum   RTS to return to, or #SC_RTS_NUM_NULL
+ *  \param [in]         CallDepth      Number of calls waiting on this RTS
+ */
+void SC_BeginRts(SC_RtsIndex_t RtsIndex, SC_RtsNum_t CallerRtsNum, uint16 CallDepth);
+
+/**
+ * \brief Carries out a call or chain entry in an RTS
+ *
+ *  \par Description
+ *      Starts the RTS named by an #SC_CALL_RTS_CC or #SC_CHAIN_RTS_CC
+ *      entry directly, without sending the entry on the Software Bus.
+ *      A call holds the calling RTS at the entry until the called RTS
+ *      returns; a chain ends the calling RTS and hands its caller, if any,
+ *      to the new RTS.  On any error the calling RTS is stopped.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        The entry is the next command of the RTS at RtsIndex
+ *
+ *  \param [in]         RtsIndex       RTS index holding the entry (base zero)
+ *  \param [in]         CommandCode    #SC_CALL_RTS_CC or #SC_CHAIN_RTS_CC
+ *  \param [in]         Cmd            Pointer to the command in the RTS
+ *
+ *  \return Whether the call or chain was carried out
+ *  \retval true  The named RTS was started
+ *  \retval false The entry failed and the calling RTS was stopped
+ */
+bool SC_ProcessRtsCall(SC_RtsIndex_t RtsIndex, CFE_MSG_FcnCode_t CommandCode, const SC_CallRtsCmd_t *Cmd);
+
+/**
+ * \brief Ends an RTS that ran to completion
+ *
+ *  \par Description
+ *      Stops the RTS and, if it was called and its caller is still
+ *      waiting on it, moves the caller on to its next command.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        None
+ *
+ *  \param [in]         RtsIndex       RTS index that completed (base zero)
+ */
+void SC_ReturnFromRts(SC_RtsIndex_t RtsIndex);
+
 /**
  * \brief Automatically starts an RTS
  *
@@ -177,4 +375,61 @@ void SC_KillRts(SC_RtsIndex_t RtsIndex);
  */
 void SC_AutoStartRts(SC_RtsNum_t RtsNum);
 
+/**
+ * \brief Handles the messages waiting on the trigger pipe
+ *
+ *  \par Description
+ *        Polls the trigger pipe, which is subscribed to the message IDs
+ *        named by the trigger table, and passes each message received to
+ *        #SC_ProcessTriggers.  At most #SC_TRIGGER_PIPE_DEPTH messages
+ *        are handled in one call.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        Called by the main loop each time it is done with the command
+ *        pipe, so trigger messages never wait in line with commands.
+ */
+void SC_ProcessTriggerPipe(void);
+
+/**
+ * \brief Starts the RTSs of the triggers on a message
+ *
+ *  \par Description
+ *        Checks a message that is not an SC input against the trigger
+ *        table, and starts the RTS of each trigger that matches it.  An
+ *        RTS that is disabled, not loaded or already executing is not
+ *        started, and counts as an RTS activation error.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        None
+ *
+ *  \param [in]  BufPtr  Pointer to the Software Bus message
+ *
+ *  \return Whether the message ID is one the trigger table names
+ *  \retval true   The message is a trigger message, whether or not it matched
+ *  \retval false  The message is not a trigger message
+ */
+bool SC_ProcessTriggers(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ * \brief Checks the field match of a trigger against a message
+ *
+ *  \par Description
+ *        Reads the field named by the trigger from the message and
+ *        compares it, masked, with the trigger value.  A trigger with
+ *        no field match always matches.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        The trigger is from a validated table, so the field size is
+ *        0, 1, 2 or 4 bytes.
+ *
+ *  \param [in]  TriggerPtr  Pointer to the trigger table entry
+ *  \param [in]  Msg         Pointer to the message
+ *  \param [in]  MsgSize     Size of the message in bytes
+ *
+ *  \return Match result
+ *  \retval true   The message fires the trigger
+ *  \retval false  The message does not fire the trigger
+ */
+bool SC_TriggerMatches(const SC_TriggerEntry_t *TriggerPtr, const CFE_MSG_Message_t *Msg, CFE_MSG_Size_t MsgSize);
+
 #endif
@@ -38,6 +38,7 @@
 #include "sc_utils.h"
 #include "sc_events.h"
 #include "sc_msgdefs.h"
+#include "sc_msgids.h"
 #include "sc_tbldefs.h"
 #include <string.h>
 
@@ -60,30 +61,81 @@ void SC_GetNextRtsTime(void)
     int16              i;             /* loop counter MUST be SIGNED !*/
     SC_RtsIndex_t      NextRts;       /* the next rts to schedule */
     uint32             NextWakeupCnt; /* the next wakeup count for the RTS */
+    uint32             RtsWakeupCnt;  /* the wakeup count the RTS is waiting for */
+    SC_RtsIndex_t      DueRts;        /* the due rts that goes first */
+    uint32             DueWakeupCnt;  /* the wakeup count of the due rts */
+    uint16             DuePriority;   /* the priority level of the due rts */
+    uint16             DueTurn;       /* how far the due rts is from its turn */
+    uint16             Priority;
+    uint16             Turn;
     SC_RtsInfoEntry_t *RtsInfoPtr;
 
+    SC_BeginPhase(SC_Phase_RTP_SCHEDULE);
+
     NextRts  = SC_INVALID_RTS_INDEX;
     NextWakeupCnt = SC_MAX_WAKEUP_CNT;
+    DueRts        = SC_INVALID_RTS_INDEX;
+    DueWakeupCnt  = SC_MAX_WAKEUP_CNT;
+    DuePriority   = SC_RTS_PRIORITY_LEVELS;
+    DueTurn       = SC_NUMBER_OF_RTS;
 
     /*
-     ** Go through the table backwards to account for the RTS priority
-     ** Lower number RTSs get higher priority
-     ** Backward processing ensures selection of the lowest RTS number
-     ** when multiple RTSs have the same next command wakeup count
+     ** Go through the table backwards so that, of the RTSs with nothing
+     ** due yet, the lowest RTS number is selected when several have the
+     ** same next command wakeup count. RTSs with a command due are
+     ** selected by priority level and turn instead.
      */
     for (i = SC_NUMBER_OF_RTS - 1; i >= 0; i--)
     {
         RtsInfoPtr = SC_GetRtsInfoObject(SC_RTS_IDX_C(i));
         if (RtsInfoPtr->RtsStatus == SC_Status_EXECUTING)
         {
-            if (RtsInfoPtr->NextCommandTgtWakeup <= NextWakeupCnt)
+            RtsWakeupCnt = RtsInfoPtr->NextCommandTgtWakeup;
+
+            /*
+             ** A timed RTS that is not held by a call waits on the
+             ** time its next command is due instead of a wakeup count
+             */
+            if (RtsInfoPtr->TimedFlag && RtsWakeupCnt != SC_MAX_WAKEUP_CNT &&
+                CFE_TIME_Compare(RtsInfoPtr->NextCommandTime, SC_AppData.CurrentSysTime) == CFE_TIME_A_GT_B)
+            {
+                RtsWakeupCnt = SC_MAX_WAKEUP_CNT;
+            }
+
+            if (RtsWakeupCnt <= NextWakeupCnt)
             {
-                NextWakeupCnt = RtsInfoPtr->NextCommandTgtWakeup;
+                NextWakeupCnt = RtsWakeupCnt;
                 NextRts  = SC_RTS_IDX_C(i);
             } /* end if */
+
+            /*
+             ** Of the RTSs with a command due, the highest priority level
+             ** goes first, and within a level the RTS that comes next after
+             ** the last one of that level to send a command
+             */
+            if (RtsWakeupCnt <= SC_AppData.CurrentWakeupCount)
+            {
+                Priority = SC_GetRtsPriority(SC_RTS_IDX_C(i));
+                Turn     = (i + SC_NUMBER_OF_RTS - 1 - SC_IDX_AS_UINT(SC_AppData.RtsLastServed[Priority])) %
+                       SC_NUMBER_OF_RTS;
+
+                if (Priority < DuePriority || (Priority == DuePriority && Turn < DueTurn))
+                {
+                    DueRts       = SC_RTS_IDX_C(i);
+                    DueWakeupCnt = RtsWakeupCnt;
+                    DuePriority  = Priority;
+                    DueTurn      = Turn;
+                }
+            }
         }     /* end if */
     }         /* end for */
 
+    if (SC_RtsIndexIsValid(DueRts))
+    {
+        NextRts       = DueRts;
+        NextWakeupCnt = DueWakeupCnt;
+    }
+
     if (!SC_RtsIndexIsValid(NextRts))
     {
         SC_OperData.RtsCtrlBlckAddr->CurrRtsNum = SC_RTS_NUM_NULL;
@@ -94,6 +146,8 @@ void SC_GetNextRtsTime(void)
         SC_OperData.RtsCtrlBlckAddr->CurrRtsNum = SC_RtsIndexToNum(NextRts);
         SC_AppData.NextCmdTime[SC_Process_RTP]  = NextWakeupCnt;
     } /* end if */
+
+    SC_EndPhase(SC_Phase_RTP_SCHEDULE);
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -105,7 +159,6 @@ void SC_GetNextRtsCommand(void)
 {
     SC_RtsIndex_t      RtsIndex;
     SC_EntryOffset_t   CmdOffset;
-    SC_EntryOffset_t   PendingOffset;
     SC_RtsEntry_t *    EntryPtr;
     CFE_MSG_Size_t     CmdLength = 0;
     SC_RtsInfoEntry_t *RtsInfoPtr;
@@ -139,131 +192,334 @@ void SC_GetNextRtsCommand(void)
              */
 
             CmdOffset = SC_EntryOffsetAdvance(CmdOffset, CmdLength);
+
+            SC_SeekRtsCommand(RtsIndex, CmdOffset);
+
+        } /* end if the RTS status is EXECUTING */
+
+    } /* end if the RTS number is valid */
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Finds the next command to send in an RTS                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_SeekRtsCommand(SC_RtsIndex_t RtsIndex, SC_EntryOffset_t CmdOffset)
+{
+    SC_EntryOffset_t   PendingOffset;
+    SC_RtsEntry_t *    EntryPtr;
+    CFE_MSG_Size_t     CmdLength = 0;
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+    SC_RtsNum_t        RtsNum;
+    CFE_SB_MsgId_t     MessageID;
+    CFE_MSG_FcnCode_t  CommandCode;
+    uint16             CtrlSteps = 0;
+    bool               Seeking   = true;
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+    RtsNum     = SC_RtsIndexToNum(RtsIndex);
+
+    /* patch entries only apply to the command that follows them */
+    RtsInfoPtr->PatchCount = 0;
+
+    /*
+     ** Control entries send nothing, so keep looking
+     ** until a command is found or the RTS ends
+     */
+    while (Seeking)
+    {
+        Seeking = false;
+
+        /*
+         ** if the end of the buffer is not reached.
+         ** This check is made to make sure that at least the minimum
+         ** Sized packet fits in the buffer. It assures we are not reading
+         ** bogus length info from other data.
+         */
+
+        /* If at least the header for a command plus the RTS header can fit in the buffer */
+        if ((SC_GetRtsSize(RtsIndex) >= SC_RTS_HDR_WORDS) &&
+            SC_IDX_WITHIN_LIMIT(CmdOffset, 1 + SC_GetRtsSize(RtsIndex) - SC_RTS_HDR_WORDS))
+        {
             /*
-             ** if the end of the buffer is not reached.
-             ** This check is made to make sure that at least the minimum
-             ** Sized packet fits in the buffer. It assures we are not reading
-             ** bogus length info from other data.
+             ** Get the next RTS command
              */
+            EntryPtr = SC_GetRtsEntryAtOffset(RtsIndex, CmdOffset);
 
-            /* If at least the header for a command plus the RTS header can fit in the buffer */
-            if (SC_IDX_WITHIN_LIMIT(CmdOffset, 1 + SC_RTS_BUFF_SIZE32 - SC_RTS_HDR_WORDS))
-            {
-                /*
-                 ** Get the next RTS command
-                 */
-                EntryPtr = SC_GetRtsEntryAtOffset(RtsIndex, CmdOffset);
+            /*
+             ** get the length of the new command
+             */
+            CFE_MSG_GetSize(CFE_MSG_PTR(EntryPtr->Msg), &CmdLength);
+            CmdLength += SC_RTS_HEADER_SIZE;
 
-                /*
-                 ** get the length of the new command
-                 */
-                CFE_MSG_GetSize(CFE_MSG_PTR(EntryPtr->Msg), &CmdLength);
-                CmdLength += SC_RTS_HEADER_SIZE;
+            /*
+             ** Check to see if the command length is less than the size of a header.
+             ** This indicates that there are no more commands
+             */
 
+            if ((CmdLength - SC_RTS_HEADER_SIZE) >= (SC_PACKET_MIN_SIZE))
+            {
                 /*
-                 ** Check to see if the command length is less than the size of a header.
-                 ** This indicates that there are no more commands
+                 ** Check to see if the command length is too big
+                 ** If it is , then there is an error with the command
                  */
-
-                if ((CmdLength - SC_RTS_HEADER_SIZE) >= (SC_PACKET_MIN_SIZE))
+                if ((CmdLength - SC_RTS_HEADER_SIZE) <= SC_PACKET_MAX_SIZE)
                 {
                     /*
-                     ** Check to see if the command length is too big
-                     ** If it is , then there is an error with the command
+                     ** Last Check is to check to see if the command
+                     ** runs off of the end of the buffer
+                     ** (plus 1 to round byte len up to word len)
                      */
-                    if ((CmdLength - SC_RTS_HEADER_SIZE) <= SC_PACKET_MAX_SIZE)
+                    PendingOffset = SC_EntryOffsetAdvance(CmdOffset, CmdLength);
+                    if (SC_IDX_WITHIN_LIMIT(PendingOffset, 1 + SC_GetRtsSize(RtsIndex)))
                     {
-                        /*
-                         ** Last Check is to check to see if the command
-                         ** runs off of the end of the buffer
-                         ** (plus 1 to round byte len up to word len)
-                         */
-                        PendingOffset = SC_EntryOffsetAdvance(CmdOffset, CmdLength);
-                        if (SC_IDX_WITHIN_LIMIT(PendingOffset, 1 + SC_RTS_BUFF_SIZE32))
+                        MessageID   = CFE_SB_INVALID_MSG_ID;
+                        CommandCode = 0;
+                        CFE_MSG_GetMsgId(CFE_MSG_PTR(EntryPtr->Msg), &MessageID);
+                        CFE_MSG_GetFcnCode(CFE_MSG_PTR(EntryPtr->Msg), &CommandCode);
+
+                        if (CFE_SB_MsgIdToValue(MessageID) == SC_CMD_MID &&
+                            (CommandCode == SC_RTS_LOOP_CC || CommandCode == SC_RTS_END_LOOP_CC ||
+                             CommandCode == SC_RTS_GOTO_CC || CommandCode == SC_RTS_PATCH_CC ||
+                             CommandCode == SC_RTS_TIMED_CC))
                         {
                             /*
-                             ** Everything passed!
-                             ** Update the proper next command wakeup count for that RTS
-                             */
-                            RtsInfoPtr->NextCommandTgtWakeup = SC_ComputeAbsWakeup(EntryPtr->Header.WakeupCount);
-
-                            /*
-                             ** Update the appropriate RTS info table current command pointer
+                             ** Control entries are carried out as soon as they are
+                             ** reached, and the search goes on from where they lead.
+                             ** A run of them with no command is taken to be stuck.
                              */
-                            RtsInfoPtr->NextCommandPtr = CmdOffset;
+                            if (CtrlSteps < SC_RTS_MAX_CTRL_STEPS)
+                            {
+                                CtrlSteps++;
+                                Seeking = SC_ProcessRtsControl(RtsIndex, CommandCode, &CmdOffset);
+                            }
+                            else
+                            {
+                                SC_OperData.HkPacket.Payload.RtsCmdErrCtr++;
+                                SC_CountRtsCmdErr(RtsIndex);
+                                SC_OperData.HkPacket.Payload.LastRtsErrSeq = RtsNum;
+                                SC_OperData.HkPacket.Payload.LastRtsErrCmd = CmdOffset;
+
+                                SC_KillRts(RtsIndex);
+                                CFE_EVS_SendEvent(SC_RTS_CTRL_STEPS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                                  "RTS %03u Aborted: %d Control Entries Without a Command at Offset %u",
+                                                  SC_IDNUM_AS_UINT(RtsNum), SC_RTS_MAX_CTRL_STEPS,
+                                                  (unsigned int)SC_IDX_AS_UINT(CmdOffset));
+                            }
                         }
                         else
-                        { /* the command runs past the end of the buffer */
-
+                        {
                             /*
-                             ** Having a command that runs off of the end of the buffer
-                             ** is an error condition, so record it
+                             ** Everything passed!
+                             ** Update the proper next command wakeup count for that RTS,
+                             ** or for a timed RTS the time it is due, leaving it free
+                             ** to run on any wakeup from now on once that time comes
                              */
-                            SC_OperData.HkPacket.Payload.RtsCmdErrCtr++;
-                            RtsInfoPtr->CmdErrCtr++;
-                            SC_OperData.HkPacket.Payload.LastRtsErrSeq = SC_OperData.RtsCtrlBlckAddr->CurrRtsNum;
-                            SC_OperData.HkPacket.Payload.LastRtsErrCmd = CmdOffset;
+                            if (RtsInfoPtr->TimedFlag)
+                            {
+                                RtsInfoPtr->NextCommandTime =
+                                    SC_ComputeRtsDueTime(RtsInfoPtr->NextCommandTime, EntryPtr->Header.WakeupCount);
+                                RtsInfoPtr->NextCommandTgtWakeup = SC_AppData.CurrentWakeupCount;
+                            }
+                            else
+                            {
+                                RtsInfoPtr->NextCommandTgtWakeup = SC_ComputeAbsWakeup(EntryPtr->Header.WakeupCount);
+                            }
 
                             /*
-                             ** Stop the RTS from executing
+                             ** Update the appropriate RTS info table current command pointer
                              */
-                            SC_KillRts(RtsIndex);
-                            CFE_EVS_SendEvent(SC_RTS_LNGTH_ERR_EID, CFE_EVS_EventType_ERROR,
-                                              "Cmd Runs passed end of table, RTS %03u Aborted",
-                                              SC_IDNUM_AS_UINT(SC_OperData.RtsCtrlBlckAddr->CurrRtsNum));
-
-                        } /* end if the command runs off the end of the buffer */
+                            RtsInfoPtr->NextCommandPtr = CmdOffset;
+                        }
                     }
                     else
-                    { /* the command length is too large */
+                    { /* the command runs past the end of the buffer */
 
-                        /* update the error information */
+                        /*
+                         ** Having a command that runs off of the end of the buffer
+                         ** is an error condition, so record it
+                         */
                         SC_OperData.HkPacket.Payload.RtsCmdErrCtr++;
-                        RtsInfoPtr->CmdErrCtr++;
-                        SC_OperData.HkPacket.Payload.LastRtsErrSeq = SC_OperData.RtsCtrlBlckAddr->CurrRtsNum;
+                        SC_CountRtsCmdErr(RtsIndex);
+                        SC_OperData.HkPacket.Payload.LastRtsErrSeq = RtsNum;
                         SC_OperData.HkPacket.Payload.LastRtsErrCmd = CmdOffset;
 
-                        /* Stop the RTS from executing */
+                        /*
+                         ** Stop the RTS from executing
+                         */
                         SC_KillRts(RtsIndex);
-                        CFE_EVS_SendEvent(SC_RTS_CMD_LNGTH_ERR_EID, CFE_EVS_EventType_ERROR,
-                                          "Invalid Length Field in RTS Command, RTS %03u Aborted. Length: %u, Max: %d",
-                                          SC_IDNUM_AS_UINT(SC_OperData.RtsCtrlBlckAddr->CurrRtsNum),
-                                          (unsigned int)(CmdLength - (uint16)SC_RTS_HEADER_SIZE), SC_PACKET_MAX_SIZE);
+                        CFE_EVS_SendEvent(SC_RTS_LNGTH_ERR_EID, CFE_EVS_EventType_ERROR,
+                                          "Cmd Runs passed end of table, RTS %03u Aborted", SC_IDNUM_AS_UINT(RtsNum));
 
-                    } /* end if the command length is invalid */
+                    } /* end if the command runs off the end of the buffer */
                 }
                 else
-                { /* The command length is zero indicating no more cmds */
-                    /*
-                     **  This is not an error condition, so stop the RTS
-                     */
+                { /* the command length is too large */
+
+                    /* update the error information */
+                    SC_OperData.HkPacket.Payload.RtsCmdErrCtr++;
+                    SC_CountRtsCmdErr(RtsIndex);
+                    SC_OperData.HkPacket.Payload.LastRtsErrSeq = RtsNum;
+                    SC_OperData.HkPacket.Payload.LastRtsErrCmd = CmdOffset;
 
                     /* Stop the RTS from executing */
                     SC_KillRts(RtsIndex);
-                    if (SC_RtsNumHasEvent(SC_OperData.RtsCtrlBlckAddr->CurrRtsNum))
-                    {
-                        CFE_EVS_SendEvent(SC_RTS_COMPL_INF_EID, CFE_EVS_EventType_INFORMATION,
-                                          "RTS %03u Execution Completed",
-                                          SC_IDNUM_AS_UINT(SC_OperData.RtsCtrlBlckAddr->CurrRtsNum));
-                    }
-                }
+                    CFE_EVS_SendEvent(SC_RTS_CMD_LNGTH_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "Invalid Length Field in RTS Command, RTS %03u Aborted. Length: %u, Max: %d",
+                                      SC_IDNUM_AS_UINT(RtsNum), (unsigned int)(CmdLength - (uint16)SC_RTS_HEADER_SIZE),
+                                      SC_PACKET_MAX_SIZE);
+
+                } /* end if the command length is invalid */
             }
             else
-            { /* The end of the RTS buffer has been reached... */
-                /* Stop the RTS from executing */
-                SC_KillRts(RtsIndex);
-                if (SC_RtsNumHasEvent(SC_OperData.RtsCtrlBlckAddr->CurrRtsNum))
+            { /* The command length is zero indicating no more cmds */
+                /*
+                 **  This is not an error condition, so stop the RTS
+                 */
+
+                if (SC_RtsNumHasEvent(RtsNum) && !SC_DeferEvent(SC_RTS_COMPL_INF_EID, SC_IDNUM_AS_UINT(RtsNum)))
                 {
                     CFE_EVS_SendEvent(SC_RTS_COMPL_INF_EID, CFE_EVS_EventType_INFORMATION,
-                                      "RTS %03u Execution Completed",
-                                      SC_IDNUM_AS_UINT(SC_OperData.RtsCtrlBlckAddr->CurrRtsNum));
+                                      "RTS %03u Execution Completed", SC_IDNUM_AS_UINT(RtsNum));
                 }
 
-            } /* end if */
+                /* Stop the RTS from executing and resume its caller */
+                SC_ReturnFromRts(RtsIndex);
+            }
+        }
+        else
+        { /* The end of the RTS buffer has been reached... */
+            if (SC_RtsNumHasEvent(RtsNum) && !SC_DeferEvent(SC_RTS_COMPL_INF_EID, SC_IDNUM_AS_UINT(RtsNum)))
+            {
+                CFE_EVS_SendEvent(SC_RTS_COMPL_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                  "RTS %03u Execution Completed", SC_IDNUM_AS_UINT(RtsNum));
+            }
 
-        } /* end if the RTS status is EXECUTING */
+            /* Stop the RTS from executing and resume its caller */
+            SC_ReturnFromRts(RtsIndex);
 
-    } /* end if the RTS number is valid */
+        } /* end if */
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Carries out an RTS loop, end loop, goto, patch or timed entry   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool SC_ProcessRtsControl(SC_RtsIndex_t RtsIndex, CFE_MSG_FcnCode_t CommandCode, SC_EntryOffset_t *CmdOffset)
+{
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+    SC_RtsEntry_t *    EntryPtr;
+    SC_RtsNum_t        RtsNum;
+    SC_EntryOffset_t   NextOffset;
+    CFE_MSG_Size_t     CmdLength = 0;
+    uint16             Loop;
+    bool               Repeat;
+    bool               Success = true;
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+    RtsNum     = SC_RtsIndexToNum(RtsIndex);
+    EntryPtr   = SC_GetRtsEntryAtOffset(RtsIndex, *CmdOffset);
+
+    CFE_MSG_GetSize(CFE_MSG_PTR(EntryPtr->Msg), &CmdLength);
+    NextOffset = SC_EntryOffsetAdvance(*CmdOffset, CmdLength + SC_RTS_HEADER_SIZE);
+
+    if (CommandCode == SC_RTS_LOOP_CC)
+    {
+        if (RtsInfoPtr->LoopDepth >= SC_RTS_MAX_LOOP_DEPTH)
+        {
+            CFE_EVS_SendEvent(SC_RTS_LOOP_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "RTS %03u Aborted: Loops Nested Over %d Deep at Offset %u", SC_IDNUM_AS_UINT(RtsNum),
+                              SC_RTS_MAX_LOOP_DEPTH, (unsigned int)SC_IDX_AS_UINT(*CmdOffset));
+            Success = false;
+        }
+        else
+        {
+            /* the loop body starts with the entry after this one */
+            Loop                        = RtsInfoPtr->LoopDepth;
+            RtsInfoPtr->LoopCount[Loop] = ((const SC_RtsLoopCmd_t *)&EntryPtr->Msg)->Payload.LoopCount;
+            RtsInfoPtr->LoopStart[Loop] = NextOffset;
+            RtsInfoPtr->LoopDepth       = Loop + 1;
+            *CmdOffset                  = NextOffset;
+        }
+    }
+    else if (CommandCode == SC_RTS_END_LOOP_CC)
+    {
+        if (RtsInfoPtr->LoopDepth == 0)
+        {
+            CFE_EVS_SendEvent(SC_RTS_LOOP_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "RTS %03u Aborted: End Loop Without a Loop at Offset %u", SC_IDNUM_AS_UINT(RtsNum),
+                              (unsigned int)SC_IDX_AS_UINT(*CmdOffset));
+            Success = false;
+        }
+        else
+        {
+            Loop = RtsInfoPtr->LoopDepth - 1;
+
+            Repeat = (RtsInfoPtr->LoopCount[Loop] == SC_RTS_LOOP_FOREVER);
+            if (!Repeat)
+            {
+                RtsInfoPtr->LoopCount[Loop]--;
+                Repeat = (RtsInfoPtr->LoopCount[Loop] != 0);
+            }
+
+            if (Repeat)
+            {
+                /* go around again */
+                *CmdOffset = RtsInfoPtr->LoopStart[Loop];
+            }
+            else
+            {
+                /* the loop is done, carry on after it */
+                RtsInfoPtr->LoopDepth = Loop;
+                *CmdOffset            = NextOffset;
+            }
+        }
+    }
+    else if (CommandCode == SC_RTS_PATCH_CC)
+    {
+        if (RtsInfoPtr->PatchCount >= SC_RTS_MAX_PATCHES)
+        {
+            CFE_EVS_SendEvent(SC_RTS_PATCH_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "RTS %03u Aborted: Over %d Patches for One Command at Offset %u",
+                              SC_IDNUM_AS_UINT(RtsNum), SC_RTS_MAX_PATCHES, (unsigned int)SC_IDX_AS_UINT(*CmdOffset));
+            Success = false;
+        }
+        else
+        {
+            /* the patch is applied when the command after it is sent */
+            RtsInfoPtr->PatchEntry[RtsInfoPtr->PatchCount] = *CmdOffset;
+            RtsInfoPtr->PatchCount++;
+            *CmdOffset = NextOffset;
+        }
+    }
+    else if (CommandCode == SC_RTS_TIMED_CC)
+    {
+        /* the delays of the commands after this are times, counted from now */
+        RtsInfoPtr->TimedFlag       = true;
+        RtsInfoPtr->NextCommandTime = SC_AppData.CurrentSysTime;
+        *CmdOffset                  = NextOffset;
+    }
+    else
+    {
+        /* a goto leaves any loops in progress, its target was checked at load time */
+        RtsInfoPtr->LoopDepth = 0;
+        *CmdOffset            = SC_ENTRY_OFFSET_C(((const SC_RtsGotoCmd_t *)&EntryPtr->Msg)->Payload.EntryOffset);
+    }
+
+    if (!Success)
+    {
+        SC_OperData.HkPacket.Payload.RtsCmdErrCtr++;
+        SC_CountRtsCmdErr(RtsIndex);
+        SC_OperData.HkPacket.Payload.LastRtsErrSeq = RtsNum;
+        SC_OperData.HkPacket.Payload.LastRtsErrCmd = *CmdOffset;
+
+        SC_KillRts(RtsIndex);
+    }
+
+    return Success;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -28,6 +28,7 @@
 #define SC_STATE_H
 
 #include "cfe.h"
+#include "sc_index_types.h"
 
 /**
  * \brief Gets the next wakeup count for an RTS command to run
@@ -36,9 +37,15 @@
  *         This function searches the RTS info table to find
  *         the next RTS that needs to run based on the wakeup
  *         count that the RTS needs to run and it's priority.
+ *         Of the RTSs with a command due, the one at the highest
+ *         priority level goes first, and the RTSs of one level take
+ *         turns.  If none is due, the RTS due soonest is selected.
  *
  *  \par Assumptions, External Events, and Notes:
- *        None
+ *        An RTS timed by #SC_RTS_TIMED_CC is only considered once the
+ *        time its next command is due has come.  Only the RTP control
+ *        block and next command time are written, the RTS info table is
+ *        left as it is.
  */
 void SC_GetNextRtsTime(void);
 
@@ -58,6 +65,52 @@ void SC_GetNextRtsTime(void);
  */
 void SC_GetNextRtsCommand(void);
 
+/**
+ * \brief Finds the next command to send in an RTS
+ *
+ *  \par Description
+ *         Starting with the entry at the given offset, this routine
+ *         finds the next command the RTS is to send and sets the RTS
+ *         to send it at the wakeup count given by its entry, or at the time
+ *         given by its entry if the RTS is timed.  Loop, end loop, goto,
+ *         patch and timed entries found on the way are carried out as
+ *         they are reached.  If there are no more commands the RTS completes,
+ *         and if an entry is invalid the RTS is stopped.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        The RTS must be EXECUTING.
+ *
+ *  \param [in]    RtsIndex    RTS index to search (base zero)
+ *  \param [in]    CmdOffset   Word offset of the first entry to consider
+ */
+void SC_SeekRtsCommand(SC_RtsIndex_t RtsIndex, SC_EntryOffset_t CmdOffset);
+
+/**
+ * \brief Carries out an RTS loop, end loop, goto, patch or timed entry
+ *
+ *  \par Description
+ *         Applies the control entry at the given offset to the RTS and
+ *         returns the offset of the entry the RTS continues from.  If the
+ *         entry can't be carried out the RTS is stopped.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        The entry is known to be a valid #SC_RTS_LOOP_CC,
+ *        #SC_RTS_END_LOOP_CC, #SC_RTS_GOTO_CC, #SC_RTS_PATCH_CC or
+ *        #SC_RTS_TIMED_CC entry.
+ *        A patch entry is only recorded here, it is applied when the
+ *        command after it is sent.
+ *
+ *  \param [in]    RtsIndex     RTS index holding the entry (base zero)
+ *  \param [in]    CommandCode  Command code of the entry
+ *  \param [in,out] CmdOffset   Offset of the entry on entry, offset to
+ *                               continue from on return
+ *
+ *  \return Boolean success
+ *  \retval true  The RTS continues from CmdOffset
+ *  \retval false The RTS was stopped
+ */
+bool SC_ProcessRtsControl(SC_RtsIndex_t RtsIndex, CFE_MSG_FcnCode_t CommandCode, SC_EntryOffset_t *CmdOffset);
+
 /**
  * \brief Gets the next ATS command to run
  *
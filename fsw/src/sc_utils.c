@@ -32,8 +32,25 @@
 #include "sc_utils.h"
 #include "sc_events.h"
 #include "sc_msgids.h"
+#include "sc_perfids.h"
 #include <string.h>
 
+/**************************************************************************
+ **
+ ** Local data
+ **
+ **************************************************************************/
+
+/* performance ID of each processing phase */
+static const uint32 SC_PHASE_PERF_ID[SC_Phase_MAX] = {[SC_Phase_WAKEUP]       = SC_WAKEUP_PERF_ID,
+                                                     [SC_Phase_ATP_DISPATCH] = SC_ATP_DISPATCH_PERF_ID,
+                                                     [SC_Phase_RTP_SCHEDULE] = SC_RTP_SCHEDULE_PERF_ID,
+                                                     [SC_Phase_LOAD_ATS]     = SC_LOAD_ATS_PERF_ID,
+                                                     [SC_Phase_BUILD_INDEX]  = SC_BUILD_INDEX_PERF_ID,
+                                                     [SC_Phase_VERIFY_ATS]   = SC_VERIFY_ATS_PERF_ID,
+                                                     [SC_Phase_APPEND]       = SC_APPEND_PERF_ID,
+                                                     [SC_Phase_SEND_HK]      = SC_SEND_HK_PERF_ID};
+
 /**************************************************************************
  **
  ** Functions
@@ -71,8 +88,9 @@ void SC_GetCurrentTime(void)
     /* Use SC defined time */
     TempTime = SC_AppData.TimeRef.GetTime();
 
-    /* We don't care about subseconds */
-    SC_AppData.CurrentTime = TempTime.Seconds;
+    /* ATSs don't care about subseconds, timed RTSs do */
+    SC_AppData.CurrentTime    = TempTime.Seconds;
+    SC_AppData.CurrentSysTime = TempTime;
 }
 
 SC_AbsTimeTag_t SC_GetAtsEntryTime(SC_AtsEntryHeader_t *Entry)
@@ -80,8 +98,8 @@ SC_AbsTimeTag_t SC_GetAtsEntryTime(SC_AtsEntryHeader_t *Entry)
     /*
     ** ATS Entry Header looks like this...
     **
-    **    uint16 Pad;
-    **    uint16 CmdNumber;
+    **    uint16 Pad;        (omitted if SC_CMD_INDEX_BITS is 32)
+    **    SC_CommandNum_t CmdNumber;
     **
     **    uint16 TimeTag_MS;
     **    uint16 TimeTag_LS;
@@ -129,7 +147,305 @@ SC_AbsTimeTag_t SC_ComputeAbsTime(uint32 RelTime)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 uint32 SC_ComputeAbsWakeup(uint32 RelWakeup)
 {
-    return SC_AppData.CurrentWakeupCount + RelWakeup;
+    uint32 NextWakeup = SC_AppData.CurrentWakeupCount;
+
+    /* between wakeups the count is still that of the last one, so the first chance is the next */
+    if (!SC_AppData.InWakeup)
+    {
+        NextWakeup++;
+    }
+
+    return NextWakeup + RelWakeup;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compute when a timed RTS command is due                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_TIME_SysTime_t SC_ComputeRtsDueTime(CFE_TIME_SysTime_t PrevTime, uint32 RelTime)
+{
+    CFE_TIME_SysTime_t RelTimeWSubs;
+
+    /*
+     ** The upper half of the relative time is seconds and the lower
+     ** half is 1/65536ths of a second, the top of the subseconds field
+     */
+    RelTimeWSubs.Seconds    = RelTime >> 16;
+    RelTimeWSubs.Subseconds = (RelTime & 0xFFFF) << 16;
+
+    return CFE_TIME_Add(PrevTime, RelTimeWSubs);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compute the time spanned by a number of wakeups                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_TIME_SysTime_t SC_WakeupsToTime(uint32 Wakeups)
+{
+    CFE_TIME_SysTime_t Span;
+
+    /* the wakeups left over from whole seconds are a fraction of 2^32 subseconds */
+    Span.Seconds    = Wakeups / SC_WAKEUPS_PER_SECOND;
+    Span.Subseconds = (uint32)(((uint64)(Wakeups % SC_WAKEUPS_PER_SECOND) << 32) / SC_WAKEUPS_PER_SECOND);
+
+    return Span;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compute the microseconds between two times                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 SC_ElapsedUsec(CFE_TIME_SysTime_t StartTime, CFE_TIME_SysTime_t EndTime)
+{
+    CFE_TIME_SysTime_t Delta;
+    uint32             ElapsedUsec = 0;
+
+    /*
+     ** An end before the start can only be due to the clock
+     ** being adjusted, count it as no time at all
+     */
+    if (CFE_TIME_Compare(EndTime, StartTime) == CFE_TIME_A_GT_B)
+    {
+        Delta = CFE_TIME_Subtract(EndTime, StartTime);
+
+        /* saturate rather than wrap, past about 71 minutes */
+        if (Delta.Seconds < (SC_MAX_TIME / 1000000))
+        {
+            ElapsedUsec = (Delta.Seconds * 1000000) + CFE_TIME_Sub2MicroSecs(Delta.Subseconds);
+        }
+        else
+        {
+            ElapsedUsec = SC_MAX_TIME;
+        }
+    }
+
+    return ElapsedUsec;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Record how late a command was sent                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_RecordDispatchLatency(SC_Process_Enum_t Process, CFE_TIME_SysTime_t ScheduledTime)
+{
+    SC_LatencyHist_t  *HistPtr = &SC_OperData.DiagPacket.Payload.Latency[Process];
+    CFE_TIME_SysTime_t SentTime;
+    uint32             LatencyUsec;
+    uint32             Scaled;
+    uint16             Bin = 0;
+
+    SentTime = SC_AppData.TimeRef.GetTime();
+
+    /* a command sent "early" counts as on time */
+    LatencyUsec = SC_ElapsedUsec(ScheduledTime, SentTime);
+
+    /*
+     ** Bin 0 is below the base latency, each bin after it
+     ** covers twice the span of the one before
+     */
+    Scaled = LatencyUsec / SC_LATENCY_HIST_BASE_USEC;
+    while (Scaled != 0 && Bin < (SC_LATENCY_HIST_BINS - 1))
+    {
+        Scaled >>= 1;
+        Bin++;
+    }
+
+    HistPtr->Bin[Bin]++;
+
+    if (HistPtr->Count == 0 || LatencyUsec < HistPtr->MinUsec)
+    {
+        HistPtr->MinUsec = LatencyUsec;
+    }
+    if (LatencyUsec > HistPtr->MaxUsec)
+    {
+        HistPtr->MaxUsec = LatencyUsec;
+    }
+
+    HistPtr->Count++;
+    SC_AppData.LatencySumUsec[Process] += LatencyUsec;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Record a command dispatch in the trace table                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_RecordTrace(SC_Process_Enum_t Process, uint16 SourceNum, uint32 CmdId, CFE_SB_MsgId_t MsgId,
+                    CFE_MSG_FcnCode_t FcnCode, CFE_TIME_SysTime_t ScheduledTime, SC_Status_Enum_t Status)
+{
+    SC_TraceTable_t *TracePtr = SC_OperData.TraceTblAddr;
+    SC_TraceEntry_t *EntryPtr = &TracePtr->Entry[TracePtr->NextEntry];
+
+    EntryPtr->ScheduledTime = ScheduledTime;
+    EntryPtr->ActualTime    = SC_AppData.TimeRef.GetTime();
+    EntryPtr->MsgId         = CFE_SB_MsgIdToValue(MsgId);
+    EntryPtr->CmdId         = CmdId;
+    EntryPtr->SourceNum     = SourceNum;
+    EntryPtr->Process       = Process;
+    EntryPtr->FcnCode       = FcnCode;
+    EntryPtr->Status        = Status;
+
+    /* only now is the entry complete, move on to the oldest one */
+    TracePtr->NextEntry++;
+    if (TracePtr->NextEntry >= SC_TRACE_ENTRIES)
+    {
+        TracePtr->NextEntry = 0;
+    }
+
+    TracePtr->EntryCount++;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Mark the start of a processing phase                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_BeginPhase(SC_Phase_Enum_t Phase)
+{
+    CFE_ES_PerfLogEntry(SC_PHASE_PERF_ID[Phase]);
+
+    /* MET, so time corrections don't show up as phase time */
+    SC_AppData.PhaseStartTime[Phase] = CFE_TIME_GetMET();
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Mark the end of a processing phase                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_EndPhase(SC_Phase_Enum_t Phase)
+{
+    SC_PhaseStats_t *StatsPtr = &SC_OperData.DiagPacket.Payload.Phase[Phase];
+    uint32           ElapsedUsec;
+
+    ElapsedUsec = SC_ElapsedUsec(SC_AppData.PhaseStartTime[Phase], CFE_TIME_GetMET());
+
+    StatsPtr->LastUsec = ElapsedUsec;
+    if (ElapsedUsec > StatsPtr->MaxUsec)
+    {
+        StatsPtr->MaxUsec = ElapsedUsec;
+    }
+
+    StatsPtr->Count++;
+    SC_AppData.PhaseSumUsec[Phase] += ElapsedUsec;
+
+    CFE_ES_PerfLogExit(SC_PHASE_PERF_ID[Phase]);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Queue an event for a summary                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool SC_DeferEvent(uint16 EventID, uint16 Num)
+{
+    SC_DeferredEvent_t *Record;
+    bool                Queued = false;
+
+    if (SC_OperData.HkPacket.Payload.EventMode == SC_EventMode_DEFERRED &&
+        SC_AppData.NumDeferredEvents < SC_DEFERRED_EVENT_DEPTH)
+    {
+        Record          = &SC_AppData.DeferredEvent[SC_AppData.NumDeferredEvents];
+        Record->EventID = EventID;
+        Record->Num     = Num;
+
+        SC_AppData.NumDeferredEvents++;
+        Queued = true;
+    }
+
+    return Queued;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Send one summary event for each event ID queued                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SC_FlushDeferredEvents(void)
+{
+    char        List[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    const char *What;
+    uint16      EventID;
+    uint16      EventType;
+    uint16      Count;
+    size_t      Length;
+    uint16      i;
+    uint16      j;
+
+    for (i = 0; i < SC_AppData.NumDeferredEvents; i++)
+    {
+        EventID = SC_AppData.DeferredEvent[i].EventID;
+
+        /* records already in an earlier summary are cleared */
+        if (EventID != 0)
+        {
+            Count  = 0;
+            Length = 0;
+
+            for (j = i; j < SC_AppData.NumDeferredEvents; j++)
+            {
+                if (SC_AppData.DeferredEvent[j].EventID == EventID)
+                {
+                    /* keep room for the count and text in front and the "..." */
+                    if (Length < sizeof(List) - 40)
+                    {
+                        Length += snprintf(&List[Length], sizeof(List) - Length, "%s%03u", (Count == 0) ? " " : ",",
+                                           (unsigned int)SC_AppData.DeferredEvent[j].Num);
+                    }
+                    else if (List[Length - 1] != '.')
+                    {
+                        Length += snprintf(&List[Length], sizeof(List) - Length, "...");
+                    }
+
+                    SC_AppData.DeferredEvent[j].EventID = 0;
+                    Count++;
+                }
+            }
+
+            EventType = CFE_EVS_EventType_ERROR;
+            switch (EventID)
+            {
+                case SC_RTS_START_INF_EID:
+                    What      = "RTS Started";
+                    EventType = CFE_EVS_EventType_INFORMATION;
+                    break;
+
+                case SC_RTS_COMPL_INF_EID:
+                    What      = "RTS Execution Completed";
+                    EventType = CFE_EVS_EventType_INFORMATION;
+                    break;
+
+                case SC_RTS_DIST_ERR_EID:
+                    What = "RTS Command Distribution Failed, RTS Stopped";
+                    break;
+
+                case SC_RTS_CHKSUM_ERR_EID:
+                    What = "RTS Command Failed Checksum, RTS Stopped";
+                    break;
+
+                case SC_STARTRTSGRP_CMD_NOT_LDED_ERR_EID:
+                    What = "Start RTS group rejected RTS, Not Loaded or In Use";
+                    break;
+
+                case SC_STARTRTSGRP_CMD_DISABLED_ERR_EID:
+                    What = "Start RTS group rejected RTS, Disabled";
+                    break;
+
+                default:
+                    What      = "Events";
+                    EventType = CFE_EVS_EventType_INFORMATION;
+                    break;
+            }
+
+            CFE_EVS_SendEvent(EventID, EventType, "%u %s:%s", (unsigned int)Count, What, List);
+        }
+    }
+
+    SC_AppData.NumDeferredEvents = 0;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
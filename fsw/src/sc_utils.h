@@ -79,7 +79,9 @@ SC_AbsTimeTag_t SC_ComputeAbsTime(uint32 RelTime);
  *       the function
  *
  *  \par Assumptions, External Events, and Notes:
- *        None
+ *        Outside a wakeup, such as when a ground command starts an RTS,
+ *        the relative count is taken from the next wakeup, the first
+ *        one that can send the command
  *
  *  \param [in]        RelWakeup        The relative wakeup count to compute from
  *
@@ -87,6 +89,169 @@ SC_AbsTimeTag_t SC_ComputeAbsTime(uint32 RelTime);
  */
 uint32 SC_ComputeAbsWakeup(uint32 RelWakeup);
 
+/**
+ * \brief Computes when the next command of a timed RTS is due
+ *
+ *  \par Description
+ *       This function adds the relative time of a command in an RTS
+ *       timed by #SC_RTS_TIMED_CC to the time the command before it
+ *       was due
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        The upper 16 bits of the relative time are seconds and the
+ *        lower 16 bits are 1/65536ths of a second
+ *
+ *  \param [in]        PrevTime        The time the previous command was due
+ *  \param [in]        RelTime         The relative time of the command
+ *
+ *  \return The time the command is due
+ */
+CFE_TIME_SysTime_t SC_ComputeRtsDueTime(CFE_TIME_SysTime_t PrevTime, uint32 RelTime);
+
+/**
+ * \brief Computes the time spanned by a number of wakeups
+ *
+ *  \par Description
+ *       This function converts a count of wakeups to a span of time at
+ *       #SC_WAKEUPS_PER_SECOND
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        None
+ *
+ *  \param [in]        Wakeups         The number of wakeups
+ *
+ *  \return The time spanned by the wakeups
+ */
+CFE_TIME_SysTime_t SC_WakeupsToTime(uint32 Wakeups);
+
+/**
+ * \brief Computes the microseconds between two times
+ *
+ *  \par Description
+ *       This function returns how much later the end time is than
+ *       the start time, in microseconds
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        An end time before the start time can only be due to the
+ *        clock being adjusted and gives 0.  The result saturates at
+ *        #SC_MAX_TIME rather than wrapping.
+ *
+ *  \param [in]        StartTime       The earlier time
+ *  \param [in]        EndTime         The later time
+ *
+ *  \return The elapsed microseconds
+ */
+uint32 SC_ElapsedUsec(CFE_TIME_SysTime_t StartTime, CFE_TIME_SysTime_t EndTime);
+
+/**
+ * \brief Records the dispatch latency of a command
+ *
+ *  \par Description
+ *       This function adds the time from when a command was scheduled
+ *       to now, when it has been sent, to the latency histogram of the
+ *       processor that sent it in the diagnostic packet
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        The running sum kept for the mean is turned into the mean
+ *        when the diagnostic packet is sent
+ *
+ *  \param [in]        Process         The processor that sent the command,
+ *                                     #SC_Process_ATP or #SC_Process_RTP
+ *  \param [in]        ScheduledTime   The time the command was scheduled for
+ */
+void SC_RecordDispatchLatency(SC_Process_Enum_t Process, CFE_TIME_SysTime_t ScheduledTime);
+
+/**
+ * \brief Records a command dispatch in the trace table
+ *
+ *  \par Description
+ *       This function writes an entry for a command the ATP or RTP
+ *       dispatched over the oldest entry of the trace table
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        Only the dispatch path writes the trace table.  The entry is
+ *        filled in before the table moves past it, so a dump taken
+ *        between dispatches is always consistent.  Like the other dump
+ *        only tables the trace table address is not checked: it is got
+ *        once at start up, SC does not run without it, and it is never
+ *        released, so a dump only has to be managed, not reloaded.
+ *
+ *  \param [in]        Process         The processor that dispatched the command,
+ *                                     #SC_Process_ATP or #SC_Process_RTP
+ *  \param [in]        SourceNum       The ATS or RTS number
+ *  \param [in]        CmdId           The ATS command number or RTS entry offset
+ *  \param [in]        MsgId           The message ID of the command
+ *  \param [in]        FcnCode         The function code of the command
+ *  \param [in]        ScheduledTime   The time the command was scheduled for
+ *  \param [in]        Status          What became of the command
+ */
+void SC_RecordTrace(SC_Process_Enum_t Process, uint16 SourceNum, uint32 CmdId, CFE_SB_MsgId_t MsgId,
+                    CFE_MSG_FcnCode_t FcnCode, CFE_TIME_SysTime_t ScheduledTime, SC_Status_Enum_t Status);
+
+/**
+ * \brief Marks the start of a processing phase
+ *
+ *  \par Description
+ *       This function logs the performance entry marker of the phase
+ *       and notes the MET it began at
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        Each call must be matched by a call to #SC_EndPhase for the
+ *        same phase.  Phases may nest but a phase may not nest in itself.
+ *
+ *  \param [in]        Phase           The phase starting
+ */
+void SC_BeginPhase(SC_Phase_Enum_t Phase);
+
+/**
+ * \brief Marks the end of a processing phase
+ *
+ *  \par Description
+ *       This function adds the time since the matching #SC_BeginPhase
+ *       to the phase statistics in the diagnostic packet and logs the
+ *       performance exit marker of the phase
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        The running sum kept for the mean is turned into the mean
+ *        when the diagnostic packet is sent
+ *
+ *  \param [in]        Phase           The phase ending
+ */
+void SC_EndPhase(SC_Phase_Enum_t Phase);
+
+/**
+ * \brief Queues an event for a summary
+ *
+ *  \par Description
+ *       In #SC_EventMode_DEFERRED mode this function queues the event
+ *       so it is reported in a summary by #SC_FlushDeferredEvents
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        The caller sends the event itself when it is not queued
+ *
+ *  \param [in]        EventID         The ID of the event
+ *  \param [in]        Num             The RTS number the event is about
+ *
+ *  \return Whether the event was queued
+ *  \retval true  The event was queued
+ *  \retval false SC is in #SC_EventMode_IMMEDIATE mode or the queue is full
+ */
+bool SC_DeferEvent(uint16 EventID, uint16 Num);
+
+/**
+ * \brief Sends the summary events for the queued events
+ *
+ *  \par Description
+ *       This function sends one event for each event ID queued by
+ *       #SC_DeferEvent, with the same ID, giving how many there were
+ *       and listing their RTS numbers in the order they were queued,
+ *       then empties the queue
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *        A list that does not fit in one event message ends with "..."
+ */
+void SC_FlushDeferredEvents(void);
+
 /**
  * \brief Compares absolute time
  *
@@ -44,6 +44,56 @@
 #error SC_MAX_CMDS_PER_WAKEUP cannot be less than 1!
 #endif
 
+#ifndef SC_WAKEUPS_PER_SECOND
+#error SC_WAKEUPS_PER_SECOND must be defined!
+#elif (SC_WAKEUPS_PER_SECOND < 1)
+#error SC_WAKEUPS_PER_SECOND cannot be less than 1!
+#elif (SC_WAKEUPS_PER_SECOND > 1000000)
+#error SC_WAKEUPS_PER_SECOND cannot be greater than 1000000!
+#endif
+
+#ifndef SC_ATS_LOAD_ENTRIES_PER_WAKEUP
+#error SC_ATS_LOAD_ENTRIES_PER_WAKEUP must be defined!
+#elif (SC_ATS_LOAD_ENTRIES_PER_WAKEUP < 1)
+#error SC_ATS_LOAD_ENTRIES_PER_WAKEUP cannot be less than 1!
+#endif
+
+#ifndef SC_ATS_WINDOW_ENTRIES_PER_PKT
+#error SC_ATS_WINDOW_ENTRIES_PER_PKT must be defined!
+#elif (SC_ATS_WINDOW_ENTRIES_PER_PKT < 1)
+#error SC_ATS_WINDOW_ENTRIES_PER_PKT cannot be less than 1!
+#elif (SC_ATS_WINDOW_ENTRIES_PER_PKT > 65535)
+#error SC_ATS_WINDOW_ENTRIES_PER_PKT cannot be greater than 65535!
+#endif
+
+#ifndef SC_ATS_WINDOW_MAX_PKTS
+#error SC_ATS_WINDOW_MAX_PKTS must be defined!
+#elif (SC_ATS_WINDOW_MAX_PKTS < 1)
+#error SC_ATS_WINDOW_MAX_PKTS cannot be less than 1!
+#endif
+
+#ifndef SC_ATS_STATUS_ENTRIES_PER_WAKEUP
+#error SC_ATS_STATUS_ENTRIES_PER_WAKEUP must be defined!
+#elif (SC_ATS_STATUS_ENTRIES_PER_WAKEUP < 1)
+#error SC_ATS_STATUS_ENTRIES_PER_WAKEUP cannot be less than 1!
+#endif
+
+#ifndef SC_ATS_STATUS_RUNS_PER_PKT
+#error SC_ATS_STATUS_RUNS_PER_PKT must be defined!
+#elif (SC_ATS_STATUS_RUNS_PER_PKT < 1)
+#error SC_ATS_STATUS_RUNS_PER_PKT cannot be less than 1!
+#elif (SC_ATS_STATUS_RUNS_PER_PKT > 65535)
+#error SC_ATS_STATUS_RUNS_PER_PKT cannot be greater than 65535!
+#endif
+
+#ifndef SC_LOOKAHEAD_ENTRIES
+#error SC_LOOKAHEAD_ENTRIES must be defined!
+#elif (SC_LOOKAHEAD_ENTRIES < 1)
+#error SC_LOOKAHEAD_ENTRIES cannot be less than 1!
+#elif (SC_LOOKAHEAD_ENTRIES > 255)
+#error SC_LOOKAHEAD_ENTRIES cannot be greater than 255!
+#endif
+
 #ifndef SC_NUMBER_OF_RTS
 #error SC_NUMBER_OF_RTS must be defined!
 #elif (SC_NUMBER_OF_RTS > CFE_PLATFORM_TBL_MAX_NUM_TABLES)
@@ -69,9 +119,15 @@
 #error Sum of all SC tables cannot be greater than CFE_PLATFORM_TBL_MAX_NUM_TABLES!
 #endif
 
+#ifndef SC_CMD_INDEX_BITS
+#error SC_CMD_INDEX_BITS must be defined!
+#elif (SC_CMD_INDEX_BITS != 16) && (SC_CMD_INDEX_BITS != 32)
+#error SC_CMD_INDEX_BITS must be either 16 or 32!
+#endif
+
 #ifndef SC_ATS_BUFF_SIZE
 #error SC_ATS_BUFF_SIZE must be defined!
-#elif (SC_ATS_BUFF_SIZE > 65535)
+#elif (SC_CMD_INDEX_BITS == 16) && (SC_ATS_BUFF_SIZE > 65535)
 #error SC_ATS_BUFF_SIZE cannot be greater than 65535!
 #elif (SC_ATS_BUFF_SIZE < SC_PACKET_MIN_SIZE)
 #error SC_ATS_BUFF_SIZE must be at least big enough to hold one command (SC_PACKET_MAX_SIZE)!
@@ -92,14 +148,132 @@
 #error SC_RTS_BUFF_SIZE cannot be greater than 65535!
 #elif (SC_RTS_BUFF_SIZE < SC_PACKET_MIN_SIZE)
 #error SC_RTS_BUFF_SIZE must be at least big enough to hold one command (SC_PACKET_MIN_SIZE)!
+#endif
+
+#ifndef SC_RTS_MAX_SIZE
+#error SC_RTS_MAX_SIZE must be defined!
+#elif (SC_RTS_MAX_SIZE > 65535)
+#error SC_RTS_MAX_SIZE cannot be greater than 65535!
+#elif (SC_RTS_MAX_SIZE < SC_PACKET_MIN_SIZE)
+#error SC_RTS_MAX_SIZE must be at least big enough to hold one command (SC_PACKET_MIN_SIZE)!
 /* buf size = words, tbl size = bytes */
-#elif ((SC_RTS_BUFF_SIZE * 2) > CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE)
-#error SC_RTS_BUFF_SIZE cannot be greater than CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE!
+#elif ((SC_RTS_MAX_SIZE * 2) > CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE)
+#error SC_RTS_MAX_SIZE cannot be greater than CFE_PLATFORM_TBL_MAX_SNGL_TABLE_SIZE!
+#endif
+
+#ifndef SC_RTS_MAX_CALL_DEPTH
+#error SC_RTS_MAX_CALL_DEPTH must be defined!
+#elif (SC_RTS_MAX_CALL_DEPTH < 1)
+#error SC_RTS_MAX_CALL_DEPTH cannot be less than 1!
+#elif (SC_RTS_MAX_CALL_DEPTH > (SC_NUMBER_OF_RTS - 1))
+#error SC_RTS_MAX_CALL_DEPTH cannot be greater than SC_NUMBER_OF_RTS - 1!
+#endif
+
+#ifndef SC_RTS_MAX_LOOP_DEPTH
+#error SC_RTS_MAX_LOOP_DEPTH must be defined!
+#elif (SC_RTS_MAX_LOOP_DEPTH < 1)
+#error SC_RTS_MAX_LOOP_DEPTH cannot be less than 1!
+#elif (SC_RTS_MAX_LOOP_DEPTH > 255)
+#error SC_RTS_MAX_LOOP_DEPTH cannot be greater than 255!
+#endif
+
+#ifndef SC_RTS_MAX_CTRL_STEPS
+#error SC_RTS_MAX_CTRL_STEPS must be defined!
+#elif (SC_RTS_MAX_CTRL_STEPS < 1)
+#error SC_RTS_MAX_CTRL_STEPS cannot be less than 1!
+#elif (SC_RTS_MAX_CTRL_STEPS > 255)
+#error SC_RTS_MAX_CTRL_STEPS cannot be greater than 255!
+#endif
+
+#ifndef SC_RTS_MAX_PATCHES
+#error SC_RTS_MAX_PATCHES must be defined!
+#elif (SC_RTS_MAX_PATCHES < 1)
+#error SC_RTS_MAX_PATCHES cannot be less than 1!
+#elif (SC_RTS_MAX_PATCHES > 255)
+#error SC_RTS_MAX_PATCHES cannot be greater than 255!
+#endif
+
+#ifndef SC_RTS_PRIORITY_LEVELS
+#error SC_RTS_PRIORITY_LEVELS must be defined!
+#elif (SC_RTS_PRIORITY_LEVELS < 1)
+#error SC_RTS_PRIORITY_LEVELS cannot be less than 1!
+#elif (SC_RTS_PRIORITY_LEVELS > 255)
+#error SC_RTS_PRIORITY_LEVELS cannot be greater than 255!
+#endif
+
+#ifndef SC_RTS_DEFAULT_PRIORITY
+#error SC_RTS_DEFAULT_PRIORITY must be defined!
+#elif (SC_RTS_DEFAULT_PRIORITY < 0)
+#error SC_RTS_DEFAULT_PRIORITY cannot be less than 0!
+#elif (SC_RTS_DEFAULT_PRIORITY >= SC_RTS_PRIORITY_LEVELS)
+#error SC_RTS_DEFAULT_PRIORITY must be less than SC_RTS_PRIORITY_LEVELS!
+#endif
+
+#ifndef SC_RTS_PRIORITY_OVER_ATP
+#error SC_RTS_PRIORITY_OVER_ATP must be defined!
+#elif (SC_RTS_PRIORITY_OVER_ATP < 0)
+#error SC_RTS_PRIORITY_OVER_ATP cannot be less than 0!
+#elif (SC_RTS_PRIORITY_OVER_ATP > SC_RTS_PRIORITY_LEVELS)
+#error SC_RTS_PRIORITY_OVER_ATP cannot be greater than SC_RTS_PRIORITY_LEVELS!
+#endif
+
+#ifndef SC_NUMBER_OF_TRIGGERS
+#error SC_NUMBER_OF_TRIGGERS must be defined!
+#elif (SC_NUMBER_OF_TRIGGERS < 1)
+#error SC_NUMBER_OF_TRIGGERS cannot be less than 1!
+#elif (SC_NUMBER_OF_TRIGGERS > 255)
+#error SC_NUMBER_OF_TRIGGERS cannot be greater than 255!
+#endif
+
+#ifndef SC_TRACE_ENTRIES
+#error SC_TRACE_ENTRIES must be defined!
+#elif (SC_TRACE_ENTRIES < 1)
+#error SC_TRACE_ENTRIES cannot be less than 1!
+#endif
+
+#ifndef SC_LATENCY_HIST_BINS
+#error SC_LATENCY_HIST_BINS must be defined!
+#elif (SC_LATENCY_HIST_BINS < 2)
+#error SC_LATENCY_HIST_BINS cannot be less than 2!
+#elif (SC_LATENCY_HIST_BINS > 32)
+#error SC_LATENCY_HIST_BINS cannot be greater than 32!
+#endif
+
+#ifndef SC_FORECAST_WINDOWS
+#error SC_FORECAST_WINDOWS must be defined!
+#elif (SC_FORECAST_WINDOWS < 1)
+#error SC_FORECAST_WINDOWS cannot be less than 1!
+#elif (SC_FORECAST_WINDOWS > 16)
+#error SC_FORECAST_WINDOWS cannot be greater than 16!
+#endif
+
+#ifndef SC_LATENCY_HIST_BASE_USEC
+#error SC_LATENCY_HIST_BASE_USEC must be defined!
+#elif (SC_LATENCY_HIST_BASE_USEC < 1)
+#error SC_LATENCY_HIST_BASE_USEC cannot be less than 1!
+#endif
+
+#ifndef SC_RTS_ARG_BLOCK_SIZE
+#error SC_RTS_ARG_BLOCK_SIZE must be defined!
+#elif (SC_RTS_ARG_BLOCK_SIZE < 4)
+#error SC_RTS_ARG_BLOCK_SIZE cannot be less than 4!
+#elif (SC_RTS_ARG_BLOCK_SIZE > SC_PACKET_MAX_SIZE)
+#error SC_RTS_ARG_BLOCK_SIZE cannot be greater than SC_PACKET_MAX_SIZE!
+#elif ((SC_RTS_ARG_BLOCK_SIZE % 4) != 0)
+#error SC_RTS_ARG_BLOCK_SIZE must be a multiple of 4!
+#endif
+
+#ifndef SC_RTS_POOL_SIZE
+#error SC_RTS_POOL_SIZE must be defined!
+#elif (SC_RTS_POOL_SIZE < SC_PACKET_MIN_SIZE)
+#error SC_RTS_POOL_SIZE must be at least big enough to hold one command (SC_PACKET_MIN_SIZE)!
+#elif (SC_RTS_POOL_SIZE < SC_RTS_MAX_SIZE)
+#error SC_RTS_POOL_SIZE cannot be less than SC_RTS_MAX_SIZE!
 #endif
 
 #ifndef SC_MAX_ATS_CMDS
 #error SC_MAX_ATS_CMDS must be defined!
-#elif (SC_MAX_ATS_CMDS > 65535)
+#elif (SC_CMD_INDEX_BITS == 16) && (SC_MAX_ATS_CMDS > 65535)
 #error SC_MAX_ATS_CMDS cannot be greater than 65535!
 #elif (SC_MAX_ATS_CMDS < 1)
 #error SC_MAX_ATS_CMDS cannot be less than 1!
@@ -139,6 +313,12 @@
 #error SC_PIPE_DEPTH cannot be less than 1!
 #endif
 
+#ifndef SC_TRIGGER_PIPE_DEPTH
+#error SC_TRIGGER_PIPE_DEPTH must be defined!
+#elif (SC_TRIGGER_PIPE_DEPTH < 1)
+#error SC_TRIGGER_PIPE_DEPTH cannot be less than 1!
+#endif
+
 #ifndef SC_ATS_TABLE_NAME
 #error SC_ATS_TABLE_NAME must be defined!
 #endif
@@ -151,6 +331,10 @@
 #error SC_RTS_TABLE_NAME must be defined!
 #endif
 
+#ifndef SC_TRIGGER_TABLE_NAME
+#error SC_TRIGGER_TABLE_NAME must be defined!
+#endif
+
 #ifndef SC_ATS_FILE_NAME
 #error SC_ATS_FILE_NAME must be defined!
 #endif
@@ -163,6 +347,10 @@
 #error SC_RTS_FILE_NAME must be defined!
 #endif
 
+#ifndef SC_TRIGGER_FILE_NAME
+#error SC_TRIGGER_FILE_NAME must be defined!
+#endif
+
 #ifndef SC_RTSINFO_TABLE_NAME
 #error SC_RTSINFO_TABLE_NAME must be defined!
 #endif
@@ -187,12 +375,34 @@
 #error SC_ATS_CMD_STAT_TABLE_NAME must be defined!
 #endif
 
+#ifndef SC_TRACE_TABLE_NAME
+#error SC_TRACE_TABLE_NAME must be defined!
+#endif
+
+#ifndef SC_RTS_STATS_TABLE_NAME
+#error SC_RTS_STATS_TABLE_NAME must be defined!
+#endif
+
 #ifndef SC_CONT_ON_FAILURE_START
 #error SC_CONT_ON_FAILURE_START must be defined!
 #elif ((SC_CONT_ON_FAILURE_START != SC_AtsCont_TRUE) && (SC_CONT_ON_FAILURE_START != SC_AtsCont_FALSE))
 #error SC_CONT_ON_FAILURE_START must be either SC_AtsCont_TRUE or SC_AtsCont_FALSE!
 #endif
 
+#ifndef SC_EVENT_MODE_START
+#error SC_EVENT_MODE_START must be defined!
+#elif ((SC_EVENT_MODE_START != SC_EventMode_IMMEDIATE) && (SC_EVENT_MODE_START != SC_EventMode_DEFERRED))
+#error SC_EVENT_MODE_START must be either SC_EventMode_IMMEDIATE or SC_EventMode_DEFERRED!
+#endif
+
+#ifndef SC_DEFERRED_EVENT_DEPTH
+#error SC_DEFERRED_EVENT_DEPTH must be defined!
+#elif (SC_DEFERRED_EVENT_DEPTH < 1)
+#error SC_DEFERRED_EVENT_DEPTH cannot be less than 1!
+#elif (SC_DEFERRED_EVENT_DEPTH > 65535)
+#error SC_DEFERRED_EVENT_DEPTH cannot be greater than 65535!
+#endif
+
 #ifndef SC_TIME_TO_USE
 #error SC_TIME_TO_USE must be defined!
 #elif (SC_TIME_TO_USE != SC_TimeRef_USE_CFE_TIME)
@@ -63,7 +63,7 @@ typedef struct
 typedef union
 {
     SC_RtsStruct002_t rts;
-    uint16            buf[SC_RTS_BUFF_SIZE];
+    uint16            buf[SC_RTS_MAX_SIZE];
 } SC_RtsTable002_t;
 
 /* Helper macro to get size of structure elements */
@@ -0,0 +1,51 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,924-1, and identified as “Core Flight
+ * System (cFS) Stored Command Application version 3.1.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   CFS Stored Command (SC) default trigger table
+ *
+ * The following source code demonstrates how to create a Stored Command
+ * trigger table using the software defined table structures.  It's also
+ * possible to create this table via alternative tools (ground system) and
+ * or system agnostic data definitions (XTCE/EDS/JSON).
+ *
+ * This source file creates the default trigger table loaded at startup.
+ * Every entry is unused (a message ID of 0), so SC subscribes to nothing
+ * until a trigger table is loaded by command.  An entry such as the
+ * following would start RTS 2 on each message 0x0881 whose 16-bit field
+ * at byte offset 12 has bit 0 set:
+ *
+ *   [0] = {.MsgId = 0x0881, .RtsNum = 2, .MatchSize = 2, .MatchOffset = 12,
+ *          .MatchMask = 0x0001, .MatchValue = 0x0001}
+ */
+
+#include "cfe.h"
+#include "cfe_tbl_filedef.h"
+
+#include "sc_tbldefs.h"      /* defines SC table headers */
+#include "sc_platform_cfg.h" /* defines the number of triggers */
+
+/* Used designated initializers to be verbose, modify as needed/desired */
+SC_TriggerEntry_t SC_Trig[SC_NUMBER_OF_TRIGGERS] = {
+    [0] = {.MsgId = 0},
+};
+
+/* Macro for table structure */
+CFE_TBL_FILEDEF(SC_Trig, SC.TRIG_TBL, SC Default Trigger Table, sc_trig.tbl)
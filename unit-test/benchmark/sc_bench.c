@@ -0,0 +1,656 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,924-1, and identified as “Core Flight
+ * System (cFS) Stored Command Application version 3.1.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Host benchmark driver
+ *
+ *   Builds synthetic ATS, append and RTS tables of a chosen size and time
+ *   distribution, then times the SC flight code that verifies, loads,
+ *   appends, starts, jumps and dispatches them.  Run with -h for the options.
+ */
+
+/*
+ * Includes
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "sc_app.h"
+#include "sc_atsrq.h"
+#include "sc_dispatch.h"
+#include "sc_loads.h"
+#include "sc_msgids.h"
+#include "sc_rtsrq.h"
+#include "sc_utils.h"
+#include "sc_bench.h"
+
+/* Spacecraft time when each run starts, the ATS begins one second later */
+#define SC_BENCH_EPOCH 1000000
+
+/* A command for some other application, so that SC sends it on the bus */
+#define SC_BENCH_CMD_MID 0x18F0
+
+/* Jumps timed in each iteration */
+#define SC_BENCH_JUMPS_PER_ITERATION 16
+
+/* Spread of command time tags across the ATS */
+typedef enum
+{
+    SC_Bench_Dist_UNIFORM, /* evenly spaced over the span */
+    SC_Bench_Dist_RANDOM,  /* uniformly random seconds within the span */
+    SC_Bench_Dist_BURST    /* evenly spaced bursts, each due in a single second */
+} SC_Bench_Dist_Enum_t;
+
+typedef enum
+{
+    SC_Bench_Op_VERIFY,
+    SC_Bench_Op_LOAD_ATS,
+    SC_Bench_Op_APPEND,
+    SC_Bench_Op_START_ATS,
+    SC_Bench_Op_JUMP,
+    SC_Bench_Op_LOAD_RTS,
+    SC_Bench_Op_START_RTS,
+    SC_Bench_Op_DISPATCH,
+    SC_Bench_Op_MAX
+} SC_Bench_Op_Enum_t;
+
+typedef struct
+{
+    uint32               AtsCmds;
+    uint32               SpanSecs;
+    SC_Bench_Dist_Enum_t Dist;
+    uint32               BurstSize;
+    uint32               NumRts;
+    uint32               CmdsPerRts;
+    uint32               RtsWakeups;
+    uint32               AppendCmds;
+    uint32               CmdBytes;
+    uint32               Iterations;
+    uint32               Seed;
+} SC_Bench_Config_t;
+
+typedef struct
+{
+    uint64 *Samples; /* elapsed nanoseconds of each sample */
+    uint32  NumSamples;
+    uint32  MaxSamples;
+    uint64  TotalCmds; /* commands handled over all the samples */
+} SC_Bench_Stats_t;
+
+const char *SC_BENCH_OP_NAMES[SC_Bench_Op_MAX] = {[SC_Bench_Op_VERIFY]    = "verify",
+                                                  [SC_Bench_Op_LOAD_ATS]  = "load-ats",
+                                                  [SC_Bench_Op_APPEND]    = "append",
+                                                  [SC_Bench_Op_START_ATS] = "start-ats",
+                                                  [SC_Bench_Op_JUMP]      = "jump",
+                                                  [SC_Bench_Op_LOAD_RTS]  = "load-rts",
+                                                  [SC_Bench_Op_START_RTS] = "start-rts",
+                                                  [SC_Bench_Op_DISPATCH]  = "dispatch"};
+
+const char *SC_BENCH_DIST_NAMES[] = {"uniform", "random", "burst"};
+
+SC_Bench_Config_t SC_Bench_Config;
+SC_Bench_Stats_t  SC_Bench_Stats[SC_Bench_Op_MAX];
+uint32            SC_Bench_RandomState;
+SC_AbsTimeTag_t   SC_Bench_LastTimeTag; /* latest time tag in the ATS */
+
+/*
+ * Function Definitions
+ */
+
+/* Small fixed generator, so a seed gives the same tables on every host */
+uint32 SC_Bench_Random(void)
+{
+    SC_Bench_RandomState ^= SC_Bench_RandomState << 13;
+    SC_Bench_RandomState ^= SC_Bench_RandomState >> 17;
+    SC_Bench_RandomState ^= SC_Bench_RandomState << 5;
+
+    return SC_Bench_RandomState;
+}
+
+uint64 SC_Bench_Now(void)
+{
+    struct timespec Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+
+    return ((uint64)Now.tv_sec * 1000000000) + Now.tv_nsec;
+}
+
+void SC_Bench_Record(SC_Bench_Op_Enum_t Op, uint64 StartNs, uint32 NumCmds)
+{
+    uint64            ElapsedNs = SC_Bench_Now() - StartNs;
+    SC_Bench_Stats_t *StatsPtr  = &SC_Bench_Stats[Op];
+
+    if (StatsPtr->NumSamples == StatsPtr->MaxSamples)
+    {
+        StatsPtr->MaxSamples = (StatsPtr->MaxSamples == 0) ? 1024 : StatsPtr->MaxSamples * 2;
+        StatsPtr->Samples    = realloc(StatsPtr->Samples, StatsPtr->MaxSamples * sizeof(uint64));
+        if (StatsPtr->Samples == NULL)
+        {
+            fprintf(stderr, "out of memory for %s samples\n", SC_BENCH_OP_NAMES[Op]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    StatsPtr->Samples[StatsPtr->NumSamples] = ElapsedNs;
+    StatsPtr->NumSamples++;
+    StatsPtr->TotalCmds += NumCmds;
+}
+
+int SC_Bench_CompareSamples(const void *A, const void *B)
+{
+    uint64 SampleA = *(const uint64 *)A;
+    uint64 SampleB = *(const uint64 *)B;
+
+    return (SampleA > SampleB) - (SampleA < SampleB);
+}
+
+void SC_Bench_Report(void)
+{
+    SC_Bench_Stats_t *StatsPtr;
+    uint64            SumNs;
+    uint32            Op;
+    uint32            i;
+    uint32            Last;
+
+    printf("%-10s %8s %9s %10s %10s %10s %10s %10s %9s %12s\n", "operation", "samples", "cmds/smp", "mean_ns",
+           "p50_ns", "p90_ns", "p99_ns", "max_ns", "ns/cmd", "cmds/s");
+
+    for (Op = 0; Op < SC_Bench_Op_MAX; Op++)
+    {
+        StatsPtr = &SC_Bench_Stats[Op];
+        if (StatsPtr->NumSamples == 0)
+        {
+            continue;
+        }
+
+        qsort(StatsPtr->Samples, StatsPtr->NumSamples, sizeof(uint64), SC_Bench_CompareSamples);
+
+        SumNs = 0;
+        for (i = 0; i < StatsPtr->NumSamples; i++)
+        {
+            SumNs += StatsPtr->Samples[i];
+        }
+        if (SumNs == 0)
+        {
+            SumNs = 1;
+        }
+
+        Last = StatsPtr->NumSamples - 1;
+        printf("%-10s %8lu %9.1f %10.0f %10llu %10llu %10llu %10llu %9.1f %12.0f\n", SC_BENCH_OP_NAMES[Op],
+               (unsigned long)StatsPtr->NumSamples, (double)StatsPtr->TotalCmds / StatsPtr->NumSamples,
+               (double)SumNs / StatsPtr->NumSamples, (unsigned long long)StatsPtr->Samples[Last * 50 / 100],
+               (unsigned long long)StatsPtr->Samples[Last * 90 / 100],
+               (unsigned long long)StatsPtr->Samples[Last * 99 / 100], (unsigned long long)StatsPtr->Samples[Last],
+               StatsPtr->TotalCmds ? (double)SumNs / StatsPtr->TotalCmds : 0.0,
+               (double)StatsPtr->TotalCmds * 1e9 / SumNs);
+    }
+}
+
+/* Time tag of the Index'th of Count commands spread over the span */
+SC_AbsTimeTag_t SC_Bench_TimeTag(uint32 Index, uint32 Count)
+{
+    uint32 Offset;
+    uint32 NumBursts;
+
+    switch (SC_Bench_Config.Dist)
+    {
+        case SC_Bench_Dist_RANDOM:
+            Offset = SC_Bench_Random() % SC_Bench_Config.SpanSecs;
+            break;
+
+        case SC_Bench_Dist_BURST:
+            NumBursts = (Count + SC_Bench_Config.BurstSize - 1) / SC_Bench_Config.BurstSize;
+            Offset    = (uint32)(((uint64)(Index / SC_Bench_Config.BurstSize) * SC_Bench_Config.SpanSecs) / NumBursts);
+            break;
+
+        default:
+            Offset = (uint32)(((uint64)Index * SC_Bench_Config.SpanSecs) / Count);
+            break;
+    }
+
+    return SC_BENCH_EPOCH + 1 + Offset;
+}
+
+void SC_Bench_InitCmd(CFE_MSG_Message_t *MsgPtr, uint32 Index)
+{
+    CFE_MSG_Init(MsgPtr, CFE_SB_ValueToMsgId(SC_BENCH_CMD_MID), SC_Bench_Config.CmdBytes);
+    CFE_MSG_SetFcnCode(MsgPtr, Index % 128);
+    CFE_MSG_GenerateChecksum(MsgPtr);
+}
+
+/* Write ATS entries for command numbers FirstCmd on, returns the words used */
+uint32 SC_Bench_BuildAts(uint32 *Buffer32, uint32 BufferWords, uint32 FirstCmd, uint32 NumCmds)
+{
+    SC_AtsEntry_t * EntryPtr;
+    SC_AbsTimeTag_t TimeTag;
+    uint32          EntryWords;
+    uint32          Offset = 0;
+    uint32          i;
+
+    memset(Buffer32, 0, BufferWords * SC_BYTES_IN_WORD);
+
+    EntryWords = SC_ATS_HDR_NOPKT_WORDS + (SC_Bench_Config.CmdBytes + SC_ROUND_UP_BYTES) / SC_BYTES_IN_WORD;
+
+    for (i = 0; i < NumCmds; i++)
+    {
+        EntryPtr = (SC_AtsEntry_t *)&Buffer32[Offset];
+        TimeTag  = SC_Bench_TimeTag(i, NumCmds);
+        if (TimeTag > SC_Bench_LastTimeTag)
+        {
+            SC_Bench_LastTimeTag = TimeTag;
+        }
+
+        EntryPtr->Header.CmdNumber  = SC_COMMAND_NUM_C(FirstCmd + i);
+        EntryPtr->Header.TimeTag_MS = (uint16)(TimeTag >> 16);
+        EntryPtr->Header.TimeTag_LS = (uint16)TimeTag;
+        SC_Bench_InitCmd(CFE_MSG_PTR(EntryPtr->Msg), i);
+
+        Offset += EntryWords;
+    }
+
+    return Offset;
+}
+
+/* Write an RTS that waits RtsWakeups between commands, returns the words used */
+uint32 SC_Bench_BuildRts(uint32 *Buffer32)
+{
+    SC_RtsEntry_t *EntryPtr;
+    uint32         Offset = 0;
+    uint32         i;
+
+    memset(Buffer32, 0, SC_RTS_MAX_SIZE32 * SC_BYTES_IN_WORD);
+
+    for (i = 0; i < SC_Bench_Config.CmdsPerRts; i++)
+    {
+        EntryPtr = (SC_RtsEntry_t *)&Buffer32[Offset];
+
+        EntryPtr->Header.WakeupCount = SC_Bench_Config.RtsWakeups;
+        SC_Bench_InitCmd(CFE_MSG_PTR(EntryPtr->Msg), i);
+
+        Offset += (SC_RTS_HEADER_SIZE + SC_Bench_Config.CmdBytes + SC_ROUND_UP_BYTES) / SC_BYTES_IN_WORD;
+    }
+
+    return Offset;
+}
+
+/* Keep every count within what the SC tables can hold */
+void SC_Bench_ClampConfig(void)
+{
+    uint32 AtsEntryWords;
+    uint32 RtsEntryWords;
+    uint32 Limit;
+
+    if (SC_Bench_Config.CmdBytes < SC_PACKET_MIN_SIZE)
+    {
+        SC_Bench_Config.CmdBytes = SC_PACKET_MIN_SIZE;
+    }
+    if (SC_Bench_Config.CmdBytes > SC_PACKET_MAX_SIZE)
+    {
+        SC_Bench_Config.CmdBytes = SC_PACKET_MAX_SIZE;
+    }
+
+    AtsEntryWords = SC_ATS_HDR_NOPKT_WORDS + (SC_Bench_Config.CmdBytes + SC_ROUND_UP_BYTES) / SC_BYTES_IN_WORD;
+    RtsEntryWords = (SC_RTS_HEADER_SIZE + SC_Bench_Config.CmdBytes + SC_ROUND_UP_BYTES) / SC_BYTES_IN_WORD;
+
+    Limit = SC_ATS_BUFF_SIZE32 / AtsEntryWords;
+    if (Limit > SC_MAX_ATS_CMDS)
+    {
+        Limit = SC_MAX_ATS_CMDS;
+    }
+    if (SC_Bench_Config.AtsCmds > Limit)
+    {
+        SC_Bench_Config.AtsCmds = Limit;
+    }
+    if (SC_Bench_Config.AtsCmds == 0)
+    {
+        SC_Bench_Config.AtsCmds = 1;
+    }
+
+    /* the append must fit its own table, the command numbers left and the rest of the ATS */
+    Limit = SC_APPEND_BUFF_SIZE32 / AtsEntryWords;
+    if (Limit > SC_MAX_ATS_CMDS - SC_Bench_Config.AtsCmds)
+    {
+        Limit = SC_MAX_ATS_CMDS - SC_Bench_Config.AtsCmds;
+    }
+    if (Limit > (SC_ATS_BUFF_SIZE32 / AtsEntryWords) - SC_Bench_Config.AtsCmds)
+    {
+        Limit = (SC_ATS_BUFF_SIZE32 / AtsEntryWords) - SC_Bench_Config.AtsCmds;
+    }
+    if (SC_Bench_Config.AppendCmds > Limit)
+    {
+        SC_Bench_Config.AppendCmds = Limit;
+    }
+
+    if (SC_Bench_Config.NumRts > SC_NUMBER_OF_RTS)
+    {
+        SC_Bench_Config.NumRts = SC_NUMBER_OF_RTS;
+    }
+
+    /* leave room for the empty entry that ends each RTS */
+    Limit = (SC_RTS_MAX_SIZE32 - SC_RTS_HDR_WORDS) / RtsEntryWords;
+    if (SC_Bench_Config.CmdsPerRts > Limit)
+    {
+        SC_Bench_Config.CmdsPerRts = Limit;
+    }
+    if (SC_Bench_Config.CmdsPerRts == 0)
+    {
+        SC_Bench_Config.NumRts = 0;
+    }
+
+    if (SC_Bench_Config.SpanSecs == 0)
+    {
+        SC_Bench_Config.SpanSecs = 1;
+    }
+    if (SC_Bench_Config.BurstSize == 0)
+    {
+        SC_Bench_Config.BurstSize = 1;
+    }
+    if (SC_Bench_Config.Iterations == 0)
+    {
+        SC_Bench_Config.Iterations = 1;
+    }
+    if (SC_Bench_Config.Seed == 0)
+    {
+        SC_Bench_Config.Seed = 1;
+    }
+}
+
+void SC_Bench_SetTime(uint32 Seconds)
+{
+    SC_Bench_Time.Seconds    = Seconds;
+    SC_Bench_Time.Subseconds = 0;
+
+    SC_GetCurrentTime();
+}
+
+void SC_Bench_StartAts(void)
+{
+    SC_StartAtsCmd_t StartCmd;
+
+    memset(&StartCmd, 0, sizeof(StartCmd));
+    StartCmd.Payload.AtsNum = SC_ATS_NUM_C(1);
+
+    SC_StartAtsCmd(&StartCmd);
+}
+
+void SC_Bench_StartRts(SC_RtsIndex_t RtsIndex)
+{
+    SC_StartRtsCmd_t StartCmd;
+
+    memset(&StartCmd, 0, sizeof(StartCmd));
+    StartCmd.Payload.RtsNum = SC_RtsIndexToNum(RtsIndex);
+
+    SC_SetRtsDisabled(RtsIndex, false);
+    SC_StartRtsCmd(&StartCmd);
+}
+
+/* Build the tables, then load, start and run them, timing every step */
+void SC_Bench_RunIteration(void)
+{
+    SC_JumpAtsCmd_t Jump;
+    SC_WakeupCmd_t  Wakeup;
+    SC_RtsIndex_t   RtsIndex;
+    uint64          StartNs;
+    uint64          WakeupPeriod;
+    uint32          SentBefore;
+    uint32          MaxWakeups;
+    uint32          NumWakeups;
+    uint32          AtsCmds;
+    uint32          i;
+
+    SC_Bench_SetTime(SC_BENCH_EPOCH);
+    SC_Bench_LastTimeTag = SC_BENCH_EPOCH + 1;
+
+    /* verify and load the ATS */
+    SC_Bench_BuildAts(SC_OperData.AtsTblAddr[0], SC_ATS_BUFF_SIZE32, 1, SC_Bench_Config.AtsCmds);
+
+    StartNs = SC_Bench_Now();
+    if (SC_VerifyAtsTable(SC_OperData.AtsTblAddr[0], SC_ATS_BUFF_SIZE32) != CFE_SUCCESS)
+    {
+        fprintf(stderr, "synthetic ATS failed verification, rerun with -v for the events\n");
+        exit(EXIT_FAILURE);
+    }
+    SC_Bench_Record(SC_Bench_Op_VERIFY, StartNs, SC_Bench_Config.AtsCmds);
+
+    StartNs = SC_Bench_Now();
+    SC_LoadAts(SC_ATS_IDX_C(0));
+    SC_Bench_Record(SC_Bench_Op_LOAD_ATS, StartNs, SC_Bench_Config.AtsCmds);
+
+    /* append to it */
+    AtsCmds = SC_Bench_Config.AtsCmds;
+    if (SC_Bench_Config.AppendCmds > 0)
+    {
+        SC_Bench_BuildAts(SC_OperData.AppendTblAddr, SC_APPEND_BUFF_SIZE32, SC_Bench_Config.AtsCmds + 1,
+                          SC_Bench_Config.AppendCmds);
+        SC_UpdateAppend();
+
+        StartNs = SC_Bench_Now();
+        SC_ProcessAppend(SC_ATS_IDX_C(0));
+        SC_Bench_Record(SC_Bench_Op_APPEND, StartNs, SC_Bench_Config.AppendCmds);
+
+        AtsCmds += SC_Bench_Config.AppendCmds;
+    }
+
+    /* start it, and jump around in it */
+    StartNs = SC_Bench_Now();
+    SC_Bench_StartAts();
+    SC_Bench_Record(SC_Bench_Op_START_ATS, StartNs, AtsCmds);
+
+    memset(&Jump, 0, sizeof(Jump));
+    Jump.Payload.ResetPolicy = SC_JumpAtsReset_ALL;
+    for (i = 0; i < SC_BENCH_JUMPS_PER_ITERATION; i++)
+    {
+        /* no later than the last command, so a jump never skips the whole ATS */
+        Jump.Payload.NewTime = SC_BENCH_EPOCH + 1 + (SC_Bench_Random() % (SC_Bench_LastTimeTag - SC_BENCH_EPOCH));
+
+        StartNs = SC_Bench_Now();
+        SC_JumpAtsCmd(&Jump);
+        SC_Bench_Record(SC_Bench_Op_JUMP, StartNs, AtsCmds);
+    }
+
+    SC_KillAts();
+
+    /* load and start the RTSs */
+    for (i = 0; i < SC_Bench_Config.NumRts; i++)
+    {
+        RtsIndex = SC_RTS_IDX_C(i);
+        SC_Bench_BuildRts(SC_OperData.RtsTblAddr[i]);
+
+        StartNs = SC_Bench_Now();
+        SC_LoadRts(RtsIndex);
+        SC_Bench_Record(SC_Bench_Op_LOAD_RTS, StartNs, SC_Bench_Config.CmdsPerRts);
+
+        StartNs = SC_Bench_Now();
+        SC_Bench_StartRts(RtsIndex);
+        SC_Bench_Record(SC_Bench_Op_START_RTS, StartNs, SC_Bench_Config.CmdsPerRts);
+    }
+
+    /* run everything to completion, one wakeup at a time, after a reload undoes the jumps */
+    SC_LoadAts(SC_ATS_IDX_C(0));
+    SC_Bench_SetTime(SC_BENCH_EPOCH);
+    SC_Bench_StartAts();
+
+    CFE_MSG_Init(CFE_MSG_PTR(Wakeup.CommandHeader), CFE_SB_ValueToMsgId(SC_WAKEUP_MID), sizeof(Wakeup));
+
+    /* far more wakeups than the load needs, in case something never finishes */
+    MaxWakeups = (SC_Bench_Config.SpanSecs + 2) * SC_WAKEUPS_PER_SECOND * 4 +
+                 SC_Bench_Config.CmdsPerRts * (SC_Bench_Config.RtsWakeups + 1) * 4 + AtsCmds;
+
+    /* in units of 2^-32 seconds */
+    WakeupPeriod = 0x100000000ULL / SC_WAKEUPS_PER_SECOND;
+
+    NumWakeups = 0;
+    while ((SC_OperData.AtsCtrlBlckAddr->AtpState == SC_Status_EXECUTING ||
+            SC_OperData.RtsCtrlBlckAddr->NumRtsActive > 0) &&
+           NumWakeups < MaxWakeups)
+    {
+        SC_Bench_AdvanceTime((uint32)(WakeupPeriod >> 32), (uint32)WakeupPeriod);
+        SentBefore = SC_Bench_NumSent;
+
+        StartNs = SC_Bench_Now();
+        SC_ProcessRequest((const CFE_SB_Buffer_t *)&Wakeup);
+        SC_Bench_Record(SC_Bench_Op_DISPATCH, StartNs, SC_Bench_NumSent - SentBefore);
+
+        NumWakeups++;
+    }
+
+    if (NumWakeups == MaxWakeups)
+    {
+        fprintf(stderr, "stored commands still running after %lu wakeups\n", (unsigned long)NumWakeups);
+        SC_KillAts();
+        for (i = 0; i < SC_Bench_Config.NumRts; i++)
+        {
+            SC_KillRts(SC_RTS_IDX_C(i));
+        }
+    }
+}
+
+void SC_Bench_Usage(const char *Program)
+{
+    printf("usage: %s [options]\n"
+           "  -a N    commands in the ATS (default 900)\n"
+           "  -s N    seconds the ATS spans (default 3600)\n"
+           "  -d D    ATS time tag distribution: uniform, random or burst (default uniform)\n"
+           "  -b N    commands in each burst (default 10)\n"
+           "  -r N    RTSs to run alongside the ATS (default 16)\n"
+           "  -c N    commands in each RTS (default 10)\n"
+           "  -w N    wakeups between RTS commands (default 1)\n"
+           "  -p N    commands appended to the ATS (default 100)\n"
+           "  -m N    bytes in each command (default %d)\n"
+           "  -i N    iterations (default 20)\n"
+           "  -z N    random seed (default 1)\n"
+           "  -v      print the events SC sends\n",
+           Program, SC_PACKET_MIN_SIZE);
+}
+
+int main(int argc, char *argv[])
+{
+    int    Opt;
+    uint32 i;
+
+    SC_Bench_Config.AtsCmds    = 900;
+    SC_Bench_Config.SpanSecs   = 3600;
+    SC_Bench_Config.Dist       = SC_Bench_Dist_UNIFORM;
+    SC_Bench_Config.BurstSize  = 10;
+    SC_Bench_Config.NumRts     = 16;
+    SC_Bench_Config.CmdsPerRts = 10;
+    SC_Bench_Config.RtsWakeups = 1;
+    SC_Bench_Config.AppendCmds = 100;
+    SC_Bench_Config.CmdBytes   = SC_PACKET_MIN_SIZE;
+    SC_Bench_Config.Iterations = 20;
+    SC_Bench_Config.Seed       = 1;
+
+    while ((Opt = getopt(argc, argv, "a:s:d:b:r:c:w:p:m:i:z:vh")) != -1)
+    {
+        switch (Opt)
+        {
+            case 'a':
+                SC_Bench_Config.AtsCmds = strtoul(optarg, NULL, 0);
+                break;
+            case 's':
+                SC_Bench_Config.SpanSecs = strtoul(optarg, NULL, 0);
+                break;
+            case 'd':
+                if (strcmp(optarg, "random") == 0)
+                {
+                    SC_Bench_Config.Dist = SC_Bench_Dist_RANDOM;
+                }
+                else if (strcmp(optarg, "burst") == 0)
+                {
+                    SC_Bench_Config.Dist = SC_Bench_Dist_BURST;
+                }
+                else if (strcmp(optarg, "uniform") == 0)
+                {
+                    SC_Bench_Config.Dist = SC_Bench_Dist_UNIFORM;
+                }
+                else
+                {
+                    SC_Bench_Usage(argv[0]);
+                    return EXIT_FAILURE;
+                }
+                break;
+            case 'b':
+                SC_Bench_Config.BurstSize = strtoul(optarg, NULL, 0);
+                break;
+            case 'r':
+                SC_Bench_Config.NumRts = strtoul(optarg, NULL, 0);
+                break;
+            case 'c':
+                SC_Bench_Config.CmdsPerRts = strtoul(optarg, NULL, 0);
+                break;
+            case 'w':
+                SC_Bench_Config.RtsWakeups = strtoul(optarg, NULL, 0);
+                break;
+            case 'p':
+                SC_Bench_Config.AppendCmds = strtoul(optarg, NULL, 0);
+                break;
+            case 'm':
+                SC_Bench_Config.CmdBytes = strtoul(optarg, NULL, 0);
+                break;
+            case 'i':
+                SC_Bench_Config.Iterations = strtoul(optarg, NULL, 0);
+                break;
+            case 'z':
+                SC_Bench_Config.Seed = strtoul(optarg, NULL, 0);
+                break;
+            case 'v':
+                SC_Bench_Verbose = true;
+                break;
+            default:
+                SC_Bench_Usage(argv[0]);
+                return (Opt == 'h') ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+    SC_Bench_ClampConfig();
+    SC_Bench_RandomState = SC_Bench_Config.Seed;
+
+    printf("ATS %lu cmds over %lu s (%s, bursts of %lu), append %lu cmds, %lu RTS x %lu cmds every %lu wakeups, "
+           "%lu byte cmds, %lu iterations, seed %lu\n",
+           (unsigned long)SC_Bench_Config.AtsCmds, (unsigned long)SC_Bench_Config.SpanSecs,
+           SC_BENCH_DIST_NAMES[SC_Bench_Config.Dist], (unsigned long)SC_Bench_Config.BurstSize,
+           (unsigned long)SC_Bench_Config.AppendCmds, (unsigned long)SC_Bench_Config.NumRts,
+           (unsigned long)SC_Bench_Config.CmdsPerRts, (unsigned long)SC_Bench_Config.RtsWakeups,
+           (unsigned long)SC_Bench_Config.CmdBytes, (unsigned long)SC_Bench_Config.Iterations,
+           (unsigned long)SC_Bench_Config.Seed);
+
+    if (SC_AppInit() != CFE_SUCCESS)
+    {
+        fprintf(stderr, "SC_AppInit failed\n");
+        return EXIT_FAILURE;
+    }
+
+    for (i = 0; i < SC_Bench_Config.Iterations; i++)
+    {
+        SC_Bench_RunIteration();
+    }
+
+    SC_Bench_Report();
+
+    printf("%lu commands sent, %lu events, %lu error events\n", (unsigned long)SC_Bench_NumSent,
+           (unsigned long)SC_Bench_NumEvents, (unsigned long)SC_Bench_NumErrorEvents);
+
+    return (SC_Bench_NumErrorEvents == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,88 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,924-1, and identified as “Core Flight
+ * System (cFS) Stored Command Application version 3.1.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Host benchmark shared declarations
+ *
+ *   The benchmark and replay drivers link the flight sources of SC against
+ *   the small cFE stand-ins in sc_bench_cfe.c.  These are the hooks the
+ *   drivers use to steer and observe those stand-ins.
+ */
+#ifndef SC_BENCH_H
+#define SC_BENCH_H
+
+/*
+ * Includes
+ */
+
+#include "cfe.h"
+
+/**
+ * \brief Simulated spacecraft time
+ *
+ * Returned by the CFE_TIME_GetTime, GetTAI and GetUTC stand-ins, so the
+ * driver controls when stored commands come due.  CFE_TIME_GetMET returns
+ * host time instead, so the SC phase statistics show real processing time.
+ */
+extern CFE_TIME_SysTime_t SC_Bench_Time;
+
+/** \brief Number of messages passed to CFE_SB_TransmitMsg */
+extern uint32 SC_Bench_NumSent;
+
+/** \brief Number of events sent with CFE_EVS_SendEvent */
+extern uint32 SC_Bench_NumEvents;
+
+/** \brief Number of error events sent with CFE_EVS_SendEvent */
+extern uint32 SC_Bench_NumErrorEvents;
+
+/** \brief Print every event and syslog message when true */
+extern bool SC_Bench_Verbose;
+
+/**
+ * \brief Optional observer of every event sent
+ *
+ * When set, CFE_EVS_SendEvent formats each event and passes it here.
+ */
+extern void (*SC_Bench_EventHook)(uint16 EventID, uint16 EventType, const char *Text);
+
+/**
+ * \brief Advance the simulated time
+ *
+ *  \par Description
+ *       Moves #SC_Bench_Time forward by the given time.
+ *
+ *  \param [in]   Seconds     Whole seconds to advance
+ *  \param [in]   Subseconds  Fraction of a second to advance, in units of 2^-32 seconds
+ */
+void SC_Bench_AdvanceTime(uint32 Seconds, uint32 Subseconds);
+
+/**
+ * \brief Short name of an event type
+ *
+ *  \par Description
+ *       Returns "DBG", "INF", "ERR" or "CRIT", or "?" for anything else.
+ *
+ *  \param [in]   EventType  Event type, one of CFE_EVS_EventType_Enum_t
+ *
+ *  \return Name of the event type
+ */
+const char *SC_Bench_EventTypeName(uint16 EventType);
+
+#endif
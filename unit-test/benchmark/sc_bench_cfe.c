@@ -0,0 +1,673 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,924-1, and identified as “Core Flight
+ * System (cFS) Stored Command Application version 3.1.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Host benchmark cFE stand-ins
+ *
+ *   Minimal implementations of the cFE services SC calls, fast enough that
+ *   the benchmark measures SC rather than the services.  Messages are plain
+ *   CCSDS packets, tables are heap buffers loaded from memory or from table
+ *   files, the software bus only counts what is sent and time is whatever
+ *   the driver sets it to.
+ */
+
+/*
+ * Includes
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "cfe.h"
+#include "sc_bench.h"
+
+/* Room for all the SC tables, with some to spare */
+#define SC_BENCH_MAX_TABLES 128
+
+/* CCSDS primary header byte offsets, the packet length field is the size less 7 */
+#define SC_BENCH_STREAM_ID_BYTE 0
+#define SC_BENCH_LENGTH_BYTE    4
+#define SC_BENCH_LENGTH_BIAS    7
+
+/* The command secondary header follows whatever primary header the mission uses */
+#define SC_BENCH_FCN_CODE_BYTE offsetof(CFE_MSG_CommandHeader_t, Sec)
+#define SC_BENCH_CHECKSUM_BYTE (SC_BENCH_FCN_CODE_BYTE + 1)
+
+typedef struct
+{
+    void *                    Buffer;         /* active data, the buffer SC uses */
+    void *                    Inactive;       /* data loaded but not yet activated */
+    size_t                    Size;
+    uint16                    Options;
+    bool                      LoadPending;    /* Inactive holds a load for CFE_TBL_Manage to activate */
+    bool                      Updated;        /* activated since the last CFE_TBL_GetAddress */
+    bool                      Loaded;         /* activated at least once */
+    CFE_TBL_CallbackFuncPtr_t ValidationFunc;
+} SC_Bench_Table_t;
+
+CFE_TIME_SysTime_t SC_Bench_Time;
+uint32             SC_Bench_NumSent;
+uint32             SC_Bench_NumEvents;
+uint32             SC_Bench_NumErrorEvents;
+bool               SC_Bench_Verbose;
+
+void (*SC_Bench_EventHook)(uint16 EventID, uint16 EventType, const char *Text);
+
+SC_Bench_Table_t SC_Bench_Tables[SC_BENCH_MAX_TABLES];
+int32            SC_Bench_NumTables;
+
+/*
+ * Function Definitions
+ */
+
+void SC_Bench_AdvanceTime(uint32 Seconds, uint32 Subseconds)
+{
+    CFE_TIME_SysTime_t Delta;
+
+    Delta.Seconds    = Seconds;
+    Delta.Subseconds = Subseconds;
+
+    SC_Bench_Time = CFE_TIME_Add(SC_Bench_Time, Delta);
+}
+
+/*
+ * Executive services
+ */
+
+void CFE_ES_ExitApp(uint32 ExitStatus)
+{
+    exit((int)ExitStatus);
+}
+
+int32 CFE_ES_GetResetType(uint32 *ResetSubtypePtr)
+{
+    if (ResetSubtypePtr != NULL)
+    {
+        *ResetSubtypePtr = 0;
+    }
+
+    return CFE_PSP_RST_TYPE_POWERON;
+}
+
+void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
+{
+    /* performance markers are not recorded */
+    (void)Marker;
+    (void)EntryExit;
+}
+
+bool CFE_ES_RunLoop(uint32 *RunStatus)
+{
+    (void)RunStatus;
+
+    return false;
+}
+
+CFE_Status_t CFE_ES_WriteToSysLog(const char *SpecStringPtr, ...)
+{
+    va_list va;
+
+    va_start(va, SpecStringPtr);
+    vfprintf(stderr, SpecStringPtr, va);
+    va_end(va);
+
+    return CFE_SUCCESS;
+}
+
+/*
+ * Event services
+ */
+
+const char *SC_Bench_EventTypeName(uint16 EventType)
+{
+    static const char *EVENT_TYPE_NAMES[] = {[CFE_EVS_EventType_DEBUG]       = "DBG",
+                                             [CFE_EVS_EventType_INFORMATION] = "INF",
+                                             [CFE_EVS_EventType_ERROR]       = "ERR",
+                                             [CFE_EVS_EventType_CRITICAL]    = "CRIT"};
+
+    if (EventType >= sizeof(EVENT_TYPE_NAMES) / sizeof(EVENT_TYPE_NAMES[0]) || EVENT_TYPE_NAMES[EventType] == NULL)
+    {
+        return "?";
+    }
+
+    return EVENT_TYPE_NAMES[EventType];
+}
+
+CFE_Status_t CFE_EVS_Register(const void *Filters, uint16 NumEventFilters, uint16 FilterScheme)
+{
+    (void)Filters;
+    (void)NumEventFilters;
+    (void)FilterScheme;
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_EVS_SendEvent(uint16 EventID, uint16 EventType, const char *Spec, ...)
+{
+    char    Text[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    va_list va;
+
+    SC_Bench_NumEvents++;
+    if (EventType == CFE_EVS_EventType_ERROR || EventType == CFE_EVS_EventType_CRITICAL)
+    {
+        SC_Bench_NumErrorEvents++;
+    }
+
+    /* formatting is the slow part, so only done when someone looks */
+    if (SC_Bench_Verbose || SC_Bench_EventHook != NULL)
+    {
+        va_start(va, Spec);
+        vsnprintf(Text, sizeof(Text), Spec, va);
+        va_end(va);
+
+        if (SC_Bench_Verbose)
+        {
+            printf("EVS %3u %s: %s\n", (unsigned int)EventID, SC_Bench_EventTypeName(EventType), Text);
+        }
+
+        if (SC_Bench_EventHook != NULL)
+        {
+            SC_Bench_EventHook(EventID, EventType, Text);
+        }
+    }
+
+    return CFE_SUCCESS;
+}
+
+/*
+ * Message services, on CCSDS command and telemetry headers
+ */
+
+CFE_Status_t CFE_MSG_Init(CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t MsgId, CFE_MSG_Size_t Size)
+{
+    uint8 *Bytes = (uint8 *)MsgPtr;
+    uint32 Value = CFE_SB_MsgIdToValue(MsgId);
+
+    memset(MsgPtr, 0, Size);
+
+    Bytes[SC_BENCH_STREAM_ID_BYTE]     = (uint8)(Value >> 8);
+    Bytes[SC_BENCH_STREAM_ID_BYTE + 1] = (uint8)Value;
+    Bytes[SC_BENCH_STREAM_ID_BYTE + 2] = 0xC0; /* unsegmented */
+
+    return CFE_MSG_SetSize(MsgPtr, Size);
+}
+
+CFE_Status_t CFE_MSG_GetMsgId(const CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t *MsgId)
+{
+    const uint8 *Bytes = (const uint8 *)MsgPtr;
+
+    *MsgId = CFE_SB_ValueToMsgId((Bytes[SC_BENCH_STREAM_ID_BYTE] << 8) | Bytes[SC_BENCH_STREAM_ID_BYTE + 1]);
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_GetSize(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_Size_t *Size)
+{
+    const uint8 *Bytes = (const uint8 *)MsgPtr;
+
+    *Size = ((Bytes[SC_BENCH_LENGTH_BYTE] << 8) | Bytes[SC_BENCH_LENGTH_BYTE + 1]) + SC_BENCH_LENGTH_BIAS;
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_SetSize(CFE_MSG_Message_t *MsgPtr, CFE_MSG_Size_t Size)
+{
+    uint8 *Bytes = (uint8 *)MsgPtr;
+
+    if (Size < SC_BENCH_LENGTH_BIAS || Size > 0xFFFF + SC_BENCH_LENGTH_BIAS)
+    {
+        return CFE_MSG_BAD_ARGUMENT;
+    }
+
+    Bytes[SC_BENCH_LENGTH_BYTE]     = (uint8)((Size - SC_BENCH_LENGTH_BIAS) >> 8);
+    Bytes[SC_BENCH_LENGTH_BYTE + 1] = (uint8)(Size - SC_BENCH_LENGTH_BIAS);
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_GetFcnCode(const CFE_MSG_Message_t *MsgPtr, CFE_MSG_FcnCode_t *FcnCode)
+{
+    *FcnCode = ((const uint8 *)MsgPtr)[SC_BENCH_FCN_CODE_BYTE] & 0x7F;
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_SetFcnCode(CFE_MSG_Message_t *MsgPtr, CFE_MSG_FcnCode_t FcnCode)
+{
+    ((uint8 *)MsgPtr)[SC_BENCH_FCN_CODE_BYTE] = FcnCode & 0x7F;
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_GenerateChecksum(CFE_MSG_Message_t *MsgPtr)
+{
+    uint8 *        Bytes = (uint8 *)MsgPtr;
+    CFE_MSG_Size_t Size  = 0;
+    CFE_MSG_Size_t i;
+    uint8          Sum = 0xFF;
+
+    CFE_MSG_GetSize(MsgPtr, &Size);
+
+    Bytes[SC_BENCH_CHECKSUM_BYTE] = 0;
+    for (i = 0; i < Size; i++)
+    {
+        Sum ^= Bytes[i];
+    }
+    Bytes[SC_BENCH_CHECKSUM_BYTE] = Sum;
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_MSG_ValidateChecksum(const CFE_MSG_Message_t *MsgPtr, bool *IsValid)
+{
+    const uint8 *  Bytes = (const uint8 *)MsgPtr;
+    CFE_MSG_Size_t Size  = 0;
+    CFE_MSG_Size_t i;
+    uint8          Sum = 0;
+
+    CFE_MSG_GetSize(MsgPtr, &Size);
+
+    for (i = 0; i < Size; i++)
+    {
+        Sum ^= Bytes[i];
+    }
+    *IsValid = (Sum == 0xFF);
+
+    return CFE_SUCCESS;
+}
+
+/*
+ * Software bus, which keeps no routes and only counts what is sent
+ */
+
+CFE_Status_t CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const char *PipeName)
+{
+    (void)PipeIdPtr;
+    (void)Depth;
+    (void)PipeName;
+
+    return CFE_SUCCESS;
+}
+
+bool CFE_SB_IsValidMsgId(CFE_SB_MsgId_t MsgId)
+{
+    return !CFE_SB_MsgId_Equal(MsgId, CFE_SB_INVALID_MSG_ID);
+}
+
+CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int32 TimeOut)
+{
+    (void)BufPtr;
+    (void)PipeId;
+    (void)TimeOut;
+
+    return CFE_SB_NO_MESSAGE;
+}
+
+CFE_Status_t CFE_SB_Subscribe(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId)
+{
+    (void)MsgId;
+    (void)PipeId;
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_SB_Unsubscribe(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId)
+{
+    (void)MsgId;
+    (void)PipeId;
+
+    return CFE_SUCCESS;
+}
+
+void CFE_SB_TimeStampMsg(CFE_MSG_Message_t *MsgPtr)
+{
+    /* telemetry time stamps are not checked */
+    (void)MsgPtr;
+}
+
+CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IsOrigination)
+{
+    (void)MsgPtr;
+    (void)IsOrigination;
+
+    SC_Bench_NumSent++;
+
+    return CFE_SUCCESS;
+}
+
+/*
+ * Table services, where every table is a zeroed heap buffer.  A load is
+ * staged in a second buffer, as a ground load is, and CFE_TBL_Manage
+ * validates and activates it.
+ */
+
+/* Table files hold their header fields big-endian whatever the host */
+uint32 SC_Bench_FromBigEndian(const void *FieldPtr)
+{
+    const uint8 *Bytes = (const uint8 *)FieldPtr;
+
+    return ((uint32)Bytes[0] << 24) | ((uint32)Bytes[1] << 16) | ((uint32)Bytes[2] << 8) | Bytes[3];
+}
+
+/* Read a cFE table file, or a raw image of the whole table, over Buffer */
+CFE_Status_t SC_Bench_ReadTableFile(const char *Filename, uint8 *Buffer, size_t Size)
+{
+    FILE *             FilePtr;
+    CFE_FS_Header_t    FileHeader;
+    CFE_TBL_File_Hdr_t TblHeader;
+    size_t             Offset   = 0;
+    size_t             NumBytes = Size;
+    bool               IsRaw    = true;
+    CFE_Status_t       Status   = CFE_SUCCESS;
+
+    FilePtr = fopen(Filename, "rb");
+    if (FilePtr == NULL)
+    {
+        return CFE_TBL_ERR_FILE_NOT_FOUND;
+    }
+
+    if (fread(&FileHeader, sizeof(FileHeader), 1, FilePtr) == 1 &&
+        SC_Bench_FromBigEndian(&FileHeader.ContentType) == CFE_FS_FILE_CONTENT_ID)
+    {
+        IsRaw = false;
+        if (fread(&TblHeader, sizeof(TblHeader), 1, FilePtr) == 1)
+        {
+            Offset   = SC_Bench_FromBigEndian(&TblHeader.Offset);
+            NumBytes = SC_Bench_FromBigEndian(&TblHeader.NumBytes);
+        }
+        else
+        {
+            Status = CFE_TBL_ERR_NO_TBL_HEADER;
+        }
+    }
+    else
+    {
+        rewind(FilePtr);
+    }
+
+    if (Status == CFE_SUCCESS && (Offset > Size || NumBytes > Size - Offset))
+    {
+        Status = CFE_TBL_ERR_FILE_TOO_LARGE;
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        if (IsRaw)
+        {
+            /* a raw image may be shorter than the table, but not longer */
+            NumBytes = fread(Buffer, 1, Size, FilePtr);
+            if (NumBytes == 0)
+            {
+                Status = CFE_TBL_ERR_LOAD_INCOMPLETE;
+            }
+            else if (fgetc(FilePtr) != EOF)
+            {
+                Status = CFE_TBL_ERR_FILE_TOO_LARGE;
+            }
+        }
+        else if (fread(&Buffer[Offset], 1, NumBytes, FilePtr) != NumBytes)
+        {
+            Status = CFE_TBL_ERR_LOAD_INCOMPLETE;
+        }
+    }
+
+    fclose(FilePtr);
+
+    return Status;
+}
+
+CFE_Status_t CFE_TBL_Register(CFE_TBL_Handle_t *TblHandlePtr, const char *Name, size_t Size, uint16 TblOptionFlags,
+                              CFE_TBL_CallbackFuncPtr_t TblValidationFuncPtr)
+{
+    SC_Bench_Table_t *TblPtr;
+
+    (void)Name;
+
+    if (SC_Bench_NumTables >= SC_BENCH_MAX_TABLES)
+    {
+        return CFE_TBL_ERR_REGISTRY_FULL;
+    }
+
+    TblPtr = &SC_Bench_Tables[SC_Bench_NumTables];
+    memset(TblPtr, 0, sizeof(*TblPtr));
+    TblPtr->Buffer         = calloc(1, Size);
+    TblPtr->Size           = Size;
+    TblPtr->Options        = TblOptionFlags;
+    TblPtr->ValidationFunc = TblValidationFuncPtr;
+
+    if (TblPtr->Buffer == NULL)
+    {
+        return CFE_TBL_ERR_NO_BUFFER_AVAIL;
+    }
+
+    *TblHandlePtr = (CFE_TBL_Handle_t)SC_Bench_NumTables;
+    SC_Bench_NumTables++;
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_TBL_GetAddress(void **TblPtr, CFE_TBL_Handle_t TblHandle)
+{
+    SC_Bench_Table_t *TablePtr;
+
+    if (TblHandle < 0 || TblHandle >= SC_Bench_NumTables)
+    {
+        return CFE_TBL_ERR_INVALID_HANDLE;
+    }
+
+    TablePtr = &SC_Bench_Tables[TblHandle];
+    *TblPtr  = TablePtr->Buffer;
+
+    if (TablePtr->Updated)
+    {
+        TablePtr->Updated = false;
+        return CFE_TBL_INFO_UPDATED;
+    }
+
+    /* the driver fills loadable tables in place, so to SC they were never loaded */
+    if (TablePtr->Loaded || (TablePtr->Options & CFE_TBL_OPT_DUMP_ONLY) == CFE_TBL_OPT_DUMP_ONLY)
+    {
+        return CFE_SUCCESS;
+    }
+
+    return CFE_TBL_ERR_NEVER_LOADED;
+}
+
+CFE_Status_t CFE_TBL_Load(CFE_TBL_Handle_t TblHandle, CFE_TBL_SrcEnum_t SrcType, const void *SrcDataPtr)
+{
+    SC_Bench_Table_t *TablePtr;
+    CFE_Status_t      Status = CFE_SUCCESS;
+
+    if (TblHandle < 0 || TblHandle >= SC_Bench_NumTables)
+    {
+        return CFE_TBL_ERR_INVALID_HANDLE;
+    }
+
+    TablePtr = &SC_Bench_Tables[TblHandle];
+    if ((TablePtr->Options & CFE_TBL_OPT_DUMP_ONLY) == CFE_TBL_OPT_DUMP_ONLY)
+    {
+        return CFE_TBL_ERR_DUMP_ONLY;
+    }
+
+    if (TablePtr->Inactive == NULL)
+    {
+        TablePtr->Inactive = malloc(TablePtr->Size);
+        if (TablePtr->Inactive == NULL)
+        {
+            return CFE_TBL_ERR_NO_BUFFER_AVAIL;
+        }
+    }
+
+    /* a partial load changes only part of the active data */
+    memcpy(TablePtr->Inactive, TablePtr->Buffer, TablePtr->Size);
+
+    if (SrcType == CFE_TBL_SRC_ADDRESS)
+    {
+        memcpy(TablePtr->Inactive, SrcDataPtr, TablePtr->Size);
+    }
+    else
+    {
+        Status = SC_Bench_ReadTableFile(SrcDataPtr, TablePtr->Inactive, TablePtr->Size);
+    }
+
+    TablePtr->LoadPending = (Status == CFE_SUCCESS);
+
+    return Status;
+}
+
+CFE_Status_t CFE_TBL_Manage(CFE_TBL_Handle_t TblHandle)
+{
+    SC_Bench_Table_t *TablePtr;
+    CFE_Status_t      Status = CFE_SUCCESS;
+
+    if (TblHandle < 0 || TblHandle >= SC_Bench_NumTables)
+    {
+        return CFE_TBL_ERR_INVALID_HANDLE;
+    }
+
+    TablePtr = &SC_Bench_Tables[TblHandle];
+    if (TablePtr->LoadPending)
+    {
+        TablePtr->LoadPending = false;
+
+        if (TablePtr->ValidationFunc != NULL)
+        {
+            Status = TablePtr->ValidationFunc(TablePtr->Inactive);
+        }
+
+        if (Status == CFE_SUCCESS)
+        {
+            memcpy(TablePtr->Buffer, TablePtr->Inactive, TablePtr->Size);
+            TablePtr->Updated = true;
+            TablePtr->Loaded  = true;
+        }
+    }
+
+    return Status;
+}
+
+CFE_Status_t CFE_TBL_Modified(CFE_TBL_Handle_t TblHandle)
+{
+    (void)TblHandle;
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_TBL_NotifyByMessage(CFE_TBL_Handle_t TblHandle, CFE_SB_MsgId_t MsgId, CFE_MSG_FcnCode_t CommandCode,
+                                     uint32 Parameter)
+{
+    (void)TblHandle;
+    (void)MsgId;
+    (void)CommandCode;
+    (void)Parameter;
+
+    return CFE_SUCCESS;
+}
+
+CFE_Status_t CFE_TBL_ReleaseAddress(CFE_TBL_Handle_t TblHandle)
+{
+    (void)TblHandle;
+
+    return CFE_SUCCESS;
+}
+
+/*
+ * Time services
+ */
+
+CFE_TIME_SysTime_t CFE_TIME_GetTime(void)
+{
+    return SC_Bench_Time;
+}
+
+CFE_TIME_SysTime_t CFE_TIME_GetTAI(void)
+{
+    return SC_Bench_Time;
+}
+
+CFE_TIME_SysTime_t CFE_TIME_GetUTC(void)
+{
+    return SC_Bench_Time;
+}
+
+CFE_TIME_SysTime_t CFE_TIME_GetMET(void)
+{
+    struct timespec    Now;
+    CFE_TIME_SysTime_t Met;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+
+    Met.Seconds    = (uint32)Now.tv_sec;
+    Met.Subseconds = (uint32)(((uint64)Now.tv_nsec << 32) / 1000000000);
+
+    return Met;
+}
+
+CFE_TIME_SysTime_t CFE_TIME_Add(CFE_TIME_SysTime_t Time1, CFE_TIME_SysTime_t Time2)
+{
+    CFE_TIME_SysTime_t Result;
+
+    Result.Subseconds = Time1.Subseconds + Time2.Subseconds;
+    Result.Seconds    = Time1.Seconds + Time2.Seconds + (Result.Subseconds < Time1.Subseconds);
+
+    return Result;
+}
+
+CFE_TIME_SysTime_t CFE_TIME_Subtract(CFE_TIME_SysTime_t Time1, CFE_TIME_SysTime_t Time2)
+{
+    CFE_TIME_SysTime_t Result;
+
+    Result.Subseconds = Time1.Subseconds - Time2.Subseconds;
+    Result.Seconds    = Time1.Seconds - Time2.Seconds - (Time1.Subseconds < Time2.Subseconds);
+
+    return Result;
+}
+
+CFE_TIME_Compare_t CFE_TIME_Compare(CFE_TIME_SysTime_t TimeA, CFE_TIME_SysTime_t TimeB)
+{
+    if (TimeA.Seconds != TimeB.Seconds)
+    {
+        return (TimeA.Seconds > TimeB.Seconds) ? CFE_TIME_A_GT_B : CFE_TIME_A_LT_B;
+    }
+
+    if (TimeA.Subseconds != TimeB.Subseconds)
+    {
+        return (TimeA.Subseconds > TimeB.Subseconds) ? CFE_TIME_A_GT_B : CFE_TIME_A_LT_B;
+    }
+
+    return CFE_TIME_EQUAL;
+}
+
+uint32 CFE_TIME_Sub2MicroSecs(uint32 SubSeconds)
+{
+    return (uint32)(((uint64)SubSeconds * 1000000) >> 32);
+}
+
+CFE_Status_t CFE_TIME_Print(char *PrintBuffer, CFE_TIME_SysTime_t TimeToPrint)
+{
+    snprintf(PrintBuffer, CFE_TIME_PRINTED_STRING_SIZE, "%lu.%06lu", (unsigned long)TimeToPrint.Seconds,
+             (unsigned long)CFE_TIME_Sub2MicroSecs(TimeToPrint.Subseconds));
+
+    return CFE_SUCCESS;
+}
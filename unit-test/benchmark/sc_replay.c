@@ -0,0 +1,785 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,924-1, and identified as “Core Flight
+ * System (cFS) Stored Command Application version 3.1.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Host simulated-time replay driver
+ *
+ *   Runs SC against a script of table loads and ground commands on a
+ *   virtual clock.  The clock is SC's time accessor, and it only moves
+ *   between wakeups, so hours of stored commands replay in seconds and
+ *   every run of a script dispatches the same commands at the same
+ *   spacecraft times.  Each dispatch, event and script action is logged,
+ *   and the log can be checked against a golden copy.  Run with -h for
+ *   the options and the script format.
+ */
+
+/*
+ * Includes
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "sc_app.h"
+#include "sc_dispatch.h"
+#include "sc_msgids.h"
+#include "sc_tbldefs.h"
+#include "sc_bench.h"
+
+/* Spacecraft time at script offset 0, unless the script sets its own */
+#define SC_REPLAY_DEFAULT_EPOCH 1000000
+
+/* Longest script line, and longest table file path once resolved */
+#define SC_REPLAY_MAX_LINE 512
+
+/* Most arguments any action takes */
+#define SC_REPLAY_MAX_ARGS 2
+
+typedef enum
+{
+    SC_Replay_Act_LOAD_ATS,
+    SC_Replay_Act_LOAD_APPEND,
+    SC_Replay_Act_LOAD_RTS,
+    SC_Replay_Act_START_ATS,
+    SC_Replay_Act_STOP_ATS,
+    SC_Replay_Act_SWITCH_ATS,
+    SC_Replay_Act_JUMP_ATS,
+    SC_Replay_Act_APPEND_ATS,
+    SC_Replay_Act_START_RTS,
+    SC_Replay_Act_STOP_RTS,
+    SC_Replay_Act_ENABLE_RTS,
+    SC_Replay_Act_DISABLE_RTS,
+    SC_Replay_Act_NOOP,
+    SC_Replay_Act_RATE,
+    SC_Replay_Act_END,
+    SC_Replay_Act_MAX
+} SC_Replay_Act_Enum_t;
+
+typedef struct
+{
+    const char *Name;
+    uint8       MinArgs;
+    uint8       MaxArgs;
+    bool        NumberArg; /* the first argument is a number */
+} SC_Replay_ActDef_t;
+
+typedef struct
+{
+    CFE_TIME_SysTime_t   Time; /* spacecraft time the action is due */
+    SC_Replay_Act_Enum_t Act;
+    uint32               Number;                   /* first argument, when it is a number */
+    uint32               Policy;                   /* jump reset policy */
+    char                 Path[SC_REPLAY_MAX_LINE]; /* table file, resolved against the script directory */
+    char                 Text[SC_REPLAY_MAX_LINE]; /* the action as written, for the log */
+} SC_Replay_Action_t;
+
+/* Every command the script can send, so one buffer holds any of them */
+typedef union
+{
+    SC_NoopCmd_t        Noop;
+    SC_StartAtsCmd_t    StartAts;
+    SC_StopAtsCmd_t     StopAts;
+    SC_SwitchAtsCmd_t   SwitchAts;
+    SC_JumpAtsCmd_t     JumpAts;
+    SC_AppendAtsCmd_t   AppendAts;
+    SC_StartRtsCmd_t    StartRts;
+    SC_StopRtsCmd_t     StopRts;
+    SC_EnableRtsCmd_t   EnableRts;
+    SC_DisableRtsCmd_t  DisableRts;
+    SC_ManageTableCmd_t ManageTable;
+    SC_WakeupCmd_t      Wakeup;
+} SC_Replay_Cmd_t;
+
+const SC_Replay_ActDef_t SC_REPLAY_ACTS[SC_Replay_Act_MAX] = {
+    [SC_Replay_Act_LOAD_ATS]    = {"load-ats", 2, 2, true},
+    [SC_Replay_Act_LOAD_APPEND] = {"load-append", 1, 1, false},
+    [SC_Replay_Act_LOAD_RTS]    = {"load-rts", 2, 2, true},
+    [SC_Replay_Act_START_ATS]   = {"start-ats", 1, 1, true},
+    [SC_Replay_Act_STOP_ATS]    = {"stop-ats", 0, 0, false},
+    [SC_Replay_Act_SWITCH_ATS]  = {"switch-ats", 0, 0, false},
+    [SC_Replay_Act_JUMP_ATS]    = {"jump", 1, 2, true},
+    [SC_Replay_Act_APPEND_ATS]  = {"append-ats", 1, 1, true},
+    [SC_Replay_Act_START_RTS]   = {"start-rts", 1, 1, true},
+    [SC_Replay_Act_STOP_RTS]    = {"stop-rts", 1, 1, true},
+    [SC_Replay_Act_ENABLE_RTS]  = {"enable-rts", 1, 1, true},
+    [SC_Replay_Act_DISABLE_RTS] = {"disable-rts", 1, 1, true},
+    [SC_Replay_Act_NOOP]        = {"noop", 0, 0, false},
+    [SC_Replay_Act_RATE]        = {"rate", 1, 1, true},
+    [SC_Replay_Act_END]         = {"end", 0, 0, false}};
+
+const char *SC_REPLAY_JUMP_POLICIES[] = {
+    [SC_JumpAtsReset_NONE] = "none", [SC_JumpAtsReset_SKIPPED] = "skipped", [SC_JumpAtsReset_ALL] = "all"};
+
+const char *SC_REPLAY_STATUS_NAMES[] = {[SC_Status_EMPTY]           = "EMPTY",
+                                        [SC_Status_LOADED]          = "LOADED",
+                                        [SC_Status_IDLE]            = "IDLE",
+                                        [SC_Status_EXECUTED]        = "EXECUTED",
+                                        [SC_Status_SKIPPED]         = "SKIPPED",
+                                        [SC_Status_EXECUTING]       = "EXECUTING",
+                                        [SC_Status_FAILED_CHECKSUM] = "FAILED_CHECKSUM",
+                                        [SC_Status_FAILED_DISTRIB]  = "FAILED_DISTRIB",
+                                        [SC_Status_STARTING]        = "STARTING"};
+
+CFE_TIME_SysTime_t SC_Replay_Clock;
+CFE_TIME_SysTime_t SC_Replay_Epoch;
+FILE *             SC_Replay_Script;
+const char *       SC_Replay_ScriptName;
+char               SC_Replay_ScriptDir[SC_REPLAY_MAX_LINE];
+uint32             SC_Replay_LineNum;
+bool               SC_Replay_Started;  /* a timed line has been read, so the epoch is fixed */
+CFE_TIME_SysTime_t SC_Replay_LastTime; /* time of the last action read */
+FILE *             SC_Replay_Log;
+bool               SC_Replay_DebugEvents;
+uint32             SC_Replay_TraceDrained; /* trace entries already logged */
+uint32             SC_Replay_NumDispatches;
+
+/*
+ * Function Definitions
+ */
+
+/* The virtual clock, installed as SC's time accessor */
+CFE_TIME_SysTime_t SC_Replay_GetTime(void)
+{
+    return SC_Replay_Clock;
+}
+
+uint64 SC_Replay_Now(void)
+{
+    struct timespec Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+
+    return ((uint64)Now.tv_sec * 1000000000) + Now.tv_nsec;
+}
+
+/* Start a log line with the spacecraft time, which is all a line may depend on besides SC */
+void SC_Replay_LogPrefix(void)
+{
+    char TimeText[CFE_TIME_PRINTED_STRING_SIZE];
+
+    CFE_TIME_Print(TimeText, SC_Replay_Clock);
+    fprintf(SC_Replay_Log, "%s ", TimeText);
+}
+
+/* Log the dispatches written to the trace table since the last call */
+void SC_Replay_DrainTrace(void)
+{
+    SC_TraceTable_t *TracePtr = SC_OperData.TraceTblAddr;
+    SC_TraceEntry_t *EntryPtr;
+    char             DueText[CFE_TIME_PRINTED_STRING_SIZE];
+    const char *     StatusName;
+
+    /* the table was cleared, start again from its first entry */
+    if (TracePtr->EntryCount < SC_Replay_TraceDrained)
+    {
+        SC_Replay_TraceDrained = 0;
+    }
+
+    if (TracePtr->EntryCount - SC_Replay_TraceDrained > SC_TRACE_ENTRIES)
+    {
+        SC_Replay_LogPrefix();
+        fprintf(SC_Replay_Log, "! %lu dispatches overwritten before they were logged\n",
+                (unsigned long)(TracePtr->EntryCount - SC_Replay_TraceDrained - SC_TRACE_ENTRIES));
+        SC_Replay_TraceDrained = TracePtr->EntryCount - SC_TRACE_ENTRIES;
+    }
+
+    while (SC_Replay_TraceDrained < TracePtr->EntryCount)
+    {
+        EntryPtr = &TracePtr->Entry[SC_Replay_TraceDrained % SC_TRACE_ENTRIES];
+
+        StatusName = "?";
+        if (EntryPtr->Status < sizeof(SC_REPLAY_STATUS_NAMES) / sizeof(SC_REPLAY_STATUS_NAMES[0]))
+        {
+            StatusName = SC_REPLAY_STATUS_NAMES[EntryPtr->Status];
+        }
+
+        CFE_TIME_Print(DueText, EntryPtr->ScheduledTime);
+        SC_Replay_LogPrefix();
+        fprintf(SC_Replay_Log, "%s %u cmd %lu mid 0x%04lX cc %u due %s %s\n",
+                (EntryPtr->Process == SC_Process_ATP) ? "ATS" : "RTS", (unsigned int)EntryPtr->SourceNum,
+                (unsigned long)EntryPtr->CmdId, (unsigned long)EntryPtr->MsgId, (unsigned int)EntryPtr->FcnCode,
+                DueText, StatusName);
+
+        SC_Replay_TraceDrained++;
+        SC_Replay_NumDispatches++;
+    }
+}
+
+void SC_Replay_LogEvent(uint16 EventID, uint16 EventType, const char *Text)
+{
+    if (EventType == CFE_EVS_EventType_DEBUG && !SC_Replay_DebugEvents)
+    {
+        return;
+    }
+
+    /* dispatches come first, so an event follows the command that caused it */
+    SC_Replay_DrainTrace();
+
+    SC_Replay_LogPrefix();
+    fprintf(SC_Replay_Log, "EVS %u %s: %s\n", (unsigned int)EventID, SC_Bench_EventTypeName(EventType), Text);
+}
+
+void SC_Replay_ScriptError(const char *Message, const char *Token)
+{
+    fprintf(stderr, "%s:%lu: %s '%s'\n", SC_Replay_ScriptName, (unsigned long)SC_Replay_LineNum, Message, Token);
+    exit(EXIT_FAILURE);
+}
+
+uint32 SC_Replay_ParseNumber(const char *Token)
+{
+    char *        End;
+    unsigned long Value = strtoul(Token, &End, 0);
+
+    if (*Token == '\0' || *End != '\0' || Value > 0xFFFFFFFF)
+    {
+        SC_Replay_ScriptError("not a number", Token);
+    }
+
+    return (uint32)Value;
+}
+
+/* Seconds since the epoch, with an optional fraction */
+CFE_TIME_SysTime_t SC_Replay_ParseOffset(const char *Token)
+{
+    CFE_TIME_SysTime_t Offset;
+    char *             End;
+    double             Seconds = strtod(Token, &End);
+
+    if (*End != '\0' || !(Seconds >= 0) || Seconds >= 4294967296.0)
+    {
+        SC_Replay_ScriptError("not a time offset", Token);
+    }
+
+    Offset.Seconds    = (uint32)Seconds;
+    Offset.Subseconds = (uint32)((Seconds - Offset.Seconds) * 4294967296.0);
+
+    return CFE_TIME_Add(SC_Replay_Epoch, Offset);
+}
+
+/* Read the next action from the script, returns false at the end of the file */
+bool SC_Replay_ReadAction(SC_Replay_Action_t *Action)
+{
+    char   Line[SC_REPLAY_MAX_LINE];
+    char * Tokens[SC_REPLAY_MAX_ARGS + 3];
+    char * CommentPtr;
+    uint32 NumTokens;
+    uint32 NumArgs;
+    int    Act;
+
+    while (fgets(Line, sizeof(Line), SC_Replay_Script) != NULL)
+    {
+        SC_Replay_LineNum++;
+
+        CommentPtr = strchr(Line, '#');
+        if (CommentPtr != NULL)
+        {
+            *CommentPtr = '\0';
+        }
+
+        NumTokens = 0;
+        for (Tokens[0] = strtok(Line, " \t\r\n"); Tokens[NumTokens] != NULL;
+             Tokens[NumTokens] = strtok(NULL, " \t\r\n"))
+        {
+            if (++NumTokens == sizeof(Tokens) / sizeof(Tokens[0]))
+            {
+                SC_Replay_ScriptError("too many arguments after", Tokens[1]);
+            }
+        }
+
+        if (NumTokens == 0)
+        {
+            continue;
+        }
+
+        if (strcmp(Tokens[0], "epoch") == 0)
+        {
+            if (NumTokens != 2 || SC_Replay_Started)
+            {
+                SC_Replay_ScriptError("epoch must be one number before the first action", Tokens[0]);
+            }
+
+            SC_Replay_Epoch.Seconds    = SC_Replay_ParseNumber(Tokens[1]);
+            SC_Replay_Epoch.Subseconds = 0;
+            continue;
+        }
+
+        if (NumTokens < 2)
+        {
+            SC_Replay_ScriptError("no action after", Tokens[0]);
+        }
+
+        Action->Time    = SC_Replay_ParseOffset(Tokens[0]);
+
+        if (SC_Replay_Started && CFE_TIME_Compare(Action->Time, SC_Replay_LastTime) == CFE_TIME_A_LT_B)
+        {
+            SC_Replay_ScriptError("actions must be in time order, not", Tokens[0]);
+        }
+        SC_Replay_Started  = true;
+        SC_Replay_LastTime = Action->Time;
+
+        for (Act = 0; Act < SC_Replay_Act_MAX; Act++)
+        {
+            if (strcmp(Tokens[1], SC_REPLAY_ACTS[Act].Name) == 0)
+            {
+                break;
+            }
+        }
+
+        if (Act == SC_Replay_Act_MAX)
+        {
+            SC_Replay_ScriptError("unknown action", Tokens[1]);
+        }
+
+        NumArgs = NumTokens - 2;
+        if (NumArgs < SC_REPLAY_ACTS[Act].MinArgs || NumArgs > SC_REPLAY_ACTS[Act].MaxArgs)
+        {
+            SC_Replay_ScriptError("wrong number of arguments for", Tokens[1]);
+        }
+
+        Action->Act     = (SC_Replay_Act_Enum_t)Act;
+        Action->Number  = 0;
+        Action->Policy  = SC_JumpAtsReset_NONE;
+        Action->Path[0] = '\0';
+
+        if (SC_REPLAY_ACTS[Act].NumberArg)
+        {
+            Action->Number = SC_Replay_ParseNumber(Tokens[2]);
+        }
+
+        if ((Act == SC_Replay_Act_LOAD_ATS && (Action->Number < 1 || Action->Number > SC_NUMBER_OF_ATS)) ||
+            (Act == SC_Replay_Act_LOAD_RTS && (Action->Number < 1 || Action->Number > SC_NUMBER_OF_RTS)))
+        {
+            SC_Replay_ScriptError("no such table number", Tokens[2]);
+        }
+
+        if (Act == SC_Replay_Act_JUMP_ATS && NumArgs == 2)
+        {
+            for (Action->Policy = 0;
+                 Action->Policy < sizeof(SC_REPLAY_JUMP_POLICIES) / sizeof(SC_REPLAY_JUMP_POLICIES[0]);
+                 Action->Policy++)
+            {
+                if (strcmp(Tokens[3], SC_REPLAY_JUMP_POLICIES[Action->Policy]) == 0)
+                {
+                    break;
+                }
+            }
+
+            if (Action->Policy == sizeof(SC_REPLAY_JUMP_POLICIES) / sizeof(SC_REPLAY_JUMP_POLICIES[0]))
+            {
+                SC_Replay_ScriptError("unknown jump reset policy", Tokens[3]);
+            }
+        }
+
+        /* the table file is the last argument of a load */
+        if (Act == SC_Replay_Act_LOAD_ATS || Act == SC_Replay_Act_LOAD_APPEND || Act == SC_Replay_Act_LOAD_RTS)
+        {
+            snprintf(Action->Path, sizeof(Action->Path), "%s%s",
+                     (Tokens[NumTokens - 1][0] == '/') ? "" : SC_Replay_ScriptDir, Tokens[NumTokens - 1]);
+        }
+
+        /* the action is logged as written, so the log does not depend on where the script is */
+        Action->Text[0] = '\0';
+        for (NumArgs = 1; NumArgs < NumTokens; NumArgs++)
+        {
+            strncat(Action->Text, " ", sizeof(Action->Text) - strlen(Action->Text) - 1);
+            strncat(Action->Text, Tokens[NumArgs], sizeof(Action->Text) - strlen(Action->Text) - 1);
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+/* Stage a table file and have SC take it, as cFE does after a ground load */
+void SC_Replay_LoadTable(const SC_Replay_Action_t *Action, CFE_TBL_Handle_t TblHandle, uint32 TableId)
+{
+    SC_Replay_Cmd_t Cmd;
+    CFE_Status_t    Status;
+
+    Status = CFE_TBL_Load(TblHandle, CFE_TBL_SRC_FILE, Action->Path);
+    if (Status != CFE_SUCCESS)
+    {
+        SC_Replay_LogPrefix();
+        fprintf(SC_Replay_Log, "!%s: table load failed, status 0x%08X\n", Action->Text, (unsigned int)Status);
+        return;
+    }
+
+    memset(&Cmd, 0, sizeof(Cmd));
+    CFE_MSG_Init(CFE_MSG_PTR(Cmd.ManageTable.CommandHeader), CFE_SB_ValueToMsgId(SC_CMD_MID),
+                 sizeof(Cmd.ManageTable));
+    CFE_MSG_SetFcnCode(CFE_MSG_PTR(Cmd.ManageTable.CommandHeader), SC_MANAGE_TABLE_CC);
+    Cmd.ManageTable.Payload.Parameter = TableId;
+
+    SC_ProcessRequest((const CFE_SB_Buffer_t *)&Cmd);
+}
+
+/* Send a ground command with the action's number, if it has one, as the payload */
+void SC_Replay_SendCommand(const SC_Replay_Action_t *Action, CFE_MSG_FcnCode_t FcnCode, size_t Size)
+{
+    SC_Replay_Cmd_t Cmd;
+
+    memset(&Cmd, 0, sizeof(Cmd));
+    CFE_MSG_Init(CFE_MSG_PTR(Cmd.Noop.CommandHeader), CFE_SB_ValueToMsgId(SC_CMD_MID), Size);
+    CFE_MSG_SetFcnCode(CFE_MSG_PTR(Cmd.Noop.CommandHeader), FcnCode);
+
+    switch (FcnCode)
+    {
+        case SC_START_ATS_CC:
+            Cmd.StartAts.Payload.AtsNum = SC_ATS_NUM_C(Action->Number);
+            break;
+        case SC_APPEND_ATS_CC:
+            Cmd.AppendAts.Payload.AtsNum = SC_ATS_NUM_C(Action->Number);
+            break;
+        case SC_JUMP_ATS_CC:
+            /* like the action times, the jump time is relative to the epoch */
+            Cmd.JumpAts.Payload.NewTime     = SC_Replay_Epoch.Seconds + Action->Number;
+            Cmd.JumpAts.Payload.ResetPolicy = Action->Policy;
+            break;
+        case SC_START_RTS_CC:
+        case SC_STOP_RTS_CC:
+        case SC_ENABLE_RTS_CC:
+        case SC_DISABLE_RTS_CC:
+            /* all the single RTS commands share a payload */
+            Cmd.StartRts.Payload.RtsNum = SC_RTS_NUM_C(Action->Number);
+            break;
+        default:
+            break;
+    }
+
+    SC_ProcessRequest((const CFE_SB_Buffer_t *)&Cmd);
+}
+
+/* Carry out an action, returns the wakeups per second from then on */
+uint32 SC_Replay_Perform(const SC_Replay_Action_t *Action, uint32 Rate)
+{
+    SC_Replay_LogPrefix();
+    fprintf(SC_Replay_Log, ">%s\n", Action->Text);
+
+    switch (Action->Act)
+    {
+        case SC_Replay_Act_LOAD_ATS:
+            SC_Replay_LoadTable(Action, SC_OperData.AtsTblHandle[Action->Number - 1],
+                                SC_TBL_ID_ATS_0 + Action->Number - 1);
+            break;
+        case SC_Replay_Act_LOAD_APPEND:
+            SC_Replay_LoadTable(Action, SC_OperData.AppendTblHandle, SC_TBL_ID_APPEND);
+            break;
+        case SC_Replay_Act_LOAD_RTS:
+            SC_Replay_LoadTable(Action, SC_OperData.RtsTblHandle[Action->Number - 1],
+                                SC_TBL_ID_RTS_0 + Action->Number - 1);
+            break;
+        case SC_Replay_Act_START_ATS:
+            SC_Replay_SendCommand(Action, SC_START_ATS_CC, sizeof(SC_StartAtsCmd_t));
+            break;
+        case SC_Replay_Act_STOP_ATS:
+            SC_Replay_SendCommand(Action, SC_STOP_ATS_CC, sizeof(SC_StopAtsCmd_t));
+            break;
+        case SC_Replay_Act_SWITCH_ATS:
+            SC_Replay_SendCommand(Action, SC_SWITCH_ATS_CC, sizeof(SC_SwitchAtsCmd_t));
+            break;
+        case SC_Replay_Act_JUMP_ATS:
+            SC_Replay_SendCommand(Action, SC_JUMP_ATS_CC, sizeof(SC_JumpAtsCmd_t));
+            break;
+        case SC_Replay_Act_APPEND_ATS:
+            SC_Replay_SendCommand(Action, SC_APPEND_ATS_CC, sizeof(SC_AppendAtsCmd_t));
+            break;
+        case SC_Replay_Act_START_RTS:
+            SC_Replay_SendCommand(Action, SC_START_RTS_CC, sizeof(SC_StartRtsCmd_t));
+            break;
+        case SC_Replay_Act_STOP_RTS:
+            SC_Replay_SendCommand(Action, SC_STOP_RTS_CC, sizeof(SC_StopRtsCmd_t));
+            break;
+        case SC_Replay_Act_ENABLE_RTS:
+            SC_Replay_SendCommand(Action, SC_ENABLE_RTS_CC, sizeof(SC_EnableRtsCmd_t));
+            break;
+        case SC_Replay_Act_DISABLE_RTS:
+            SC_Replay_SendCommand(Action, SC_DISABLE_RTS_CC, sizeof(SC_DisableRtsCmd_t));
+            break;
+        case SC_Replay_Act_NOOP:
+            SC_Replay_SendCommand(Action, SC_NOOP_CC, sizeof(SC_NoopCmd_t));
+            break;
+        case SC_Replay_Act_RATE:
+            Rate = Action->Number;
+            break;
+        case SC_Replay_Act_END:
+        default:
+            break;
+    }
+
+    return Rate;
+}
+
+/* Compare the log with the golden log, reporting the first difference */
+bool SC_Replay_CompareGolden(FILE *LogFile, const char *GoldenName)
+{
+    FILE * GoldenFile;
+    char   LogLine[SC_REPLAY_MAX_LINE * 2];
+    char   GoldenLine[SC_REPLAY_MAX_LINE * 2];
+    char * LogPtr;
+    char * GoldenPtr;
+    uint32 LineNum = 0;
+
+    GoldenFile = fopen(GoldenName, "r");
+    if (GoldenFile == NULL)
+    {
+        perror(GoldenName);
+        return false;
+    }
+
+    rewind(LogFile);
+
+    do
+    {
+        LineNum++;
+        LogPtr    = fgets(LogLine, sizeof(LogLine), LogFile);
+        GoldenPtr = fgets(GoldenLine, sizeof(GoldenLine), GoldenFile);
+
+        if (LogPtr == NULL || GoldenPtr == NULL || strcmp(LogLine, GoldenLine) != 0)
+        {
+            break;
+        }
+    } while (true);
+
+    fclose(GoldenFile);
+
+    if (LogPtr == NULL && GoldenPtr == NULL)
+    {
+        return true;
+    }
+
+    fprintf(stderr, "log differs from %s at line %lu\n  expected: %s  actual:   %s", GoldenName, (unsigned long)LineNum,
+            (GoldenPtr != NULL) ? GoldenLine : "(end of file)\n", (LogPtr != NULL) ? LogLine : "(end of file)\n");
+
+    return false;
+}
+
+void SC_Replay_Usage(const char *Program)
+{
+    printf("usage: %s [options] script\n"
+           "  -o FILE  write the log to FILE (default standard output)\n"
+           "  -g FILE  compare the log with the golden log FILE, exit 1 if they differ\n"
+           "  -d       log debug events too\n"
+           "\n"
+           "Each script line is '<seconds> <action> [args]', with the seconds counted from\n"
+           "the epoch (default %d, set with an 'epoch <seconds>' line before the first action)\n"
+           "and never going back.  '#' starts a comment.  Actions:\n"
+           "  load-ats N FILE, load-append FILE, load-rts N FILE\n"
+           "      load a table file, relative to the script, and have SC take it\n"
+           "  start-ats N, stop-ats, switch-ats, append-ats N, jump SECONDS [none|skipped|all]\n"
+           "  start-rts N, stop-rts N, enable-rts N, disable-rts N, noop\n"
+           "      send the ground command, jump times are counted from the epoch\n"
+           "  rate N\n"
+           "      send N wakeups a second from now on (default %d), 0 for none\n"
+           "  end\n"
+           "      stop the replay, every script needs one\n",
+           Program, SC_REPLAY_DEFAULT_EPOCH, SC_WAKEUPS_PER_SECOND);
+}
+
+int main(int argc, char *argv[])
+{
+    SC_Replay_Action_t Action;
+    SC_Replay_Cmd_t    Wakeup;
+    const char *       LogName    = NULL;
+    const char *       GoldenName = NULL;
+    const char *       SlashPtr;
+    int                Opt;
+    bool               HaveAction;
+    bool               Ended = false;
+    bool               Matched;
+    uint32             Rate       = SC_WAKEUPS_PER_SECOND;
+    uint32             NumWakeups = 0;
+    uint64             WakeupPeriod;
+    CFE_TIME_SysTime_t Period;
+    uint64             RunStartNs;
+    uint64             StartNs;
+    uint64             ElapsedNs;
+    uint64             WakeupNs    = 0;
+    uint64             MaxWakeupNs = 0;
+    double             HostSecs;
+    double             VirtualSecs;
+
+    while ((Opt = getopt(argc, argv, "o:g:dh")) != -1)
+    {
+        switch (Opt)
+        {
+            case 'o':
+                LogName = optarg;
+                break;
+            case 'g':
+                GoldenName = optarg;
+                break;
+            case 'd':
+                SC_Replay_DebugEvents = true;
+                break;
+            default:
+                SC_Replay_Usage(argv[0]);
+                return (Opt == 'h') ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+    if (optind != argc - 1)
+    {
+        SC_Replay_Usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    SC_Replay_ScriptName = argv[optind];
+    SC_Replay_Script     = fopen(SC_Replay_ScriptName, "r");
+    if (SC_Replay_Script == NULL)
+    {
+        perror(SC_Replay_ScriptName);
+        return EXIT_FAILURE;
+    }
+
+    /* table files are found relative to the script */
+    SlashPtr = strrchr(SC_Replay_ScriptName, '/');
+    if (SlashPtr != NULL && SlashPtr - SC_Replay_ScriptName + 1 < (int)sizeof(SC_Replay_ScriptDir))
+    {
+        memcpy(SC_Replay_ScriptDir, SC_Replay_ScriptName, SlashPtr - SC_Replay_ScriptName + 1);
+    }
+
+    /* a golden comparison needs the log read back, so it goes to a file either way */
+    if (LogName != NULL)
+    {
+        SC_Replay_Log = fopen(LogName, (GoldenName != NULL) ? "w+" : "w");
+    }
+    else
+    {
+        SC_Replay_Log = (GoldenName != NULL) ? tmpfile() : stdout;
+    }
+
+    if (SC_Replay_Log == NULL)
+    {
+        perror((LogName != NULL) ? LogName : "log");
+        return EXIT_FAILURE;
+    }
+
+    SC_Replay_Epoch.Seconds = SC_REPLAY_DEFAULT_EPOCH;
+    SC_Replay_Clock         = SC_Replay_Epoch;
+
+    if (SC_AppInit() != CFE_SUCCESS)
+    {
+        fprintf(stderr, "SC_AppInit failed\n");
+        return EXIT_FAILURE;
+    }
+
+    /* from here on SC sees only the virtual clock, and its events go in the log */
+    SC_AppData.TimeRef.GetTime = SC_Replay_GetTime;
+    SC_Bench_EventHook         = SC_Replay_LogEvent;
+    SC_Replay_TraceDrained     = SC_OperData.TraceTblAddr->EntryCount;
+
+    memset(&Wakeup, 0, sizeof(Wakeup));
+    CFE_MSG_Init(CFE_MSG_PTR(Wakeup.Wakeup.CommandHeader), CFE_SB_ValueToMsgId(SC_WAKEUP_MID),
+                 sizeof(Wakeup.Wakeup));
+
+    HaveAction = SC_Replay_ReadAction(&Action);
+    if (HaveAction)
+    {
+        SC_Replay_Clock = SC_Replay_Epoch;
+    }
+
+    RunStartNs = SC_Replay_Now();
+
+    while (!Ended)
+    {
+        /* everything due by now happens before this wakeup */
+        while (HaveAction && CFE_TIME_Compare(Action.Time, SC_Replay_Clock) != CFE_TIME_A_GT_B)
+        {
+            Rate = SC_Replay_Perform(&Action, Rate);
+            SC_Replay_DrainTrace();
+
+            if (Action.Act == SC_Replay_Act_END)
+            {
+                Ended = true;
+                break;
+            }
+
+            HaveAction = SC_Replay_ReadAction(&Action);
+        }
+
+        if (Ended)
+        {
+            break;
+        }
+
+        if (!HaveAction)
+        {
+            SC_Replay_ScriptError("script has no", "end");
+        }
+
+        if (Rate == 0)
+        {
+            /* nothing happens without wakeups, so go straight to the next action */
+            SC_Replay_Clock = Action.Time;
+            continue;
+        }
+
+        StartNs = SC_Replay_Now();
+        SC_ProcessRequest((const CFE_SB_Buffer_t *)&Wakeup);
+        ElapsedNs = SC_Replay_Now() - StartNs;
+
+        WakeupNs += ElapsedNs;
+        if (ElapsedNs > MaxWakeupNs)
+        {
+            MaxWakeupNs = ElapsedNs;
+        }
+        NumWakeups++;
+
+        SC_Replay_DrainTrace();
+
+        /* in units of 2^-32 seconds */
+        WakeupPeriod      = 0x100000000ULL / Rate;
+        Period.Seconds    = (uint32)(WakeupPeriod >> 32);
+        Period.Subseconds = (uint32)WakeupPeriod;
+        SC_Replay_Clock   = CFE_TIME_Add(SC_Replay_Clock, Period);
+    }
+
+    HostSecs    = (SC_Replay_Now() - RunStartNs) / 1e9;
+    VirtualSecs = (SC_Replay_Clock.Seconds - SC_Replay_Epoch.Seconds) +
+                  (SC_Replay_Clock.Subseconds - (double)SC_Replay_Epoch.Subseconds) / 4294967296.0;
+
+    fflush(SC_Replay_Log);
+
+    fprintf(stderr,
+            "replayed %.0f s in %.3f s (%.0fx), %lu wakeups (mean %.0f ns, max %lu ns), %lu dispatches, "
+            "%lu events, %lu error events\n",
+            VirtualSecs, HostSecs, (HostSecs > 0) ? VirtualSecs / HostSecs : 0, (unsigned long)NumWakeups,
+            (NumWakeups > 0) ? (double)WakeupNs / NumWakeups : 0, (unsigned long)MaxWakeupNs,
+            (unsigned long)SC_Replay_NumDispatches, (unsigned long)SC_Bench_NumEvents,
+            (unsigned long)SC_Bench_NumErrorEvents);
+
+    Matched = true;
+    if (GoldenName != NULL)
+    {
+        Matched = SC_Replay_CompareGolden(SC_Replay_Log, GoldenName);
+    }
+
+    if (SC_Replay_Log != stdout)
+    {
+        fclose(SC_Replay_Log);
+    }
+    fclose(SC_Replay_Script);
+
+    return Matched ? EXIT_SUCCESS : EXIT_FAILURE;
+}
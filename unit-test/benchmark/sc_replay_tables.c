@@ -0,0 +1,144 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,924-1, and identified as “Core Flight
+ * System (cFS) Stored Command Application version 3.1.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Sample replay table writer
+ *
+ *   Writes the example ATS and RTS tables in fsw/tables as cFE table
+ *   files, for the sample replay script in the sample directory.  The
+ *   images come from the same sources as the flight tables, so they
+ *   follow the mission's headers and configuration.
+ */
+
+/*
+ * Includes
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cfe.h"
+#include "cfe_tbl_filedef.h"
+
+/* Longest table file path */
+#define SC_REPLAY_TABLES_MAX_PATH 512
+
+/* One example table, as its CFE_TBL_FILEDEF line describes it */
+typedef struct
+{
+    const void *Data;
+    size_t      Size;
+    const char *TableName;
+    const char *FileName;
+} SC_ReplayTables_Image_t;
+
+/*
+ * Each example table source ends with a CFE_TBL_FILEDEF line.  Here it
+ * describes the table image instead of defining the cFE file definition,
+ * which every source names the same.
+ */
+#undef CFE_TBL_FILEDEF
+#define CFE_TBL_FILEDEF(ObjName, TblName, Desc, Filename) \
+    const SC_ReplayTables_Image_t SC_ReplayTables_##ObjName = {&ObjName, sizeof(ObjName), #TblName, #Filename};
+
+#include "sc_ats1.c"
+#undef SC_MEMBER_SIZE
+#include "sc_rts001.c"
+#undef SC_MEMBER_SIZE
+#include "sc_rts002.c"
+#undef SC_MEMBER_SIZE
+
+const SC_ReplayTables_Image_t *SC_ReplayTables_Images[] = {&SC_ReplayTables_SC_Ats1, &SC_ReplayTables_SC_Rts001,
+                                                           &SC_ReplayTables_SC_Rts002};
+
+/* Table files hold their header fields big-endian whatever the host */
+void SC_ReplayTables_ToBigEndian(void *FieldPtr, uint32 Value)
+{
+    uint8 *Bytes = (uint8 *)FieldPtr;
+
+    Bytes[0] = (uint8)(Value >> 24);
+    Bytes[1] = (uint8)(Value >> 16);
+    Bytes[2] = (uint8)(Value >> 8);
+    Bytes[3] = (uint8)Value;
+}
+
+/* Write one table file, with the headers cFE table services read */
+bool SC_ReplayTables_Write(const char *Dir, const SC_ReplayTables_Image_t *Image)
+{
+    FILE *             FilePtr;
+    CFE_FS_Header_t    FileHeader;
+    CFE_TBL_File_Hdr_t TblHeader;
+    char               Path[SC_REPLAY_TABLES_MAX_PATH];
+    bool               Written;
+
+    snprintf(Path, sizeof(Path), "%s/%s", Dir, Image->FileName);
+
+    memset(&FileHeader, 0, sizeof(FileHeader));
+    SC_ReplayTables_ToBigEndian(&FileHeader.ContentType, CFE_FS_FILE_CONTENT_ID);
+    SC_ReplayTables_ToBigEndian(&FileHeader.SubType, CFE_FS_SubType_TBL_IMG);
+    SC_ReplayTables_ToBigEndian(&FileHeader.Length, sizeof(FileHeader));
+    strncpy(FileHeader.Description, Image->TableName, sizeof(FileHeader.Description) - 1);
+
+    memset(&TblHeader, 0, sizeof(TblHeader));
+    SC_ReplayTables_ToBigEndian(&TblHeader.Offset, 0);
+    SC_ReplayTables_ToBigEndian(&TblHeader.NumBytes, Image->Size);
+    strncpy(TblHeader.TableName, Image->TableName, sizeof(TblHeader.TableName) - 1);
+
+    FilePtr = fopen(Path, "wb");
+    if (FilePtr == NULL)
+    {
+        perror(Path);
+        return false;
+    }
+
+    Written = (fwrite(&FileHeader, sizeof(FileHeader), 1, FilePtr) == 1) &&
+              (fwrite(&TblHeader, sizeof(TblHeader), 1, FilePtr) == 1) &&
+              (fwrite(Image->Data, Image->Size, 1, FilePtr) == 1);
+
+    if (fclose(FilePtr) != 0 || !Written)
+    {
+        fprintf(stderr, "%s: write failed\n", Path);
+        return false;
+    }
+
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    size_t i;
+
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: %s directory\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    for (i = 0; i < sizeof(SC_ReplayTables_Images) / sizeof(SC_ReplayTables_Images[0]); i++)
+    {
+        if (!SC_ReplayTables_Write(argv[1], SC_ReplayTables_Images[i]))
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
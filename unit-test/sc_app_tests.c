@@ -49,19 +49,53 @@ void UT_Handler_CFE_TBL_GetAddress(void *UserObj, UT_EntryKey_t FuncKey, const U
     SC_Test_SetTableAddrs();
 }
 
+/* The table ID a table handle is registered with for manage requests */
+typedef struct
+{
+    CFE_TBL_Handle_t TblHandle;
+    uint32           TableID;
+} UT_SC_ManageRegistration_t;
+
+void UT_Handler_CFE_TBL_NotifyByMessage(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_SC_ManageRegistration_t *Registration = UserObj;
+    CFE_TBL_Handle_t            TblHandle    = UT_Hook_GetArgValueByName(Context, "TblHandle", CFE_TBL_Handle_t);
+
+    if (TblHandle == Registration->TblHandle)
+    {
+        Registration->TableID = UT_Hook_GetArgValueByName(Context, "Parameter", uint32);
+    }
+}
+
 /* Nominal setup for table initialization */
 void UT_Setup_InitTables(void)
 {
     uint8 i;
 
-    /* There's 4 info/control tables, and SC_NUMBER_OF_ATS command status tables */
-    for (i = 0; i < 4 + SC_NUMBER_OF_ATS; i++)
+    /* There's 4 info/control tables, SC_NUMBER_OF_ATS command status tables, the trace and RTS statistics tables */
+    for (i = 0; i < 6 + SC_NUMBER_OF_ATS; i++)
     {
         UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_SUCCESS);
     }
     UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_TBL_INFO_UPDATED);
 }
 
+/* HK fields that table initialization fills in: empty ATS buffers and all RTS disabled */
+void UT_Expect_InitTablesHk(SC_HkTlm_Payload_t *Payload)
+{
+    uint16 i;
+
+    for (i = 0; i < SC_NUMBER_OF_ATS; i++)
+    {
+        Payload->AtpFreeBytes[i] = SC_ATS_BUFF_SIZE32 * SC_BYTES_IN_WORD;
+    }
+
+    for (i = 0; i < SC_NUMBER_OF_RTS; i++)
+    {
+        Payload->RtsDisabledStatus[i / SC_NUMBER_OF_RTS_IN_UINT16] |= (1 << (i % SC_NUMBER_OF_RTS_IN_UINT16));
+    }
+}
+
 void SC_AppMain_Test_Nominal(void)
 {
     CFE_SB_MsgId_t TestMsgId = CFE_SB_ValueToMsgId(SC_CMD_MID);
@@ -88,6 +122,7 @@ void SC_AppMain_Test_Nominal(void)
     /* Verify results */
     /* Generates 2 event messages we don't care about in this test */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_STUB_COUNT(SC_ProcessTriggerPipe, 2);
 }
 
 void SC_AppMain_Test_AppInitError(void)
@@ -125,6 +160,7 @@ void SC_AppMain_Test_RcvMsgError(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventID, SC_APP_EXIT_ERR_EID);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 3);
     UtAssert_STUB_COUNT(CFE_ES_WriteToSysLog, 1);
+    UtAssert_STUB_COUNT(SC_ProcessTriggerPipe, 0);
 }
 
 void SC_AppInit_Test_NominalPowerOnReset(void)
@@ -167,6 +203,8 @@ void SC_AppInit_Test_NominalPowerOnReset(void)
     Expected_SC_OperData.AtsCmdStatusHandle[0] = 0;
     Expected_SC_OperData.AtsCmdStatusHandle[1] = 0;
 
+    UT_Expect_InitTablesHk(&Expected_SC_OperData.HkPacket.Payload);
+
     Expected_SC_OperData.HkPacket.Payload.ContinueAtsOnFailureFlag = SC_AtsCont_TRUE;
 
     UtAssert_MemCmp(&SC_OperData.CmdPipe, &Expected_SC_OperData.CmdPipe, sizeof(Expected_SC_OperData.CmdPipe), "2");
@@ -232,6 +270,8 @@ void SC_AppInit_Test_Nominal(void)
     Expected_SC_OperData.AtsCmdStatusHandle[0] = 0;
     Expected_SC_OperData.AtsCmdStatusHandle[1] = 0;
 
+    UT_Expect_InitTablesHk(&Expected_SC_OperData.HkPacket.Payload);
+
     UtAssert_MemCmp(&SC_OperData.CmdPipe, &Expected_SC_OperData.CmdPipe, sizeof(Expected_SC_OperData.CmdPipe), "2");
     UtAssert_MemCmp(&SC_OperData.AtsInfoHandle, &Expected_SC_OperData.AtsInfoHandle,
                     sizeof(Expected_SC_OperData.AtsInfoHandle), "AtsInfoHandle");
@@ -322,6 +362,20 @@ void SC_AppInit_Test_SBSubscribeToCmdError(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
 }
 
+void SC_AppInit_Test_TriggerPipeError(void)
+{
+    /* Set CFE_SB_CreatePipe to return -1 for the trigger pipe in order to generate error message SC_CR_PIPE_ERR_EID */
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_CreatePipe), 2, -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(SC_AppInit(), -1);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_CR_PIPE_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(CFE_SB_Subscribe, 3);
+}
+
 void SC_AppInit_Test_InitTablesError(void)
 {
     /* Set CFE_TBL_Register to return -1 in order to reach return statement immediately after
@@ -345,6 +399,9 @@ void SC_InitTables_Test_Nominal(void)
     /* Execute the function being tested */
     UtAssert_INT32_EQ(SC_AppInit(), CFE_SUCCESS);
 
+    UtAssert_UINT32_EQ(SC_GetRtsInfoObject(SC_RTS_IDX_C(0))->Priority, SC_RTS_DEFAULT_PRIORITY);
+    SC_Assert_IDX_VALUE(SC_AppData.RtsLastServed[0], SC_NUMBER_OF_RTS - 1);
+
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTS_LOAD_FAIL_COUNT_INFO_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, SC_INIT_INF_EID);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
@@ -382,7 +439,7 @@ void SC_InitTables_Test_ErrorGetLoadTablePointers(void)
 {
     /* Causes SC_GetLoadTablePointers to return -1 in order to cause SC_GetLoadTablePointers to return -1, in order to
      * reach "Return(Result)" after SC_GetLoadTablePointers */
-    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 7, -1);
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 9, -1);
 
     /* Execute the function being tested */
     UtAssert_INT32_EQ(SC_InitTables(), -1);
@@ -471,11 +528,39 @@ void SC_RegisterAllTables_Test_ErrorRegisterATSCommandStatus(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
 }
 
+void SC_RegisterAllTables_Test_ErrorRegisterTrace(void)
+{
+    /* Set CFE_TBL_Register to return -1 after the ATS command status tables in order to generate error message
+     * SC_REGISTER_TRACE_TABLE_ERR_EID */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Register), 5 + SC_NUMBER_OF_ATS, -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(SC_RegisterAllTables(), -1);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_REGISTER_TRACE_TABLE_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_RegisterAllTables_Test_ErrorRegisterRtsStats(void)
+{
+    /* Set CFE_TBL_Register to return -1 after the trace table in order to generate error message
+     * SC_REGISTER_RTS_STATS_TABLE_ERR_EID */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Register), 6 + SC_NUMBER_OF_ATS, -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(SC_RegisterAllTables(), -1);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_REGISTER_RTS_STATS_TABLE_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
 void SC_RegisterAllTables_Test_ErrorRegisterLoadableRTS(void)
 {
     /* Set CFE_TBL_Register to return -1 on the last call when registering loadable RTS tables in order to generate
      * error message SC_REGISTER_RTS_TBL_ERR_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Register), 5 + SC_NUMBER_OF_ATS, -1);
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Register), 7 + SC_NUMBER_OF_ATS, -1);
 
     /* Execute the function being tested */
     UtAssert_INT32_EQ(SC_RegisterAllTables(), -1);
@@ -489,7 +574,7 @@ void SC_RegisterAllTables_Test_ErrorRegisterLoadableATS(void)
 {
     /* Set CFE_TBL_Register to return -1 on the last call when registering loadable ATS tables in order to generate
      * error message SC_REGISTER_ATS_TBL_ERR_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Register), 6 + SC_NUMBER_OF_ATS + SC_NUMBER_OF_RTS, -1);
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Register), 8 + SC_NUMBER_OF_ATS + SC_NUMBER_OF_RTS, -1);
 
     /* Execute the function being tested */
     UtAssert_INT32_EQ(SC_RegisterAllTables(), -1);
@@ -503,7 +588,7 @@ void SC_RegisterAllTables_Test_ErrorRegisterLoadableAppendATS(void)
 {
     /* Set CFE_TBL_Register to return -1 on the last call when registering loadable Append ATS tables in order to
      * generate error message SC_REGISTER_APPEND_TBL_ERR_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Register), 5 + 2 * SC_NUMBER_OF_ATS + SC_NUMBER_OF_RTS, -1);
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Register), 7 + 2 * SC_NUMBER_OF_ATS + SC_NUMBER_OF_RTS, -1);
 
     /* Execute the function being tested */
     UtAssert_INT32_EQ(SC_RegisterAllTables(), -1);
@@ -513,13 +598,27 @@ void SC_RegisterAllTables_Test_ErrorRegisterLoadableAppendATS(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
 }
 
+void SC_RegisterAllTables_Test_ErrorRegisterTrigger(void)
+{
+    /* Set CFE_TBL_Register to return -1 on the last call, when registering the trigger table in order to
+     * generate error message SC_REGISTER_TRIGGER_TBL_ERR_EID */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Register), 8 + 2 * SC_NUMBER_OF_ATS + SC_NUMBER_OF_RTS, -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(SC_RegisterAllTables(), -1);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_REGISTER_TRIGGER_TBL_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
 void SC_RegisterDumpOnlyTables_Test_Nominal(void)
 {
     /* Execute the function being tested */
     UtAssert_INT32_EQ(SC_RegisterDumpOnlyTables(), CFE_SUCCESS);
 
     /* Verify results */
-    UtAssert_STUB_COUNT(CFE_TBL_Register, 4 + SC_NUMBER_OF_ATS);
+    UtAssert_STUB_COUNT(CFE_TBL_Register, 6 + SC_NUMBER_OF_ATS);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
@@ -529,7 +628,7 @@ void SC_RegisterLoadableTables_Test_Nominal(void)
     UtAssert_INT32_EQ(SC_RegisterLoadableTables(), CFE_SUCCESS);
 
     /* Verify results */
-    UtAssert_STUB_COUNT(CFE_TBL_Register, 1 + SC_NUMBER_OF_RTS + SC_NUMBER_OF_ATS);
+    UtAssert_STUB_COUNT(CFE_TBL_Register, 2 + SC_NUMBER_OF_RTS + SC_NUMBER_OF_ATS);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
@@ -614,6 +713,34 @@ void SC_GetDumpTablePointers_Test_ErrorGetAddressATSCommandStatus(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
 }
 
+void SC_GetDumpTablePointers_Test_ErrorGetAddressTrace(void)
+{
+    /* Need to set CFE_TBL_GetAddress to return -1 after the ATS command status tables (to generate error message
+     * SC_GET_ADDRESS_TRACE_ERR_EID) */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 5 + SC_NUMBER_OF_ATS, -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(SC_GetDumpTablePointers(), -1);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_GET_ADDRESS_TRACE_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_GetDumpTablePointers_Test_ErrorGetAddressRtsStats(void)
+{
+    /* Need to set CFE_TBL_GetAddress to return -1 after the trace table (to generate error message
+     * SC_GET_ADDRESS_RTS_STATS_ERR_EID) */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 6 + SC_NUMBER_OF_ATS, -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(SC_GetDumpTablePointers(), -1);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_GET_ADDRESS_RTS_STATS_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
 void SC_GetLoadTablePointers_Test_Nominal(void)
 {
     /* Prevents all error messages */
@@ -657,11 +784,12 @@ void SC_GetLoadTablePointers_Test_ErrorGetAddressLoadableATSAppend(void)
 
 void SC_GetLoadTablePointers_Test_ErrorGetAddressLoadableRTS(void)
 {
-    /* Need to set CFE_TBL_GetAddress to return -1 on call (SC_NUMBER_OF_ATS + 2) (to generate error message
+    /* Need to set CFE_TBL_GetAddress to return -1 on call (SC_NUMBER_OF_ATS + 3) (to generate error message
      * SC_GET_ADDRESS_RTS_ERR_EID) */
     UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_INFO_UPDATED);
     UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_INFO_UPDATED);
     UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_INFO_UPDATED);
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_INFO_UPDATED);
     UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, -1);
 
     /* Execute the function being tested */
@@ -670,6 +798,25 @@ void SC_GetLoadTablePointers_Test_ErrorGetAddressLoadableRTS(void)
     /* Verify results */
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_GET_ADDRESS_RTS_ERR_EID);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(SC_UpdateTriggers, 1);
+}
+
+void SC_GetLoadTablePointers_Test_ErrorGetAddressTrigger(void)
+{
+    /* Need to set CFE_TBL_GetAddress to return -1 on call (SC_NUMBER_OF_ATS + 2) (to generate error message
+     * SC_GET_ADDRESS_TRIGGER_ERR_EID) */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_INFO_UPDATED);
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_INFO_UPDATED);
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_INFO_UPDATED);
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, -1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(SC_GetLoadTablePointers(), -1);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_GET_ADDRESS_TRIGGER_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(SC_UpdateTriggers, 0);
 }
 
 void SC_LoadDefaultTables_Test(void)
@@ -687,6 +834,51 @@ void SC_LoadDefaultTables_Test(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
 }
 
+void SC_LoadDefaultTables_Test_TriggerError(void)
+{
+    /* The RTS tables load, the trigger table does not */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_Load), SC_NUMBER_OF_RTS + 1, -1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_LoadDefaultTables());
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_TBL_Load, SC_NUMBER_OF_RTS + 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTS_LOAD_FAIL_COUNT_INFO_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, SC_TRIGGER_LOAD_FAIL_DBG_EID);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+}
+
+void SC_RegisterManageCmds_Test_Trace(void)
+{
+    UT_SC_ManageRegistration_t Registration = {.TblHandle = 7, .TableID = 0};
+
+    SC_OperData.TraceTblHandle = Registration.TblHandle;
+    UT_SetHandlerFunction(UT_KEY(CFE_TBL_NotifyByMessage), UT_Handler_CFE_TBL_NotifyByMessage, &Registration);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_RegisterManageCmds());
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_TBL_NotifyByMessage, 8 + (2 * SC_NUMBER_OF_ATS) + SC_NUMBER_OF_RTS);
+    UtAssert_UINT32_EQ(Registration.TableID, SC_TBL_ID_TRACE);
+}
+
+void SC_RegisterManageCmds_Test_RtsStats(void)
+{
+    UT_SC_ManageRegistration_t Registration = {.TblHandle = 8, .TableID = 0};
+
+    SC_OperData.RtsStatsHandle = Registration.TblHandle;
+    UT_SetHandlerFunction(UT_KEY(CFE_TBL_NotifyByMessage), UT_Handler_CFE_TBL_NotifyByMessage, &Registration);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_RegisterManageCmds());
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Registration.TableID, SC_TBL_ID_RTS_STATS);
+}
+
 void UtTest_Setup(void)
 {
     UtTest_Add(SC_AppMain_Test_Nominal, SC_Test_Setup, SC_Test_TearDown, "SC_AppMain_Test_Nominal");
@@ -703,6 +895,7 @@ void UtTest_Setup(void)
                "SC_AppInit_Test_SBSubscribeToCmdError");
     UtTest_Add(SC_AppInit_Test_SubscribeToWakeupError, SC_Test_Setup, SC_Test_TearDown,
                "SC_AppInit_Test_SubscribeToWakeupError");
+    UtTest_Add(SC_AppInit_Test_TriggerPipeError, SC_Test_Setup, SC_Test_TearDown, "SC_AppInit_Test_TriggerPipeError");
     UtTest_Add(SC_AppInit_Test_InitTablesError, SC_Test_Setup, SC_Test_TearDown, "SC_AppInit_Test_InitTablesError");
     UtTest_Add(SC_InitTables_Test_Nominal, SC_Test_Setup, SC_Test_TearDown, "SC_InitTables_Test_Nominal");
     UtTest_Add(SC_InitTables_Test_ErrorRegisterAllTables, SC_Test_Setup, SC_Test_TearDown,
@@ -722,12 +915,18 @@ void UtTest_Setup(void)
                "SC_RegisterAllTables_Test_ErrorRegisterATPControl");
     UtTest_Add(SC_RegisterAllTables_Test_ErrorRegisterATSCommandStatus, SC_Test_Setup, SC_Test_TearDown,
                "SC_RegisterAllTables_Test_ErrorRegisterATSCommandStatus");
+    UtTest_Add(SC_RegisterAllTables_Test_ErrorRegisterTrace, SC_Test_Setup, SC_Test_TearDown,
+               "SC_RegisterAllTables_Test_ErrorRegisterTrace");
+    UtTest_Add(SC_RegisterAllTables_Test_ErrorRegisterRtsStats, SC_Test_Setup, SC_Test_TearDown,
+               "SC_RegisterAllTables_Test_ErrorRegisterRtsStats");
     UtTest_Add(SC_RegisterAllTables_Test_ErrorRegisterLoadableRTS, SC_Test_Setup, SC_Test_TearDown,
                "SC_RegisterAllTables_Test_ErrorRegisterLoadableRTS");
     UtTest_Add(SC_RegisterAllTables_Test_ErrorRegisterLoadableATS, SC_Test_Setup, SC_Test_TearDown,
                "SC_RegisterAllTables_Test_ErrorRegisterLoadableATS");
     UtTest_Add(SC_RegisterAllTables_Test_ErrorRegisterLoadableAppendATS, SC_Test_Setup, SC_Test_TearDown,
                "SC_RegisterAllTables_Test_ErrorRegisterLoadableAppendATS");
+    UtTest_Add(SC_RegisterAllTables_Test_ErrorRegisterTrigger, SC_Test_Setup, SC_Test_TearDown,
+               "SC_RegisterAllTables_Test_ErrorRegisterTrigger");
     UtTest_Add(SC_RegisterDumpOnlyTables_Test_Nominal, SC_Test_Setup, SC_Test_TearDown,
                "SC_RegisterDumpOnlyTables_Test_Nominal");
     UtTest_Add(SC_RegisterLoadableTables_Test_Nominal, SC_Test_Setup, SC_Test_TearDown,
@@ -744,6 +943,10 @@ void UtTest_Setup(void)
                "SC_GetDumpTablePointers_Test_ErrorGetAddressATPControl");
     UtTest_Add(SC_GetDumpTablePointers_Test_ErrorGetAddressATSCommandStatus, SC_Test_Setup, SC_Test_TearDown,
                "SC_GetDumpTablePointers_Test_ErrorGetAddressATSCommandStatus");
+    UtTest_Add(SC_GetDumpTablePointers_Test_ErrorGetAddressTrace, SC_Test_Setup, SC_Test_TearDown,
+               "SC_GetDumpTablePointers_Test_ErrorGetAddressTrace");
+    UtTest_Add(SC_GetDumpTablePointers_Test_ErrorGetAddressRtsStats, SC_Test_Setup, SC_Test_TearDown,
+               "SC_GetDumpTablePointers_Test_ErrorGetAddressRtsStats");
     UtTest_Add(SC_GetLoadTablePointers_Test_Nominal, SC_Test_Setup, SC_Test_TearDown,
                "SC_GetLoadTablePointers_Test_Nominal");
     UtTest_Add(SC_GetLoadTablePointers_Test_ErrorGetAddressLoadableATS, SC_Test_Setup, SC_Test_TearDown,
@@ -752,5 +955,12 @@ void UtTest_Setup(void)
                "SC_GetLoadTablePointers_Test_ErrorGetAddressLoadableATSAppend");
     UtTest_Add(SC_GetLoadTablePointers_Test_ErrorGetAddressLoadableRTS, SC_Test_Setup, SC_Test_TearDown,
                "SC_GetLoadTablePointers_Test_ErrorGetAddressLoadableRTS");
+    UtTest_Add(SC_GetLoadTablePointers_Test_ErrorGetAddressTrigger, SC_Test_Setup, SC_Test_TearDown,
+               "SC_GetLoadTablePointers_Test_ErrorGetAddressTrigger");
     UtTest_Add(SC_LoadDefaultTables_Test, SC_Test_Setup, SC_Test_TearDown, "SC_LoadDefaultTables_Test");
+    UtTest_Add(SC_LoadDefaultTables_Test_TriggerError, SC_Test_Setup, SC_Test_TearDown,
+               "SC_LoadDefaultTables_Test_TriggerError");
+    UtTest_Add(SC_RegisterManageCmds_Test_Trace, SC_Test_Setup, SC_Test_TearDown, "SC_RegisterManageCmds_Test_Trace");
+    UtTest_Add(SC_RegisterManageCmds_Test_RtsStats, SC_Test_Setup, SC_Test_TearDown,
+               "SC_RegisterManageCmds_Test_RtsStats");
 }
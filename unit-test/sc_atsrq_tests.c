@@ -63,6 +63,46 @@ int32 UT_SC_StartAtsRq_CompareHook3(void *UserObj, int32 StubRetcode, uint32 Cal
     }
 }
 
+int32 UT_SC_QueryAts_CompareAbsTimeHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                         const UT_StubContext_t *Context)
+{
+    SC_AbsTimeTag_t AbsTime1 = UT_Hook_GetArgValueByName(Context, "AbsTime1", SC_AbsTimeTag_t);
+    SC_AbsTimeTag_t AbsTime2 = UT_Hook_GetArgValueByName(Context, "AbsTime2", SC_AbsTimeTag_t);
+
+    return (AbsTime1 > AbsTime2);
+}
+
+int32 UT_SC_QueryAts_GetAtsEntryTimeHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                         const UT_StubContext_t *Context)
+{
+    SC_AtsEntryHeader_t *Entry = UT_Hook_GetArgValueByName(Context, "Entry", SC_AtsEntryHeader_t *);
+
+    /* each command is scheduled 10 seconds after the one before it */
+    return SC_IDNUM_AS_UINT(Entry->CmdNumber) * 10;
+}
+
+/* Loads an ATS with NumCmds commands at times 10, 20, 30, ... */
+void UT_SC_QueryAts_Setup(SC_AtsIndex_t AtsIndex, uint32 NumCmds)
+{
+    SC_AtsEntryHeader_t *Entry;
+    uint32               i;
+
+    for (i = 0; i < NumCmds; i++)
+    {
+        SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_C(i))->CmdNum      = SC_COMMAND_NUM_C(i + 1);
+        SC_GetAtsEntryOffsetForCmd(AtsIndex, SC_COMMAND_IDX_C(i))->Offset     = SC_ENTRY_OFFSET_C(i * SC_ATS_HDR_WORDS);
+        SC_GetAtsStatusEntryForCommand(AtsIndex, SC_COMMAND_IDX_C(i))->Status = SC_Status_LOADED;
+
+        Entry            = &SC_GetAtsEntryAtOffset(AtsIndex, SC_ENTRY_OFFSET_C(i * SC_ATS_HDR_WORDS))->Header;
+        Entry->CmdNumber = SC_COMMAND_NUM_C(i + 1);
+    }
+
+    SC_GetAtsInfoObject(AtsIndex)->NumberOfCommands = NumCmds;
+
+    UT_SetHookFunction(UT_KEY(SC_CompareAbsTime), UT_SC_QueryAts_CompareAbsTimeHook, NULL);
+    UT_SetHookFunction(UT_KEY(SC_GetAtsEntryTime), UT_SC_QueryAts_GetAtsEntryTimeHook, NULL);
+}
+
 void SC_StartAtsCmd_Test_NominalA(void)
 {
     CFE_SB_MsgId_t        TestMsgId = CFE_SB_ValueToMsgId(SC_CMD_MID);
@@ -935,6 +975,520 @@ void SC_JumpAtsCmd_Test_AtsNotLoaded(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
 }
 
+void UT_SC_JumpAtsBack_Setup(SC_AtsIndex_t AtsIndex, SC_JumpAtsReset_Enum_t ResetPolicy)
+{
+    SC_AtsInfoTable_t *AtsInfoPtr;
+    uint32             i;
+
+    AtsInfoPtr = SC_GetAtsInfoObject(AtsIndex);
+
+    for (i = 0; i < 4; i++)
+    {
+        SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_C(i))->CmdNum = SC_COMMAND_NUM_C(i + 1);
+    }
+
+    SC_GetAtsStatusEntryForCommand(AtsIndex, SC_COMMAND_IDX_C(0))->Status = SC_Status_EXECUTED;
+    SC_GetAtsStatusEntryForCommand(AtsIndex, SC_COMMAND_IDX_C(1))->Status = SC_Status_SKIPPED;
+    SC_GetAtsStatusEntryForCommand(AtsIndex, SC_COMMAND_IDX_C(2))->Status = SC_Status_EXECUTED;
+    SC_GetAtsStatusEntryForCommand(AtsIndex, SC_COMMAND_IDX_C(3))->Status = SC_Status_LOADED;
+
+    SC_OperData.AtsCtrlBlckAddr->CurrAtsNum   = SC_AtsIndexToNum(AtsIndex);
+    SC_OperData.AtsCtrlBlckAddr->AtpState     = SC_Status_EXECUTING;
+    SC_OperData.AtsCtrlBlckAddr->CmdNumber    = SC_COMMAND_NUM_C(4);
+    SC_OperData.AtsCtrlBlckAddr->TimeIndexPtr = SC_SEQUENCE_IDX_C(3);
+    AtsInfoPtr->NumberOfCommands              = 4;
+
+    UT_CmdBuf.JumpAtsCmd.Payload.ResetPolicy = ResetPolicy;
+
+    /*
+     * Jump time is before the current entry (call 1) and before list entry 1 (call 2),
+     * but after list entry 0 (call 3)
+     */
+    UT_SetDeferredRetcode(UT_KEY(SC_CompareAbsTime), 3, true);
+}
+
+void SC_JumpAtsCmd_Test_JumpBackResetAll(void)
+{
+    SC_AtsIndex_t AtsIndex = SC_ATS_IDX_C(0);
+
+    UT_SC_JumpAtsBack_Setup(AtsIndex, SC_JumpAtsReset_ALL);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_JumpAtsCmd(&UT_CmdBuf.JumpAtsCmd));
+
+    /* Verify results */
+    SC_Assert_CmdStatus(SC_GetAtsStatusEntryForCommand(AtsIndex, SC_COMMAND_IDX_C(0))->Status, SC_Status_EXECUTED);
+    SC_Assert_CmdStatus(SC_GetAtsStatusEntryForCommand(AtsIndex, SC_COMMAND_IDX_C(1))->Status, SC_Status_LOADED);
+    SC_Assert_CmdStatus(SC_GetAtsStatusEntryForCommand(AtsIndex, SC_COMMAND_IDX_C(2))->Status, SC_Status_LOADED);
+    SC_Assert_CmdStatus(SC_GetAtsStatusEntryForCommand(AtsIndex, SC_COMMAND_IDX_C(3))->Status, SC_Status_LOADED);
+    SC_Assert_ID_VALUE(SC_OperData.AtsCtrlBlckAddr->CmdNumber, 2);
+    SC_Assert_IDX_VALUE(SC_OperData.AtsCtrlBlckAddr->TimeIndexPtr, 1);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdCtr, 1);
+    UtAssert_STUB_COUNT(SC_CompareAbsTime, 3);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_JUMPATS_CMD_LIST_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, SC_JUMP_ATS_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventID, SC_JUMP_ATS_RESET_DBG_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 3);
+}
+
+void SC_JumpAtsCmd_Test_JumpBackResetSkipped(void)
+{
+    SC_AtsIndex_t AtsIndex = SC_ATS_IDX_C(0);
+
+    UT_SC_JumpAtsBack_Setup(AtsIndex, SC_JumpAtsReset_SKIPPED);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_JumpAtsCmd(&UT_CmdBuf.JumpAtsCmd));
+
+    /* Verify results */
+    SC_Assert_CmdStatus(SC_GetAtsStatusEntryForCommand(AtsIndex, SC_COMMAND_IDX_C(0))->Status, SC_Status_EXECUTED);
+    SC_Assert_CmdStatus(SC_GetAtsStatusEntryForCommand(AtsIndex, SC_COMMAND_IDX_C(1))->Status, SC_Status_LOADED);
+    SC_Assert_CmdStatus(SC_GetAtsStatusEntryForCommand(AtsIndex, SC_COMMAND_IDX_C(2))->Status, SC_Status_EXECUTED);
+    SC_Assert_IDX_VALUE(SC_OperData.AtsCtrlBlckAddr->TimeIndexPtr, 1);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdCtr, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventID, SC_JUMP_ATS_RESET_DBG_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 3);
+}
+
+void SC_JumpAtsCmd_Test_JumpBackNoReset(void)
+{
+    SC_AtsIndex_t AtsIndex = SC_ATS_IDX_C(0);
+
+    UT_SC_JumpAtsBack_Setup(AtsIndex, SC_JumpAtsReset_NONE);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_JumpAtsCmd(&UT_CmdBuf.JumpAtsCmd));
+
+    /* Verify results */
+    SC_Assert_CmdStatus(SC_GetAtsStatusEntryForCommand(AtsIndex, SC_COMMAND_IDX_C(1))->Status, SC_Status_SKIPPED);
+    SC_Assert_CmdStatus(SC_GetAtsStatusEntryForCommand(AtsIndex, SC_COMMAND_IDX_C(2))->Status, SC_Status_EXECUTED);
+    SC_Assert_IDX_VALUE(SC_OperData.AtsCtrlBlckAddr->TimeIndexPtr, 1);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdCtr, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, SC_JUMP_ATS_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+}
+
+void SC_JumpAtsCmd_Test_InvalidResetPolicy(void)
+{
+    UT_CmdBuf.JumpAtsCmd.Payload.ResetPolicy = 99;
+    SC_OperData.AtsCtrlBlckAddr->AtpState    = SC_Status_EXECUTING;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_JumpAtsCmd(&UT_CmdBuf.JumpAtsCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdErrCtr, 1);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdCtr, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_JUMPATS_CMD_POLICY_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_QueryAtsWindowCmd_Test_Nominal(void)
+{
+    SC_AtsIndex_t              AtsIndex = SC_ATS_IDX_C(0);
+    SC_AtsWindowTlm_Payload_t *Payload  = &SC_OperData.AtsWindowPacket.Payload;
+
+    UT_SC_QueryAts_Setup(AtsIndex, SC_ATS_WINDOW_ENTRIES_PER_PKT + 3);
+    SC_GetAtsStatusEntryForCommand(AtsIndex, SC_COMMAND_IDX_C(SC_ATS_WINDOW_ENTRIES_PER_PKT + 1))->Status =
+        SC_Status_EXECUTED;
+
+    /* window excludes the first command and the last command */
+    UT_CmdBuf.QueryAtsWindowCmd.Payload.AtsNum    = SC_AtsIndexToNum(AtsIndex);
+    UT_CmdBuf.QueryAtsWindowCmd.Payload.StartTime = 20;
+    UT_CmdBuf.QueryAtsWindowCmd.Payload.EndTime   = (SC_ATS_WINDOW_ENTRIES_PER_PKT + 3) * 10;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_QueryAtsWindowCmd(&UT_CmdBuf.QueryAtsWindowCmd));
+
+    /* Verify results, the last of the two packets is left in the buffer */
+    UtAssert_UINT32_EQ(Payload->TotalEntries, SC_ATS_WINDOW_ENTRIES_PER_PKT + 1);
+    UtAssert_UINT32_EQ(Payload->FirstEntry, SC_ATS_WINDOW_ENTRIES_PER_PKT);
+    UtAssert_UINT32_EQ(Payload->NumEntries, 1);
+    SC_Assert_ID_VALUE(Payload->Entry[0].CmdNum, SC_ATS_WINDOW_ENTRIES_PER_PKT + 2);
+    UtAssert_UINT32_EQ(Payload->Entry[0].TimeTag, (SC_ATS_WINDOW_ENTRIES_PER_PKT + 2) * 10);
+    SC_Assert_CmdStatus(Payload->Entry[0].Status, SC_Status_EXECUTED);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdCtr, 1);
+
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_QUERYATS_CMD_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_QueryAtsWindowCmd_Test_PacketLimit(void)
+{
+    SC_AtsIndex_t              AtsIndex = SC_ATS_IDX_C(0);
+    SC_AtsWindowTlm_Payload_t *Payload  = &SC_OperData.AtsWindowPacket.Payload;
+    uint32                     NumCmds  = (SC_ATS_WINDOW_ENTRIES_PER_PKT * SC_ATS_WINDOW_MAX_PKTS) + 2;
+
+    UT_SC_QueryAts_Setup(AtsIndex, NumCmds);
+
+    /* window holds every command, more than the packets sent can report */
+    UT_CmdBuf.QueryAtsWindowCmd.Payload.AtsNum    = SC_AtsIndexToNum(AtsIndex);
+    UT_CmdBuf.QueryAtsWindowCmd.Payload.StartTime = 0;
+    UT_CmdBuf.QueryAtsWindowCmd.Payload.EndTime   = (NumCmds + 1) * 10;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_QueryAtsWindowCmd(&UT_CmdBuf.QueryAtsWindowCmd));
+
+    /* Verify results, the last packet sent stops short of the window end */
+    UtAssert_UINT32_EQ(Payload->TotalEntries, NumCmds);
+    UtAssert_UINT32_EQ(Payload->FirstEntry, SC_ATS_WINDOW_ENTRIES_PER_PKT * SC_ATS_WINDOW_MAX_PKTS);
+    UtAssert_UINT32_EQ(Payload->NumEntries, 0);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdCtr, 1);
+
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, SC_ATS_WINDOW_MAX_PKTS);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_QUERYATS_CMD_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_QueryAtsWindowCmd_Test_EmptyWindow(void)
+{
+    SC_AtsIndex_t              AtsIndex = SC_ATS_IDX_C(1);
+    SC_AtsWindowTlm_Payload_t *Payload  = &SC_OperData.AtsWindowPacket.Payload;
+
+    UT_SC_QueryAts_Setup(AtsIndex, 2);
+
+    /* window is after the last command */
+    UT_CmdBuf.QueryAtsWindowCmd.Payload.AtsNum    = SC_AtsIndexToNum(AtsIndex);
+    UT_CmdBuf.QueryAtsWindowCmd.Payload.StartTime = 30;
+    UT_CmdBuf.QueryAtsWindowCmd.Payload.EndTime   = 40;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_QueryAtsWindowCmd(&UT_CmdBuf.QueryAtsWindowCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Payload->TotalEntries, 0);
+    UtAssert_UINT32_EQ(Payload->NumEntries, 0);
+    SC_Assert_ID_EQ(Payload->AtsNum, SC_AtsIndexToNum(AtsIndex));
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdCtr, 1);
+
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_QUERYATS_CMD_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_QueryAtsWindowCmd_Test_InvalidAtsId(void)
+{
+    UT_CmdBuf.QueryAtsWindowCmd.Payload.AtsNum = SC_ATS_NUM_C(99);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_QueryAtsWindowCmd(&UT_CmdBuf.QueryAtsWindowCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdErrCtr, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_QUERYATS_CMD_INVLD_ID_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_QueryAtsWindowCmd_Test_NotLoaded(void)
+{
+    UT_CmdBuf.QueryAtsWindowCmd.Payload.AtsNum = SC_AtsIndexToNum(SC_ATS_IDX_C(0));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_QueryAtsWindowCmd(&UT_CmdBuf.QueryAtsWindowCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdErrCtr, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_QUERYATS_CMD_NOT_LDED_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_QueryAtsWindowCmd_Test_InvalidWindow(void)
+{
+    SC_AtsIndex_t AtsIndex = SC_ATS_IDX_C(0);
+
+    UT_SC_QueryAts_Setup(AtsIndex, 2);
+
+    UT_CmdBuf.QueryAtsWindowCmd.Payload.AtsNum    = SC_AtsIndexToNum(AtsIndex);
+    UT_CmdBuf.QueryAtsWindowCmd.Payload.StartTime = 20;
+    UT_CmdBuf.QueryAtsWindowCmd.Payload.EndTime   = 20;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_QueryAtsWindowCmd(&UT_CmdBuf.QueryAtsWindowCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdErrCtr, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_QUERYATS_CMD_WINDOW_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_SendAtsWindowPacket_Test(void)
+{
+    SC_OperData.AtsWindowPacket.Payload.NumEntries = 0;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_SendAtsWindowPacket());
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_MSG_SetSize, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TimeStampMsg, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+}
+
+void SC_ReportAtsStatusCmd_Test_Nominal(void)
+{
+    SC_AtsIndex_t              AtsIndex = SC_ATS_IDX_C(1);
+    SC_AtsStatusTlm_Payload_t *Payload  = &SC_OperData.AtsStatusPacket.Payload;
+
+    UT_SC_QueryAts_Setup(AtsIndex, 5);
+
+    UT_CmdBuf.ReportAtsStatusCmd.Payload.AtsNum = SC_AtsIndexToNum(AtsIndex);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_ReportAtsStatusCmd(&UT_CmdBuf.ReportAtsStatusCmd));
+
+    /* Verify results, nothing is sent until the next wakeup */
+    UtAssert_BOOL_TRUE(SC_AppData.AtsStatusJob.Active);
+    SC_Assert_IDX_EQ(SC_AppData.AtsStatusJob.AtsIndex, AtsIndex);
+    UtAssert_UINT32_EQ(SC_AppData.AtsStatusJob.SeqIndex, 0);
+    UtAssert_UINT32_EQ(Payload->TotalCommands, 5);
+    UtAssert_UINT32_EQ(Payload->NumRuns, 0);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdCtr, 1);
+
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_REPORTATS_CMD_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_ReportAtsStatusCmd_Test_InvalidAtsId(void)
+{
+    UT_CmdBuf.ReportAtsStatusCmd.Payload.AtsNum = SC_ATS_NUM_C(99);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_ReportAtsStatusCmd(&UT_CmdBuf.ReportAtsStatusCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdErrCtr, 1);
+    UtAssert_BOOL_FALSE(SC_AppData.AtsStatusJob.Active);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_REPORTATS_CMD_INVLD_ID_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_ReportAtsStatusCmd_Test_NotLoaded(void)
+{
+    UT_CmdBuf.ReportAtsStatusCmd.Payload.AtsNum = SC_AtsIndexToNum(SC_ATS_IDX_C(0));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_ReportAtsStatusCmd(&UT_CmdBuf.ReportAtsStatusCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdErrCtr, 1);
+    UtAssert_BOOL_FALSE(SC_AppData.AtsStatusJob.Active);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_REPORTATS_CMD_NOT_LDED_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_ReportAtsStatusCmd_Test_Busy(void)
+{
+    SC_AtsIndex_t AtsIndex = SC_ATS_IDX_C(0);
+
+    UT_SC_QueryAts_Setup(AtsIndex, 2);
+
+    SC_AppData.AtsStatusJob.Active   = true;
+    SC_AppData.AtsStatusJob.SeqIndex = 1;
+
+    UT_CmdBuf.ReportAtsStatusCmd.Payload.AtsNum = SC_AtsIndexToNum(AtsIndex);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_ReportAtsStatusCmd(&UT_CmdBuf.ReportAtsStatusCmd));
+
+    /* Verify results, the summary in progress is left alone */
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdErrCtr, 1);
+    UtAssert_UINT32_EQ(SC_AppData.AtsStatusJob.SeqIndex, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_REPORTATS_CMD_BUSY_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_ProcessAtsStatusSummary_Test_Idle(void)
+{
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_ProcessAtsStatusSummary(SC_ATS_STATUS_ENTRIES_PER_WAKEUP));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_ProcessAtsStatusSummary_Test_Incremental(void)
+{
+    SC_AtsIndex_t              AtsIndex = SC_ATS_IDX_C(0);
+    SC_AtsStatusTlm_Payload_t *Payload  = &SC_OperData.AtsStatusPacket.Payload;
+
+    UT_SC_QueryAts_Setup(AtsIndex, 4);
+    SC_GetAtsStatusEntryForCommand(AtsIndex, SC_COMMAND_IDX_C(0))->Status = SC_Status_EXECUTED;
+    SC_GetAtsStatusEntryForCommand(AtsIndex, SC_COMMAND_IDX_C(1))->Status = SC_Status_EXECUTED;
+
+    UT_CmdBuf.ReportAtsStatusCmd.Payload.AtsNum = SC_AtsIndexToNum(AtsIndex);
+    SC_ReportAtsStatusCmd(&UT_CmdBuf.ReportAtsStatusCmd);
+
+    /* Execute the function being tested, one wakeup covers 3 commands */
+    UtAssert_VOIDCALL(SC_ProcessAtsStatusSummary(3));
+
+    /* Verify results, nothing is sent until the summary is done */
+    UtAssert_BOOL_TRUE(SC_AppData.AtsStatusJob.Active);
+    UtAssert_UINT32_EQ(SC_AppData.AtsStatusJob.SeqIndex, 3);
+    UtAssert_UINT32_EQ(Payload->NumRuns, 2);
+    UtAssert_UINT32_EQ(Payload->Run[0], (SC_Status_EXECUTED << SC_ATS_STATUS_RUN_STATUS_SHIFT) | 2);
+    UtAssert_UINT32_EQ(Payload->Run[1], (SC_Status_LOADED << SC_ATS_STATUS_RUN_STATUS_SHIFT) | 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+
+    /* Execute the function being tested, the next wakeup finishes it */
+    UtAssert_VOIDCALL(SC_ProcessAtsStatusSummary(3));
+
+    UtAssert_BOOL_FALSE(SC_AppData.AtsStatusJob.Active);
+    UtAssert_UINT32_EQ(Payload->NumRuns, 2);
+    UtAssert_UINT32_EQ(Payload->Run[1], (SC_Status_LOADED << SC_ATS_STATUS_RUN_STATUS_SHIFT) | 2);
+    UtAssert_BOOL_TRUE(Payload->LastPacket);
+    UtAssert_UINT32_EQ(Payload->PacketNum, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, SC_REPORTATS_DONE_DBG_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+}
+
+void SC_ProcessAtsStatusSummary_Test_MultiPacket(void)
+{
+    SC_AtsIndex_t              AtsIndex = SC_ATS_IDX_C(0);
+    SC_AtsStatusTlm_Payload_t *Payload  = &SC_OperData.AtsStatusPacket.Payload;
+    uint32                     i;
+
+    /* every other command executed, so each command is its own run */
+    UT_SC_QueryAts_Setup(AtsIndex, SC_ATS_STATUS_RUNS_PER_PKT + 2);
+    for (i = 0; i < SC_ATS_STATUS_RUNS_PER_PKT + 2; i += 2)
+    {
+        SC_GetAtsStatusEntryForCommand(AtsIndex, SC_COMMAND_IDX_C(i))->Status = SC_Status_EXECUTED;
+    }
+
+    UT_CmdBuf.ReportAtsStatusCmd.Payload.AtsNum = SC_AtsIndexToNum(AtsIndex);
+    SC_ReportAtsStatusCmd(&UT_CmdBuf.ReportAtsStatusCmd);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_ProcessAtsStatusSummary(SC_ATS_STATUS_ENTRIES_PER_WAKEUP));
+
+    /* Verify results, the last of the two packets is left in the buffer */
+    UtAssert_BOOL_FALSE(SC_AppData.AtsStatusJob.Active);
+    UtAssert_UINT32_EQ(Payload->PacketNum, 1);
+    UtAssert_UINT32_EQ(Payload->FirstCommand, SC_ATS_STATUS_RUNS_PER_PKT);
+    UtAssert_UINT32_EQ(Payload->NumRuns, 2);
+    UtAssert_BOOL_TRUE(Payload->LastPacket);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 2);
+}
+
+void SC_ProcessAtsStatusSummary_Test_RunFull(void)
+{
+    SC_AtsIndex_t              AtsIndex = SC_ATS_IDX_C(0);
+    SC_AtsStatusTlm_Payload_t *Payload  = &SC_OperData.AtsStatusPacket.Payload;
+
+    UT_SC_QueryAts_Setup(AtsIndex, 1);
+
+    SC_AppData.AtsStatusJob.Active      = true;
+    SC_AppData.AtsStatusJob.AtsIndex    = AtsIndex;
+    SC_AppData.AtsStatusJob.NumCommands = 1;
+
+    /* a run of the same status that can't be extended */
+    Payload->NumRuns = 1;
+    Payload->Run[0]  = (SC_Status_LOADED << SC_ATS_STATUS_RUN_STATUS_SHIFT) | SC_ATS_STATUS_RUN_MAX_LENGTH;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_ProcessAtsStatusSummary(SC_ATS_STATUS_ENTRIES_PER_WAKEUP));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Payload->NumRuns, 2);
+    UtAssert_UINT32_EQ(Payload->Run[1], (SC_Status_LOADED << SC_ATS_STATUS_RUN_STATUS_SHIFT) | 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+}
+
+void SC_ProcessAtsStatusSummary_Test_AtsCleared(void)
+{
+    SC_AtsIndex_t AtsIndex = SC_ATS_IDX_C(0);
+
+    UT_SC_QueryAts_Setup(AtsIndex, 3);
+
+    UT_CmdBuf.ReportAtsStatusCmd.Payload.AtsNum = SC_AtsIndexToNum(AtsIndex);
+    SC_ReportAtsStatusCmd(&UT_CmdBuf.ReportAtsStatusCmd);
+
+    SC_GetAtsInfoObject(AtsIndex)->NumberOfCommands = 0;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_ProcessAtsStatusSummary(SC_ATS_STATUS_ENTRIES_PER_WAKEUP));
+
+    /* Verify results, an empty last packet ends the summary */
+    UtAssert_BOOL_FALSE(SC_AppData.AtsStatusJob.Active);
+    UtAssert_UINT32_EQ(SC_OperData.AtsStatusPacket.Payload.NumRuns, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+}
+
+void SC_StopAtsStatusSummary_Test_Reloaded(void)
+{
+    SC_AtsIndex_t              AtsIndex = SC_ATS_IDX_C(0);
+    SC_AtsStatusTlm_Payload_t *Payload  = &SC_OperData.AtsStatusPacket.Payload;
+
+    UT_SC_QueryAts_Setup(AtsIndex, 3);
+
+    UT_CmdBuf.ReportAtsStatusCmd.Payload.AtsNum = SC_AtsIndexToNum(AtsIndex);
+    SC_ReportAtsStatusCmd(&UT_CmdBuf.ReportAtsStatusCmd);
+    SC_ProcessAtsStatusSummary(1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_StopAtsStatusSummary(AtsIndex));
+
+    /* Verify results, the runs so far are sent as the last packet */
+    UtAssert_BOOL_FALSE(SC_AppData.AtsStatusJob.Active);
+    UtAssert_BOOL_TRUE(Payload->LastPacket);
+    UtAssert_UINT32_EQ(Payload->NumRuns, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, SC_REPORTATS_STOP_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+
+    /* a reload of an ATS with the same size does not resume the summary */
+    UtAssert_VOIDCALL(SC_ProcessAtsStatusSummary(SC_ATS_STATUS_ENTRIES_PER_WAKEUP));
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+}
+
+void SC_StopAtsStatusSummary_Test_OtherAts(void)
+{
+    SC_AtsIndex_t AtsIndex = SC_ATS_IDX_C(0);
+
+    UT_SC_QueryAts_Setup(AtsIndex, 3);
+
+    UT_CmdBuf.ReportAtsStatusCmd.Payload.AtsNum = SC_AtsIndexToNum(AtsIndex);
+    SC_ReportAtsStatusCmd(&UT_CmdBuf.ReportAtsStatusCmd);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_StopAtsStatusSummary(SC_ATS_IDX_C(1)));
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(SC_AppData.AtsStatusJob.Active);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_SendAtsStatusPacket_Test(void)
+{
+    SC_OperData.AtsStatusPacket.Payload.NumRuns = 0;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_SendAtsStatusPacket());
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_MSG_SetSize, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TimeStampMsg, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+}
+
 void ContinueAtsOnFailureCmd_Test_Nominal(void)
 {
     CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(SC_CMD_MID);
@@ -1199,6 +1753,50 @@ void UtTest_Setup(void)
                "SC_JumpAtsCmd_Test_AllCommandsSkipped");
     UtTest_Add(SC_JumpAtsCmd_Test_NoRunningAts, SC_Test_Setup, SC_Test_TearDown, "SC_JumpAtsCmd_Test_NoRunningAts");
     UtTest_Add(SC_JumpAtsCmd_Test_AtsNotLoaded, SC_Test_Setup, SC_Test_TearDown, "SC_JumpAtsCmd_Test_AtsNotLoaded");
+    UtTest_Add(SC_JumpAtsCmd_Test_JumpBackResetAll, SC_Test_Setup, SC_Test_TearDown,
+               "SC_JumpAtsCmd_Test_JumpBackResetAll");
+    UtTest_Add(SC_JumpAtsCmd_Test_JumpBackResetSkipped, SC_Test_Setup, SC_Test_TearDown,
+               "SC_JumpAtsCmd_Test_JumpBackResetSkipped");
+    UtTest_Add(SC_JumpAtsCmd_Test_JumpBackNoReset, SC_Test_Setup, SC_Test_TearDown,
+               "SC_JumpAtsCmd_Test_JumpBackNoReset");
+    UtTest_Add(SC_JumpAtsCmd_Test_InvalidResetPolicy, SC_Test_Setup, SC_Test_TearDown,
+               "SC_JumpAtsCmd_Test_InvalidResetPolicy");
+    UtTest_Add(SC_QueryAtsWindowCmd_Test_Nominal, SC_Test_Setup, SC_Test_TearDown,
+               "SC_QueryAtsWindowCmd_Test_Nominal");
+    UtTest_Add(SC_QueryAtsWindowCmd_Test_PacketLimit, SC_Test_Setup, SC_Test_TearDown,
+               "SC_QueryAtsWindowCmd_Test_PacketLimit");
+    UtTest_Add(SC_QueryAtsWindowCmd_Test_EmptyWindow, SC_Test_Setup, SC_Test_TearDown,
+               "SC_QueryAtsWindowCmd_Test_EmptyWindow");
+    UtTest_Add(SC_QueryAtsWindowCmd_Test_InvalidAtsId, SC_Test_Setup, SC_Test_TearDown,
+               "SC_QueryAtsWindowCmd_Test_InvalidAtsId");
+    UtTest_Add(SC_QueryAtsWindowCmd_Test_NotLoaded, SC_Test_Setup, SC_Test_TearDown,
+               "SC_QueryAtsWindowCmd_Test_NotLoaded");
+    UtTest_Add(SC_QueryAtsWindowCmd_Test_InvalidWindow, SC_Test_Setup, SC_Test_TearDown,
+               "SC_QueryAtsWindowCmd_Test_InvalidWindow");
+    UtTest_Add(SC_SendAtsWindowPacket_Test, SC_Test_Setup, SC_Test_TearDown, "SC_SendAtsWindowPacket_Test");
+    UtTest_Add(SC_ReportAtsStatusCmd_Test_Nominal, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ReportAtsStatusCmd_Test_Nominal");
+    UtTest_Add(SC_ReportAtsStatusCmd_Test_InvalidAtsId, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ReportAtsStatusCmd_Test_InvalidAtsId");
+    UtTest_Add(SC_ReportAtsStatusCmd_Test_NotLoaded, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ReportAtsStatusCmd_Test_NotLoaded");
+    UtTest_Add(SC_ReportAtsStatusCmd_Test_Busy, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ReportAtsStatusCmd_Test_Busy");
+    UtTest_Add(SC_ProcessAtsStatusSummary_Test_Idle, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessAtsStatusSummary_Test_Idle");
+    UtTest_Add(SC_ProcessAtsStatusSummary_Test_Incremental, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessAtsStatusSummary_Test_Incremental");
+    UtTest_Add(SC_ProcessAtsStatusSummary_Test_MultiPacket, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessAtsStatusSummary_Test_MultiPacket");
+    UtTest_Add(SC_ProcessAtsStatusSummary_Test_RunFull, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessAtsStatusSummary_Test_RunFull");
+    UtTest_Add(SC_ProcessAtsStatusSummary_Test_AtsCleared, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessAtsStatusSummary_Test_AtsCleared");
+    UtTest_Add(SC_StopAtsStatusSummary_Test_Reloaded, SC_Test_Setup, SC_Test_TearDown,
+               "SC_StopAtsStatusSummary_Test_Reloaded");
+    UtTest_Add(SC_StopAtsStatusSummary_Test_OtherAts, SC_Test_Setup, SC_Test_TearDown,
+               "SC_StopAtsStatusSummary_Test_OtherAts");
+    UtTest_Add(SC_SendAtsStatusPacket_Test, SC_Test_Setup, SC_Test_TearDown, "SC_SendAtsStatusPacket_Test");
     UtTest_Add(ContinueAtsOnFailureCmd_Test_Nominal, SC_Test_Setup, SC_Test_TearDown,
                "ContinueAtsOnFailureCmd_Test_Nominal");
     UtTest_Add(ContinueAtsOnFailureCmd_Test_FalseState, SC_Test_Setup, SC_Test_TearDown,
@@ -23,7 +23,9 @@
 
 #include "sc_cmds.h"
 #include "sc_atsrq.h"
+#include "sc_dispatch.h"
 #include "sc_rtsrq.h"
+#include "sc_loads.h"
 #include "sc_state.h"
 #include "sc_events.h"
 #include "sc_msgids.h"
@@ -100,7 +102,7 @@ void SC_ProcessAtpCmd_Test_SwitchCmd(void)
 void SC_ProcessAtpCmd_Test_NonSwitchCmd(void)
 {
     SC_AtsEntryHeader_t *         Entry;
-    CFE_SB_MsgId_t                TestMsgId = CFE_SB_ValueToMsgId(SC_CMD_MID);
+    CFE_SB_MsgId_t                TestMsgId = SC_UT_MID_1;
     CFE_MSG_FcnCode_t             FcnCode   = SC_NOOP_CC;
     SC_AtsIndex_t                 AtsIndex  = SC_ATS_IDX_C(0);
     SC_AtsCmdStatusEntry_t *      StatusEntryPtr;
@@ -141,9 +143,173 @@ void SC_ProcessAtpCmd_Test_NonSwitchCmd(void)
     UtAssert_True(SC_OperData.HkPacket.Payload.AtsCmdErrCtr == 0, "SC_OperData.HkPacket.Payload.AtsCmdErrCtr == 0");
     UtAssert_True(SC_OperData.NumCmdsWakeup == 1, "SC_OperData.NumCmdsWakeup == 1");
     SC_Assert_CmdStatus(StatusEntryPtr->Status, SC_Status_EXECUTED);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_STUB_COUNT(SC_RecordDispatchLatency, 1);
+    UtAssert_STUB_COUNT(SC_RecordTrace, 1);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
+static SC_Status_Enum_t UT_SC_TraceStatus;
+static uint32           UT_SC_TraceCmdId;
+
+static void UT_SC_RecordTraceHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_SC_TraceStatus = UT_Hook_GetArgValueByName(Context, "Status", SC_Status_Enum_t);
+    UT_SC_TraceCmdId  = UT_Hook_GetArgValueByName(Context, "CmdId", uint32);
+}
+
+static const CFE_SB_Buffer_t *UT_SC_LocalCmdPtr;
+
+static void UT_SC_ProcessCommandHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_SC_LocalCmdPtr = UT_Hook_GetArgValueByName(Context, "BufPtr", const CFE_SB_Buffer_t *);
+}
+
+void SC_ProcessAtpCmd_Test_LocalCmd(void)
+{
+    SC_AtsEntryHeader_t *         Entry;
+    CFE_SB_MsgId_t                TestMsgId = CFE_SB_ValueToMsgId(SC_CMD_MID);
+    CFE_MSG_FcnCode_t             FcnCode   = SC_START_RTS_CC;
+    SC_AtsIndex_t                 AtsIndex  = SC_ATS_IDX_C(0);
+    SC_AtsCmdStatusEntry_t *      StatusEntryPtr;
+    SC_AtsCmdEntryOffsetRecord_t *CmdOffsetRec;
+
+    CmdOffsetRec   = SC_GetAtsEntryOffsetForCmd(AtsIndex, SC_COMMAND_IDX_C(0));
+    StatusEntryPtr = SC_GetAtsStatusEntryForCommand(AtsIndex, SC_COMMAND_IDX_C(0));
+
+    Entry            = (SC_AtsEntryHeader_t *)SC_GetAtsEntryAtOffset(AtsIndex, SC_ENTRY_OFFSET_FIRST);
+    Entry->CmdNumber = SC_COMMAND_NUM_C(1);
+
+    SC_OperData.AtsCtrlBlckAddr->AtpState = SC_Status_EXECUTING;
+
+    SC_OperData.AtsCtrlBlckAddr->CurrAtsNum = SC_AtsIndexToNum(AtsIndex);
+    SC_OperData.AtsCtrlBlckAddr->CmdNumber  = SC_COMMAND_NUM_C(1);
+
+    StatusEntryPtr->Status = SC_Status_LOADED;
+    CmdOffsetRec->Offset   = SC_ENTRY_OFFSET_FIRST;
+
+    SC_AppData.EnableHeaderUpdate = true;
+
+    UT_SetHookFunction(UT_KEY(CFE_TIME_Compare), Ut_CFE_TIME_CompareHookAlessthanB, NULL);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetHandlerFunction(UT_KEY(SC_ProcessCommand), UT_SC_ProcessCommandHandler, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_ProcessAtpCmd());
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.AtsCmdCtr, 1);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.AtsCmdErrCtr, 0);
+    SC_Assert_CmdStatus(StatusEntryPtr->Status, SC_Status_EXECUTED);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(SC_GetNextAtsCommand, 1);
+    UtAssert_STUB_COUNT(SC_ProcessCommand, 1);
+    UtAssert_ADDRESS_EQ(UT_SC_LocalCmdPtr, SC_AppData.LocalCmdBuf);
+    UtAssert_STUB_COUNT(SC_RecordDispatchLatency, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+static SC_Status_Enum_t UT_SC_LocalCmdStatus;
+
+static void UT_SC_ProcessCommandRejectHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_SC_LocalCmdStatus = SC_GetAtsStatusEntryForCommand(SC_ATS_IDX_C(0), SC_COMMAND_IDX_C(0))->Status;
+
+    SC_OperData.HkPacket.Payload.CmdErrCtr++;
+}
+
+static void UT_SC_ProcessCommandReloadHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    SC_GetAtsStatusEntryForCommand(SC_ATS_IDX_C(0), SC_COMMAND_IDX_C(0))->Status = SC_Status_LOADED;
+}
+
+void SC_ProcessAtpCmd_Test_LocalCmdRejected(void)
+{
+    SC_AtsEntryHeader_t *         Entry;
+    CFE_SB_MsgId_t                TestMsgId = CFE_SB_ValueToMsgId(SC_CMD_MID);
+    CFE_MSG_FcnCode_t             FcnCode   = SC_START_RTS_CC;
+    SC_AtsIndex_t                 AtsIndex  = SC_ATS_IDX_C(0);
+    SC_AtsCmdStatusEntry_t *      StatusEntryPtr;
+    SC_AtsCmdEntryOffsetRecord_t *CmdOffsetRec;
+
+    CmdOffsetRec   = SC_GetAtsEntryOffsetForCmd(AtsIndex, SC_COMMAND_IDX_C(0));
+    StatusEntryPtr = SC_GetAtsStatusEntryForCommand(AtsIndex, SC_COMMAND_IDX_C(0));
+
+    Entry            = (SC_AtsEntryHeader_t *)SC_GetAtsEntryAtOffset(AtsIndex, SC_ENTRY_OFFSET_FIRST);
+    Entry->CmdNumber = SC_COMMAND_NUM_C(1);
+
+    SC_OperData.AtsCtrlBlckAddr->AtpState   = SC_Status_EXECUTING;
+    SC_OperData.AtsCtrlBlckAddr->CurrAtsNum = SC_AtsIndexToNum(AtsIndex);
+    SC_OperData.AtsCtrlBlckAddr->CmdNumber  = SC_COMMAND_NUM_C(1);
+
+    StatusEntryPtr->Status = SC_Status_LOADED;
+    CmdOffsetRec->Offset   = SC_ENTRY_OFFSET_FIRST;
+
+    SC_AppData.EnableHeaderUpdate = true;
+
+    UT_SetHookFunction(UT_KEY(CFE_TIME_Compare), Ut_CFE_TIME_CompareHookAlessthanB, NULL);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetHandlerFunction(UT_KEY(SC_ProcessCommand), UT_SC_ProcessCommandRejectHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(SC_RecordTrace), UT_SC_RecordTraceHandler, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_ProcessAtpCmd());
+
+    /* Verify results: the command is executing while its handler runs, and failed once it rejects it */
+    SC_Assert_CmdStatus(UT_SC_LocalCmdStatus, SC_Status_EXECUTING);
+    SC_Assert_CmdStatus(StatusEntryPtr->Status, SC_Status_FAILED_DISTRIB);
+    UtAssert_ZERO(SC_OperData.HkPacket.Payload.AtsCmdCtr);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.AtsCmdErrCtr, 1);
+    SC_Assert_ID_EQ(SC_OperData.HkPacket.Payload.LastAtsErrSeq, SC_AtsIndexToNum(AtsIndex));
+    SC_Assert_ID_VALUE(SC_OperData.HkPacket.Payload.LastAtsErrCmd, 1);
+    UtAssert_STUB_COUNT(SC_RecordDispatchLatency, 0);
+    UtAssert_STUB_COUNT(SC_RecordTrace, 1);
+    SC_Assert_CmdStatus(UT_SC_TraceStatus, SC_Status_FAILED_DISTRIB);
+}
+
+void SC_ProcessAtpCmd_Test_LocalCmdReloadsAts(void)
+{
+    SC_AtsEntryHeader_t *         Entry;
+    CFE_SB_MsgId_t                TestMsgId = CFE_SB_ValueToMsgId(SC_CMD_MID);
+    CFE_MSG_FcnCode_t             FcnCode   = SC_MANAGE_TABLE_CC;
+    SC_AtsIndex_t                 AtsIndex  = SC_ATS_IDX_C(0);
+    SC_AtsCmdStatusEntry_t *      StatusEntryPtr;
+    SC_AtsCmdEntryOffsetRecord_t *CmdOffsetRec;
+
+    CmdOffsetRec   = SC_GetAtsEntryOffsetForCmd(AtsIndex, SC_COMMAND_IDX_C(0));
+    StatusEntryPtr = SC_GetAtsStatusEntryForCommand(AtsIndex, SC_COMMAND_IDX_C(0));
+
+    Entry            = (SC_AtsEntryHeader_t *)SC_GetAtsEntryAtOffset(AtsIndex, SC_ENTRY_OFFSET_FIRST);
+    Entry->CmdNumber = SC_COMMAND_NUM_C(1);
+
+    SC_OperData.AtsCtrlBlckAddr->AtpState   = SC_Status_EXECUTING;
+    SC_OperData.AtsCtrlBlckAddr->CurrAtsNum = SC_AtsIndexToNum(AtsIndex);
+    SC_OperData.AtsCtrlBlckAddr->CmdNumber  = SC_COMMAND_NUM_C(1);
+
+    StatusEntryPtr->Status = SC_Status_LOADED;
+    CmdOffsetRec->Offset   = SC_ENTRY_OFFSET_FIRST;
+
+    SC_AppData.EnableHeaderUpdate = true;
+
+    UT_SetHookFunction(UT_KEY(CFE_TIME_Compare), Ut_CFE_TIME_CompareHookAlessthanB, NULL);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetHandlerFunction(UT_KEY(SC_ProcessCommand), UT_SC_ProcessCommandReloadHandler, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_ProcessAtpCmd());
+
+    /* Verify results: the command is counted, but the status of the new load is kept */
+    SC_Assert_CmdStatus(StatusEntryPtr->Status, SC_Status_LOADED);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.AtsCmdCtr, 1);
+    UtAssert_ZERO(SC_OperData.HkPacket.Payload.AtsCmdErrCtr);
+}
+
 void SC_ProcessAtpCmd_Test_InlineSwitchError(void)
 {
     SC_AtsEntryHeader_t *         Entry;
@@ -198,7 +364,7 @@ void SC_ProcessAtpCmd_Test_InlineSwitchError(void)
 void SC_ProcessAtpCmd_Test_SBErrorAtsA(void)
 {
     SC_AtsEntryHeader_t *         Entry;
-    CFE_SB_MsgId_t                TestMsgId = CFE_SB_ValueToMsgId(SC_CMD_MID);
+    CFE_SB_MsgId_t                TestMsgId = SC_UT_MID_1;
     CFE_MSG_FcnCode_t             FcnCode   = SC_NOOP_CC;
     SC_AtsIndex_t                 AtsIndex  = SC_ATS_IDX_C(0);
     SC_AtsCmdStatusEntry_t *      StatusEntryPtr;
@@ -249,7 +415,7 @@ void SC_ProcessAtpCmd_Test_SBErrorAtsA(void)
 void SC_ProcessAtpCmd_Test_SBErrorAtsB(void)
 {
     SC_AtsEntryHeader_t *         Entry;
-    CFE_SB_MsgId_t                TestMsgId = CFE_SB_ValueToMsgId(SC_CMD_MID);
+    CFE_SB_MsgId_t                TestMsgId = SC_UT_MID_1;
     CFE_MSG_FcnCode_t             FcnCode   = SC_NOOP_CC;
     SC_AtsIndex_t                 AtsIndex  = SC_ATS_IDX_C(1);
     SC_AtsCmdStatusEntry_t *      StatusEntryPtr;
@@ -484,6 +650,8 @@ void SC_ProcessAtpCmd_Test_CmdNumberMismatchAtsA(void)
     StatusEntryPtr->Status = SC_Status_LOADED;
     CmdOffsetRec->Offset   = SC_ENTRY_OFFSET_FIRST;
 
+    UT_SetHandlerFunction(UT_KEY(SC_RecordTrace), UT_SC_RecordTraceHandler, NULL);
+
     /* Execute the function being tested */
     UtAssert_VOIDCALL(SC_ProcessAtpCmd());
 
@@ -493,6 +661,11 @@ void SC_ProcessAtpCmd_Test_CmdNumberMismatchAtsA(void)
     SC_Assert_ID_VALUE(SC_OperData.HkPacket.Payload.LastAtsErrSeq, SC_AtsId_ATSA);
     SC_Assert_ID_VALUE(SC_OperData.HkPacket.Payload.LastAtsErrCmd, 1);
     SC_Assert_CmdStatus(StatusEntryPtr->Status, SC_Status_SKIPPED);
+
+    /* the skipped command is traced under the number it was expected to have */
+    UtAssert_STUB_COUNT(SC_RecordTrace, 1);
+    SC_Assert_CmdStatus(UT_SC_TraceStatus, SC_Status_SKIPPED);
+    UtAssert_UINT32_EQ(UT_SC_TraceCmdId, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_ATS_MSMTCH_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, SC_ATS_ABT_ERR_EID);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
@@ -694,10 +867,290 @@ void SC_ProcessRtpCommand_Test_Nominal(void)
     UtAssert_True(SC_OperData.NumCmdsWakeup == 1, "SC_OperData.NumCmdsWakeup == 1");
     UtAssert_UINT32_EQ(RtsInfoPtr->CmdCtr, 1);
     UtAssert_UINT32_EQ(RtsInfoPtr->CmdErrCtr, 0);
+    UtAssert_STUB_COUNT(SC_RecordDispatchLatency, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_ProcessRtpCommand_Test_Late(void)
+{
+    SC_RtsIndex_t       RtsIndex = SC_RTS_IDX_C(1);
+    SC_RtsInfoEntry_t  *RtsInfoPtr;
+    SC_RtsStatsEntry_t *RtsStatsPtr;
+
+    RtsInfoPtr  = SC_GetRtsInfoObject(RtsIndex);
+    RtsStatsPtr = SC_GetRtsStatsObject(RtsIndex);
+
+    SC_AppData.NextCmdTime[SC_Process_RTP]  = 4;
+    SC_AppData.CurrentWakeupCount           = 7;
+    SC_OperData.RtsCtrlBlckAddr->CurrRtsNum = SC_RtsIndexToNum(RtsIndex);
+    RtsInfoPtr->RtsStatus                   = SC_Status_EXECUTING;
+    RtsInfoPtr->NextCommandTgtWakeup        = 4;
+    RtsInfoPtr->Priority                    = 2;
+    RtsInfoPtr->MaxLateWakeups              = 1;
+    RtsStatsPtr->LateCmdCtr                 = 2;
+    RtsStatsPtr->MaxLateWakeups             = 5;
+
+    SC_AppData.EnableHeaderUpdate = true;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_ProcessRtpCommand());
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(RtsInfoPtr->LateCmdCtr, 1);
+    UtAssert_UINT32_EQ(RtsInfoPtr->MaxLateWakeups, 3);
+    SC_Assert_IDX_EQ(SC_AppData.RtsLastServed[2], RtsIndex);
+    UtAssert_UINT32_EQ(RtsInfoPtr->CmdCtr, 1);
+    UtAssert_UINT32_EQ(RtsStatsPtr->LateCmdCtr, 3);
+    UtAssert_UINT32_EQ(RtsStatsPtr->MaxLateWakeups, 5);
+    UtAssert_UINT32_EQ(RtsStatsPtr->CmdCtr, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+static CFE_TIME_SysTime_t UT_SC_ScheduledTime;
+
+static void UT_SC_RecordDispatchLatencyHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_SC_ScheduledTime = UT_Hook_GetArgValueByName(Context, "ScheduledTime", CFE_TIME_SysTime_t);
+}
+
+void SC_ProcessRtpCommand_Test_TimedLatency(void)
+{
+    SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    SC_AppData.NextCmdTime[SC_Process_RTP]  = 0;
+    SC_AppData.CurrentSysTime               = (CFE_TIME_SysTime_t) {200, 0};
+    SC_OperData.RtsCtrlBlckAddr->CurrRtsNum = SC_RtsIndexToNum(RtsIndex);
+    RtsInfoPtr->RtsStatus                   = SC_Status_EXECUTING;
+    RtsInfoPtr->TimedFlag                   = true;
+    RtsInfoPtr->NextCommandTime             = (CFE_TIME_SysTime_t) {199, 0x40000000};
+
+    SC_AppData.EnableHeaderUpdate = true;
+
+    UT_SetHandlerFunction(UT_KEY(SC_RecordDispatchLatency), UT_SC_RecordDispatchLatencyHandler, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_ProcessRtpCommand());
+
+    /* Verify results: a timed command is measured from its own time, not the wakeup */
+    UtAssert_STUB_COUNT(SC_RecordDispatchLatency, 1);
+    UtAssert_UINT32_EQ(UT_SC_ScheduledTime.Seconds, 199);
+    UtAssert_UINT32_EQ(UT_SC_ScheduledTime.Subseconds, 0x40000000);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_ProcessRtpCommand_Test_FirstEligibleWakeup(void)
+{
+    SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    /* the wakeup the command was due on, the first that could send it */
+    SC_AppData.NextCmdTime[SC_Process_RTP]  = 7;
+    SC_AppData.CurrentWakeupCount           = 7;
+    SC_AppData.CurrentSysTime               = (CFE_TIME_SysTime_t) {20, 0x80000000};
+    SC_OperData.RtsCtrlBlckAddr->CurrRtsNum = SC_RtsIndexToNum(RtsIndex);
+    RtsInfoPtr->RtsStatus                   = SC_Status_EXECUTING;
+    RtsInfoPtr->NextCommandTgtWakeup        = 7;
+
+    SC_AppData.EnableHeaderUpdate = true;
+
+    UT_SetHandlerFunction(UT_KEY(SC_RecordDispatchLatency), UT_SC_RecordDispatchLatencyHandler, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_ProcessRtpCommand());
+
+    /* Verify results: no lateness, and due at the wakeup it went out on */
+    UtAssert_UINT32_EQ(RtsInfoPtr->LateCmdCtr, 0);
+    UtAssert_UINT32_EQ(RtsInfoPtr->MaxLateWakeups, 0);
+    UtAssert_STUB_COUNT(SC_RecordDispatchLatency, 1);
+    UtAssert_UINT32_EQ(UT_SC_ScheduledTime.Seconds, 20);
+    UtAssert_UINT32_EQ(UT_SC_ScheduledTime.Subseconds, 0x80000000);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_ProcessRtpCommand_Test_TimedLate(void)
+{
+    SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    /* reached many wakeups ago, but only due a little over two wakeups ago */
+    SC_AppData.NextCmdTime[SC_Process_RTP]  = 0;
+    SC_AppData.CurrentWakeupCount           = 100;
+    SC_OperData.RtsCtrlBlckAddr->CurrRtsNum = SC_RtsIndexToNum(RtsIndex);
+    RtsInfoPtr->RtsStatus                   = SC_Status_EXECUTING;
+    RtsInfoPtr->TimedFlag                   = true;
+    RtsInfoPtr->NextCommandTgtWakeup        = 10;
+
+    SC_AppData.EnableHeaderUpdate = true;
+
+    UT_SetDefaultReturnValue(UT_KEY(SC_ElapsedUsec), (2 * SC_WAKEUP_PERIOD_USEC) + 1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_ProcessRtpCommand());
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(RtsInfoPtr->LateCmdCtr, 1);
+    UtAssert_UINT32_EQ(RtsInfoPtr->MaxLateWakeups, 2);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
+static void UT_SC_TimeSubtractHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_TIME_SysTime_t Time1 = UT_Hook_GetArgValueByName(Context, "Time1", CFE_TIME_SysTime_t);
+    CFE_TIME_SysTime_t Time2 = UT_Hook_GetArgValueByName(Context, "Time2", CFE_TIME_SysTime_t);
+
+    Time1.Seconds -= Time2.Seconds;
+    UT_Stub_SetReturnValue(FuncKey, Time1);
+}
+
+static void UT_SC_WakeupsToTimeHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_TIME_SysTime_t Span = {UT_Hook_GetArgValueByName(Context, "Wakeups", uint32), 0};
+
+    UT_Stub_SetReturnValue(FuncKey, Span);
+}
+
+void SC_ProcessRtpCommand_Test_LateLatency(void)
+{
+    SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    /* due at wakeup 4, sent at wakeup 7 */
+    SC_AppData.NextCmdTime[SC_Process_RTP]  = 4;
+    SC_AppData.CurrentWakeupCount           = 7;
+    SC_AppData.CurrentSysTime               = (CFE_TIME_SysTime_t) {200, 0};
+    SC_OperData.RtsCtrlBlckAddr->CurrRtsNum = SC_RtsIndexToNum(RtsIndex);
+    RtsInfoPtr->RtsStatus                   = SC_Status_EXECUTING;
+    RtsInfoPtr->NextCommandTgtWakeup        = 4;
+
+    SC_AppData.EnableHeaderUpdate = true;
+
+    UT_SetHandlerFunction(UT_KEY(SC_RecordDispatchLatency), UT_SC_RecordDispatchLatencyHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(SC_WakeupsToTime), UT_SC_WakeupsToTimeHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_Subtract), UT_SC_TimeSubtractHandler, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_ProcessRtpCommand());
+
+    /* Verify results: the command is measured from the start of wakeup 4, not wakeup 7 */
+    UtAssert_STUB_COUNT(SC_WakeupsToTime, 1);
+    UtAssert_STUB_COUNT(SC_RecordDispatchLatency, 1);
+    UtAssert_UINT32_EQ(UT_SC_ScheduledTime.Seconds, 197);
+    UtAssert_UINT32_EQ(RtsInfoPtr->MaxLateWakeups, 3);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_ProcessRtpCommand_Test_CallRts(void)
+{
+    SC_RtsIndex_t      RtsIndex  = SC_RTS_IDX_C(0);
+    CFE_SB_MsgId_t     TestMsgId = CFE_SB_ValueToMsgId(SC_CMD_MID);
+    CFE_MSG_FcnCode_t  FcnCode   = SC_CALL_RTS_CC;
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    SC_AppData.NextCmdTime[SC_Process_RTP]  = 0;
+    SC_AppData.CurrentTime                  = 1;
+    SC_OperData.RtsCtrlBlckAddr->CurrRtsNum = SC_RtsIndexToNum(RtsIndex);
+    RtsInfoPtr->RtsStatus                   = SC_Status_EXECUTING;
+
+    SC_AppData.EnableHeaderUpdate = true;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDefaultReturnValue(UT_KEY(SC_ProcessRtsCall), true);
+    UT_SetHandlerFunction(UT_KEY(SC_RecordTrace), UT_SC_RecordTraceHandler, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_ProcessRtpCommand());
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(SC_ProcessRtsCall, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(SC_GetNextRtsCommand, 0);
+    UtAssert_True(SC_OperData.NumCmdsWakeup == 1, "SC_OperData.NumCmdsWakeup == 1");
+    UtAssert_STUB_COUNT(SC_RecordTrace, 1);
+    SC_Assert_CmdStatus(UT_SC_TraceStatus, SC_Status_EXECUTED);
+}
+
+void SC_ProcessRtpCommand_Test_CallRtsFailed(void)
+{
+    SC_RtsIndex_t      RtsIndex  = SC_RTS_IDX_C(0);
+    CFE_SB_MsgId_t     TestMsgId = CFE_SB_ValueToMsgId(SC_CMD_MID);
+    CFE_MSG_FcnCode_t  FcnCode   = SC_CHAIN_RTS_CC;
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    SC_AppData.NextCmdTime[SC_Process_RTP]  = 0;
+    SC_AppData.CurrentTime                  = 1;
+    SC_OperData.RtsCtrlBlckAddr->CurrRtsNum = SC_RtsIndexToNum(RtsIndex);
+    RtsInfoPtr->RtsStatus                   = SC_Status_EXECUTING;
+
+    SC_AppData.EnableHeaderUpdate = true;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDefaultReturnValue(UT_KEY(SC_ProcessRtsCall), false);
+    UT_SetHandlerFunction(UT_KEY(SC_RecordTrace), UT_SC_RecordTraceHandler, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_ProcessRtpCommand());
+
+    /* Verify results: the failed chain is traced as not sent */
+    UtAssert_STUB_COUNT(SC_ProcessRtsCall, 1);
+    UtAssert_STUB_COUNT(SC_RecordTrace, 1);
+    SC_Assert_CmdStatus(UT_SC_TraceStatus, SC_Status_FAILED_DISTRIB);
+}
+
+void SC_ProcessRtpCommand_Test_LocalCmd(void)
+{
+    SC_RtsIndex_t      RtsIndex  = SC_RTS_IDX_C(0);
+    CFE_SB_MsgId_t     TestMsgId = CFE_SB_ValueToMsgId(SC_CMD_MID);
+    CFE_MSG_FcnCode_t  FcnCode   = SC_STOP_RTS_CC;
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    SC_AppData.NextCmdTime[SC_Process_RTP]  = 0;
+    SC_AppData.CurrentTime                  = 1;
+    SC_OperData.RtsCtrlBlckAddr->CurrRtsNum = SC_RtsIndexToNum(RtsIndex);
+    RtsInfoPtr->RtsStatus                   = SC_Status_EXECUTING;
+
+    SC_AppData.EnableHeaderUpdate = true;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+
+    UT_SetHandlerFunction(UT_KEY(SC_ProcessCommand), UT_SC_ProcessCommandHandler, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_ProcessRtpCommand());
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.RtsCmdCtr, 1);
+    UtAssert_UINT32_EQ(RtsInfoPtr->CmdCtr, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(SC_GetNextRtsCommand, 1);
+    UtAssert_STUB_COUNT(SC_ProcessCommand, 1);
+    UtAssert_ADDRESS_EQ(UT_SC_LocalCmdPtr, SC_AppData.LocalCmdBuf);
+    UtAssert_STUB_COUNT(SC_ProcessRtsCall, 0);
+}
+
 void SC_ProcessRtpCommand_Test_BadSoftwareBusReturn(void)
 {
     SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
@@ -750,6 +1203,8 @@ void SC_ProcessRtpCommand_Test_BadChecksum(void)
     ChecksumValid = false;
     UT_SetDataBuffer(UT_KEY(CFE_MSG_ValidateChecksum), &ChecksumValid, sizeof(ChecksumValid), false);
 
+    UT_SetHandlerFunction(UT_KEY(SC_RecordTrace), UT_SC_RecordTraceHandler, NULL);
+
     /* Execute the function being tested */
     UtAssert_VOIDCALL(SC_ProcessRtpCommand());
 
@@ -761,9 +1216,216 @@ void SC_ProcessRtpCommand_Test_BadChecksum(void)
     UtAssert_UINT32_EQ(RtsInfoPtr->CmdErrCtr, 1);
     SC_Assert_ID_VALUE(SC_OperData.HkPacket.Payload.LastRtsErrSeq, 1);
     SC_Assert_IDX_VALUE(SC_OperData.HkPacket.Payload.LastRtsErrCmd, 0);
+    UtAssert_STUB_COUNT(SC_RecordTrace, 1);
+    SC_Assert_CmdStatus(UT_SC_TraceStatus, SC_Status_FAILED_CHECKSUM);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTS_CHKSUM_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_ProcessRtpCommand_Test_BadChecksumDeferred(void)
+{
+    SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+    bool               ChecksumValid = false;
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    SC_OperData.RtsCtrlBlckAddr->CurrRtsNum = SC_RtsIndexToNum(RtsIndex);
+    RtsInfoPtr->RtsStatus                   = SC_Status_EXECUTING;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_ValidateChecksum), &ChecksumValid, sizeof(ChecksumValid), false);
+
+    /* The error is queued for a summary */
+    UT_SetDefaultReturnValue(UT_KEY(SC_DeferEvent), true);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_ProcessRtpCommand());
+
+    /* Verify results: counted and the RTS stopped as before */
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.RtsCmdErrCtr, 1);
+    UtAssert_STUB_COUNT(SC_KillRts, 1);
+    UtAssert_STUB_COUNT(SC_DeferEvent, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_ProcessRtpCommand_Test_Patched(void)
+{
+    SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+    SC_RtsPatchCmd_t * PatchCmd;
+    size_t             MsgSize = SC_PACKET_MAX_SIZE;
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    SC_AppData.NextCmdTime[SC_Process_RTP]  = 0;
+    SC_AppData.CurrentTime                  = 1;
+    SC_OperData.RtsCtrlBlckAddr->CurrRtsNum = SC_RtsIndexToNum(RtsIndex);
+    RtsInfoPtr->RtsStatus                   = SC_Status_EXECUTING;
+    RtsInfoPtr->PatchCount                  = 1;
+    RtsInfoPtr->PatchEntry[0]               = SC_ENTRY_OFFSET_C(100);
+    RtsInfoPtr->Args[2]                     = 0x5A;
+
+    PatchCmd                    = (SC_RtsPatchCmd_t *)&SC_GetRtsEntryAtOffset(RtsIndex, SC_ENTRY_OFFSET_C(100))->Msg;
+    PatchCmd->Payload.ArgOffset = 2;
+    PatchCmd->Payload.MsgOffset = sizeof(CFE_MSG_CommandHeader_t);
+    PatchCmd->Payload.Length    = 1;
+
+    SC_AppData.EnableHeaderUpdate = true;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_ProcessRtpCommand());
+
+    /* Verify results, the patch goes into the copy that is sent, not the RTS */
+    UtAssert_UINT32_EQ(((uint8 *)SC_AppData.RtsPatchBuf)[sizeof(CFE_MSG_CommandHeader_t)], 0x5A);
+    UtAssert_ZERO(((uint8 *)SC_GetRtsEntryAtOffset(RtsIndex, SC_ENTRY_OFFSET_FIRST))[SC_RTS_HEADER_SIZE +
+                                                                                   sizeof(CFE_MSG_CommandHeader_t)]);
+    UtAssert_STUB_COUNT(CFE_MSG_GenerateChecksum, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.RtsCmdCtr, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_ProcessRtpCommand_Test_PatchError(void)
+{
+    SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    SC_AppData.NextCmdTime[SC_Process_RTP]  = 0;
+    SC_AppData.CurrentTime                  = 1;
+    SC_OperData.RtsCtrlBlckAddr->CurrRtsNum = SC_RtsIndexToNum(RtsIndex);
+    RtsInfoPtr->RtsStatus                   = SC_Status_EXECUTING;
+    RtsInfoPtr->PatchCount                  = 1;
+    RtsInfoPtr->PatchEntry[0]               = SC_ENTRY_OFFSET_C(100);
+
+    SC_AppData.EnableHeaderUpdate = true;
+
+    /* Execute the function being tested, the patch entry has no length */
+    UtAssert_VOIDCALL(SC_ProcessRtpCommand());
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(SC_KillRts, 1);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.RtsCmdErrCtr, 1);
+    UtAssert_UINT32_EQ(RtsInfoPtr->CmdErrCtr, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTS_PATCH_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_PatchRtsCommand_Test_Nominal(void)
+{
+    SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+    SC_RtsPatchCmd_t * PatchCmd;
+    uint32             Msg[4];
+    uint32             PatchedMsg[4];
+    size_t             MsgSize = sizeof(Msg);
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    memset(Msg, 0xFF, sizeof(Msg));
+    memset(PatchedMsg, 0, sizeof(PatchedMsg));
+
+    RtsInfoPtr->PatchCount    = 2;
+    RtsInfoPtr->PatchEntry[0] = SC_ENTRY_OFFSET_C(0);
+    RtsInfoPtr->PatchEntry[1] = SC_ENTRY_OFFSET_C(10);
+    RtsInfoPtr->Args[0]       = 1;
+    RtsInfoPtr->Args[1]       = 2;
+
+    PatchCmd                    = (SC_RtsPatchCmd_t *)&SC_GetRtsEntryAtOffset(RtsIndex, SC_ENTRY_OFFSET_C(0))->Msg;
+    PatchCmd->Payload.ArgOffset = 0;
+    PatchCmd->Payload.MsgOffset = sizeof(CFE_MSG_CommandHeader_t);
+    PatchCmd->Payload.Length    = 2;
+
+    /* the last bytes of the command may be patched */
+    PatchCmd                    = (SC_RtsPatchCmd_t *)&SC_GetRtsEntryAtOffset(RtsIndex, SC_ENTRY_OFFSET_C(10))->Msg;
+    PatchCmd->Payload.ArgOffset = SC_RTS_ARG_BLOCK_SIZE - 1;
+    PatchCmd->Payload.MsgOffset = sizeof(Msg) - 1;
+    PatchCmd->Payload.Length    = 1;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(SC_PatchRtsCommand(RtsIndex, (CFE_MSG_Message_t *)Msg, (CFE_MSG_Message_t *)PatchedMsg));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(((uint8 *)PatchedMsg)[sizeof(CFE_MSG_CommandHeader_t)], 1);
+    UtAssert_UINT32_EQ(((uint8 *)PatchedMsg)[sizeof(CFE_MSG_CommandHeader_t) + 1], 2);
+    UtAssert_UINT32_EQ(((uint8 *)PatchedMsg)[sizeof(Msg) - 1], 0);
+    UtAssert_UINT32_EQ(((uint8 *)PatchedMsg)[0], 0xFF);
+    UtAssert_UINT32_EQ(((uint8 *)Msg)[sizeof(CFE_MSG_CommandHeader_t)], 0xFF);
+    UtAssert_STUB_COUNT(CFE_MSG_GenerateChecksum, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_PatchRtsCommand_Test_ArgRange(void)
+{
+    SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+    SC_RtsPatchCmd_t * PatchCmd;
+    uint32             Msg[4];
+    uint32             PatchedMsg[4];
+    size_t             MsgSize = sizeof(Msg);
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    RtsInfoPtr->PatchCount    = 1;
+    RtsInfoPtr->PatchEntry[0] = SC_ENTRY_OFFSET_C(0);
+
+    PatchCmd                    = (SC_RtsPatchCmd_t *)&SC_GetRtsEntryAtOffset(RtsIndex, SC_ENTRY_OFFSET_C(0))->Msg;
+    PatchCmd->Payload.ArgOffset = SC_RTS_ARG_BLOCK_SIZE - 1;
+    PatchCmd->Payload.MsgOffset = sizeof(CFE_MSG_CommandHeader_t);
+    PatchCmd->Payload.Length    = 2;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(SC_PatchRtsCommand(RtsIndex, (CFE_MSG_Message_t *)Msg, (CFE_MSG_Message_t *)PatchedMsg));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_MSG_GenerateChecksum, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTS_PATCH_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_PatchRtsCommand_Test_MsgRange(void)
+{
+    SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+    SC_RtsPatchCmd_t * PatchCmd;
+    uint32             Msg[4];
+    uint32             PatchedMsg[4];
+    size_t             MsgSize[2] = {sizeof(Msg), sizeof(Msg)};
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    RtsInfoPtr->PatchCount    = 1;
+    RtsInfoPtr->PatchEntry[0] = SC_ENTRY_OFFSET_C(0);
+
+    PatchCmd = (SC_RtsPatchCmd_t *)&SC_GetRtsEntryAtOffset(RtsIndex, SC_ENTRY_OFFSET_C(0))->Msg;
+    PatchCmd->Payload.Length = 1;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), MsgSize, sizeof(MsgSize), false);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTS_CHKSUM_ERR_EID);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    /* Execute the function being tested, a patch may not touch the command header */
+    PatchCmd->Payload.MsgOffset = sizeof(CFE_MSG_CommandHeader_t) - 1;
+    UtAssert_BOOL_FALSE(SC_PatchRtsCommand(RtsIndex, (CFE_MSG_Message_t *)Msg, (CFE_MSG_Message_t *)PatchedMsg));
+
+    /* nor run past the end of the command */
+    PatchCmd->Payload.MsgOffset = sizeof(Msg);
+    UtAssert_BOOL_FALSE(SC_PatchRtsCommand(RtsIndex, (CFE_MSG_Message_t *)Msg, (CFE_MSG_Message_t *)PatchedMsg));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_MSG_GenerateChecksum, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, SC_RTS_PATCH_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
 }
 
 void SC_ProcessRtpCommand_Test_NextCmdTime(void)
@@ -830,13 +1492,31 @@ void SC_ProcessRtpCommand_Test_RtsStatus(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
+void SC_CopyLocalCmd_Test(void)
+{
+    uint8                  Cmd[SC_PACKET_MIN_SIZE];
+    CFE_MSG_Size_t         MsgSize = sizeof(Cmd);
+    const CFE_SB_Buffer_t *CopyPtr;
+
+    memset(Cmd, 0xA5, sizeof(Cmd));
+    memset(SC_AppData.LocalCmdBuf, 0, sizeof(SC_AppData.LocalCmdBuf));
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    /* Execute the function being tested */
+    CopyPtr = SC_CopyLocalCmd((const CFE_MSG_Message_t *)Cmd);
+
+    /* Verify results: the whole command is copied, and nothing past it */
+    UtAssert_ADDRESS_EQ(CopyPtr, SC_AppData.LocalCmdBuf);
+    UtAssert_MemCmp(SC_AppData.LocalCmdBuf, Cmd, sizeof(Cmd), "Command copied");
+    UtAssert_ZERO(((uint8 *)SC_AppData.LocalCmdBuf)[sizeof(Cmd)]);
+}
+
 void SC_SendHkPacket_Test(void)
 {
     uint8              i;
     int32              LastRtsHkIndex = 0;
     SC_RtsIndex_t      RtsIndex       = SC_RTS_IDX_C(SC_NUMBER_OF_RTS - 1);
-    SC_RtsInfoEntry_t *RtsInfoPtr;
-    SC_AtsInfoTable_t *AtsInfoPtr;
 
     SC_OperData.HkPacket.Payload.CmdErrCtr                = 1;
     SC_OperData.HkPacket.Payload.CmdCtr                   = 2;
@@ -860,29 +1540,26 @@ void SC_SendHkPacket_Test(void)
     SC_OperData.AtsCtrlBlckAddr->SwitchPendFlag           = 0;
     SC_AppData.NextCmdTime[SC_Process_ATP]                = 0;
     SC_AppData.NextCmdTime[SC_Process_RTP]                = 0;
-    SC_OperData.RtsCtrlBlckAddr->NumRtsActive             = 20;
+    SC_OperData.HkPacket.Payload.NumRtsActive             = 20;
     SC_OperData.RtsCtrlBlckAddr->CurrRtsNum               = SC_RTS_NUM_C(21);
     SC_OperData.HkPacket.Payload.ContinueAtsOnFailureFlag = SC_AtsCont_TRUE;
 
-    for (i = 0; i < SC_NUMBER_OF_ATS - 1; i++)
+    /* the free bytes and status masks follow each transition */
+    for (i = 0; i < SC_NUMBER_OF_ATS; i++)
     {
-        AtsInfoPtr = SC_GetAtsInfoObject(SC_ATS_IDX_C(i));
-
-        AtsInfoPtr->AtsSize = 0;
+        SC_SetAtsSize(SC_ATS_IDX_C(i), 0);
     }
 
     for (i = 0; i < SC_NUMBER_OF_RTS - 1; i++)
     {
-        RtsInfoPtr = SC_GetRtsInfoObject(SC_RTS_IDX_C(i));
-
-        RtsInfoPtr->DisabledFlag = true;
-        RtsInfoPtr->RtsStatus    = SC_Status_EXECUTING;
+        SC_SetRtsDisabled(SC_RTS_IDX_C(i), true);
+        SC_SetRtsStatus(SC_RTS_IDX_C(i), SC_Status_EXECUTING);
     }
 
-    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
-
-    RtsInfoPtr->DisabledFlag = false;
-    RtsInfoPtr->RtsStatus    = SC_Status_EMPTY;
+    SC_SetRtsDisabled(RtsIndex, true);
+    SC_SetRtsStatus(RtsIndex, SC_Status_EXECUTING);
+    SC_SetRtsDisabled(RtsIndex, false);
+    SC_SetRtsStatus(RtsIndex, SC_Status_EMPTY);
 
     LastRtsHkIndex = sizeof(SC_OperData.HkPacket.Payload.RtsExecutingStatus) /
                          sizeof(SC_OperData.HkPacket.Payload.RtsExecutingStatus[0]) -
@@ -925,6 +1602,9 @@ void SC_SendHkPacket_Test(void)
     SC_Assert_ID_VALUE(SC_OperData.HkPacket.Payload.RtsNum, 21);
     UtAssert_True(SC_OperData.HkPacket.Payload.NextRtsWakeupCnt == 0, "SC_OperData.HkPacket.Payload.NextRtsWakeupCnt == 0");
     UtAssert_BOOL_TRUE(SC_OperData.HkPacket.Payload.ContinueAtsOnFailureFlag);
+    SC_Assert_ID_VALUE(SC_OperData.HkPacket.Payload.AtsLoadAtsNum, 0);
+    UtAssert_UINT8_EQ(SC_OperData.HkPacket.Payload.AtsLoadPhase, SC_AtsLoadPhase_IDLE);
+    UtAssert_ZERO(SC_OperData.HkPacket.Payload.AtsLoadProgress);
 
     /* Check first element */
     UtAssert_True(SC_OperData.HkPacket.Payload.RtsExecutingStatus[0] == 65535,
@@ -941,10 +1621,73 @@ void SC_SendHkPacket_Test(void)
     /* Check last element */
     UtAssert_INT32_EQ(SC_OperData.HkPacket.Payload.RtsExecutingStatus[LastRtsHkIndex], 32767);
     UtAssert_INT32_EQ(SC_OperData.HkPacket.Payload.RtsDisabledStatus[LastRtsHkIndex], 32767);
+    UtAssert_BOOL_FALSE(SC_GetRtsInfoObject(RtsIndex)->DisabledFlag);
+    UtAssert_UINT32_EQ(SC_GetRtsInfoObject(RtsIndex)->RtsStatus, SC_Status_EMPTY);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_SendHkPacket_Test_AtsLoadProgress(void)
+{
+    SC_AppData.AtsLoadJob.Phase    = SC_AtsLoadPhase_PARSE;
+    SC_AppData.AtsLoadJob.AtsIndex = SC_ATS_IDX_C(1);
+    SC_AppData.AtsLoadJob.CmdCount = 5;
+    SC_AppData.AtsLoadJob.SortStep = 3;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_SendHkPacket());
+
+    /* Verify results */
+    SC_Assert_ID_VALUE(SC_OperData.HkPacket.Payload.AtsLoadAtsNum, 2);
+    UtAssert_UINT8_EQ(SC_OperData.HkPacket.Payload.AtsLoadPhase, SC_AtsLoadPhase_PARSE);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.AtsLoadProgress, 5);
+
+    SC_AppData.AtsLoadJob.Phase = SC_AtsLoadPhase_INDEX;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_SendHkPacket());
+
+    /* Verify results */
+    UtAssert_UINT8_EQ(SC_OperData.HkPacket.Payload.AtsLoadPhase, SC_AtsLoadPhase_INDEX);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.AtsLoadProgress, 3);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_SendHkPacket_Test_RtsPool(void)
+{
+    SC_AppData.RtsPoolFreeWords   = 100;
+    SC_AppData.RtsPoolLargestFree = 60;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_SendHkPacket());
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.RtsPoolFreeBytes, 100 * SC_BYTES_IN_WORD);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.RtsPoolFragBytes, 40 * SC_BYTES_IN_WORD);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
+void SC_SendDiagPacket_Test(void)
+{
+    SC_OperData.DiagPacket.Payload.Latency[SC_Process_ATP].Count = 4;
+    SC_AppData.LatencySumUsec[SC_Process_ATP]                    = 1000;
+    SC_OperData.DiagPacket.Payload.Latency[SC_Process_RTP].Count = 0;
+    SC_OperData.DiagPacket.Payload.Phase[SC_Phase_SEND_HK].Count = 3;
+    SC_AppData.PhaseSumUsec[SC_Phase_SEND_HK]                    = 90;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_SendDiagPacket());
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(SC_OperData.DiagPacket.Payload.Latency[SC_Process_ATP].MeanUsec, 250);
+    UtAssert_ZERO(SC_OperData.DiagPacket.Payload.Latency[SC_Process_RTP].MeanUsec);
+    UtAssert_UINT32_EQ(SC_OperData.DiagPacket.Payload.Phase[SC_Phase_SEND_HK].MeanUsec, 30);
+    UtAssert_ZERO(SC_OperData.DiagPacket.Payload.Phase[SC_Phase_WAKEUP].MeanUsec);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+}
+
 void SC_ProcessRequest_Test_HkMID(void)
 {
     /* Execute the function being tested */
@@ -1006,6 +1749,10 @@ void SC_ProcessRequest_Test_WakeupNONE(void)
     /* Verify results */
     UtAssert_UINT32_EQ(SC_OperData.NumCmdsWakeup, 0);
 
+    /* the wakeup and the ATP dispatch it ran are both timed */
+    UtAssert_STUB_COUNT(SC_BeginPhase, 2);
+    UtAssert_STUB_COUNT(SC_EndPhase, 2);
+
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
@@ -1024,6 +1771,41 @@ void SC_ProcessRequest_Test_WakeupRtpNotExecutionTime(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
+static bool UT_SC_InWakeup;
+
+static void UT_SC_GetNextRtsTimeHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_SC_InWakeup = SC_AppData.InWakeup;
+}
+
+void SC_ProcessRequest_Test_WakeupFirstRtsCmdOnTime(void)
+{
+    SC_RtsIndex_t      RtsIndex   = SC_RTS_IDX_C(0);
+    SC_RtsInfoEntry_t *RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    /* an RTS started between wakeups has its first command due on the next one */
+    SC_AppData.CurrentWakeupCount           = 6;
+    SC_AppData.NextCmdTime[SC_Process_ATP]  = SC_MAX_TIME;
+    SC_AppData.NextCmdTime[SC_Process_RTP]  = 7;
+    SC_OperData.RtsCtrlBlckAddr->CurrRtsNum = SC_RtsIndexToNum(RtsIndex);
+    RtsInfoPtr->RtsStatus                   = SC_Status_EXECUTING;
+    RtsInfoPtr->NextCommandTgtWakeup        = 7;
+
+    SC_AppData.EnableHeaderUpdate = true;
+
+    UT_SetHandlerFunction(UT_KEY(SC_GetNextRtsTime), UT_SC_GetNextRtsTimeHandler, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_WakeupCmd(&UT_CmdBuf.WakeupCmd));
+
+    /* Verify results: sent on its first eligible wakeup, so not late */
+    UtAssert_UINT32_EQ(SC_AppData.CurrentWakeupCount, 7);
+    UtAssert_BOOL_TRUE(RtsInfoPtr->CmdCtr > 0);
+    UtAssert_UINT32_EQ(RtsInfoPtr->LateCmdCtr, 0);
+    UtAssert_BOOL_TRUE(UT_SC_InWakeup);
+    UtAssert_BOOL_FALSE(SC_AppData.InWakeup);
+}
+
 void SC_ProcessRequest_Test_WakeupNoSwitchPending(void)
 {
     SC_OperData.AtsCtrlBlckAddr->SwitchPendFlag = false;
@@ -1147,6 +1929,42 @@ void SC_ProcessRequest_Test_WakeupAtpExecutionTimeTooManyCmds(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
+void SC_ProcessRequest_Test_WakeupRtsOverAtp(void)
+{
+    SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    /* the RTS is due at a level over the ATP, and the ATP has a command due */
+    SC_AppData.NextCmdTime[SC_Process_RTP]  = 0;
+    SC_AppData.NextCmdTime[SC_Process_ATP]  = 0;
+    SC_AppData.CurrentTime                  = 0;
+    SC_OperData.AtsCtrlBlckAddr->AtpState   = SC_Status_EXECUTING;
+    SC_OperData.RtsCtrlBlckAddr->CurrRtsNum = SC_RtsIndexToNum(RtsIndex);
+    RtsInfoPtr->RtsStatus                   = SC_Status_EXECUTING;
+    RtsInfoPtr->Priority                    = 0;
+
+    SC_AppData.EnableHeaderUpdate = true;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_WakeupCmd(&UT_CmdBuf.WakeupCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.RtsCmdCtr, SC_MAX_CMDS_PER_WAKEUP);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.AtsCmdCtr, 0);
+}
+
+void SC_ProcessRequest_Test_WakeupAtsLoad(void)
+{
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_WakeupCmd(&UT_CmdBuf.WakeupCmd));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(SC_ProcessAtsLoad, 1);
+    UtAssert_STUB_COUNT(SC_ProcessAtsStatusSummary, 1);
+}
+
 void SC_ProcessCommand_Test_NoOp(void)
 {
     /* Execute the function being tested */
@@ -1179,6 +1997,235 @@ void SC_ProcessCommand_Test_ResetCounters(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
 }
 
+void SC_ProcessCommand_Test_ResetDiag(void)
+{
+    SC_OperData.DiagPacket.Payload.Latency[SC_Process_RTP].Count  = 3;
+    SC_OperData.DiagPacket.Payload.Latency[SC_Process_RTP].Bin[2] = 3;
+    SC_AppData.LatencySumUsec[SC_Process_RTP]                     = 9000;
+    SC_OperData.DiagPacket.Payload.Phase[SC_Phase_WAKEUP].MaxUsec = 70;
+    SC_AppData.PhaseSumUsec[SC_Phase_WAKEUP]                      = 700;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_ResetDiagCmd(&UT_CmdBuf.ResetDiagCmd));
+
+    /* Verify results */
+    UtAssert_ZERO(SC_OperData.DiagPacket.Payload.Latency[SC_Process_RTP].Count);
+    UtAssert_ZERO(SC_OperData.DiagPacket.Payload.Latency[SC_Process_RTP].Bin[2]);
+    UtAssert_ZERO(SC_AppData.LatencySumUsec[SC_Process_RTP]);
+    UtAssert_ZERO(SC_OperData.DiagPacket.Payload.Phase[SC_Phase_WAKEUP].MaxUsec);
+    UtAssert_ZERO(SC_AppData.PhaseSumUsec[SC_Phase_WAKEUP]);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdCtr, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RESET_DIAG_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_QueryLookaheadCmd_Test_Nominal(void)
+{
+    SC_AtsIndex_t              AtsIndex = SC_ATS_IDX_C(0);
+    SC_LookaheadTlm_Payload_t *Payload  = &SC_OperData.LookaheadPacket.Payload;
+    SC_RtsInfoEntry_t *        RtsInfoPtr;
+    uint16                     i;
+
+    SC_AppData.CurrentTime        = 100;
+    SC_AppData.CurrentWakeupCount = 50;
+
+    /* ATS A is on its first of 3 commands, the second is skipped */
+    SC_OperData.AtsCtrlBlckAddr->AtpState     = SC_Status_EXECUTING;
+    SC_OperData.AtsCtrlBlckAddr->CurrAtsNum   = SC_AtsIndexToNum(AtsIndex);
+    SC_OperData.AtsCtrlBlckAddr->TimeIndexPtr = SC_SEQUENCE_IDX_FIRST;
+
+    SC_GetAtsInfoObject(AtsIndex)->NumberOfCommands = 3;
+    for (i = 0; i < 3; i++)
+    {
+        SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_C(i))->CmdNum      = SC_COMMAND_NUM_C(i + 1);
+        SC_GetAtsStatusEntryForCommand(AtsIndex, SC_COMMAND_IDX_C(i))->Status = SC_Status_LOADED;
+    }
+    SC_GetAtsStatusEntryForCommand(AtsIndex, SC_COMMAND_IDX_C(1))->Status = SC_Status_SKIPPED;
+    UT_SetDeferredRetcode(UT_KEY(SC_GetAtsEntryTime), 1, 105);
+    UT_SetDeferredRetcode(UT_KEY(SC_GetAtsEntryTime), 1, 120);
+
+    /* RTS 1 is due in 10 wakeups, timed RTS 2 is already due and RTS 3 waits on a call */
+    RtsInfoPtr                       = SC_GetRtsInfoObject(SC_RTS_IDX_C(0));
+    RtsInfoPtr->RtsStatus            = SC_Status_EXECUTING;
+    RtsInfoPtr->NextCommandTgtWakeup = 60;
+    RtsInfoPtr->NextCommandPtr       = SC_ENTRY_OFFSET_C(4);
+
+    RtsInfoPtr                          = SC_GetRtsInfoObject(SC_RTS_IDX_C(1));
+    RtsInfoPtr->RtsStatus               = SC_Status_EXECUTING;
+    RtsInfoPtr->TimedFlag               = true;
+    RtsInfoPtr->NextCommandTgtWakeup    = 50;
+    RtsInfoPtr->NextCommandTime.Seconds = 98;
+
+    RtsInfoPtr                       = SC_GetRtsInfoObject(SC_RTS_IDX_C(2));
+    RtsInfoPtr->RtsStatus            = SC_Status_EXECUTING;
+    RtsInfoPtr->NextCommandTgtWakeup = SC_MAX_WAKEUP_CNT;
+
+    UT_CmdBuf.QueryLookaheadCmd.Payload.NumEntries = 3;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_QueryLookaheadCmd(&UT_CmdBuf.QueryLookaheadCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Payload->CurrentTime, 100);
+    UtAssert_UINT32_EQ(Payload->CurrentWakeup, 50);
+    UtAssert_UINT32_EQ(Payload->NumEntries, 3);
+
+    UtAssert_UINT32_EQ(Payload->Entry[0].Process, SC_Process_RTP);
+    UtAssert_UINT32_EQ(Payload->Entry[0].SourceNum, 2);
+    UtAssert_UINT32_EQ(Payload->Entry[0].DueDelta, 0);
+    UtAssert_UINT32_EQ(Payload->Entry[0].DueTime, 98);
+    UtAssert_UINT32_EQ(Payload->Entry[0].DueWakeup, 0);
+
+    UtAssert_UINT32_EQ(Payload->Entry[1].Process, SC_Process_ATP);
+    UtAssert_UINT32_EQ(Payload->Entry[1].SourceNum, 1);
+    UtAssert_UINT32_EQ(Payload->Entry[1].CmdId, 1);
+    UtAssert_UINT32_EQ(Payload->Entry[1].DueDelta, 5);
+    UtAssert_UINT32_EQ(Payload->Entry[1].DueTime, 105);
+
+    UtAssert_UINT32_EQ(Payload->Entry[2].Process, SC_Process_RTP);
+    UtAssert_UINT32_EQ(Payload->Entry[2].SourceNum, 1);
+    UtAssert_UINT32_EQ(Payload->Entry[2].CmdId, 4);
+    UtAssert_UINT32_EQ(Payload->Entry[2].DueDelta, (10 + SC_WAKEUPS_PER_SECOND - 1) / SC_WAKEUPS_PER_SECOND);
+    UtAssert_UINT32_EQ(Payload->Entry[2].DueWakeup, 60);
+
+    UtAssert_STUB_COUNT(SC_GetAtsEntryTime, 2);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdCtr, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_LOOKAHEAD_CMD_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_QueryLookaheadCmd_Test_WakeupsToSeconds(void)
+{
+    SC_LookaheadTlm_Payload_t *Payload = &SC_OperData.LookaheadPacket.Payload;
+    SC_RtsInfoEntry_t *        RtsInfoPtr;
+
+    SC_AppData.CurrentTime        = 100;
+    SC_AppData.CurrentWakeupCount = 50;
+
+    /* RTS 1 is due a wakeup into its fourth second, RTS 2 at the end of its second */
+    RtsInfoPtr                       = SC_GetRtsInfoObject(SC_RTS_IDX_C(0));
+    RtsInfoPtr->RtsStatus            = SC_Status_EXECUTING;
+    RtsInfoPtr->NextCommandTgtWakeup = 50 + (3 * SC_WAKEUPS_PER_SECOND) + 1;
+
+    RtsInfoPtr                       = SC_GetRtsInfoObject(SC_RTS_IDX_C(1));
+    RtsInfoPtr->RtsStatus            = SC_Status_EXECUTING;
+    RtsInfoPtr->NextCommandTgtWakeup = 50 + (2 * SC_WAKEUPS_PER_SECOND);
+
+    UT_CmdBuf.QueryLookaheadCmd.Payload.NumEntries = SC_LOOKAHEAD_ENTRIES;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_QueryLookaheadCmd(&UT_CmdBuf.QueryLookaheadCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Payload->NumEntries, 2);
+    UtAssert_UINT32_EQ(Payload->Entry[0].SourceNum, 2);
+    UtAssert_UINT32_EQ(Payload->Entry[0].DueDelta, 2);
+    UtAssert_UINT32_EQ(Payload->Entry[1].SourceNum, 1);
+    UtAssert_UINT32_EQ(Payload->Entry[1].DueDelta, 4);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_LOOKAHEAD_CMD_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_QueryLookaheadCmd_Test_Nothing(void)
+{
+    UT_CmdBuf.QueryLookaheadCmd.Payload.NumEntries = SC_LOOKAHEAD_ENTRIES;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_QueryLookaheadCmd(&UT_CmdBuf.QueryLookaheadCmd));
+
+    /* Verify results */
+    UtAssert_ZERO(SC_OperData.LookaheadPacket.Payload.NumEntries);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdCtr, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_LOOKAHEAD_CMD_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_QueryLookaheadCmd_Test_InvalidNumEntries(void)
+{
+    UT_CmdBuf.QueryLookaheadCmd.Payload.NumEntries = 0;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_QueryLookaheadCmd(&UT_CmdBuf.QueryLookaheadCmd));
+
+    UT_CmdBuf.QueryLookaheadCmd.Payload.NumEntries = SC_LOOKAHEAD_ENTRIES + 1;
+
+    UtAssert_VOIDCALL(SC_QueryLookaheadCmd(&UT_CmdBuf.QueryLookaheadCmd));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdErrCtr, 2);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_LOOKAHEAD_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, SC_LOOKAHEAD_CMD_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+}
+
+void SC_InsertLookaheadEntry_Test_Full(void)
+{
+    SC_LookaheadTlm_Payload_t *Payload = &SC_OperData.LookaheadPacket.Payload;
+    SC_LookaheadEntry_t        Entry;
+
+    memset(&Entry, 0, sizeof(Entry));
+
+    Payload->NumEntries        = 2;
+    Payload->Entry[0].DueDelta = 3;
+    Payload->Entry[1].DueDelta = 7;
+
+    /* ties go after the entries already held, and the last entry falls off */
+    Entry.DueDelta  = 3;
+    Entry.SourceNum = 9;
+    UtAssert_VOIDCALL(SC_InsertLookaheadEntry(&Entry, 2));
+
+    UtAssert_UINT32_EQ(Payload->NumEntries, 2);
+    UtAssert_UINT32_EQ(Payload->Entry[0].DueDelta, 3);
+    UtAssert_UINT32_EQ(Payload->Entry[1].DueDelta, 3);
+    UtAssert_UINT32_EQ(Payload->Entry[1].SourceNum, 9);
+
+    /* a command due after all of a full packet is not added */
+    Entry.DueDelta  = 5;
+    Entry.SourceNum = 10;
+    UtAssert_VOIDCALL(SC_InsertLookaheadEntry(&Entry, 2));
+
+    UtAssert_UINT32_EQ(Payload->NumEntries, 2);
+    UtAssert_UINT32_EQ(Payload->Entry[1].SourceNum, 9);
+}
+
+void SC_SetEventModeCmd_Test_Nominal(void)
+{
+    UT_CmdBuf.SetEventModeCmd.Payload.Mode = SC_EventMode_DEFERRED;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_SetEventModeCmd(&UT_CmdBuf.SetEventModeCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.EventMode, SC_EventMode_DEFERRED);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdCtr, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_EVENT_MODE_CMD_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_SetEventModeCmd_Test_InvalidMode(void)
+{
+    UT_CmdBuf.SetEventModeCmd.Payload.Mode = 2;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_SetEventModeCmd(&UT_CmdBuf.SetEventModeCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.EventMode, SC_EventMode_IMMEDIATE);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdErrCtr, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_EVENT_MODE_CMD_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
 void SC_ProcessCommand_Test_StartAts(void)
 {
     UT_CmdBuf.StartAtsCmd.Payload.AtsNum = SC_ATS_NUM_C(1);
@@ -1271,13 +2318,58 @@ void SC_ProcessCommand_Test_TableManageAtsTableNominal(void)
 
     UT_CmdBuf.ManageTableCmd.Payload.Parameter = SC_TBL_ID_ATS_0;
 
-    /* Set to reach "SC_LoadAts(ArrayIndex)" */
+    /* Set to reach "SC_BeginAtsLoad(AtsIndex)" */
     UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_INFO_UPDATED);
 
     /* Execute the function being tested */
     UtAssert_VOIDCALL(SC_ManageTableCmd(&UT_CmdBuf.ManageTableCmd));
 
-    /* This function is already verified to work correctly in another file, so no verifications here. */
+    /* Verify results */
+    UtAssert_STUB_COUNT(SC_BeginAtsLoad, 1);
+    UtAssert_STUB_COUNT(SC_LoadAts, 0);
+}
+
+void SC_ProcessCommand_Test_TableManageAtsTableInUse(void)
+{
+    SC_AtsIndex_t AtsIndex = SC_ATS_IDX_C(0);
+
+    UT_CmdBuf.ManageTableCmd.Payload.Parameter = SC_TBL_ID_ATS_0;
+
+    SC_OperData.AtsCtrlBlckAddr->AtpState   = SC_Status_EXECUTING;
+    SC_OperData.AtsCtrlBlckAddr->CurrAtsNum = SC_AtsIndexToNum(AtsIndex);
+
+    /* Set to reach "SC_LoadAts(AtsIndex)" */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_INFO_UPDATED);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_ManageTableCmd(&UT_CmdBuf.ManageTableCmd));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(SC_LoadAts, 1);
+    UtAssert_STUB_COUNT(SC_BeginAtsLoad, 0);
+}
+
+void SC_ProcessCommand_Test_TableManageAtsTableSwitchPending(void)
+{
+    SC_AtsIndex_t AtsIndex = SC_ATS_IDX_C(0);
+
+    UT_CmdBuf.ManageTableCmd.Payload.Parameter = SC_TBL_ID_ATS_0;
+
+    SC_OperData.AtsCtrlBlckAddr->AtpState       = SC_Status_EXECUTING;
+    SC_OperData.AtsCtrlBlckAddr->CurrAtsNum     = SC_ATS_NUM_C(2);
+    SC_OperData.AtsCtrlBlckAddr->SwitchPendFlag = true;
+
+    UT_SetDeferredRetcode(UT_KEY(SC_ToggleAtsIndex), 1, SC_IDX_AS_UINT(AtsIndex));
+
+    /* Set to reach "SC_LoadAts(AtsIndex)" */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_INFO_UPDATED);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_ManageTableCmd(&UT_CmdBuf.ManageTableCmd));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(SC_LoadAts, 1);
+    UtAssert_STUB_COUNT(SC_BeginAtsLoad, 0);
 }
 
 void SC_ProcessCommand_Test_TableManageAtsTableGetAddressError(void)
@@ -1306,7 +2398,7 @@ void SC_ProcessCommand_Test_TableManageAtsTableID(void)
     /* test TableID >= SC_TBL_ID_ATS_0 */
     UT_CmdBuf.ManageTableCmd.Payload.Parameter = 0;
 
-    /* Set to reach "SC_LoadAts(ArrayIndex)" */
+    /* Set to reach "SC_BeginAtsLoad(AtsIndex)" */
     UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_INFO_UPDATED);
 
     /* Execute the function being tested */
@@ -1461,6 +2553,37 @@ void SC_ProcessCommand_Test_TableManageAppendTableGetAddressSuccess(void)
     /* This function is already verified to work correctly in another file, so no verifications here. */
 }
 
+void SC_ProcessCommand_Test_TableManageTriggerTableNominal(void)
+{
+    UT_CmdBuf.ManageTableCmd.Payload.Parameter = SC_TBL_ID_TRIGGER;
+
+    /* Set to reach "SC_UpdateTriggers()" */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, CFE_TBL_INFO_UPDATED);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_ManageTableCmd(&UT_CmdBuf.ManageTableCmd));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(SC_UpdateTriggers, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_ProcessCommand_Test_TableManageTriggerTableGetAddressError(void)
+{
+    UT_CmdBuf.ManageTableCmd.Payload.Parameter = SC_TBL_ID_TRIGGER;
+
+    /* Set to generate error message SC_TABLE_MANAGE_TRIGGER_ERR_EID */
+    UT_SetDeferredRetcode(UT_KEY(CFE_TBL_GetAddress), 1, -1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_ManageTableCmd(&UT_CmdBuf.ManageTableCmd));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(SC_UpdateTriggers, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_TABLE_MANAGE_TRIGGER_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
 void SC_ProcessCommand_Test_TableManageRtsTableNominal(void)
 {
     UT_CmdBuf.ManageTableCmd.Payload.Parameter = SC_TBL_ID_RTS_0;
@@ -1589,6 +2712,30 @@ void SC_ProcessCommand_Test_TableManageAtsCmdStatus(void)
     /* This function is already verified to work correctly in another file, so no verifications here. */
 }
 
+void SC_ProcessCommand_Test_TableManageTrace(void)
+{
+    UT_CmdBuf.ManageTableCmd.Payload.Parameter = SC_TBL_ID_TRACE;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_ManageTableCmd(&UT_CmdBuf.ManageTableCmd));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_TBL_Manage, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_ProcessCommand_Test_TableManageRtsStats(void)
+{
+    UT_CmdBuf.ManageTableCmd.Payload.Parameter = SC_TBL_ID_RTS_STATS;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_ManageTableCmd(&UT_CmdBuf.ManageTableCmd));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_TBL_Manage, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void SC_ProcessCommand_Test_TableManageInvalidTableID(void)
 {
     UT_CmdBuf.ManageTableCmd.Payload.Parameter = 999;
@@ -1641,6 +2788,11 @@ void UtTest_Setup(void)
     UtTest_Add(SC_ProcessAtpCmd_Test_SwitchCmd, SC_Test_Setup, SC_Test_TearDown, "SC_ProcessAtpCmd_Test_SwitchCmd");
     UtTest_Add(SC_ProcessAtpCmd_Test_NonSwitchCmd, SC_Test_Setup, SC_Test_TearDown,
                "SC_ProcessAtpCmd_Test_NonSwitchCmd");
+    UtTest_Add(SC_ProcessAtpCmd_Test_LocalCmd, SC_Test_Setup, SC_Test_TearDown, "SC_ProcessAtpCmd_Test_LocalCmd");
+    UtTest_Add(SC_ProcessAtpCmd_Test_LocalCmdRejected, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessAtpCmd_Test_LocalCmdRejected");
+    UtTest_Add(SC_ProcessAtpCmd_Test_LocalCmdReloadsAts, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessAtpCmd_Test_LocalCmdReloadsAts");
     UtTest_Add(SC_ProcessAtpCmd_Test_InlineSwitchError, SC_Test_Setup, SC_Test_TearDown,
                "SC_ProcessAtpCmd_Test_InlineSwitchError");
     UtTest_Add(SC_ProcessAtpCmd_Test_SBErrorAtsA, SC_Test_Setup, SC_Test_TearDown, "SC_ProcessAtpCmd_Test_SBErrorAtsA");
@@ -1662,10 +2814,27 @@ void UtTest_Setup(void)
     UtTest_Add(SC_ProcessAtpCmd_Test_AtpState, SC_Test_Setup, SC_Test_TearDown, "SC_ProcessAtpCmd_Test_AtpState");
     UtTest_Add(SC_ProcessAtpCmd_Test_CmdMid, SC_Test_Setup, SC_Test_TearDown, "SC_ProcessAtpCmd_Test_CmdMid");
     UtTest_Add(SC_ProcessRtpCommand_Test_Nominal, SC_Test_Setup, SC_Test_TearDown, "SC_ProcessRtpCommand_Test_Nominal");
+    UtTest_Add(SC_ProcessRtpCommand_Test_Late, SC_Test_Setup, SC_Test_TearDown, "SC_ProcessRtpCommand_Test_Late");
+    UtTest_Add(SC_ProcessRtpCommand_Test_TimedLatency, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessRtpCommand_Test_TimedLatency");
+    UtTest_Add(SC_ProcessRtpCommand_Test_FirstEligibleWakeup, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessRtpCommand_Test_FirstEligibleWakeup");
+    UtTest_Add(SC_ProcessRtpCommand_Test_TimedLate, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessRtpCommand_Test_TimedLate");
+    UtTest_Add(SC_ProcessRtpCommand_Test_LateLatency, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessRtpCommand_Test_LateLatency");
+    UtTest_Add(SC_ProcessRtpCommand_Test_CallRts, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessRtpCommand_Test_CallRts");
+    UtTest_Add(SC_ProcessRtpCommand_Test_CallRtsFailed, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessRtpCommand_Test_CallRtsFailed");
+    UtTest_Add(SC_ProcessRtpCommand_Test_LocalCmd, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessRtpCommand_Test_LocalCmd");
     UtTest_Add(SC_ProcessRtpCommand_Test_BadSoftwareBusReturn, SC_Test_Setup, SC_Test_TearDown,
                "SC_ProcessRtpCommand_Test_BadSoftwareBusReturn");
     UtTest_Add(SC_ProcessRtpCommand_Test_BadChecksum, SC_Test_Setup, SC_Test_TearDown,
                "SC_ProcessRtpCommand_Test_BadChecksum");
+    UtTest_Add(SC_ProcessRtpCommand_Test_BadChecksumDeferred, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessRtpCommand_Test_BadChecksumDeferred");
     UtTest_Add(SC_ProcessRtpCommand_Test_NextCmdTime, SC_Test_Setup, SC_Test_TearDown,
                "SC_ProcessRtpCommand_Test_NextCmdTime");
     UtTest_Add(SC_ProcessRtpCommand_Test_RtsNumZero, SC_Test_Setup, SC_Test_TearDown,
@@ -1674,7 +2843,19 @@ void UtTest_Setup(void)
                "SC_ProcessRtpCommand_Test_RtsNumHigh");
     UtTest_Add(SC_ProcessRtpCommand_Test_RtsStatus, SC_Test_Setup, SC_Test_TearDown,
                "SC_ProcessRtpCommand_Test_RtsStatus");
+    UtTest_Add(SC_ProcessRtpCommand_Test_Patched, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessRtpCommand_Test_Patched");
+    UtTest_Add(SC_ProcessRtpCommand_Test_PatchError, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessRtpCommand_Test_PatchError");
+    UtTest_Add(SC_PatchRtsCommand_Test_Nominal, SC_Test_Setup, SC_Test_TearDown, "SC_PatchRtsCommand_Test_Nominal");
+    UtTest_Add(SC_PatchRtsCommand_Test_ArgRange, SC_Test_Setup, SC_Test_TearDown, "SC_PatchRtsCommand_Test_ArgRange");
+    UtTest_Add(SC_PatchRtsCommand_Test_MsgRange, SC_Test_Setup, SC_Test_TearDown, "SC_PatchRtsCommand_Test_MsgRange");
+    UtTest_Add(SC_CopyLocalCmd_Test, SC_Test_Setup, SC_Test_TearDown, "SC_CopyLocalCmd_Test");
     UtTest_Add(SC_SendHkPacket_Test, SC_Test_Setup, SC_Test_TearDown, "SC_SendHkPacket_Test");
+    UtTest_Add(SC_SendHkPacket_Test_AtsLoadProgress, SC_Test_Setup, SC_Test_TearDown,
+               "SC_SendHkPacket_Test_AtsLoadProgress");
+    UtTest_Add(SC_SendHkPacket_Test_RtsPool, SC_Test_Setup, SC_Test_TearDown, "SC_SendHkPacket_Test_RtsPool");
+    UtTest_Add(SC_SendDiagPacket_Test, SC_Test_Setup, SC_Test_TearDown, "SC_SendDiagPacket_Test");
     UtTest_Add(SC_ProcessRequest_Test_HkMID, SC_Test_Setup, SC_Test_TearDown, "SC_ProcessRequest_Test_HkMID");
     UtTest_Add(SC_ProcessRequest_Test_HkMIDAutoStartRts, SC_Test_Setup, SC_Test_TearDown,
                "SC_ProcessRequest_Test_HkMIDAutoStartRts");
@@ -1684,6 +2865,8 @@ void UtTest_Setup(void)
                "SC_ProcessRequest_Test_WakeupNONE");
     UtTest_Add(SC_ProcessRequest_Test_WakeupRtpNotExecutionTime, SC_Test_Setup, SC_Test_TearDown,
                "SC_ProcessRequest_Test_WakeupRtpNotExecutionTime");
+    UtTest_Add(SC_ProcessRequest_Test_WakeupFirstRtsCmdOnTime, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessRequest_Test_WakeupFirstRtsCmdOnTime");
     UtTest_Add(SC_ProcessRequest_Test_WakeupNoSwitchPending, SC_Test_Setup, SC_Test_TearDown,
                "SC_ProcessRequest_Test_WakeupNoSwitchPending");
     UtTest_Add(SC_ProcessRequest_Test_WakeupAtpNotExecutionTime, SC_Test_Setup, SC_Test_TearDown,
@@ -1696,9 +2879,25 @@ void UtTest_Setup(void)
                "SC_ProcessRequest_Test_WakeupRtpExecutionTimeTooManyCmds");
     UtTest_Add(SC_ProcessRequest_Test_WakeupAtpExecutionTimeTooManyCmds, SC_Test_Setup, SC_Test_TearDown,
                "SC_ProcessRequest_Test_WakeupAtpExecutionTimeTooManyCmds");
+    UtTest_Add(SC_ProcessRequest_Test_WakeupRtsOverAtp, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessRequest_Test_WakeupRtsOverAtp");
+    UtTest_Add(SC_ProcessRequest_Test_WakeupAtsLoad, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessRequest_Test_WakeupAtsLoad");
     UtTest_Add(SC_ProcessCommand_Test_NoOp, SC_Test_Setup, SC_Test_TearDown, "SC_ProcessCommand_Test_NoOp");
     UtTest_Add(SC_ProcessCommand_Test_ResetCounters, SC_Test_Setup, SC_Test_TearDown,
                "SC_ProcessCommand_Test_ResetCounters");
+    UtTest_Add(SC_ProcessCommand_Test_ResetDiag, SC_Test_Setup, SC_Test_TearDown, "SC_ProcessCommand_Test_ResetDiag");
+    UtTest_Add(SC_QueryLookaheadCmd_Test_Nominal, SC_Test_Setup, SC_Test_TearDown, "SC_QueryLookaheadCmd_Test_Nominal");
+    UtTest_Add(SC_QueryLookaheadCmd_Test_WakeupsToSeconds, SC_Test_Setup, SC_Test_TearDown,
+               "SC_QueryLookaheadCmd_Test_WakeupsToSeconds");
+    UtTest_Add(SC_QueryLookaheadCmd_Test_Nothing, SC_Test_Setup, SC_Test_TearDown, "SC_QueryLookaheadCmd_Test_Nothing");
+    UtTest_Add(SC_QueryLookaheadCmd_Test_InvalidNumEntries, SC_Test_Setup, SC_Test_TearDown,
+               "SC_QueryLookaheadCmd_Test_InvalidNumEntries");
+    UtTest_Add(SC_InsertLookaheadEntry_Test_Full, SC_Test_Setup, SC_Test_TearDown,
+               "SC_InsertLookaheadEntry_Test_Full");
+    UtTest_Add(SC_SetEventModeCmd_Test_Nominal, SC_Test_Setup, SC_Test_TearDown, "SC_SetEventModeCmd_Test_Nominal");
+    UtTest_Add(SC_SetEventModeCmd_Test_InvalidMode, SC_Test_Setup, SC_Test_TearDown,
+               "SC_SetEventModeCmd_Test_InvalidMode");
     UtTest_Add(SC_ProcessCommand_Test_StartAts, SC_Test_Setup, SC_Test_TearDown, "SC_ProcessCommand_Test_StartAts");
     UtTest_Add(SC_ProcessCommand_Test_StopAts, SC_Test_Setup, SC_Test_TearDown, "SC_ProcessCommand_Test_StopAts");
     UtTest_Add(SC_ProcessCommand_Test_StartRts, SC_Test_Setup, SC_Test_TearDown, "SC_ProcessCommand_Test_StartRts");
@@ -1712,6 +2911,10 @@ void UtTest_Setup(void)
     UtTest_Add(SC_ProcessCommand_Test_AppendAts, SC_Test_Setup, SC_Test_TearDown, "SC_ProcessCommand_Test_AppendAts");
     UtTest_Add(SC_ProcessCommand_Test_TableManageAtsTableNominal, SC_Test_Setup, SC_Test_TearDown,
                "SC_ProcessCommand_Test_TableManageAtsTableNominal");
+    UtTest_Add(SC_ProcessCommand_Test_TableManageAtsTableInUse, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessCommand_Test_TableManageAtsTableInUse");
+    UtTest_Add(SC_ProcessCommand_Test_TableManageAtsTableSwitchPending, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessCommand_Test_TableManageAtsTableSwitchPending");
     UtTest_Add(SC_ProcessCommand_Test_TableManageAtsTableGetAddressError, SC_Test_Setup, SC_Test_TearDown,
                "SC_ProcessCommand_Test_TableManageAtsTableGetAddressError");
     UtTest_Add(SC_ProcessCommand_Test_TableManageAtsTableID, SC_Test_Setup, SC_Test_TearDown,
@@ -1730,6 +2933,10 @@ void UtTest_Setup(void)
                "SC_ProcessCommand_Test_TableManageAppendTableGetAddressNeverLoaded");
     UtTest_Add(SC_ProcessCommand_Test_TableManageAppendTableGetAddressSuccess, SC_Test_Setup, SC_Test_TearDown,
                "SC_ProcessCommand_Test_TableManageAppendTableGetAddressSuccess");
+    UtTest_Add(SC_ProcessCommand_Test_TableManageTriggerTableNominal, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessCommand_Test_TableManageTriggerTableNominal");
+    UtTest_Add(SC_ProcessCommand_Test_TableManageTriggerTableGetAddressError, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessCommand_Test_TableManageTriggerTableGetAddressError");
     UtTest_Add(SC_ProcessCommand_Test_TableManageRtsTableNominal, SC_Test_Setup, SC_Test_TearDown,
                "SC_ProcessCommand_Test_TableManageRtsTableNominal");
     UtTest_Add(SC_ProcessCommand_Test_TableManageRtsTableGetAddressError, SC_Test_Setup, SC_Test_TearDown,
@@ -1752,6 +2959,10 @@ void UtTest_Setup(void)
                "SC_ProcessCommand_Test_TableManageAtpCtrl");
     UtTest_Add(SC_ProcessCommand_Test_TableManageAtsCmdStatus, SC_Test_Setup, SC_Test_TearDown,
                "SC_ProcessCommand_Test_TableManageAtsCmdStatus");
+    UtTest_Add(SC_ProcessCommand_Test_TableManageTrace, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessCommand_Test_TableManageTrace");
+    UtTest_Add(SC_ProcessCommand_Test_TableManageRtsStats, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessCommand_Test_TableManageRtsStats");
     UtTest_Add(SC_ProcessCommand_Test_TableManageInvalidTableID, SC_Test_Setup, SC_Test_TearDown,
                "SC_ProcessCommand_Test_TableManageInvalidTableID");
     UtTest_Add(SC_ProcessCommand_Test_StartRtsGrp, SC_Test_Setup, SC_Test_TearDown,
@@ -153,6 +153,28 @@ void SC_VerifyCmdLength_Test_LenErrorNotMID(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
 }
 
+void SC_GetCmdLength_Test(void)
+{
+    UtAssert_UINT32_EQ(SC_GetCmdLength(SC_NOOP_CC), sizeof(SC_NoopCmd_t));
+    UtAssert_UINT32_EQ(SC_GetCmdLength(SC_START_RTS_CC), sizeof(SC_StartRtsCmd_t));
+    UtAssert_UINT32_EQ(SC_GetCmdLength(SC_JUMP_ATS_CC), sizeof(SC_JumpAtsCmd_t));
+    UtAssert_UINT32_EQ(SC_GetCmdLength(SC_REPORT_ATS_STATUS_CC), sizeof(SC_ReportAtsStatusCmd_t));
+    UtAssert_UINT32_EQ(SC_GetCmdLength(SC_START_RTS_INSTANCE_CC), sizeof(SC_StartRtsInstanceCmd_t));
+    UtAssert_UINT32_EQ(SC_GetCmdLength(SC_START_RTS_PARAM_CC), sizeof(SC_StartRtsParamCmd_t));
+    UtAssert_UINT32_EQ(SC_GetCmdLength(SC_START_RTS_SET_CC), sizeof(SC_StartRtsSetCmd_t));
+    UtAssert_UINT32_EQ(SC_GetCmdLength(SC_STOP_RTS_SET_CC), sizeof(SC_StopRtsSetCmd_t));
+    UtAssert_UINT32_EQ(SC_GetCmdLength(SC_DISABLE_RTS_SET_CC), sizeof(SC_DisableRtsSetCmd_t));
+    UtAssert_UINT32_EQ(SC_GetCmdLength(SC_ENABLE_RTS_SET_CC), sizeof(SC_EnableRtsSetCmd_t));
+    UtAssert_UINT32_EQ(SC_GetCmdLength(SC_SET_RTS_PRIORITY_CC), sizeof(SC_SetRtsPriorityCmd_t));
+    UtAssert_UINT32_EQ(SC_GetCmdLength(SC_RESET_DIAG_CC), sizeof(SC_ResetDiagCmd_t));
+    UtAssert_UINT32_EQ(SC_GetCmdLength(SC_QUERY_LOOKAHEAD_CC), sizeof(SC_QueryLookaheadCmd_t));
+    UtAssert_UINT32_EQ(SC_GetCmdLength(SC_SET_EVENT_MODE_CC), sizeof(SC_SetEventModeCmd_t));
+
+    /* calls and chains are only carried out from within an RTS */
+    UtAssert_UINT32_EQ(SC_GetCmdLength(SC_CALL_RTS_CC), 0);
+    UtAssert_UINT32_EQ(SC_GetCmdLength(99), 0);
+}
+
 void SC_ProcessRequest_Test_CmdNominal(void)
 {
     /**
@@ -171,6 +193,7 @@ void SC_ProcessRequest_Test_CmdNominal(void)
 
     /* Verify results */
     UtAssert_STUB_COUNT(SC_NoopCmd, 1);
+    UtAssert_STUB_COUNT(SC_FlushDeferredEvents, 1);
 }
 
 void SC_ProcessRequest_Test_SendHkNominal(void)
@@ -618,6 +641,48 @@ void SC_ProcessCommand_Test_EnableRtsGrpCmdInvalidLength(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_CMD_LEN_ERR_EID);
 }
 
+void SC_ProcessCommand_Test_QueryAtsWindowCmdInvalidLength(void)
+{
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(SC_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = SC_QUERY_ATS_WINDOW_CC;
+
+    UT_SC_Dispatch_SetMsgId(TestMsgId);
+    UT_SC_Dispatch_SetFcnCode(FcnCode);
+    UT_SC_Dispatch_SetMsgSize(sizeof(CFE_MSG_Message_t) - 1);
+
+    /* Execute the function being tested */
+    SC_ProcessCommand(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdCtr, 0);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdErrCtr, 1);
+
+    UtAssert_STUB_COUNT(SC_QueryAtsWindowCmd, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_CMD_LEN_ERR_EID);
+}
+
+void SC_ProcessCommand_Test_ReportAtsStatusCmdInvalidLength(void)
+{
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(SC_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = SC_REPORT_ATS_STATUS_CC;
+
+    UT_SC_Dispatch_SetMsgId(TestMsgId);
+    UT_SC_Dispatch_SetFcnCode(FcnCode);
+    UT_SC_Dispatch_SetMsgSize(sizeof(CFE_MSG_Message_t) - 1);
+
+    /* Execute the function being tested */
+    SC_ProcessCommand(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdCtr, 0);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdErrCtr, 1);
+
+    UtAssert_STUB_COUNT(SC_ReportAtsStatusCmd, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_CMD_LEN_ERR_EID);
+}
+
 void SC_ProcessCommand_Test_NoopCmdNominal(void)
 {
     CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(SC_CMD_MID);
@@ -890,6 +955,198 @@ void SC_ProcessCommand_Test_EnableRtsGrpCmdNominal(void)
     UtAssert_STUB_COUNT(SC_EnableRtsGrpCmd, 1);
 }
 
+void SC_ProcessCommand_Test_QueryAtsWindowCmdNominal(void)
+{
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(SC_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = SC_QUERY_ATS_WINDOW_CC;
+
+    UT_SC_Dispatch_SetMsgId(TestMsgId);
+    UT_SC_Dispatch_SetFcnCode(FcnCode);
+    UT_SC_Dispatch_SetMsgSize(sizeof(SC_QueryAtsWindowCmd_t));
+
+    /* Execute the function being tested */
+    SC_ProcessCommand(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(SC_QueryAtsWindowCmd, 1);
+}
+
+void SC_ProcessCommand_Test_ReportAtsStatusCmdNominal(void)
+{
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(SC_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = SC_REPORT_ATS_STATUS_CC;
+
+    UT_SC_Dispatch_SetMsgId(TestMsgId);
+    UT_SC_Dispatch_SetFcnCode(FcnCode);
+    UT_SC_Dispatch_SetMsgSize(sizeof(SC_ReportAtsStatusCmd_t));
+
+    /* Execute the function being tested */
+    SC_ProcessCommand(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(SC_ReportAtsStatusCmd, 1);
+}
+
+void SC_ProcessCommand_Test_StartRtsInstanceCmdNominal(void)
+{
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(SC_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = SC_START_RTS_INSTANCE_CC;
+
+    UT_SC_Dispatch_SetMsgId(TestMsgId);
+    UT_SC_Dispatch_SetFcnCode(FcnCode);
+    UT_SC_Dispatch_SetMsgSize(sizeof(SC_StartRtsInstanceCmd_t));
+
+    /* Execute the function being tested */
+    SC_ProcessCommand(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(SC_StartRtsInstanceCmd, 1);
+}
+
+void SC_ProcessCommand_Test_StartRtsParamCmdNominal(void)
+{
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(SC_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = SC_START_RTS_PARAM_CC;
+
+    UT_SC_Dispatch_SetMsgId(TestMsgId);
+    UT_SC_Dispatch_SetFcnCode(FcnCode);
+    UT_SC_Dispatch_SetMsgSize(sizeof(SC_StartRtsParamCmd_t));
+
+    /* Execute the function being tested */
+    SC_ProcessCommand(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(SC_StartRtsParamCmd, 1);
+}
+
+void SC_ProcessCommand_Test_StartRtsSetCmdNominal(void)
+{
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(SC_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = SC_START_RTS_SET_CC;
+
+    UT_SC_Dispatch_SetMsgId(TestMsgId);
+    UT_SC_Dispatch_SetFcnCode(FcnCode);
+    UT_SC_Dispatch_SetMsgSize(sizeof(SC_StartRtsSetCmd_t));
+
+    /* Execute the function being tested */
+    SC_ProcessCommand(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(SC_StartRtsSetCmd, 1);
+}
+
+void SC_ProcessCommand_Test_StopRtsSetCmdNominal(void)
+{
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(SC_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = SC_STOP_RTS_SET_CC;
+
+    UT_SC_Dispatch_SetMsgId(TestMsgId);
+    UT_SC_Dispatch_SetFcnCode(FcnCode);
+    UT_SC_Dispatch_SetMsgSize(sizeof(SC_StopRtsSetCmd_t));
+
+    /* Execute the function being tested */
+    SC_ProcessCommand(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(SC_StopRtsSetCmd, 1);
+}
+
+void SC_ProcessCommand_Test_DisableRtsSetCmdNominal(void)
+{
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(SC_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = SC_DISABLE_RTS_SET_CC;
+
+    UT_SC_Dispatch_SetMsgId(TestMsgId);
+    UT_SC_Dispatch_SetFcnCode(FcnCode);
+    UT_SC_Dispatch_SetMsgSize(sizeof(SC_DisableRtsSetCmd_t));
+
+    /* Execute the function being tested */
+    SC_ProcessCommand(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(SC_DisableRtsSetCmd, 1);
+}
+
+void SC_ProcessCommand_Test_EnableRtsSetCmdNominal(void)
+{
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(SC_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = SC_ENABLE_RTS_SET_CC;
+
+    UT_SC_Dispatch_SetMsgId(TestMsgId);
+    UT_SC_Dispatch_SetFcnCode(FcnCode);
+    UT_SC_Dispatch_SetMsgSize(sizeof(SC_EnableRtsSetCmd_t));
+
+    /* Execute the function being tested */
+    SC_ProcessCommand(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(SC_EnableRtsSetCmd, 1);
+}
+
+void SC_ProcessCommand_Test_SetRtsPriorityCmdNominal(void)
+{
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(SC_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = SC_SET_RTS_PRIORITY_CC;
+
+    UT_SC_Dispatch_SetMsgId(TestMsgId);
+    UT_SC_Dispatch_SetFcnCode(FcnCode);
+    UT_SC_Dispatch_SetMsgSize(sizeof(SC_SetRtsPriorityCmd_t));
+
+    /* Execute the function being tested */
+    SC_ProcessCommand(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(SC_SetRtsPriorityCmd, 1);
+}
+
+void SC_ProcessCommand_Test_ResetDiagCmdNominal(void)
+{
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(SC_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = SC_RESET_DIAG_CC;
+
+    UT_SC_Dispatch_SetMsgId(TestMsgId);
+    UT_SC_Dispatch_SetFcnCode(FcnCode);
+    UT_SC_Dispatch_SetMsgSize(sizeof(SC_ResetDiagCmd_t));
+
+    /* Execute the function being tested */
+    SC_ProcessCommand(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(SC_ResetDiagCmd, 1);
+}
+
+void SC_ProcessCommand_Test_QueryLookaheadCmdNominal(void)
+{
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(SC_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = SC_QUERY_LOOKAHEAD_CC;
+
+    UT_SC_Dispatch_SetMsgId(TestMsgId);
+    UT_SC_Dispatch_SetFcnCode(FcnCode);
+    UT_SC_Dispatch_SetMsgSize(sizeof(SC_QueryLookaheadCmd_t));
+
+    /* Execute the function being tested */
+    SC_ProcessCommand(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(SC_QueryLookaheadCmd, 1);
+}
+
+void SC_ProcessCommand_Test_SetEventModeCmdNominal(void)
+{
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(SC_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = SC_SET_EVENT_MODE_CC;
+
+    UT_SC_Dispatch_SetMsgId(TestMsgId);
+    UT_SC_Dispatch_SetFcnCode(FcnCode);
+    UT_SC_Dispatch_SetMsgSize(sizeof(SC_SetEventModeCmd_t));
+
+    /* Execute the function being tested */
+    SC_ProcessCommand(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(SC_SetEventModeCmd, 1);
+}
+
 void SC_ProcessCommand_Test_InvalidCmdError(void)
 {
     /**
@@ -926,6 +1183,7 @@ void UtTest_Setup(void)
     UtTest_Add(SC_VerifyCmdLength_Test_LenError, SC_Test_Setup, SC_Test_TearDown, "SC_VerifyCmdLength_Test_LenError");
     UtTest_Add(SC_VerifyCmdLength_Test_LenErrorNotMID, SC_Test_Setup, SC_Test_TearDown,
                "SC_VerifyCmdLength_Test_LenErrorNotMID");
+    UtTest_Add(SC_GetCmdLength_Test, SC_Test_Setup, SC_Test_TearDown, "SC_GetCmdLength_Test");
 
     UtTest_Add(SC_ProcessRequest_Test_CmdNominal, SC_Test_Setup, SC_Test_TearDown, "SC_ProcessRequest_Test_CmdNominal");
     UtTest_Add(SC_ProcessRequest_Test_SendHkNominal, SC_Test_Setup, SC_Test_TearDown,
@@ -988,6 +1246,10 @@ void UtTest_Setup(void)
                "SC_ProcessCommand_Test_DisableRtsGrpCmdNominal");
     UtTest_Add(SC_ProcessCommand_Test_EnableRtsGrpCmdNominal, SC_Test_Setup, SC_Test_TearDown,
                "SC_ProcessCommand_Test_EnableRtsGrpCmdNominal");
+    UtTest_Add(SC_ProcessCommand_Test_QueryAtsWindowCmdNominal, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessCommand_Test_QueryAtsWindowCmdNominal");
+    UtTest_Add(SC_ProcessCommand_Test_ReportAtsStatusCmdNominal, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessCommand_Test_ReportAtsStatusCmdNominal");
 
     UtTest_Add(SC_ProcessCommand_Test_NoopCmdInvalidLength, SC_Test_Setup, SC_Test_TearDown,
                "SC_ProcessCommand_Test_NoopCmdInvalidLength");
@@ -1023,6 +1285,30 @@ void UtTest_Setup(void)
                "SC_ProcessCommand_Test_DisableRtsGrpCmdInvalidLength");
     UtTest_Add(SC_ProcessCommand_Test_EnableRtsGrpCmdInvalidLength, SC_Test_Setup, SC_Test_TearDown,
                "SC_ProcessCommand_Test_EnableRtsGrpCmdInvalidLength");
+    UtTest_Add(SC_ProcessCommand_Test_QueryAtsWindowCmdInvalidLength, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessCommand_Test_QueryAtsWindowCmdInvalidLength");
+    UtTest_Add(SC_ProcessCommand_Test_ReportAtsStatusCmdInvalidLength, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessCommand_Test_ReportAtsStatusCmdInvalidLength");
+    UtTest_Add(SC_ProcessCommand_Test_StartRtsInstanceCmdNominal, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessCommand_Test_StartRtsInstanceCmdNominal");
+    UtTest_Add(SC_ProcessCommand_Test_StartRtsParamCmdNominal, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessCommand_Test_StartRtsParamCmdNominal");
+    UtTest_Add(SC_ProcessCommand_Test_StartRtsSetCmdNominal, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessCommand_Test_StartRtsSetCmdNominal");
+    UtTest_Add(SC_ProcessCommand_Test_StopRtsSetCmdNominal, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessCommand_Test_StopRtsSetCmdNominal");
+    UtTest_Add(SC_ProcessCommand_Test_DisableRtsSetCmdNominal, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessCommand_Test_DisableRtsSetCmdNominal");
+    UtTest_Add(SC_ProcessCommand_Test_EnableRtsSetCmdNominal, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessCommand_Test_EnableRtsSetCmdNominal");
+    UtTest_Add(SC_ProcessCommand_Test_SetRtsPriorityCmdNominal, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessCommand_Test_SetRtsPriorityCmdNominal");
+    UtTest_Add(SC_ProcessCommand_Test_ResetDiagCmdNominal, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessCommand_Test_ResetDiagCmdNominal");
+    UtTest_Add(SC_ProcessCommand_Test_QueryLookaheadCmdNominal, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessCommand_Test_QueryLookaheadCmdNominal");
+    UtTest_Add(SC_ProcessCommand_Test_SetEventModeCmdNominal, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessCommand_Test_SetEventModeCmdNominal");
     UtTest_Add(SC_ProcessCommand_Test_InvalidCmdError, SC_Test_Setup, SC_Test_TearDown,
                "SC_ProcessCommand_Test_InvalidCmdError");
 }
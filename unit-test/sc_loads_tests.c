@@ -25,6 +25,7 @@
 #include "sc_cmds.h"
 #include "sc_state.h"
 #include "sc_atsrq.h"
+#include "sc_dispatch.h"
 #include "sc_rtsrq.h"
 #include "sc_utils.h"
 #include "sc_loads.h"
@@ -74,6 +75,39 @@ void UT_SC_SetMsgId(CFE_SB_MsgId_t MsgId)
     UT_SetHandlerFunction(UT_KEY(CFE_MSG_GetMsgId), UT_SC_CmdTableMidHandler, &TestCaseMsgId);
 }
 
+/* ATS entry times are the low 16 bits of the time tag, compared as numbers */
+void UT_SC_AtsEntryTimeHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    SC_AtsEntryHeader_t *Entry   = UT_Hook_GetArgValueByName(Context, "Entry", SC_AtsEntryHeader_t *);
+    SC_AbsTimeTag_t      AbsTime = Entry->TimeTag_LS;
+
+    UT_Stub_SetReturnValue(FuncKey, AbsTime);
+}
+
+void UT_SC_CompareAbsTimeHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    SC_AbsTimeTag_t AbsTime1 = UT_Hook_GetArgValueByName(Context, "AbsTime1", SC_AbsTimeTag_t);
+    SC_AbsTimeTag_t AbsTime2 = UT_Hook_GetArgValueByName(Context, "AbsTime2", SC_AbsTimeTag_t);
+    bool            IsLater  = (AbsTime1 > AbsTime2);
+
+    UT_Stub_SetReturnValue(FuncKey, IsLater);
+}
+
+void UT_SC_PhaseHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    SC_Phase_Enum_t *Phases = UserObj;
+    SC_Phase_Enum_t  Phase  = UT_Hook_GetArgValueByName(Context, "Phase", SC_Phase_Enum_t);
+
+    /* record the phases in call order, the stub count was just incremented */
+    Phases[UT_GetStubCount(FuncKey) - 1] = Phase;
+}
+
+void UT_SC_SetAtsEntryTimes(void)
+{
+    UT_SetHandlerFunction(UT_KEY(SC_GetAtsEntryTime), UT_SC_AtsEntryTimeHandler, NULL);
+    UT_SetHandlerFunction(UT_KEY(SC_CompareAbsTime), UT_SC_CompareAbsTimeHandler, NULL);
+}
+
 void UT_SC_Loads_Test_Setup(void)
 {
     SC_Test_Setup();
@@ -119,7 +153,7 @@ void UT_SC_AdvanceTailPtr(void **TailPtr, size_t HdrSize, size_t MsgSize)
     *TailPtr = U32Ptr;
 }
 
-SC_AtsEntryHeader_t *UT_SC_AppendSingleAtsEntry(void **TailPtr, uint16 CmdNumber, size_t MsgSize)
+SC_AtsEntryHeader_t *UT_SC_AppendSingleAtsEntry(void **TailPtr, uint32 CmdNumber, size_t MsgSize)
 {
     SC_AtsEntryHeader_t *Entry = (SC_AtsEntryHeader_t *)(*TailPtr);
 
@@ -141,7 +175,7 @@ SC_RtsEntryHeader_t *UT_SC_AppendSingleRtsEntry(void **TailPtr, SC_RelWakeupCoun
     return Entry;
 }
 
-SC_AtsEntryHeader_t *UT_SC_SetupSingleAtsEntry(SC_AtsIndex_t AtsIndex, uint16 CmdNumber, size_t MsgSize)
+SC_AtsEntryHeader_t *UT_SC_SetupSingleAtsEntry(SC_AtsIndex_t AtsIndex, uint32 CmdNumber, size_t MsgSize)
 {
     void *TailPtr;
 
@@ -161,6 +195,40 @@ SC_RtsEntryHeader_t *UT_SC_SetupSingleRtsEntry(SC_RtsIndex_t RtsIndex, CFE_SB_Ms
     return UT_SC_AppendSingleRtsEntry(&TailPtr, WakeupCount, MsgSize);
 }
 
+SC_RtsGotoCmd_t *UT_SC_SetupRtsGoto(SC_RtsIndex_t RtsIndex)
+{
+    void *                   TailPtr;
+    SC_RtsEntryHeader_t *    Entry;
+    static CFE_MSG_FcnCode_t FcnCode[2] = {SC_RTS_GOTO_CC, 0};
+
+    /* a goto followed by one other command, all for SC */
+    UT_SC_SetMsgId(CFE_SB_ValueToMsgId(SC_CMD_MID));
+    TailPtr = UT_SC_GetRtsTable(RtsIndex);
+    Entry   = UT_SC_AppendSingleRtsEntry(&TailPtr, 1, sizeof(SC_RtsGotoCmd_t));
+    UT_SC_AppendSingleRtsEntry(&TailPtr, 1, UT_SC_NOMINAL_CMD_SIZE);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), FcnCode, sizeof(FcnCode), false);
+
+    return (SC_RtsGotoCmd_t *)&((SC_RtsEntry_t *)Entry)->Msg;
+}
+
+SC_RtsPatchCmd_t *UT_SC_SetupRtsPatch(SC_RtsIndex_t RtsIndex)
+{
+    void *                   TailPtr;
+    SC_RtsEntryHeader_t *    Entry;
+    static CFE_MSG_FcnCode_t FcnCode[2] = {SC_RTS_PATCH_CC, 0};
+
+    /* a patch followed by the command it patches, all for SC */
+    UT_SC_SetMsgId(CFE_SB_ValueToMsgId(SC_CMD_MID));
+    TailPtr = UT_SC_GetRtsTable(RtsIndex);
+    Entry   = UT_SC_AppendSingleRtsEntry(&TailPtr, 1, sizeof(SC_RtsPatchCmd_t));
+    UT_SC_AppendSingleRtsEntry(&TailPtr, 1, UT_SC_NOMINAL_CMD_SIZE);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), FcnCode, sizeof(FcnCode), false);
+
+    return (SC_RtsPatchCmd_t *)&((SC_RtsEntry_t *)Entry)->Msg;
+}
+
 uint32 UT_SC_GetEntryWordCount(size_t HdrSize, size_t MsgSize)
 {
     return (MsgSize + HdrSize + SC_ROUND_UP_BYTES) / SC_BYTES_IN_WORD;
@@ -270,7 +338,7 @@ SC_RtsEntryHeader_t *UT_SC_SetupRtsTable(SC_RtsIndex_t RtsIndex, CFE_SB_MsgId_t
 
     UT_SC_SetMsgId(MsgId);
     TailPtr    = UT_SC_GetRtsTable(RtsIndex);
-    FinalEntry = UT_SC_SetupFullTable(&TailPtr, SC_RTS_HEADER_SIZE, MsgSize, SC_RTS_BUFF_SIZE32, TargetEndingWord,
+    FinalEntry = UT_SC_SetupFullTable(&TailPtr, SC_RTS_HEADER_SIZE, MsgSize, SC_RTS_MAX_SIZE32, TargetEndingWord,
                                       UT_SC_RtsEntryInit);
 
     /* Capture a pointer to the _end_ of the filled data -
@@ -306,6 +374,11 @@ void SC_LoadAts_Test_Nominal(void)
     SC_Assert_IDX_EQ(CmdOffsetRec->Offset, SC_ENTRY_OFFSET_FIRST);
     SC_Assert_CmdStatus(StatusEntryPtr->Status, SC_Status_LOADED);
     UtAssert_UINT32_EQ(AtsInfoPtr->NumberOfCommands, 1);
+    UtAssert_STUB_COUNT(SC_StopAtsStatusSummary, 1);
+
+    /* set up, parse and index are each timed once */
+    UtAssert_STUB_COUNT(SC_BeginPhase, 3);
+    UtAssert_STUB_COUNT(SC_EndPhase, 3);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
@@ -494,6 +567,54 @@ void SC_LoadAts_Test_LoadExactlyBufferLength(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
+void SC_LoadAts_Test_MaxCommands(void)
+{
+    SC_AtsIndex_t                 AtsIndex = SC_ATS_IDX_C(0);
+    SC_AtsInfoTable_t *           AtsInfoPtr;
+    SC_AtsCmdStatusEntry_t *      StatusEntryPtr;
+    SC_AtsCmdEntryOffsetRecord_t *CmdOffsetRec;
+    SC_CommandIndex_t             LastCmdIndex;
+    uint32                        EntryWords;
+    uint32                        ExpectedCount;
+
+    /*
+     * Fill the ATS with as many minimum size commands as the configuration allows.
+     * Built with the wide-config headers this is the scale test for command numbers
+     * and offsets beyond the 16 bit range.
+     */
+    EntryWords    = UT_SC_GetEntryWordCount(SC_ATS_HEADER_SIZE, SC_PACKET_MIN_SIZE);
+    ExpectedCount = SC_ATS_BUFF_SIZE32 / EntryWords;
+    if (ExpectedCount > SC_MAX_ATS_CMDS)
+    {
+        ExpectedCount = SC_MAX_ATS_CMDS;
+    }
+
+#if (SC_MAX_ATS_CMDS > 0xFFFF)
+    UtAssert_True(ExpectedCount > 0xFFFF, "ATS holds %lu commands, beyond the 16 bit range",
+                  (unsigned long)ExpectedCount);
+#endif
+
+    LastCmdIndex   = SC_COMMAND_IDX_C(ExpectedCount - 1);
+    CmdOffsetRec   = SC_GetAtsEntryOffsetForCmd(AtsIndex, LastCmdIndex);
+    StatusEntryPtr = SC_GetAtsStatusEntryForCommand(AtsIndex, LastCmdIndex);
+    AtsInfoPtr     = SC_GetAtsInfoObject(AtsIndex);
+
+    UT_SC_SetupAtsTable(AtsIndex, SC_PACKET_MIN_SIZE, 0, NULL);
+
+    /* Execute the function being tested */
+    SC_LoadAts(AtsIndex);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(AtsInfoPtr->NumberOfCommands, ExpectedCount);
+    UtAssert_UINT32_EQ(AtsInfoPtr->AtsSize, ExpectedCount * EntryWords);
+    SC_Assert_IDX_VALUE(CmdOffsetRec->Offset, (ExpectedCount - 1) * EntryWords);
+    SC_Assert_CmdStatus(StatusEntryPtr->Status, SC_Status_LOADED);
+    SC_Assert_ID_VALUE(SC_CommandIndexToNum(LastCmdIndex), ExpectedCount);
+    SC_Assert_ID_VALUE(SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_C(ExpectedCount - 1))->CmdNum,
+                       ExpectedCount);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void SC_LoadAts_Test_CmdNotEmpty(void)
 {
     void *                        TailPtr;
@@ -537,111 +658,320 @@ void SC_LoadAts_Test_InvalidIndex(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 }
 
-void SC_BuildTimeIndexTable_Test_InvalidIndex(void)
+void SC_BeginAtsLoad_Test_InvalidIndex(void)
 {
     SC_AtsIndex_t AtsIndex = SC_ATS_IDX_C(SC_NUMBER_OF_ATS);
 
-    /* Execute the function being tested */
-    SC_BuildTimeIndexTable(AtsIndex);
+    /* Pass in invalid index */
+    SC_BeginAtsLoad(AtsIndex);
 
     /* Verify results */
+    UtAssert_UINT8_EQ(SC_AppData.AtsLoadJob.Phase, SC_AtsLoadPhase_IDLE);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_BUILD_TIME_IDXTBL_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_LOADATS_INV_INDEX_ERR_EID);
 }
 
-void SC_Insert_Test(void)
+void SC_BeginAtsLoad_Test_QueuesOtherAts(void)
 {
-    SC_AtsIndex_t         AtsIndex    = SC_ATS_IDX_C(0);
-    uint8                 ListLength  = 1;
-    SC_CommandIndex_t     NewCmdIndex = SC_COMMAND_IDX_C(0);
-    SC_AtsCmdNumRecord_t *AtsCmdNumRec0;
-    SC_AtsCmdNumRecord_t *AtsCmdNumRec1;
+    SC_AtsIndex_t      AtsIndex0 = SC_ATS_IDX_C(0);
+    SC_AtsIndex_t      AtsIndex1 = SC_ATS_IDX_C(1);
+    SC_AtsInfoTable_t *AtsInfoPtr0;
+    SC_AtsInfoTable_t *AtsInfoPtr1;
 
-    AtsCmdNumRec0 = SC_GetAtsCommandNumAtSeq(AtsIndex, UT_SEQ_INDEX_0);
-    AtsCmdNumRec1 = SC_GetAtsCommandNumAtSeq(AtsIndex, UT_SEQ_INDEX_1);
+    AtsInfoPtr0 = SC_GetAtsInfoObject(AtsIndex0);
+    AtsInfoPtr1 = SC_GetAtsInfoObject(AtsIndex1);
 
-    AtsCmdNumRec0->CmdNum = SC_CommandIndexToNum(NewCmdIndex);
+    UT_SC_SetupSingleAtsEntry(AtsIndex0, 1, UT_SC_NOMINAL_CMD_SIZE);
+    UT_SC_SetupSingleAtsEntry(AtsIndex1, 1, UT_SC_NOMINAL_CMD_SIZE);
+
+    /* ATS 2 still describes its previous load */
+    AtsInfoPtr1->NumberOfCommands = 5;
+
+    SC_BeginAtsLoad(AtsIndex0);
 
     /* Execute the function being tested */
-    SC_Insert(AtsIndex, NewCmdIndex, ListLength);
+    SC_BeginAtsLoad(AtsIndex1);
 
     /* Verify results */
+    UtAssert_UINT8_EQ(SC_AppData.AtsLoadJob.Phase, SC_AtsLoadPhase_PARSE);
+    SC_Assert_IDX_EQ(SC_AppData.AtsLoadJob.AtsIndex, AtsIndex0);
+    UtAssert_BOOL_TRUE(SC_AppData.AtsLoadJob.Pending[1]);
+    UtAssert_ZERO(AtsInfoPtr0->NumberOfCommands);
+    UtAssert_ZERO(AtsInfoPtr1->NumberOfCommands);
+
+    /* The first ATS is finished before the queued one is started */
+    UtAssert_BOOL_TRUE(SC_ProcessAtsLoad(SC_MAX_ATS_CMDS));
+    UtAssert_UINT32_EQ(AtsInfoPtr0->NumberOfCommands, 1);
+    UtAssert_ZERO(AtsInfoPtr1->NumberOfCommands);
+
+    UtAssert_BOOL_TRUE(SC_ProcessAtsLoad(SC_MAX_ATS_CMDS));
+    UtAssert_UINT32_EQ(AtsInfoPtr1->NumberOfCommands, 1);
+    UtAssert_BOOL_FALSE(SC_AppData.AtsLoadJob.Pending[1]);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
-
-    SC_Assert_ID_EQ(AtsCmdNumRec1->CmdNum, AtsCmdNumRec0->CmdNum);
-    SC_Assert_ID_EQ(AtsCmdNumRec1->CmdNum, SC_CommandIndexToNum(NewCmdIndex));
 }
 
-void SC_Insert_Test_MiddleOfList(void)
+void SC_LoadAts_Test_RequeuesOtherAts(void)
 {
-    SC_AtsIndex_t         AtsIndex    = SC_ATS_IDX_C(0);
-    uint8                 ListLength  = 1;
-    SC_CommandIndex_t     NewCmdIndex = SC_COMMAND_IDX_C(0);
-    SC_AtsCmdNumRecord_t *AtsCmdNumRec0;
-    SC_AtsCmdNumRecord_t *AtsCmdNumRec1;
+    SC_AtsIndex_t      AtsIndex0 = SC_ATS_IDX_C(0);
+    SC_AtsIndex_t      AtsIndex1 = SC_ATS_IDX_C(1);
+    SC_AtsInfoTable_t *AtsInfoPtr0;
+    SC_AtsInfoTable_t *AtsInfoPtr1;
 
-    AtsCmdNumRec0 = SC_GetAtsCommandNumAtSeq(AtsIndex, UT_SEQ_INDEX_0);
-    AtsCmdNumRec1 = SC_GetAtsCommandNumAtSeq(AtsIndex, UT_SEQ_INDEX_1);
+    AtsInfoPtr0 = SC_GetAtsInfoObject(AtsIndex0);
+    AtsInfoPtr1 = SC_GetAtsInfoObject(AtsIndex1);
 
-    /* Set to cause SC_CompareAbsTime to return false, in order to reach block starting with
-      "new cmd will execute at same time or after this list entry" */
-    UT_SetDeferredRetcode(UT_KEY(SC_CompareAbsTime), 1, false);
+    UT_SC_SetupSingleAtsEntry(AtsIndex0, 1, UT_SC_NOMINAL_CMD_SIZE);
+    UT_SC_SetupSingleAtsEntry(AtsIndex1, 1, UT_SC_NOMINAL_CMD_SIZE);
 
-    AtsCmdNumRec0->CmdNum = SC_CommandIndexToNum(NewCmdIndex);
+    SC_BeginAtsLoad(AtsIndex0);
 
     /* Execute the function being tested */
-    SC_Insert(AtsIndex, NewCmdIndex, ListLength);
+    SC_LoadAts(AtsIndex1);
 
     /* Verify results */
+    UtAssert_UINT32_EQ(AtsInfoPtr1->NumberOfCommands, 1);
+    UtAssert_ZERO(AtsInfoPtr0->NumberOfCommands);
+    UtAssert_UINT8_EQ(SC_AppData.AtsLoadJob.Phase, SC_AtsLoadPhase_IDLE);
+    UtAssert_BOOL_TRUE(SC_AppData.AtsLoadJob.Pending[0]);
+
+    /* The interrupted ATS is activated again from the start */
+    UtAssert_BOOL_TRUE(SC_ProcessAtsLoad(SC_MAX_ATS_CMDS));
+    UtAssert_UINT32_EQ(AtsInfoPtr0->NumberOfCommands, 1);
+    UtAssert_BOOL_FALSE(SC_AppData.AtsLoadJob.Pending[0]);
+}
+
+void SC_ProcessAtsLoad_Test_Incremental(void)
+{
+    void *                  TailPtr;
+    SC_AtsIndex_t           AtsIndex = SC_ATS_IDX_C(0);
+    SC_AtsInfoTable_t *     AtsInfoPtr;
+    SC_AtsCmdStatusEntry_t *StatusEntryPtr;
+    uint32                  EntryWords;
+
+    AtsInfoPtr     = SC_GetAtsInfoObject(AtsIndex);
+    StatusEntryPtr = SC_GetAtsStatusEntryForCommand(AtsIndex, SC_COMMAND_IDX_C(0));
+    EntryWords     = UT_SC_GetEntryWordCount(SC_ATS_HEADER_SIZE, UT_SC_NOMINAL_CMD_SIZE);
+
+    TailPtr = UT_SC_GetAtsTable(AtsIndex);
+    UT_SC_AppendSingleAtsEntry(&TailPtr, 3, UT_SC_NOMINAL_CMD_SIZE);
+    UT_SC_AppendSingleAtsEntry(&TailPtr, 1, UT_SC_NOMINAL_CMD_SIZE);
+    UT_SC_AppendSingleAtsEntry(&TailPtr, 2, UT_SC_NOMINAL_CMD_SIZE);
+
+    SC_BeginAtsLoad(AtsIndex);
+    UtAssert_STUB_COUNT(SC_BeginPhase, 1);
+
+    /* Parse all three entries, but not the end of the load */
+    UtAssert_BOOL_FALSE(SC_ProcessAtsLoad(3));
+    UtAssert_STUB_COUNT(SC_BeginPhase, 2);
+    UtAssert_UINT8_EQ(SC_AppData.AtsLoadJob.Phase, SC_AtsLoadPhase_PARSE);
+    UtAssert_UINT32_EQ(SC_AppData.AtsLoadJob.CmdCount, 3);
+    SC_Assert_CmdStatus(StatusEntryPtr->Status, SC_Status_LOADED);
+    UtAssert_ZERO(AtsInfoPtr->NumberOfCommands);
+
+    /* Reach the end of the load */
+    UtAssert_BOOL_FALSE(SC_ProcessAtsLoad(1));
+    UtAssert_UINT8_EQ(SC_AppData.AtsLoadJob.Phase, SC_AtsLoadPhase_INDEX);
+    UtAssert_UINT32_EQ(AtsInfoPtr->AtsSize, 3 * EntryWords);
+    UtAssert_ZERO(AtsInfoPtr->NumberOfCommands);
+
+    /* Partially build the time index */
+    UtAssert_BOOL_FALSE(SC_ProcessAtsLoad(2));
+    UtAssert_UINT32_EQ(SC_AppData.AtsLoadJob.SortStep, 2);
+    UtAssert_ZERO(AtsInfoPtr->NumberOfCommands);
+
+    /* Finish the job */
+    UtAssert_BOOL_TRUE(SC_ProcessAtsLoad(SC_MAX_ATS_CMDS));
+    UtAssert_UINT8_EQ(SC_AppData.AtsLoadJob.Phase, SC_AtsLoadPhase_IDLE);
+    UtAssert_UINT32_EQ(AtsInfoPtr->NumberOfCommands, 3);
+    SC_Assert_ID_VALUE(SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_C(2))->CmdNum, 3);
+
+    /* Nothing more to do, and nothing is timed */
+    UtAssert_BOOL_TRUE(SC_ProcessAtsLoad(1));
+    UtAssert_STUB_COUNT(SC_BeginPhase, 5);
+    UtAssert_STUB_COUNT(SC_EndPhase, 5);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_ProcessAtsLoad_Test_PhaseTiming(void)
+{
+    SC_AtsIndex_t   AtsIndex = SC_ATS_IDX_C(0);
+    SC_Phase_Enum_t Phases[2];
+
+    UT_SC_SetupSingleAtsEntry(AtsIndex, 1, UT_SC_NOMINAL_CMD_SIZE);
 
-    SC_Assert_ID_EQ(AtsCmdNumRec1->CmdNum, AtsCmdNumRec0->CmdNum);
-    SC_Assert_ID_EQ(AtsCmdNumRec1->CmdNum, SC_CommandIndexToNum(NewCmdIndex));
+    SC_BeginAtsLoad(AtsIndex);
+    UT_ResetState(UT_KEY(SC_BeginPhase));
+    UT_SetHandlerFunction(UT_KEY(SC_BeginPhase), UT_SC_PhaseHandler, Phases);
+
+    /* Execute the function being tested, one call parses and then indexes */
+    UtAssert_BOOL_TRUE(SC_ProcessAtsLoad(SC_MAX_ATS_CMDS));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(SC_BeginPhase, 2);
+    UtAssert_INT32_EQ(Phases[0], SC_Phase_LOAD_ATS);
+    UtAssert_INT32_EQ(Phases[1], SC_Phase_BUILD_INDEX);
+    UtAssert_STUB_COUNT(SC_EndPhase, 3);
 }
 
-void SC_Insert_Test_MiddleOfListCompareAbsTimeTrue(void)
+void SC_ProcessAtsLoad_Test_SortsByTime(void)
 {
-    SC_AtsIndex_t         AtsIndex    = SC_ATS_IDX_C(0);
-    uint8                 ListLength  = 1;
-    SC_CommandIndex_t     NewCmdIndex = SC_COMMAND_IDX_C(0);
-    SC_AtsCmdNumRecord_t *AtsCmdNumRec0;
-    SC_AtsCmdNumRecord_t *AtsCmdNumRec1;
+    void *             TailPtr;
+    SC_AtsIndex_t      AtsIndex = SC_ATS_IDX_C(0);
+    SC_AtsInfoTable_t *AtsInfoPtr;
+    uint32             i;
 
-    AtsCmdNumRec0 = SC_GetAtsCommandNumAtSeq(AtsIndex, UT_SEQ_INDEX_0);
-    AtsCmdNumRec1 = SC_GetAtsCommandNumAtSeq(AtsIndex, UT_SEQ_INDEX_1);
+    /* Times in command number order, with a tie between commands 3 and 4 */
+    static const uint16 CmdTimes[]      = {70, 60, 50, 50, 30, 20, 10};
+    static const uint32 SortedCmdNums[] = {7, 6, 5, 3, 4, 2, 1};
 
-    /* Set to cause SC_CompareAbsTime to return false, in order to reach block starting with
-      "new cmd will execute at same time or after this list entry" */
-    UT_SetDeferredRetcode(UT_KEY(SC_CompareAbsTime), 1, true);
+    AtsInfoPtr = SC_GetAtsInfoObject(AtsIndex);
 
-    AtsCmdNumRec0->CmdNum = SC_CommandIndexToNum(NewCmdIndex);
+    UT_SC_SetAtsEntryTimes();
 
-    /* Execute the function being tested */
-    SC_Insert(AtsIndex, NewCmdIndex, ListLength);
+    TailPtr = UT_SC_GetAtsTable(AtsIndex);
+    for (i = 0; i < 7; i++)
+    {
+        UT_SC_AppendSingleAtsEntry(&TailPtr, i + 1, UT_SC_NOMINAL_CMD_SIZE)->TimeTag_LS = CmdTimes[i];
+    }
+
+    SC_BeginAtsLoad(AtsIndex);
+
+    /* Parse the seven entries and the end of the load */
+    UtAssert_BOOL_FALSE(SC_ProcessAtsLoad(8));
+    UtAssert_UINT8_EQ(SC_AppData.AtsLoadJob.Phase, SC_AtsLoadPhase_INDEX);
+
+    /* Sorting seven commands takes 7 / 2 + 7 - 1 steps */
+    UtAssert_BOOL_FALSE(SC_ProcessAtsLoad(8));
+    UtAssert_UINT32_EQ(SC_AppData.AtsLoadJob.SortStep, 8);
+    UtAssert_ZERO(AtsInfoPtr->NumberOfCommands);
+
+    UtAssert_BOOL_TRUE(SC_ProcessAtsLoad(1));
+    UtAssert_UINT32_EQ(SC_AppData.AtsLoadJob.SortStep, 9);
 
     /* Verify results */
+    UtAssert_UINT8_EQ(SC_AppData.AtsLoadJob.Phase, SC_AtsLoadPhase_IDLE);
+    UtAssert_UINT32_EQ(AtsInfoPtr->NumberOfCommands, 7);
+    for (i = 0; i < 7; i++)
+    {
+        SC_Assert_ID_VALUE(SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_C(i))->CmdNum, SortedCmdNums[i]);
+    }
+    SC_Assert_ID_EQ(SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_C(7))->CmdNum, SC_INVALID_CMD_NUMBER);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_ProcessAtsLoad_Test_ParseError(void)
+{
+    void *                        TailPtr;
+    SC_AtsIndex_t                 AtsIndex = SC_ATS_IDX_C(0);
+    SC_AtsInfoTable_t *           AtsInfoPtr;
+    SC_AtsCmdEntryOffsetRecord_t *CmdOffsetRec;
+
+    AtsInfoPtr   = SC_GetAtsInfoObject(AtsIndex);
+    CmdOffsetRec = SC_GetAtsEntryOffsetForCmd(AtsIndex, SC_COMMAND_IDX_C(0));
 
-    SC_Assert_ID_EQ(AtsCmdNumRec1->CmdNum, AtsCmdNumRec0->CmdNum);
-    SC_Assert_ID_EQ(AtsCmdNumRec1->CmdNum, SC_CommandIndexToNum(NewCmdIndex));
+    /* Second entry is a duplicate command number */
+    TailPtr = UT_SC_GetAtsTable(AtsIndex);
+    UT_SC_AppendSingleAtsEntry(&TailPtr, 1, UT_SC_NOMINAL_CMD_SIZE);
+    UT_SC_AppendSingleAtsEntry(&TailPtr, 1, UT_SC_NOMINAL_CMD_SIZE);
+
+    SC_BeginAtsLoad(AtsIndex);
+
+    UtAssert_BOOL_FALSE(SC_ProcessAtsLoad(1));
+    SC_Assert_IDX_EQ(CmdOffsetRec->Offset, SC_ENTRY_OFFSET_FIRST);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(SC_ProcessAtsLoad(1));
+
+    /* Verify results */
+    UtAssert_UINT8_EQ(SC_AppData.AtsLoadJob.Phase, SC_AtsLoadPhase_IDLE);
+    SC_Assert_IDX_EQ(CmdOffsetRec->Offset, SC_ENTRY_OFFSET_INVALID);
+    UtAssert_ZERO(AtsInfoPtr->NumberOfCommands);
+    UtAssert_ZERO(AtsInfoPtr->AtsSize);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void SC_Insert_Test_InvalidIndex(void)
+void SC_BuildTimeIndexTable_Test_InvalidIndex(void)
 {
-    SC_AtsIndex_t     AtsIndex    = SC_ATS_IDX_C(SC_NUMBER_OF_ATS);
-    uint8             ListLength  = 1;
-    SC_CommandIndex_t NewCmdIndex = SC_COMMAND_IDX_C(0);
+    SC_AtsIndex_t AtsIndex = SC_ATS_IDX_C(SC_NUMBER_OF_ATS);
 
     /* Execute the function being tested */
-    SC_Insert(AtsIndex, NewCmdIndex, ListLength);
+    SC_BuildTimeIndexTable(AtsIndex);
 
     /* Verify results */
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_INSERTATS_INV_INDEX_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_BUILD_TIME_IDXTBL_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 }
 
+void SC_BuildTimeIndexTable_Test_SortsByTime(void)
+{
+    SC_AtsIndex_t AtsIndex = SC_ATS_IDX_C(0);
+    uint32        i;
+
+    /* Command 5 is not loaded, so the list holds the other five */
+    static const uint16 CmdTimes[]      = {40, 30, 40, 10, 0, 20};
+    static const uint32 SortedCmdNums[] = {4, 6, 2, 1, 3};
+
+    UT_SC_SetAtsEntryTimes();
+    SC_InitAtsTables(AtsIndex);
+
+    for (i = 0; i < 6; i++)
+    {
+        if (CmdTimes[i] != 0)
+        {
+            SC_GetAtsEntryOffsetForCmd(AtsIndex, SC_COMMAND_IDX_C(i))->Offset = SC_ENTRY_OFFSET_C(i * 64);
+            SC_GetAtsEntryAtOffset(AtsIndex, SC_ENTRY_OFFSET_C(i * 64))->Header.TimeTag_LS = CmdTimes[i];
+        }
+    }
+
+    /* Leftover entry from an earlier index */
+    SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_C(5))->CmdNum = SC_COMMAND_NUM_C(9);
+
+    /* Execute the function being tested */
+    SC_BuildTimeIndexTable(AtsIndex);
+
+    /* Verify results */
+    for (i = 0; i < 5; i++)
+    {
+        SC_Assert_ID_VALUE(SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_C(i))->CmdNum, SortedCmdNums[i]);
+    }
+    SC_Assert_ID_EQ(SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_C(5))->CmdNum, SC_INVALID_CMD_NUMBER);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_SortAtsTimeIndexStep_Test_PastEnd(void)
+{
+    SC_AtsIndex_t AtsIndex = SC_ATS_IDX_C(0);
+
+    SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_C(0))->CmdNum = SC_COMMAND_NUM_C(2);
+    SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_C(1))->CmdNum = SC_COMMAND_NUM_C(1);
+
+    /* Two commands are sorted by steps 0 and 1 */
+    UtAssert_VOIDCALL(SC_SortAtsTimeIndexStep(AtsIndex, 2, 3));
+
+    /* Verify results */
+    SC_Assert_ID_VALUE(SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_C(0))->CmdNum, 2);
+    SC_Assert_ID_VALUE(SC_GetAtsCommandNumAtSeq(AtsIndex, SC_SEQUENCE_IDX_C(1))->CmdNum, 1);
+    UtAssert_STUB_COUNT(SC_CompareAbsTime, 0);
+}
+
+void SC_AtsCmdIsLater_Test(void)
+{
+    SC_AtsIndex_t AtsIndex = SC_ATS_IDX_C(0);
+
+    /* Same times, so the command number decides */
+    UtAssert_BOOL_TRUE(SC_AtsCmdIsLater(AtsIndex, SC_COMMAND_NUM_C(2), SC_COMMAND_NUM_C(1)));
+    UtAssert_BOOL_FALSE(SC_AtsCmdIsLater(AtsIndex, SC_COMMAND_NUM_C(1), SC_COMMAND_NUM_C(2)));
+
+    /* Later time */
+    UT_SetDeferredRetcode(UT_KEY(SC_CompareAbsTime), 1, true);
+    UtAssert_BOOL_TRUE(SC_AtsCmdIsLater(AtsIndex, SC_COMMAND_NUM_C(1), SC_COMMAND_NUM_C(2)));
+
+    /* Earlier time */
+    UT_SetDeferredRetcode(UT_KEY(SC_CompareAbsTime), 2, true);
+    UtAssert_BOOL_FALSE(SC_AtsCmdIsLater(AtsIndex, SC_COMMAND_NUM_C(2), SC_COMMAND_NUM_C(1)));
+}
+
 void SC_InitAtsTables_Test_InvalidIndex(void)
 {
     SC_AtsIndex_t AtsIndex = SC_ATS_IDX_C(SC_NUMBER_OF_ATS);
@@ -731,10 +1061,112 @@ void SC_LoadRts_Test_Nominal(void)
     /* Execute the function being tested */
     SC_LoadRts(RtsIndex);
 
+    /* Verify results, an empty RTS only needs its end marker */
+    UtAssert_INT32_EQ(SC_GetRtsInfoObject(RtsIndex)->RtsStatus, SC_Status_LOADED);
+    UtAssert_UINT32_EQ(SC_GetRtsSize(RtsIndex), SC_RTS_HDR_WORDS);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_LoadRts_Test_CopyToPool(void)
+{
+    SC_RtsIndex_t        RtsIndex = SC_RTS_IDX_C(1);
+    SC_RtsEntryHeader_t *Entry;
+    void *               TailPtr;
+    uint32               EntryWords = UT_SC_GetEntryWordCount(SC_RTS_HEADER_SIZE, SC_PACKET_MIN_SIZE);
+
+    UT_SC_SetMsgId(SC_UT_MID_1);
+    TailPtr = UT_SC_GetRtsTable(RtsIndex);
+    UT_SC_AppendSingleRtsEntry(&TailPtr, 1, SC_PACKET_MIN_SIZE);
+    UT_SC_AppendSingleRtsEntry(&TailPtr, 2, SC_PACKET_MIN_SIZE);
+
+    /* Execute the function being tested */
+    SC_LoadRts(RtsIndex);
+
     /* Verify results */
+    UtAssert_INT32_EQ(SC_GetRtsInfoObject(RtsIndex)->RtsStatus, SC_Status_LOADED);
+    UtAssert_UINT32_EQ(SC_GetRtsSize(RtsIndex), (2 * EntryWords) + SC_RTS_HDR_WORDS);
+
+    Entry = &SC_GetRtsEntryAtOffset(RtsIndex, SC_ENTRY_OFFSET_C(EntryWords))->Header;
+    UtAssert_UINT32_EQ(Entry->WakeupCount, 2);
+    UtAssert_MemCmpValue(SC_GetRtsEntryAtOffset(RtsIndex, SC_ENTRY_OFFSET_C(2 * EntryWords)), 0,
+                         SC_RTS_HDR_WORDS * SC_BYTES_IN_WORD, "RTS end marker is empty");
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
+void SC_LoadRts_Test_PoolFull(void)
+{
+    SC_RtsIndex_t RtsIndex = SC_RTS_IDX_C(0);
+
+    /* every other RTS holds a full size block, so a full RTS plus its end marker can't fit */
+    memset(SC_AppData.RtsPoolBlock, 0, sizeof(SC_AppData.RtsPoolBlock));
+    SC_AppData.RtsPoolBlock[1].Offset = SC_RTS_BUFF_SIZE32;
+    SC_AppData.RtsPoolBlock[1].Size   = SC_RTS_POOL_SIZE32 - SC_RTS_BUFF_SIZE32;
+
+    UT_SC_SetupRtsTable(RtsIndex, SC_UT_MID_1, UT_SC_NOMINAL_CMD_SIZE, SC_RTS_BUFF_SIZE32, NULL);
+
+    /* Execute the function being tested */
+    SC_LoadRts(RtsIndex);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(SC_GetRtsInfoObject(RtsIndex)->RtsStatus, SC_Status_EMPTY);
+    UtAssert_ZERO(SC_GetRtsSize(RtsIndex));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_LOADRTS_POOL_FULL_ERR_EID);
+}
+
+void SC_LoadRts_Test_StopsInstances(void)
+{
+    SC_RtsIndex_t RtsIndex = SC_RTS_IDX_C(0);
+
+    UT_SC_SetMsgId(CFE_SB_INVALID_MSG_ID);
+    UT_SC_GetRtsTable(RtsIndex);
+
+    /* the slot being loaded is itself running another RTS as an instance */
+    SC_GetRtsInfoObject(RtsIndex)->RtsStatus    = SC_Status_EXECUTING;
+    SC_GetRtsInfoObject(RtsIndex)->SourceRtsNum = SC_RTS_NUM_C(2);
+
+    /* Execute the function being tested */
+    SC_LoadRts(RtsIndex);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(SC_KillRtsInstances, 1);
+    UtAssert_STUB_COUNT(SC_KillRts, 1);
+    UtAssert_INT32_EQ(SC_GetRtsInfoObject(RtsIndex)->RtsStatus, SC_Status_LOADED);
+}
+
+static uint32 UT_SC_KilledPoolBlockSize;
+
+static void UT_SC_KillRtsHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    SC_RtsIndex_t RtsIndex = UT_Hook_GetArgValueByName(Context, "RtsIndex", SC_RtsIndex_t);
+
+    UT_SC_KilledPoolBlockSize = SC_AppData.RtsPoolBlock[SC_IDX_AS_UINT(RtsIndex)].Size;
+}
+
+void SC_LoadRts_Test_StopsRunningRts(void)
+{
+    SC_RtsIndex_t RtsIndex = SC_RTS_IDX_C(0);
+
+    UT_SC_SetMsgId(CFE_SB_INVALID_MSG_ID);
+    UT_SC_GetRtsTable(RtsIndex);
+
+    /* the RTS being reloaded is running its old commands, with RTS 2 waiting on it */
+    SC_AppData.RtsPoolBlock[0].Size             = SC_RTS_HDR_WORDS + 1;
+    SC_GetRtsInfoObject(RtsIndex)->RtsStatus    = SC_Status_EXECUTING;
+    SC_GetRtsInfoObject(RtsIndex)->CallerRtsNum = SC_RTS_NUM_C(2);
+
+    UT_SC_KilledPoolBlockSize = 0;
+    UT_SetHandlerFunction(UT_KEY(SC_KillRts), UT_SC_KillRtsHandler, NULL);
+
+    /* Execute the function being tested */
+    SC_LoadRts(RtsIndex);
+
+    /* Verify results: stopped while its old commands were still in the pool */
+    UtAssert_STUB_COUNT(SC_KillRts, 1);
+    UtAssert_UINT32_EQ(UT_SC_KilledPoolBlockSize, SC_RTS_HDR_WORDS + 1);
+    UtAssert_UINT32_EQ(SC_GetRtsSize(RtsIndex), SC_RTS_HDR_WORDS);
+}
+
 void SC_LoadRts_Test_InvalidIndex(void)
 {
     SC_RtsIndex_t RtsIndex = SC_RTS_IDX_C(SC_NUMBER_OF_RTS);
@@ -748,6 +1180,106 @@ void SC_LoadRts_Test_InvalidIndex(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 }
 
+void SC_GetRtsLength_Test_FullTable(void)
+{
+    SC_RtsIndex_t RtsIndex = SC_RTS_IDX_C(0);
+
+    UT_SC_SetupRtsTable(RtsIndex, SC_UT_MID_1, UT_SC_NOMINAL_CMD_SIZE, SC_RTS_MAX_SIZE32, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(SC_GetRtsLength(UT_SC_GetRtsTable(RtsIndex)), SC_RTS_MAX_SIZE32);
+}
+
+void SC_AllocRtsBlock_Test_FirstFit(void)
+{
+    SC_RtsIndex_t RtsIndex = SC_RTS_IDX_C(0);
+
+    memset(SC_AppData.RtsPoolBlock, 0, sizeof(SC_AppData.RtsPoolBlock));
+    SC_AppData.RtsPoolBlock[1].Offset = 0;
+    SC_AppData.RtsPoolBlock[1].Size   = 10;
+    SC_AppData.RtsPoolBlock[2].Offset = 20;
+    SC_AppData.RtsPoolBlock[2].Size   = 10;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(SC_AllocRtsBlock(RtsIndex, 10));
+
+    /* Verify results, the hole between the blocks is used */
+    UtAssert_UINT32_EQ(SC_AppData.RtsPoolBlock[0].Offset, 10);
+    UtAssert_UINT32_EQ(SC_AppData.RtsPoolBlock[0].Size, 10);
+    UtAssert_UINT32_EQ(SC_AppData.RtsPoolFreeWords, SC_RTS_POOL_SIZE32 - 30);
+    UtAssert_UINT32_EQ(SC_AppData.RtsPoolLargestFree, SC_RTS_POOL_SIZE32 - 30);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_AllocRtsBlock_Test_Compact(void)
+{
+    SC_RtsIndex_t RtsIndex = SC_RTS_IDX_C(0);
+
+    memset(SC_AppData.RtsPoolBlock, 0, sizeof(SC_AppData.RtsPoolBlock));
+    SC_AppData.RtsPoolBlock[1].Offset = 10;
+    SC_AppData.RtsPoolBlock[1].Size   = SC_RTS_POOL_SIZE32 - 20;
+    SC_AppData.RtsPool[10]            = 0x12345678;
+
+    /* Execute the function being tested, the two free regions are 10 words each */
+    UtAssert_BOOL_TRUE(SC_AllocRtsBlock(RtsIndex, 15));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(SC_AppData.RtsPoolBlock[1].Offset, 0);
+    UtAssert_UINT32_EQ(SC_AppData.RtsPool[0], 0x12345678);
+    UtAssert_UINT32_EQ(SC_AppData.RtsPoolBlock[0].Offset, SC_RTS_POOL_SIZE32 - 20);
+    UtAssert_UINT32_EQ(SC_AppData.RtsPoolFreeWords, 5);
+    UtAssert_UINT32_EQ(SC_AppData.RtsPoolLargestFree, 5);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTS_POOL_COMPACT_DBG_EID);
+}
+
+void SC_AllocRtsBlock_Test_NoSpace(void)
+{
+    SC_RtsIndex_t RtsIndex = SC_RTS_IDX_C(0);
+
+    /* the RTS's own old block is released before allocating */
+    memset(SC_AppData.RtsPoolBlock, 0, sizeof(SC_AppData.RtsPoolBlock));
+    SC_AppData.RtsPoolBlock[0].Offset = 0;
+    SC_AppData.RtsPoolBlock[0].Size   = 10;
+    SC_AppData.RtsPoolBlock[1].Offset = 10;
+    SC_AppData.RtsPoolBlock[1].Size   = SC_RTS_POOL_SIZE32 - 20;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(SC_AllocRtsBlock(RtsIndex, 21));
+
+    /* Verify results */
+    UtAssert_ZERO(SC_AppData.RtsPoolBlock[0].Size);
+    UtAssert_UINT32_EQ(SC_AppData.RtsPoolFreeWords, 20);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_FindRtsPoolGap_Test_NoFit(void)
+{
+    memset(SC_AppData.RtsPoolBlock, 0, sizeof(SC_AppData.RtsPoolBlock));
+    SC_AppData.RtsPoolBlock[3].Offset = 5;
+    SC_AppData.RtsPoolBlock[3].Size   = SC_RTS_POOL_SIZE32 - 10;
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(SC_FindRtsPoolGap(5), 0);
+    UtAssert_UINT32_EQ(SC_FindRtsPoolGap(6), SC_RTS_POOL_SIZE32);
+}
+
+void SC_UpdateRtsPoolStats_Test_Fragmented(void)
+{
+    memset(SC_AppData.RtsPoolBlock, 0, sizeof(SC_AppData.RtsPoolBlock));
+    SC_AppData.RtsPoolBlock[5].Offset = 30;
+    SC_AppData.RtsPoolBlock[5].Size   = SC_RTS_POOL_SIZE32 - 30;
+    SC_AppData.RtsPoolBlock[2].Offset = 10;
+    SC_AppData.RtsPoolBlock[2].Size   = 12;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_UpdateRtsPoolStats());
+
+    /* Verify results, the free regions are 10 and 8 words */
+    UtAssert_UINT32_EQ(SC_AppData.RtsPoolFreeWords, 18);
+    UtAssert_UINT32_EQ(SC_AppData.RtsPoolLargestFree, 10);
+}
+
 void SC_ParseRts_Test_EndOfFile(void)
 {
     SC_RtsIndex_t RtsIndex = SC_RTS_IDX_C(0);
@@ -826,7 +1358,7 @@ void SC_ParseRts_Test_CmdRunsOffEndOfBuffer(void)
     TablePtr = UT_SC_GetRtsTable(RtsIndex);
 
     /* Set up -- Modify the final entry so it would go off the end of the table */
-    UT_SC_SetupRtsTable(RtsIndex, SC_UT_MID_1, UT_SC_NOMINAL_CMD_SIZE, SC_RTS_BUFF_SIZE32 + 1, NULL);
+    UT_SC_SetupRtsTable(RtsIndex, SC_UT_MID_1, UT_SC_NOMINAL_CMD_SIZE, SC_RTS_MAX_SIZE32 + 1, NULL);
 
     /* Execute the function being tested */
     UtAssert_BOOL_FALSE(SC_ParseRts(TablePtr));
@@ -844,7 +1376,7 @@ void SC_ParseRts_Test_CmdLengthEqualsBufferLength(void)
 
     TablePtr = UT_SC_GetRtsTable(RtsIndex);
 
-    UT_SC_SetupRtsTable(RtsIndex, SC_UT_MID_1, UT_SC_NOMINAL_CMD_SIZE, SC_RTS_BUFF_SIZE32, NULL);
+    UT_SC_SetupRtsTable(RtsIndex, SC_UT_MID_1, UT_SC_NOMINAL_CMD_SIZE, SC_RTS_MAX_SIZE32, NULL);
 
     /* Execute the function being tested */
     UtAssert_BOOL_TRUE(SC_ParseRts(TablePtr));
@@ -860,7 +1392,7 @@ void SC_ParseRts_Test_CmdDoesNotFitBufferEmpty(void)
 
     TablePtr = UT_SC_GetRtsTable(RtsIndex);
 
-    UT_SC_SetupRtsTable(RtsIndex, SC_UT_MID_1, UT_SC_NOMINAL_CMD_SIZE, SC_RTS_BUFF_SIZE32 - 1, NULL);
+    UT_SC_SetupRtsTable(RtsIndex, SC_UT_MID_1, UT_SC_NOMINAL_CMD_SIZE, SC_RTS_MAX_SIZE32 - 1, NULL);
 
     /* Execute the function being tested */
     UtAssert_BOOL_TRUE(SC_ParseRts(TablePtr));
@@ -876,7 +1408,7 @@ void SC_ParseRts_Test_CmdDoesNotFitBufferNotEmpty(void)
 
     TablePtr = UT_SC_GetRtsTable(RtsIndex);
 
-    UT_SC_SetupRtsTable(RtsIndex, SC_UT_MID_1, UT_SC_NOMINAL_CMD_SIZE, SC_RTS_BUFF_SIZE32 - 1, &TailPtr);
+    UT_SC_SetupRtsTable(RtsIndex, SC_UT_MID_1, UT_SC_NOMINAL_CMD_SIZE, SC_RTS_MAX_SIZE32 - 1, &TailPtr);
 
     /* Add some nonzero data at the tail end */
     *((uint32 *)TailPtr) = 0xFFFFFFFF;
@@ -889,6 +1421,24 @@ void SC_ParseRts_Test_CmdDoesNotFitBufferNotEmpty(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 }
 
+void SC_ParseRts_Test_InvalidLocalCmd(void)
+{
+    SC_RtsIndex_t RtsIndex = SC_RTS_IDX_C(0);
+    void *        TablePtr;
+
+    TablePtr = UT_SC_GetRtsTable(RtsIndex);
+
+    UT_SC_SetupSingleRtsEntry(RtsIndex, CFE_SB_ValueToMsgId(SC_CMD_MID), 1, UT_SC_NOMINAL_CMD_SIZE);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(SC_ParseRts(TablePtr));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTS_LOCAL_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
 void SC_UpdateAppend_Test_Nominal(void)
 {
     void *TailPtr;
@@ -1038,6 +1588,98 @@ void SC_UpdateAppend_Test_CmdNumberTooHigh(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
 }
 
+void SC_ValidateTriggers_Test_Nominal(void)
+{
+    SC_OperData.TriggerTblAddr[0].MsgId       = 0x1880;
+    SC_OperData.TriggerTblAddr[0].RtsNum      = SC_RTS_NUM_C(1);
+    SC_OperData.TriggerTblAddr[1].MsgId       = 0x0881;
+    SC_OperData.TriggerTblAddr[1].RtsNum      = SC_RTS_NUM_C(SC_NUMBER_OF_RTS);
+    SC_OperData.TriggerTblAddr[1].MatchSize   = sizeof(uint16);
+    SC_OperData.TriggerTblAddr[1].MatchOffset = 12;
+
+    /* entries with no message ID are not checked */
+    SC_OperData.TriggerTblAddr[2].RtsNum = SC_RTS_NUM_C(SC_NUMBER_OF_RTS + 1);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(SC_ValidateTriggers(SC_OperData.TriggerTblAddr), CFE_SUCCESS);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_ValidateTriggers_Test_Invalid(void)
+{
+    /* invalid RTS number */
+    SC_OperData.TriggerTblAddr[0].MsgId  = 0x1880;
+    SC_OperData.TriggerTblAddr[0].RtsNum = SC_RTS_NUM_C(SC_NUMBER_OF_RTS + 1);
+    UtAssert_INT32_EQ(SC_ValidateTriggers(SC_OperData.TriggerTblAddr), SC_ERROR);
+
+    /* invalid match size */
+    SC_OperData.TriggerTblAddr[0].RtsNum    = SC_RTS_NUM_C(1);
+    SC_OperData.TriggerTblAddr[0].MatchSize = 3;
+    UtAssert_INT32_EQ(SC_ValidateTriggers(SC_OperData.TriggerTblAddr), SC_ERROR);
+
+    /* field past the largest message */
+    SC_OperData.TriggerTblAddr[0].MatchSize   = sizeof(uint32);
+    SC_OperData.TriggerTblAddr[0].MatchOffset = CFE_MISSION_SB_MAX_SB_MSG_SIZE - 2;
+    UtAssert_INT32_EQ(SC_ValidateTriggers(SC_OperData.TriggerTblAddr), SC_ERROR);
+
+    /* SC inputs are never triggers */
+    SC_OperData.TriggerTblAddr[0].MatchOffset = 0;
+    SC_OperData.TriggerTblAddr[0].MsgId       = SC_WAKEUP_MID;
+    UtAssert_INT32_EQ(SC_ValidateTriggers(SC_OperData.TriggerTblAddr), SC_ERROR);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 4);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[3].EventID, SC_TRIGGER_TBL_VERIFY_ERR_EID);
+}
+
+void SC_UpdateTriggers_Test_Nominal(void)
+{
+    /* two triggers share a message ID */
+    SC_OperData.TriggerTblAddr[0].MsgId  = 0x1880;
+    SC_OperData.TriggerTblAddr[0].RtsNum = SC_RTS_NUM_C(1);
+    SC_OperData.TriggerTblAddr[1].MsgId  = 0x1880;
+    SC_OperData.TriggerTblAddr[1].RtsNum = SC_RTS_NUM_C(2);
+    SC_OperData.TriggerTblAddr[3].MsgId  = 0x0881;
+    SC_OperData.TriggerTblAddr[3].RtsNum = SC_RTS_NUM_C(3);
+
+    /* the previous table named another message ID */
+    SC_AppData.TriggerMsgId[0]   = CFE_SB_ValueToMsgId(0x0882);
+    SC_AppData.TriggerMsgIdCount = 1;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_UpdateTriggers());
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_Unsubscribe, 1);
+    UtAssert_STUB_COUNT(CFE_SB_Subscribe, 2);
+    UtAssert_UINT32_EQ(SC_AppData.TriggerMsgIdCount, 2);
+    UtAssert_UINT32_EQ(CFE_SB_MsgIdToValue(SC_AppData.TriggerMsgId[0]), 0x1880);
+    UtAssert_UINT32_EQ(CFE_SB_MsgIdToValue(SC_AppData.TriggerMsgId[1]), 0x0881);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_UPDATE_TRIGGER_INF_EID);
+}
+
+void SC_UpdateTriggers_Test_SubscribeError(void)
+{
+    SC_OperData.TriggerTblAddr[0].MsgId  = 0x1880;
+    SC_OperData.TriggerTblAddr[0].RtsNum = SC_RTS_NUM_C(1);
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_Subscribe), 1, -1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_UpdateTriggers());
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(SC_AppData.TriggerMsgIdCount, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_TRIGGER_SUBSCRIBE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, SC_UPDATE_TRIGGER_INF_EID);
+}
+
 void SC_ProcessAppend_Test(void)
 {
     SC_AtsIndex_t                 AtsIndex = SC_ATS_IDX_C(0);
@@ -1070,10 +1712,12 @@ void SC_ProcessAppend_Test(void)
 
     /* Verify results */
     UtAssert_UINT32_EQ(AtsInfoPtr->AtsSize, 1);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.AtpFreeBytes[0], (SC_ATS_BUFF_SIZE32 - 1) * SC_BYTES_IN_WORD);
     UtAssert_UINT32_EQ(AtsInfoPtr->NumberOfCommands, 1);
     SC_Assert_IDX_EQ(CmdOffsetRec->Offset, SC_ENTRY_OFFSET_FIRST);
     SC_Assert_CmdStatus(StatusEntryPtr->Status, SC_Status_LOADED);
     SC_Assert_CmdStatus(SC_OperData.AtsCtrlBlckAddr->AtpState, SC_Status_EXECUTING);
+    UtAssert_STUB_COUNT(SC_StopAtsStatusSummary, 1);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
@@ -1256,6 +1900,10 @@ void SC_VerifyAtsTable_Test_Nominal(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_VERIFY_ATS_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_STUB_COUNT(SC_BeginPhase, 1);
+    UtAssert_STUB_COUNT(SC_EndPhase, 1);
+    UtAssert_UINT32_EQ(SC_OperData.DiagPacket.Payload.Forecast.NumCmds, 1);
+    UtAssert_UINT32_EQ(SC_OperData.DiagPacket.Payload.Forecast.PeakCmds, 1);
 
     /* Test element 1.  Note: element 0 is modified in call to SC_VerifyAtsEntry and so it does not need to be verified
      * in this test */
@@ -1302,6 +1950,119 @@ void SC_VerifyAtsTable_Test_EmptyTable(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 }
 
+void SC_ForecastAtsLoad_Test_Nominal(void)
+{
+    SC_LoadForecast_t *Forecast = &SC_OperData.DiagPacket.Payload.Forecast;
+    uint32             i;
+
+    /* Half of capacity in each of seconds 10 and 20, given out of order */
+    for (i = 0; i < SC_MAX_CMDS_PER_WAKEUP * SC_WAKEUPS_PER_SECOND; i++)
+    {
+        SC_OperData.ForecastTimes[i] = 20 - (i % 2) * 10;
+    }
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(SC_ForecastAtsLoad(i));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(SC_OperData.ForecastTimes[0], 10);
+    UtAssert_UINT32_EQ(SC_OperData.ForecastTimes[i - 1], 20);
+    UtAssert_UINT32_EQ(Forecast->NumCmds, i);
+    UtAssert_UINT32_EQ(Forecast->Capacity, SC_MAX_CMDS_PER_WAKEUP * SC_WAKEUPS_PER_SECOND);
+    UtAssert_UINT32_EQ(Forecast->PeakCmds, (i + 1) / 2);
+    UtAssert_ZERO(Forecast->NumOverloaded);
+    UtAssert_ZERO(Forecast->Window[0].NumCmds);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_ForecastAtsLoad_Test_Overloaded(void)
+{
+    SC_LoadForecast_t *Forecast = &SC_OperData.DiagPacket.Payload.Forecast;
+    uint32             Capacity = SC_MAX_CMDS_PER_WAKEUP * SC_WAKEUPS_PER_SECOND;
+    uint32             NumCmds  = 0;
+    uint32             i;
+
+    /* Seconds 5 and 30 just over capacity, second 9 well over, second 7 under */
+    for (i = 0; i <= Capacity; i++)
+    {
+        SC_OperData.ForecastTimes[NumCmds++] = 30;
+        SC_OperData.ForecastTimes[NumCmds++] = 5;
+        SC_OperData.ForecastTimes[NumCmds++] = 9;
+        SC_OperData.ForecastTimes[NumCmds++] = 9;
+    }
+
+    SC_OperData.ForecastTimes[NumCmds++] = 7;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(SC_ForecastAtsLoad(NumCmds));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Forecast->NumCmds, NumCmds);
+    UtAssert_UINT32_EQ(Forecast->PeakCmds, 2 * (Capacity + 1));
+    UtAssert_UINT32_EQ(Forecast->NumOverloaded, 3);
+    UtAssert_UINT32_EQ(Forecast->Window[0].TimeTag, 9);
+    UtAssert_UINT32_EQ(Forecast->Window[0].NumCmds, 2 * (Capacity + 1));
+
+    if (SC_FORECAST_WINDOWS >= 3)
+    {
+        UtAssert_UINT32_EQ(Forecast->Window[1].TimeTag, 5);
+        UtAssert_UINT32_EQ(Forecast->Window[1].NumCmds, Capacity + 1);
+        UtAssert_UINT32_EQ(Forecast->Window[2].TimeTag, 30);
+        UtAssert_UINT32_EQ(Forecast->Window[2].NumCmds, Capacity + 1);
+    }
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_VERIFY_ATS_LOAD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void SC_ForecastAtsLoad_Test_ReverseOrder(void)
+{
+    SC_LoadForecast_t *Forecast = &SC_OperData.DiagPacket.Payload.Forecast;
+    uint32             i;
+
+    /* A full table in reverse time order, pairs of commands in each second */
+    for (i = 0; i < SC_MAX_ATS_CMDS; i++)
+    {
+        SC_OperData.ForecastTimes[i] = (SC_MAX_ATS_CMDS - i) / 2;
+    }
+
+    /* Execute the function being tested */
+    SC_ForecastAtsLoad(SC_MAX_ATS_CMDS);
+
+    /* Verify results */
+    for (i = 1; i < SC_MAX_ATS_CMDS; i++)
+    {
+        UtAssert_True(SC_OperData.ForecastTimes[i - 1] <= SC_OperData.ForecastTimes[i], "Time tag %u is in order",
+                      (unsigned int)i);
+    }
+
+    UtAssert_UINT32_EQ(Forecast->NumCmds, SC_MAX_ATS_CMDS);
+    UtAssert_UINT32_EQ(Forecast->PeakCmds, 2);
+}
+
+void SC_SiftForecastTimes_Test(void)
+{
+    /* Only the root is out of place in the heap */
+    SC_OperData.ForecastTimes[0] = 1;
+    SC_OperData.ForecastTimes[1] = 5;
+    SC_OperData.ForecastTimes[2] = 4;
+    SC_OperData.ForecastTimes[3] = 3;
+    SC_OperData.ForecastTimes[4] = 2;
+    SC_OperData.ForecastTimes[5] = 9;
+
+    /* Execute the function being tested, the last time tag is not in the heap */
+    SC_SiftForecastTimes(0, 5);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(SC_OperData.ForecastTimes[0], 5);
+    UtAssert_UINT32_EQ(SC_OperData.ForecastTimes[1], 3);
+    UtAssert_UINT32_EQ(SC_OperData.ForecastTimes[2], 4);
+    UtAssert_UINT32_EQ(SC_OperData.ForecastTimes[3], 1);
+    UtAssert_UINT32_EQ(SC_OperData.ForecastTimes[4], 2);
+    UtAssert_UINT32_EQ(SC_OperData.ForecastTimes[5], 9);
+}
+
 void SC_VerifyAtsEntry_Test_Nominal(void)
 {
     SC_AtsIndex_t AtsIndex = SC_ATS_IDX_C(0);
@@ -1449,6 +2210,260 @@ void SC_VerifyAtsEntry_Test_DuplicateCmdNumber(void)
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 }
 
+void SC_VerifyAtsEntry_Test_InvalidLocalCmd(void)
+{
+    SC_AtsIndex_t AtsIndex = SC_ATS_IDX_C(0);
+    void *        TablePtr;
+
+    TablePtr = UT_SC_GetAtsTable(AtsIndex);
+
+    UT_SC_SetupSingleAtsEntry(AtsIndex, 1, UT_SC_NOMINAL_CMD_SIZE);
+    UT_SC_SetMsgId(CFE_SB_ValueToMsgId(SC_CMD_MID));
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(SC_VerifyAtsEntry(TablePtr, 0, SC_ATS_BUFF_SIZE), SC_ERROR);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_VERIFY_ATS_LOCAL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void SC_VerifyLocalCmd_Test_NotForSc(void)
+{
+    SC_NoopCmd_t CmdPacket;
+
+    UT_SC_SetMsgId(SC_UT_MID_1);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(SC_VerifyLocalCmd(CFE_MSG_PTR(CmdPacket.CommandHeader), UT_SC_NOMINAL_CMD_SIZE, false));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(SC_GetCmdLength, 0);
+}
+
+void SC_VerifyLocalCmd_Test_Nominal(void)
+{
+    SC_NoopCmd_t CmdPacket;
+
+    UT_SC_SetMsgId(CFE_SB_ValueToMsgId(SC_CMD_MID));
+    UT_SetDefaultReturnValue(UT_KEY(SC_GetCmdLength), sizeof(CmdPacket));
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(SC_VerifyLocalCmd(CFE_MSG_PTR(CmdPacket.CommandHeader), sizeof(CmdPacket), false));
+    UtAssert_BOOL_FALSE(SC_VerifyLocalCmd(CFE_MSG_PTR(CmdPacket.CommandHeader), sizeof(CmdPacket) + 1, false));
+}
+
+void SC_VerifyLocalCmd_Test_CallRts(void)
+{
+    SC_CallRtsCmd_t   CmdPacket;
+    CFE_MSG_FcnCode_t FcnCode = SC_CALL_RTS_CC;
+
+    UT_SC_SetMsgId(CFE_SB_ValueToMsgId(SC_CMD_MID));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(SC_VerifyLocalCmd(CFE_MSG_PTR(CmdPacket.CommandHeader), sizeof(CmdPacket), true));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(SC_GetCmdLength, 0);
+}
+
+void SC_VerifyLocalCmd_Test_CallRtsInAts(void)
+{
+    SC_CallRtsCmd_t   CmdPacket;
+    CFE_MSG_FcnCode_t FcnCode = SC_CALL_RTS_CC;
+
+    UT_SC_SetMsgId(CFE_SB_ValueToMsgId(SC_CMD_MID));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(SC_VerifyLocalCmd(CFE_MSG_PTR(CmdPacket.CommandHeader), sizeof(CmdPacket), false));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(SC_GetCmdLength, 1);
+}
+
+void SC_VerifyLocalCmd_Test_RtsControl(void)
+{
+    SC_RtsLoopCmd_t   CmdPacket;
+    CFE_MSG_FcnCode_t FcnCode[2] = {SC_RTS_LOOP_CC, SC_RTS_LOOP_CC};
+
+    UT_SC_SetMsgId(CFE_SB_ValueToMsgId(SC_CMD_MID));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), FcnCode, sizeof(FcnCode), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(SC_VerifyLocalCmd(CFE_MSG_PTR(CmdPacket.CommandHeader), sizeof(CmdPacket), true));
+    UtAssert_BOOL_FALSE(SC_VerifyLocalCmd(CFE_MSG_PTR(CmdPacket.CommandHeader), sizeof(CmdPacket), false));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(SC_GetCmdLength, 1);
+}
+
+void SC_VerifyLocalCmd_Test_RtsPatch(void)
+{
+    SC_RtsPatchCmd_t  CmdPacket;
+    CFE_MSG_FcnCode_t FcnCode[2] = {SC_RTS_PATCH_CC, SC_RTS_PATCH_CC};
+
+    UT_SC_SetMsgId(CFE_SB_ValueToMsgId(SC_CMD_MID));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), FcnCode, sizeof(FcnCode), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(SC_VerifyLocalCmd(CFE_MSG_PTR(CmdPacket.CommandHeader), sizeof(CmdPacket), true));
+    UtAssert_BOOL_FALSE(SC_VerifyLocalCmd(CFE_MSG_PTR(CmdPacket.CommandHeader), sizeof(CmdPacket) + 4, true));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(SC_GetCmdLength, 0);
+}
+
+void SC_VerifyLocalCmd_Test_RtsTimed(void)
+{
+    SC_RtsTimedCmd_t  CmdPacket;
+    CFE_MSG_FcnCode_t FcnCode[2] = {SC_RTS_TIMED_CC, SC_RTS_TIMED_CC};
+
+    UT_SC_SetMsgId(CFE_SB_ValueToMsgId(SC_CMD_MID));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), FcnCode, sizeof(FcnCode), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(SC_VerifyLocalCmd(CFE_MSG_PTR(CmdPacket.CommandHeader), sizeof(CmdPacket), true));
+    UtAssert_BOOL_FALSE(SC_VerifyLocalCmd(CFE_MSG_PTR(CmdPacket.CommandHeader), sizeof(CmdPacket) + 4, true));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(SC_GetCmdLength, 0);
+}
+
+void SC_VerifyRtsGotos_Test_Nominal(void)
+{
+    SC_RtsIndex_t    RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsGotoCmd_t *GotoCmd;
+
+    GotoCmd = UT_SC_SetupRtsGoto(RtsIndex);
+
+    GotoCmd->Payload.EntryOffset = UT_SC_GetEntryWordCount(SC_RTS_HEADER_SIZE, sizeof(SC_RtsGotoCmd_t));
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(SC_VerifyRtsGotos(UT_SC_GetRtsTable(RtsIndex)));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_VerifyRtsGotos_Test_NotAnEntry(void)
+{
+    SC_RtsIndex_t    RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsGotoCmd_t *GotoCmd;
+
+    GotoCmd = UT_SC_SetupRtsGoto(RtsIndex);
+
+    GotoCmd->Payload.EntryOffset = 1;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(SC_VerifyRtsGotos(UT_SC_GetRtsTable(RtsIndex)));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTS_GOTO_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void SC_VerifyRtsGotos_Test_PastEnd(void)
+{
+    SC_RtsIndex_t    RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsGotoCmd_t *GotoCmd;
+
+    GotoCmd = UT_SC_SetupRtsGoto(RtsIndex);
+
+    /* the end of the entries is not an entry */
+    GotoCmd->Payload.EntryOffset = UT_SC_GetEntryWordCount(SC_RTS_HEADER_SIZE, sizeof(SC_RtsGotoCmd_t)) +
+                                   UT_SC_GetEntryWordCount(SC_RTS_HEADER_SIZE, UT_SC_NOMINAL_CMD_SIZE);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(SC_VerifyRtsGotos(UT_SC_GetRtsTable(RtsIndex)));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTS_GOTO_ERR_EID);
+}
+
+void SC_VerifyRtsPatches_Test_Nominal(void)
+{
+    SC_RtsIndex_t     RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsPatchCmd_t *PatchCmd;
+
+    PatchCmd = UT_SC_SetupRtsPatch(RtsIndex);
+
+    PatchCmd->Payload.ArgOffset = SC_RTS_ARG_BLOCK_SIZE - 2;
+    PatchCmd->Payload.MsgOffset = UT_SC_NOMINAL_CMD_SIZE - 2;
+    PatchCmd->Payload.Length    = 2;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(SC_VerifyRtsPatches(UT_SC_GetRtsTable(RtsIndex)));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_VerifyRtsPatches_Test_ArgRange(void)
+{
+    SC_RtsIndex_t     RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsPatchCmd_t *PatchCmd;
+
+    PatchCmd = UT_SC_SetupRtsPatch(RtsIndex);
+
+    PatchCmd->Payload.ArgOffset = SC_RTS_ARG_BLOCK_SIZE - 1;
+    PatchCmd->Payload.MsgOffset = sizeof(CFE_MSG_CommandHeader_t);
+    PatchCmd->Payload.Length    = 2;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(SC_VerifyRtsPatches(UT_SC_GetRtsTable(RtsIndex)));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTS_PATCH_LOAD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void SC_VerifyRtsPatches_Test_Header(void)
+{
+    SC_RtsIndex_t     RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsPatchCmd_t *PatchCmd;
+
+    PatchCmd = UT_SC_SetupRtsPatch(RtsIndex);
+
+    /* the patch would overwrite the command header */
+    PatchCmd->Payload.ArgOffset = 0;
+    PatchCmd->Payload.MsgOffset = sizeof(CFE_MSG_CommandHeader_t) - 1;
+    PatchCmd->Payload.Length    = 2;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(SC_VerifyRtsPatches(UT_SC_GetRtsTable(RtsIndex)));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTS_PATCH_LOAD_ERR_EID);
+}
+
+void SC_VerifyRtsPatches_Test_PastCommand(void)
+{
+    SC_RtsIndex_t     RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsPatchCmd_t *PatchCmd;
+
+    PatchCmd = UT_SC_SetupRtsPatch(RtsIndex);
+
+    /* fits in a packet, but not in the command after the patch */
+    PatchCmd->Payload.ArgOffset = 0;
+    PatchCmd->Payload.MsgOffset = UT_SC_NOMINAL_CMD_SIZE - 1;
+    PatchCmd->Payload.Length    = 2;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(SC_VerifyRtsPatches(UT_SC_GetRtsTable(RtsIndex)));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTS_PATCH_LOAD_ERR_EID);
+}
+
+
 void UtTest_Setup(void)
 {
     UtTest_Add(SC_LoadAts_Test_Nominal, UT_SC_Loads_Test_Setup, SC_Test_TearDown, "SC_LoadAts_Test_Nominal");
@@ -1465,16 +2480,31 @@ void UtTest_Setup(void)
     UtTest_Add(SC_LoadAts_Test_AtsEmpty, UT_SC_Loads_Test_Setup, SC_Test_TearDown, "SC_LoadAts_Test_AtsEmpty");
     UtTest_Add(SC_LoadAts_Test_LoadExactlyBufferLength, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
                "SC_LoadAts_Test_LoadExactlyBufferLength");
+    UtTest_Add(SC_LoadAts_Test_MaxCommands, UT_SC_Loads_Test_Setup, SC_Test_TearDown, "SC_LoadAts_Test_MaxCommands");
     UtTest_Add(SC_LoadAts_Test_CmdNotEmpty, UT_SC_Loads_Test_Setup, SC_Test_TearDown, "SC_LoadAts_Test_CmdNotEmpty");
     UtTest_Add(SC_LoadAts_Test_InvalidIndex, UT_SC_Loads_Test_Setup, SC_Test_TearDown, "SC_LoadAts_Test_InvalidIndex");
 
+    UtTest_Add(SC_BeginAtsLoad_Test_InvalidIndex, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_BeginAtsLoad_Test_InvalidIndex");
+    UtTest_Add(SC_BeginAtsLoad_Test_QueuesOtherAts, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_BeginAtsLoad_Test_QueuesOtherAts");
+    UtTest_Add(SC_LoadAts_Test_RequeuesOtherAts, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_LoadAts_Test_RequeuesOtherAts");
+    UtTest_Add(SC_ProcessAtsLoad_Test_Incremental, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessAtsLoad_Test_Incremental");
+    UtTest_Add(SC_ProcessAtsLoad_Test_PhaseTiming, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessAtsLoad_Test_PhaseTiming");
+    UtTest_Add(SC_ProcessAtsLoad_Test_SortsByTime, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessAtsLoad_Test_SortsByTime");
+    UtTest_Add(SC_ProcessAtsLoad_Test_ParseError, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessAtsLoad_Test_ParseError");
     UtTest_Add(SC_BuildTimeIndexTable_Test_InvalidIndex, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
                "SC_BuildTimeIndexTable_Test_InvalidIndex");
-    UtTest_Add(SC_Insert_Test, UT_SC_Loads_Test_Setup, SC_Test_TearDown, "SC_Insert_Test");
-    UtTest_Add(SC_Insert_Test_MiddleOfList, UT_SC_Loads_Test_Setup, SC_Test_TearDown, "SC_Insert_Test_MiddleOfList");
-    UtTest_Add(SC_Insert_Test_MiddleOfListCompareAbsTimeTrue, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
-               "SC_Insert_Test_MiddleOfListCompareAbsTimeTrue");
-    UtTest_Add(SC_Insert_Test_InvalidIndex, UT_SC_Loads_Test_Setup, SC_Test_TearDown, "SC_Insert_Test_InvalidIndex");
+    UtTest_Add(SC_BuildTimeIndexTable_Test_SortsByTime, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_BuildTimeIndexTable_Test_SortsByTime");
+    UtTest_Add(SC_SortAtsTimeIndexStep_Test_PastEnd, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_SortAtsTimeIndexStep_Test_PastEnd");
+    UtTest_Add(SC_AtsCmdIsLater_Test, UT_SC_Loads_Test_Setup, SC_Test_TearDown, "SC_AtsCmdIsLater_Test");
     UtTest_Add(SC_InitAtsTables_Test_InvalidIndex, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
                "SC_InitAtsTables_Test_InvalidIndex");
     UtTest_Add(SC_ValidateAts_Test, UT_SC_Loads_Test_Setup, SC_Test_TearDown, "SC_ValidateAts_Test");
@@ -1483,6 +2513,23 @@ void UtTest_Setup(void)
     UtTest_Add(SC_ValidateRts_Test_ParseRts, UT_SC_Loads_Test_Setup, SC_Test_TearDown, "SC_ValidateRts_Test_ParseRts");
     UtTest_Add(SC_LoadRts_Test_Nominal, UT_SC_Loads_Test_Setup, SC_Test_TearDown, "SC_LoadRts_Test_Nominal");
     UtTest_Add(SC_LoadRts_Test_InvalidIndex, UT_SC_Loads_Test_Setup, SC_Test_TearDown, "SC_LoadRts_Test_InvalidIndex");
+    UtTest_Add(SC_LoadRts_Test_CopyToPool, UT_SC_Loads_Test_Setup, SC_Test_TearDown, "SC_LoadRts_Test_CopyToPool");
+    UtTest_Add(SC_LoadRts_Test_PoolFull, UT_SC_Loads_Test_Setup, SC_Test_TearDown, "SC_LoadRts_Test_PoolFull");
+    UtTest_Add(SC_LoadRts_Test_StopsInstances, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_LoadRts_Test_StopsInstances");
+    UtTest_Add(SC_LoadRts_Test_StopsRunningRts, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_LoadRts_Test_StopsRunningRts");
+    UtTest_Add(SC_GetRtsLength_Test_FullTable, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_GetRtsLength_Test_FullTable");
+    UtTest_Add(SC_AllocRtsBlock_Test_FirstFit, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_AllocRtsBlock_Test_FirstFit");
+    UtTest_Add(SC_AllocRtsBlock_Test_Compact, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_AllocRtsBlock_Test_Compact");
+    UtTest_Add(SC_AllocRtsBlock_Test_NoSpace, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_AllocRtsBlock_Test_NoSpace");
+    UtTest_Add(SC_FindRtsPoolGap_Test_NoFit, UT_SC_Loads_Test_Setup, SC_Test_TearDown, "SC_FindRtsPoolGap_Test_NoFit");
+    UtTest_Add(SC_UpdateRtsPoolStats_Test_Fragmented, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_UpdateRtsPoolStats_Test_Fragmented");
     UtTest_Add(SC_ParseRts_Test_EndOfFile, UT_SC_Loads_Test_Setup, SC_Test_TearDown, "SC_ParseRts_Test_EndOfFile");
     UtTest_Add(SC_ParseRts_Test_InvalidMsgId, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
                "SC_ParseRts_Test_InvalidMsgId");
@@ -1498,6 +2545,8 @@ void UtTest_Setup(void)
                "SC_ParseRts_Test_CmdDoesNotFitBufferEmpty");
     UtTest_Add(SC_ParseRts_Test_CmdDoesNotFitBufferNotEmpty, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
                "SC_ParseRts_Test_CmdDoesNotFitBufferNotEmpty");
+    UtTest_Add(SC_ParseRts_Test_InvalidLocalCmd, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_ParseRts_Test_InvalidLocalCmd");
     UtTest_Add(SC_UpdateAppend_Test_Nominal, UT_SC_Loads_Test_Setup, SC_Test_TearDown, "SC_UpdateAppend_Test_Nominal");
     UtTest_Add(SC_UpdateAppend_Test_CmdDoesNotFitBuffer, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
                "SC_UpdateAppend_Test_CmdDoesNotFitBuffer");
@@ -1511,6 +2560,14 @@ void UtTest_Setup(void)
                "SC_UpdateAppend_Test_CmdNumberZero");
     UtTest_Add(SC_UpdateAppend_Test_CmdNumberTooHigh, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
                "SC_UpdateAppend_Test_CmdNumberTooHigh");
+    UtTest_Add(SC_ValidateTriggers_Test_Nominal, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_ValidateTriggers_Test_Nominal");
+    UtTest_Add(SC_ValidateTriggers_Test_Invalid, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_ValidateTriggers_Test_Invalid");
+    UtTest_Add(SC_UpdateTriggers_Test_Nominal, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_UpdateTriggers_Test_Nominal");
+    UtTest_Add(SC_UpdateTriggers_Test_SubscribeError, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_UpdateTriggers_Test_SubscribeError");
     UtTest_Add(SC_ProcessAppend_Test, UT_SC_Loads_Test_Setup, SC_Test_TearDown, "SC_ProcessAppend_Test");
     UtTest_Add(SC_ProcessAppend_Test_CmdLoaded, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
                "SC_ProcessAppend_Test_CmdLoaded");
@@ -1527,6 +2584,13 @@ void UtTest_Setup(void)
                "SC_VerifyAtsTable_Test_InvalidEntry");
     UtTest_Add(SC_VerifyAtsTable_Test_EmptyTable, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
                "SC_VerifyAtsTable_Test_EmptyTable");
+    UtTest_Add(SC_ForecastAtsLoad_Test_Nominal, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_ForecastAtsLoad_Test_Nominal");
+    UtTest_Add(SC_ForecastAtsLoad_Test_Overloaded, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_ForecastAtsLoad_Test_Overloaded");
+    UtTest_Add(SC_ForecastAtsLoad_Test_ReverseOrder, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_ForecastAtsLoad_Test_ReverseOrder");
+    UtTest_Add(SC_SiftForecastTimes_Test, UT_SC_Loads_Test_Setup, SC_Test_TearDown, "SC_SiftForecastTimes_Test");
     UtTest_Add(SC_VerifyAtsEntry_Test_Nominal, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
                "SC_VerifyAtsEntry_Test_Nominal");
     UtTest_Add(SC_VerifyAtsEntry_Test_EndOfBuffer, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
@@ -1543,4 +2607,34 @@ void UtTest_Setup(void)
                "SC_VerifyAtsEntry_Test_BufferOverflow");
     UtTest_Add(SC_VerifyAtsEntry_Test_DuplicateCmdNumber, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
                "SC_VerifyAtsEntry_Test_DuplicateCmdNumber");
+    UtTest_Add(SC_VerifyAtsEntry_Test_InvalidLocalCmd, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_VerifyAtsEntry_Test_InvalidLocalCmd");
+    UtTest_Add(SC_VerifyLocalCmd_Test_NotForSc, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_VerifyLocalCmd_Test_NotForSc");
+    UtTest_Add(SC_VerifyLocalCmd_Test_Nominal, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_VerifyLocalCmd_Test_Nominal");
+    UtTest_Add(SC_VerifyLocalCmd_Test_CallRts, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_VerifyLocalCmd_Test_CallRts");
+    UtTest_Add(SC_VerifyLocalCmd_Test_CallRtsInAts, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_VerifyLocalCmd_Test_CallRtsInAts");
+    UtTest_Add(SC_VerifyLocalCmd_Test_RtsControl, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_VerifyLocalCmd_Test_RtsControl");
+    UtTest_Add(SC_VerifyLocalCmd_Test_RtsPatch, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_VerifyLocalCmd_Test_RtsPatch");
+    UtTest_Add(SC_VerifyLocalCmd_Test_RtsTimed, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_VerifyLocalCmd_Test_RtsTimed");
+    UtTest_Add(SC_VerifyRtsGotos_Test_Nominal, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_VerifyRtsGotos_Test_Nominal");
+    UtTest_Add(SC_VerifyRtsGotos_Test_NotAnEntry, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_VerifyRtsGotos_Test_NotAnEntry");
+    UtTest_Add(SC_VerifyRtsGotos_Test_PastEnd, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_VerifyRtsGotos_Test_PastEnd");
+    UtTest_Add(SC_VerifyRtsPatches_Test_Nominal, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_VerifyRtsPatches_Test_Nominal");
+    UtTest_Add(SC_VerifyRtsPatches_Test_ArgRange, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_VerifyRtsPatches_Test_ArgRange");
+    UtTest_Add(SC_VerifyRtsPatches_Test_Header, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_VerifyRtsPatches_Test_Header");
+    UtTest_Add(SC_VerifyRtsPatches_Test_PastCommand, UT_SC_Loads_Test_Setup, SC_Test_TearDown,
+               "SC_VerifyRtsPatches_Test_PastCommand");
 }
@@ -49,12 +49,18 @@ void SC_StartRtsCmd_Test_Nominal(void)
     SC_RtsIndex_t        RtsIndex = SC_RTS_IDX_C(0);
     size_t               MsgSize;
     SC_RtsInfoEntry_t *  RtsInfoPtr;
+    SC_RtsStatsEntry_t * RtsStatsPtr;
 
-    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+    RtsInfoPtr  = SC_GetRtsInfoObject(RtsIndex);
+    RtsStatsPtr = SC_GetRtsStatsObject(RtsIndex);
 
     Entry          = (SC_RtsEntryHeader_t *)SC_GetRtsEntryAtOffset(RtsIndex, SC_ENTRY_OFFSET_FIRST);
     Entry->WakeupCount = 0;
 
+    SC_AppData.CurrentWakeupCount        = 12;
+    SC_AppData.CurrentSysTime.Seconds    = 34;
+    RtsStatsPtr->UseCtr                  = 5;
+    RtsStatsPtr->CmdCtr                  = 9;
     UT_CmdBuf.StartRtsCmd.Payload.RtsNum = SC_RtsIndexToNum(RtsIndex);
 
     RtsInfoPtr->DisabledFlag = false;
@@ -75,8 +81,16 @@ void SC_StartRtsCmd_Test_Nominal(void)
     UtAssert_True(RtsInfoPtr->CmdErrCtr == 0, "RtsInfoPtr->CmdErrCtr == 0");
     SC_Assert_IDX_VALUE(RtsInfoPtr->NextCommandPtr, 0);
     UtAssert_UINT32_EQ(RtsInfoPtr->UseCtr, 1);
+    UtAssert_STUB_COUNT(SC_SeekRtsCommand, 1);
+
+    UtAssert_UINT32_EQ(RtsStatsPtr->UseCtr, 6);
+    UtAssert_UINT32_EQ(RtsStatsPtr->CmdCtr, 9);
+    UtAssert_UINT32_EQ(RtsStatsPtr->StartWakeup, 12);
+    UtAssert_UINT32_EQ(RtsStatsPtr->LastStartTime.Seconds, 34);
 
     UtAssert_True(SC_OperData.RtsCtrlBlckAddr->NumRtsActive == 1, "SC_OperData.RtsCtrlBlckAddr->NumRtsActive == 1");
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.NumRtsActive, 1);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.RtsExecutingStatus[0], 1);
     UtAssert_True(SC_OperData.HkPacket.Payload.RtsActiveCtr == 1, "SC_OperData.HkPacket.Payload.RtsActiveCtr == 1");
     UtAssert_True(SC_OperData.HkPacket.Payload.CmdCtr == 1, "SC_OperData.HkPacket.Payload.CmdCtr == 1");
 
@@ -84,6 +98,40 @@ void SC_StartRtsCmd_Test_Nominal(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
 }
 
+void SC_StartRtsCmd_Test_Deferred(void)
+{
+    SC_RtsEntryHeader_t *Entry;
+    SC_RtsIndex_t        RtsIndex = SC_RTS_IDX_C(0);
+    size_t               MsgSize;
+    SC_RtsInfoEntry_t *  RtsInfoPtr;
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    Entry              = (SC_RtsEntryHeader_t *)SC_GetRtsEntryAtOffset(RtsIndex, SC_ENTRY_OFFSET_FIRST);
+    Entry->WakeupCount = 0;
+
+    UT_CmdBuf.StartRtsCmd.Payload.RtsNum = SC_RtsIndexToNum(RtsIndex);
+
+    RtsInfoPtr->DisabledFlag = false;
+    RtsInfoPtr->RtsStatus    = SC_Status_LOADED;
+
+    MsgSize = sizeof(UT_CmdBuf.StartRtsCmd);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    /* The start is queued for a summary */
+    UT_SetDefaultReturnValue(UT_KEY(SC_DeferEvent), true);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_StartRtsCmd(&UT_CmdBuf.StartRtsCmd));
+
+    /* Verify results */
+    UtAssert_True(RtsInfoPtr->RtsStatus == SC_Status_EXECUTING, "RtsInfoPtr->RtsStatus == SC_Status_EXECUTING");
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdCtr, 1);
+    UtAssert_STUB_COUNT(SC_DeferEvent, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void SC_StartRtsCmd_Test_StartRtsNoEvents(void)
 {
     SC_RtsEntryHeader_t *Entry;
@@ -270,6 +318,74 @@ void SC_StartRtsCmd_Test_InvalidRtsNumZero(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
 }
 
+void SC_StartRtsParamCmd_Test_Nominal(void)
+{
+    SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
+    size_t             MsgSize;
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    UT_CmdBuf.StartRtsParamCmd.Payload.RtsNum                          = SC_RtsIndexToNum(RtsIndex);
+    UT_CmdBuf.StartRtsParamCmd.Payload.Args[0]                         = 7;
+    UT_CmdBuf.StartRtsParamCmd.Payload.Args[SC_RTS_ARG_BLOCK_SIZE - 1] = 9;
+
+    RtsInfoPtr->RtsStatus = SC_Status_LOADED;
+
+    MsgSize = SC_PACKET_MIN_SIZE;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_StartRtsParamCmd(&UT_CmdBuf.StartRtsParamCmd));
+
+    /* Verify results */
+    UtAssert_True(RtsInfoPtr->RtsStatus == SC_Status_EXECUTING, "RtsInfoPtr->RtsStatus == SC_Status_EXECUTING");
+    UtAssert_MemCmp(RtsInfoPtr->Args, UT_CmdBuf.StartRtsParamCmd.Payload.Args, sizeof(RtsInfoPtr->Args),
+                    "RTS arguments");
+    UtAssert_True(SC_OperData.HkPacket.Payload.CmdCtr == 1, "SC_OperData.HkPacket.Payload.CmdCtr == 1");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTS_START_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_StartRtsParamCmd_Test_RtsInUse(void)
+{
+    SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    UT_CmdBuf.StartRtsParamCmd.Payload.RtsNum  = SC_RtsIndexToNum(RtsIndex);
+    UT_CmdBuf.StartRtsParamCmd.Payload.Args[0] = 7;
+
+    RtsInfoPtr->RtsStatus = SC_Status_EXECUTING;
+    RtsInfoPtr->Args[0]   = 3;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_StartRtsParamCmd(&UT_CmdBuf.StartRtsParamCmd));
+
+    /* Verify results, the running RTS keeps its arguments */
+    UtAssert_UINT32_EQ(RtsInfoPtr->Args[0], 3);
+    UtAssert_True(SC_OperData.HkPacket.Payload.CmdErrCtr == 1, "SC_OperData.HkPacket.Payload.CmdErrCtr == 1");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_STARTRTS_CMD_NOT_LDED_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_StartRtsParamCmd_Test_InvalidRtsNum(void)
+{
+    UT_CmdBuf.StartRtsParamCmd.Payload.RtsNum = SC_RTS_NUM_C(SC_NUMBER_OF_RTS + 1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_StartRtsParamCmd(&UT_CmdBuf.StartRtsParamCmd));
+
+    /* Verify results */
+    UtAssert_True(SC_OperData.HkPacket.Payload.CmdErrCtr == 1, "SC_OperData.HkPacket.Payload.CmdErrCtr == 1");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_STARTRTS_CMD_INVALID_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
 void SC_StartRtsGrpCmd_Test_Nominal(void)
 {
     SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
@@ -427,6 +543,29 @@ void SC_StartRtsGrpCmd_Test_DisabledFlag(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
 }
 
+void SC_StartRtsGrpCmd_Test_Deferred(void)
+{
+    SC_GetRtsInfoObject(SC_RTS_IDX_C(0))->DisabledFlag = true;
+    SC_GetRtsInfoObject(SC_RTS_IDX_C(1))->RtsStatus    = SC_Status_EMPTY;
+
+    UT_CmdBuf.StartRtsGrpCmd.Payload.FirstRtsNum = SC_RTS_NUM_C(1);
+    UT_CmdBuf.StartRtsGrpCmd.Payload.LastRtsNum  = SC_RTS_NUM_C(2);
+
+    /* The rejections are queued for a summary */
+    UT_SetDefaultReturnValue(UT_KEY(SC_DeferEvent), true);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_StartRtsGrpCmd(&UT_CmdBuf.StartRtsGrpCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.RtsActiveErrCtr, 2);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdCtr, 1);
+    UtAssert_STUB_COUNT(SC_DeferEvent, 2);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_STARTRTSGRP_CMD_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
 void SC_StartRtsGrpCmd_Test_RtsStatus(void)
 {
     SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
@@ -632,6 +771,7 @@ void SC_DisableRtsCmd_Test_Nominal(void)
 
     /* Verify results */
     UtAssert_True(RtsInfoPtr->DisabledFlag == true, "RtsInfoPtr->DisabledFlag == true");
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.RtsDisabledStatus[0], 1);
     UtAssert_True(SC_OperData.HkPacket.Payload.CmdCtr == 1, "SC_OperData.HkPacket.Payload.CmdCtr == 1");
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID,
@@ -794,6 +934,8 @@ void SC_EnableRtsCmd_Test_Nominal(void)
 
     RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
 
+    SC_SetRtsDisabled(RtsIndex, true);
+
     UT_CmdBuf.EnableRtsCmd.Payload.RtsNum = SC_RtsIndexToNum(RtsIndex);
 
     /* Execute the function being tested */
@@ -801,6 +943,7 @@ void SC_EnableRtsCmd_Test_Nominal(void)
 
     /* Verify results */
     UtAssert_True(RtsInfoPtr->DisabledFlag == false, "RtsInfoPtr->DisabledFlag == false");
+    UtAssert_ZERO(SC_OperData.HkPacket.Payload.RtsDisabledStatus[0]);
     UtAssert_True(SC_OperData.HkPacket.Payload.CmdCtr == 1, "SC_OperData.HkPacket.Payload.CmdCtr == 1");
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID,
@@ -973,16 +1116,264 @@ void SC_EnableRtsGrpCmd_Test_DisabledFlag(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
 }
 
+void SC_StartRtsSetCmd_Test_Nominal(void)
+{
+    SC_RtsInfoEntry_t *RtsInfoPtr0  = SC_GetRtsInfoObject(SC_RTS_IDX_C(0));
+    SC_RtsInfoEntry_t *RtsInfoPtr1  = SC_GetRtsInfoObject(SC_RTS_IDX_C(1));
+    SC_RtsInfoEntry_t *RtsInfoPtr2  = SC_GetRtsInfoObject(SC_RTS_IDX_C(2));
+    SC_RtsInfoEntry_t *RtsInfoPtr3  = SC_GetRtsInfoObject(SC_RTS_IDX_C(3));
+    SC_RtsInfoEntry_t *RtsInfoPtr16 = SC_GetRtsInfoObject(SC_RTS_IDX_C(16));
+
+    /* the setters keep the HK masks the command reads in step */
+    SC_SetRtsStatus(SC_RTS_IDX_C(0), SC_Status_LOADED);
+    SC_SetRtsStatus(SC_RTS_IDX_C(1), SC_Status_LOADED);
+    SC_SetRtsDisabled(SC_RTS_IDX_C(1), true);
+    SC_SetRtsStatus(SC_RTS_IDX_C(2), SC_Status_EMPTY);
+    SC_SetRtsStatus(SC_RTS_IDX_C(3), SC_Status_EXECUTING);
+    SC_SetRtsStatus(SC_RTS_IDX_C(16), SC_Status_LOADED);
+
+    /* RTS 1 to 4 in the first word, RTS 17 in the second */
+    UT_CmdBuf.StartRtsSetCmd.Payload.RtsSet[0] = 0x000F;
+    UT_CmdBuf.StartRtsSetCmd.Payload.RtsSet[1] = 0x0001;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_StartRtsSetCmd(&UT_CmdBuf.StartRtsSetCmd));
+
+    /* Verify results */
+    UtAssert_INT32_EQ(RtsInfoPtr0->RtsStatus, SC_Status_EXECUTING);
+    UtAssert_INT32_EQ(RtsInfoPtr1->RtsStatus, SC_Status_LOADED);
+    UtAssert_INT32_EQ(RtsInfoPtr2->RtsStatus, SC_Status_EMPTY);
+    UtAssert_INT32_EQ(RtsInfoPtr3->RtsStatus, SC_Status_EXECUTING);
+    UtAssert_INT32_EQ(RtsInfoPtr16->RtsStatus, SC_Status_EXECUTING);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.RtsActiveCtr, 2);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.RtsActiveErrCtr, 3);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.RtsExecutingStatus[0], 0x0009);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.RtsExecutingStatus[1], 0x0001);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdCtr, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_STARTRTSSET_CMD_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_StartRtsSetCmd_Test_EmptySet(void)
+{
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_StartRtsSetCmd(&UT_CmdBuf.StartRtsSetCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.RtsActiveCtr, 0);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdErrCtr, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTSSET_CMD_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_StopRtsSetCmd_Test_Nominal(void)
+{
+    SC_RtsInfoEntry_t *RtsInfoPtr0 = SC_GetRtsInfoObject(SC_RTS_IDX_C(0));
+    SC_RtsInfoEntry_t *RtsInfoPtr1 = SC_GetRtsInfoObject(SC_RTS_IDX_C(1));
+
+    SC_SetRtsStatus(SC_RTS_IDX_C(0), SC_Status_EXECUTING);
+    SC_SetRtsStatus(SC_RTS_IDX_C(1), SC_Status_LOADED);
+
+    SC_OperData.RtsCtrlBlckAddr->NumRtsActive = 1;
+
+    UT_CmdBuf.StopRtsSetCmd.Payload.RtsSet[0] = 0x0003;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_StopRtsSetCmd(&UT_CmdBuf.StopRtsSetCmd));
+
+    /* Verify results */
+    UtAssert_INT32_EQ(RtsInfoPtr0->RtsStatus, SC_Status_LOADED);
+    UtAssert_INT32_EQ(RtsInfoPtr1->RtsStatus, SC_Status_LOADED);
+    UtAssert_UINT32_EQ(SC_OperData.RtsCtrlBlckAddr->NumRtsActive, 0);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.RtsExecutingStatus[0], 0);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdCtr, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_STOPRTSSET_CMD_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_StopRtsSetCmd_Test_EmptySet(void)
+{
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_StopRtsSetCmd(&UT_CmdBuf.StopRtsSetCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdErrCtr, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTSSET_CMD_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_DisableRtsSetCmd_Test_Nominal(void)
+{
+    SC_RtsInfoEntry_t *RtsInfoPtr0  = SC_GetRtsInfoObject(SC_RTS_IDX_C(0));
+    SC_RtsInfoEntry_t *RtsInfoPtr1  = SC_GetRtsInfoObject(SC_RTS_IDX_C(1));
+    SC_RtsInfoEntry_t *RtsInfoPtr63 = SC_GetRtsInfoObject(SC_RTS_IDX_C(SC_NUMBER_OF_RTS - 1));
+
+    SC_SetRtsDisabled(SC_RTS_IDX_C(0), false);
+    SC_SetRtsDisabled(SC_RTS_IDX_C(1), false);
+
+    UT_CmdBuf.DisableRtsSetCmd.Payload.RtsSet[0] = 0x0001;
+
+    UT_CmdBuf.DisableRtsSetCmd.Payload.RtsSet[SC_RTS_SET_WORDS - 1] =
+        (uint16)(1 << ((SC_NUMBER_OF_RTS - 1) % SC_NUMBER_OF_RTS_IN_UINT16));
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_DisableRtsSetCmd(&UT_CmdBuf.DisableRtsSetCmd));
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(RtsInfoPtr0->DisabledFlag);
+    UtAssert_BOOL_FALSE(RtsInfoPtr1->DisabledFlag);
+    UtAssert_BOOL_TRUE(RtsInfoPtr63->DisabledFlag);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.RtsDisabledStatus[0] & 0x0003, 0x0001);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdCtr, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_DISRTSSET_CMD_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_DisableRtsSetCmd_Test_EmptySet(void)
+{
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_DisableRtsSetCmd(&UT_CmdBuf.DisableRtsSetCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdErrCtr, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTSSET_CMD_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_EnableRtsSetCmd_Test_Nominal(void)
+{
+    SC_RtsInfoEntry_t *RtsInfoPtr0 = SC_GetRtsInfoObject(SC_RTS_IDX_C(0));
+    SC_RtsInfoEntry_t *RtsInfoPtr1 = SC_GetRtsInfoObject(SC_RTS_IDX_C(1));
+
+    SC_SetRtsDisabled(SC_RTS_IDX_C(0), true);
+    SC_SetRtsDisabled(SC_RTS_IDX_C(1), true);
+
+    UT_CmdBuf.EnableRtsSetCmd.Payload.RtsSet[0] = 0x0002;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_EnableRtsSetCmd(&UT_CmdBuf.EnableRtsSetCmd));
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(RtsInfoPtr0->DisabledFlag);
+    UtAssert_BOOL_FALSE(RtsInfoPtr1->DisabledFlag);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.RtsDisabledStatus[0] & 0x0003, 0x0001);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdCtr, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_ENARTSSET_CMD_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_EnableRtsSetCmd_Test_EmptySet(void)
+{
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_EnableRtsSetCmd(&UT_CmdBuf.EnableRtsSetCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdErrCtr, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTSSET_CMD_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_SetRtsPriorityCmd_Test_Nominal(void)
+{
+    SC_RtsInfoEntry_t *RtsInfoPtr0 = SC_GetRtsInfoObject(SC_RTS_IDX_C(0));
+    SC_RtsInfoEntry_t *RtsInfoPtr1 = SC_GetRtsInfoObject(SC_RTS_IDX_C(1));
+
+    RtsInfoPtr0->Priority = 1;
+    RtsInfoPtr1->Priority = 1;
+
+    UT_CmdBuf.SetRtsPriorityCmd.Payload.RtsSet[0] = 0x0002;
+    UT_CmdBuf.SetRtsPriorityCmd.Payload.Priority  = SC_RTS_PRIORITY_LEVELS - 1;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_SetRtsPriorityCmd(&UT_CmdBuf.SetRtsPriorityCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(RtsInfoPtr0->Priority, 1);
+    UtAssert_UINT32_EQ(RtsInfoPtr1->Priority, SC_RTS_PRIORITY_LEVELS - 1);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdCtr, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_SET_RTS_PRIORITY_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_SetRtsPriorityCmd_Test_EmptySet(void)
+{
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_SetRtsPriorityCmd(&UT_CmdBuf.SetRtsPriorityCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdErrCtr, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_SET_RTS_PRIORITY_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_SetRtsPriorityCmd_Test_InvalidPriority(void)
+{
+    SC_RtsInfoEntry_t *RtsInfoPtr = SC_GetRtsInfoObject(SC_RTS_IDX_C(0));
+
+    RtsInfoPtr->Priority = 1;
+
+    UT_CmdBuf.SetRtsPriorityCmd.Payload.RtsSet[0] = 0x0001;
+    UT_CmdBuf.SetRtsPriorityCmd.Payload.Priority  = SC_RTS_PRIORITY_LEVELS;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_SetRtsPriorityCmd(&UT_CmdBuf.SetRtsPriorityCmd));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(RtsInfoPtr->Priority, 1);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.CmdErrCtr, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_SET_RTS_PRIORITY_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_RtsSetIsValid_Test(void)
+{
+    uint16 RtsSet[SC_RTS_SET_WORDS];
+
+    memset(RtsSet, 0, sizeof(RtsSet));
+    UtAssert_BOOL_FALSE(SC_RtsSetIsValid(RtsSet));
+
+    RtsSet[SC_RTS_SET_WORDS - 1] = 1;
+    UtAssert_BOOL_TRUE(SC_RtsSetIsValid(RtsSet));
+
+    /* the top bit of the last word names an RTS only when the words are full */
+    RtsSet[SC_RTS_SET_WORDS - 1] = 0x8000;
+    UtAssert_True(SC_RtsSetIsValid(RtsSet) == ((SC_NUMBER_OF_RTS % SC_NUMBER_OF_RTS_IN_UINT16) == 0),
+                  "SC_RtsSetIsValid rejects bits past the last RTS");
+}
+
 void SC_KillRts_Test(void)
 {
-    SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
-    SC_RtsInfoEntry_t *RtsInfoPtr;
+    SC_RtsIndex_t       RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsInfoEntry_t  *RtsInfoPtr;
+    SC_RtsStatsEntry_t *RtsStatsPtr;
 
-    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+    RtsInfoPtr  = SC_GetRtsInfoObject(RtsIndex);
+    RtsStatsPtr = SC_GetRtsStatsObject(RtsIndex);
 
-    RtsInfoPtr->RtsStatus                     = SC_Status_EXECUTING;
+    SC_SetRtsStatus(RtsIndex, SC_Status_EXECUTING);
     SC_OperData.RtsCtrlBlckAddr->NumRtsActive = 1;
 
+    /* a previous, longer run is kept as the maximum */
+    SC_AppData.CurrentWakeupCount     = 10;
+    SC_AppData.CurrentSysTime.Seconds = 20;
+    RtsStatsPtr->StartWakeup          = 4;
+    RtsStatsPtr->MaxRunWakeups        = 8;
+    RtsStatsPtr->TotalRunWakeups      = 8;
+    RtsStatsPtr->MaxRunUsec           = 100;
+    RtsStatsPtr->TotalRunUsec         = 100;
+    UT_SetDefaultReturnValue(UT_KEY(SC_ElapsedUsec), 300);
+
     /* Execute the function being tested */
     UtAssert_VOIDCALL(SC_KillRts(RtsIndex));
 
@@ -990,6 +1381,16 @@ void SC_KillRts_Test(void)
     UtAssert_True(RtsInfoPtr->RtsStatus == SC_Status_LOADED, "RtsInfoPtr->RtsStatus == SC_Status_LOADED");
     UtAssert_True(RtsInfoPtr->NextCommandTgtWakeup == SC_MAX_WAKEUP_CNT, "RtsInfoPtr->NextCommandTgtWakeup == SC_MAX_WAKEUP_CNT");
     UtAssert_True(SC_OperData.RtsCtrlBlckAddr->NumRtsActive == 0, "SC_OperData.RtsCtrlBlckAddr->NumRtsActive == 0");
+    UtAssert_ZERO(SC_OperData.HkPacket.Payload.NumRtsActive);
+    UtAssert_ZERO(SC_OperData.HkPacket.Payload.RtsExecutingStatus[0]);
+
+    UtAssert_UINT32_EQ(RtsStatsPtr->LastRunWakeups, 6);
+    UtAssert_UINT32_EQ(RtsStatsPtr->MaxRunWakeups, 8);
+    UtAssert_UINT32_EQ(RtsStatsPtr->TotalRunWakeups, 14);
+    UtAssert_UINT32_EQ(RtsStatsPtr->LastRunUsec, 300);
+    UtAssert_UINT32_EQ(RtsStatsPtr->MaxRunUsec, 300);
+    UtAssert_UINT32_EQ(RtsStatsPtr->TotalRunUsec, 400);
+    UtAssert_UINT32_EQ(RtsStatsPtr->LastStopTime.Seconds, 20);
 
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
@@ -1027,44 +1428,752 @@ void SC_KillRts_Test_InvalidIndex(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
 }
 
-void SC_AutoStartRts_Test_Nominal(void)
+void SC_KillRts_Test_UnwindsCaller(void)
 {
-    SC_RtsNum_t RtsNum = SC_RTS_NUM_C(1);
+    SC_RtsIndex_t      CallerIndex = SC_RTS_IDX_C(0);
+    SC_RtsIndex_t      RtsIndex    = SC_RTS_IDX_C(1);
+    SC_RtsInfoEntry_t *CallerInfoPtr;
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+
+    CallerInfoPtr = SC_GetRtsInfoObject(CallerIndex);
+    RtsInfoPtr    = SC_GetRtsInfoObject(RtsIndex);
+
+    CallerInfoPtr->RtsStatus                  = SC_Status_EXECUTING;
+    CallerInfoPtr->CalleeRtsNum               = SC_RtsIndexToNum(RtsIndex);
+    RtsInfoPtr->RtsStatus                     = SC_Status_EXECUTING;
+    RtsInfoPtr->CallerRtsNum                  = SC_RtsIndexToNum(CallerIndex);
+    SC_OperData.RtsCtrlBlckAddr->NumRtsActive = 2;
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(SC_AutoStartRts(RtsNum));
+    UtAssert_VOIDCALL(SC_KillRts(RtsIndex));
 
     /* Verify results */
+    UtAssert_True(RtsInfoPtr->RtsStatus == SC_Status_LOADED, "RtsInfoPtr->RtsStatus == SC_Status_LOADED");
+    UtAssert_True(CallerInfoPtr->RtsStatus == SC_Status_LOADED, "CallerInfoPtr->RtsStatus == SC_Status_LOADED");
+    SC_Assert_ID_VALUE(RtsInfoPtr->CallerRtsNum, 0);
+    SC_Assert_ID_VALUE(CallerInfoPtr->CalleeRtsNum, 0);
+    UtAssert_True(SC_OperData.RtsCtrlBlckAddr->NumRtsActive == 0, "SC_OperData.RtsCtrlBlckAddr->NumRtsActive == 0");
+
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void SC_AutoStartRts_Test_InvalidId(void)
+void SC_KillRts_Test_Instance(void)
 {
-    SC_RtsNum_t RtsNum = SC_RTS_NUM_C(SC_NUMBER_OF_RTS + 1);
+    SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(1);
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    RtsInfoPtr->RtsStatus                     = SC_Status_EXECUTING;
+    RtsInfoPtr->SourceRtsNum                  = SC_RTS_NUM_C(1);
+    SC_OperData.RtsCtrlBlckAddr->NumRtsActive = 1;
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(SC_AutoStartRts(RtsNum));
+    UtAssert_VOIDCALL(SC_KillRts(RtsIndex));
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_AUTOSTART_RTS_INV_ID_ERR_EID);
-    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_True(RtsInfoPtr->RtsStatus == SC_Status_EMPTY, "RtsInfoPtr->RtsStatus == SC_Status_EMPTY");
+    SC_Assert_ID_VALUE(RtsInfoPtr->SourceRtsNum, 0);
+    UtAssert_True(SC_OperData.RtsCtrlBlckAddr->NumRtsActive == 0, "SC_OperData.RtsCtrlBlckAddr->NumRtsActive == 0");
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void SC_AutoStartRts_Test_InvalidIdZero(void)
+void SC_ProcessRtsCall_Test_Call(void)
 {
-    SC_RtsNum_t RtsNum = SC_RTS_NUM_C(0);
+    SC_RtsIndex_t      RtsIndex    = SC_RTS_IDX_C(0);
+    SC_RtsIndex_t      TargetIndex = SC_RTS_IDX_C(1);
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+    SC_RtsInfoEntry_t *TargetInfoPtr;
+    size_t             MsgSize[2];
+
+    RtsInfoPtr    = SC_GetRtsInfoObject(RtsIndex);
+    TargetInfoPtr = SC_GetRtsInfoObject(TargetIndex);
+
+    RtsInfoPtr->RtsStatus                     = SC_Status_EXECUTING;
+    RtsInfoPtr->CallDepth                     = 1;
+    TargetInfoPtr->RtsStatus                  = SC_Status_LOADED;
+    SC_OperData.RtsCtrlBlckAddr->NumRtsActive = 1;
+
+    UT_CmdBuf.CallRtsCmd.Payload.RtsNum = SC_RtsIndexToNum(TargetIndex);
+
+    MsgSize[0] = sizeof(UT_CmdBuf.CallRtsCmd);
+    MsgSize[1] = SC_PACKET_MIN_SIZE;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), MsgSize, sizeof(MsgSize), false);
 
     /* Execute the function being tested */
-    UtAssert_VOIDCALL(SC_AutoStartRts(RtsNum));
+    UtAssert_BOOL_TRUE(SC_ProcessRtsCall(RtsIndex, SC_CALL_RTS_CC, &UT_CmdBuf.CallRtsCmd));
 
     /* Verify results */
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_AUTOSTART_RTS_INV_ID_ERR_EID);
+    UtAssert_True(TargetInfoPtr->RtsStatus == SC_Status_EXECUTING, "TargetInfoPtr->RtsStatus == SC_Status_EXECUTING");
+    SC_Assert_ID_VALUE(TargetInfoPtr->CallerRtsNum, 1);
+    UtAssert_UINT32_EQ(TargetInfoPtr->CallDepth, 2);
+    UtAssert_True(RtsInfoPtr->RtsStatus == SC_Status_EXECUTING, "RtsInfoPtr->RtsStatus == SC_Status_EXECUTING");
+    SC_Assert_ID_VALUE(RtsInfoPtr->CalleeRtsNum, 2);
+    UtAssert_True(RtsInfoPtr->NextCommandTgtWakeup == SC_MAX_WAKEUP_CNT,
+                  "RtsInfoPtr->NextCommandTgtWakeup == SC_MAX_WAKEUP_CNT");
+    UtAssert_UINT32_EQ(RtsInfoPtr->CmdCtr, 1);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.RtsCmdCtr, 1);
+    UtAssert_UINT32_EQ(SC_OperData.RtsCtrlBlckAddr->NumRtsActive, 2);
+    UtAssert_STUB_COUNT(SC_SeekRtsCommand, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTS_CALL_DBG_EID);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
 }
 
+void SC_ProcessRtsCall_Test_Chain(void)
+{
+    SC_RtsIndex_t      CallerIndex = SC_RTS_IDX_C(0);
+    SC_RtsIndex_t      RtsIndex    = SC_RTS_IDX_C(1);
+    SC_RtsIndex_t      TargetIndex = SC_RTS_IDX_C(2);
+    SC_RtsInfoEntry_t *CallerInfoPtr;
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+    SC_RtsInfoEntry_t *TargetInfoPtr;
+    size_t             MsgSize[2];
+
+    CallerInfoPtr = SC_GetRtsInfoObject(CallerIndex);
+    RtsInfoPtr    = SC_GetRtsInfoObject(RtsIndex);
+    TargetInfoPtr = SC_GetRtsInfoObject(TargetIndex);
+
+    CallerInfoPtr->RtsStatus                  = SC_Status_EXECUTING;
+    CallerInfoPtr->CalleeRtsNum               = SC_RtsIndexToNum(RtsIndex);
+    RtsInfoPtr->RtsStatus                     = SC_Status_EXECUTING;
+    RtsInfoPtr->CallerRtsNum                  = SC_RtsIndexToNum(CallerIndex);
+    RtsInfoPtr->CallDepth                     = 1;
+    TargetInfoPtr->RtsStatus                  = SC_Status_LOADED;
+    SC_OperData.RtsCtrlBlckAddr->NumRtsActive = 2;
+
+    UT_CmdBuf.CallRtsCmd.Payload.RtsNum = SC_RtsIndexToNum(TargetIndex);
+
+    MsgSize[0] = sizeof(UT_CmdBuf.CallRtsCmd);
+    MsgSize[1] = SC_PACKET_MIN_SIZE;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), MsgSize, sizeof(MsgSize), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(SC_ProcessRtsCall(RtsIndex, SC_CHAIN_RTS_CC, &UT_CmdBuf.CallRtsCmd));
+
+    /* Verify results */
+    UtAssert_True(RtsInfoPtr->RtsStatus == SC_Status_LOADED, "RtsInfoPtr->RtsStatus == SC_Status_LOADED");
+    UtAssert_True(CallerInfoPtr->RtsStatus == SC_Status_EXECUTING, "CallerInfoPtr->RtsStatus == SC_Status_EXECUTING");
+    UtAssert_True(TargetInfoPtr->RtsStatus == SC_Status_EXECUTING, "TargetInfoPtr->RtsStatus == SC_Status_EXECUTING");
+    SC_Assert_ID_VALUE(TargetInfoPtr->CallerRtsNum, 1);
+    UtAssert_UINT32_EQ(TargetInfoPtr->CallDepth, 1);
+    SC_Assert_ID_VALUE(CallerInfoPtr->CalleeRtsNum, 3);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.RtsCmdCtr, 1);
+    UtAssert_UINT32_EQ(SC_OperData.RtsCtrlBlckAddr->NumRtsActive, 2);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTS_CHAIN_DBG_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_ProcessRtsCall_Test_ChainSelf(void)
+{
+    SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+    size_t             MsgSize[2];
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    RtsInfoPtr->RtsStatus                     = SC_Status_EXECUTING;
+    RtsInfoPtr->NextCommandPtr                = SC_ENTRY_OFFSET_C(10);
+    RtsInfoPtr->UseCtr                        = 1;
+    SC_OperData.RtsCtrlBlckAddr->NumRtsActive = 1;
+
+    UT_CmdBuf.CallRtsCmd.Payload.RtsNum = SC_RtsIndexToNum(RtsIndex);
+
+    MsgSize[0] = sizeof(UT_CmdBuf.CallRtsCmd);
+    MsgSize[1] = SC_PACKET_MIN_SIZE;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), MsgSize, sizeof(MsgSize), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(SC_ProcessRtsCall(RtsIndex, SC_CHAIN_RTS_CC, &UT_CmdBuf.CallRtsCmd));
+
+    /* Verify results */
+    UtAssert_True(RtsInfoPtr->RtsStatus == SC_Status_EXECUTING, "RtsInfoPtr->RtsStatus == SC_Status_EXECUTING");
+    SC_Assert_IDX_VALUE(RtsInfoPtr->NextCommandPtr, 0);
+    UtAssert_UINT32_EQ(RtsInfoPtr->UseCtr, 2);
+    UtAssert_UINT32_EQ(SC_OperData.RtsCtrlBlckAddr->NumRtsActive, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTS_CHAIN_DBG_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_ProcessRtsCall_Test_CallDepth(void)
+{
+    SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+    size_t             MsgSize;
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    RtsInfoPtr->RtsStatus                     = SC_Status_EXECUTING;
+    RtsInfoPtr->CallDepth                     = SC_RTS_MAX_CALL_DEPTH;
+    SC_OperData.RtsCtrlBlckAddr->NumRtsActive = 1;
+
+    UT_CmdBuf.CallRtsCmd.Payload.RtsNum = SC_RTS_NUM_C(2);
+
+    MsgSize = sizeof(UT_CmdBuf.CallRtsCmd);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(SC_ProcessRtsCall(RtsIndex, SC_CALL_RTS_CC, &UT_CmdBuf.CallRtsCmd));
+
+    /* Verify results */
+    UtAssert_True(RtsInfoPtr->RtsStatus == SC_Status_LOADED, "RtsInfoPtr->RtsStatus == SC_Status_LOADED");
+    UtAssert_UINT32_EQ(RtsInfoPtr->CmdErrCtr, 1);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.RtsCmdErrCtr, 1);
+    SC_Assert_ID_VALUE(SC_OperData.HkPacket.Payload.LastRtsErrSeq, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTS_CALL_DEPTH_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_ProcessRtsCall_Test_NotStartable(void)
+{
+    SC_RtsIndex_t      RtsIndex    = SC_RTS_IDX_C(0);
+    SC_RtsIndex_t      TargetIndex = SC_RTS_IDX_C(1);
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+    SC_RtsInfoEntry_t *TargetInfoPtr;
+    size_t             MsgSize[2];
+
+    RtsInfoPtr    = SC_GetRtsInfoObject(RtsIndex);
+    TargetInfoPtr = SC_GetRtsInfoObject(TargetIndex);
+
+    RtsInfoPtr->RtsStatus                     = SC_Status_EXECUTING;
+    TargetInfoPtr->RtsStatus                  = SC_Status_LOADED;
+    TargetInfoPtr->DisabledFlag               = true;
+    SC_OperData.RtsCtrlBlckAddr->NumRtsActive = 1;
+
+    UT_CmdBuf.CallRtsCmd.Payload.RtsNum = SC_RtsIndexToNum(TargetIndex);
+
+    MsgSize[0] = sizeof(UT_CmdBuf.CallRtsCmd);
+    MsgSize[1] = SC_PACKET_MIN_SIZE;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), MsgSize, sizeof(MsgSize), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(SC_ProcessRtsCall(RtsIndex, SC_CALL_RTS_CC, &UT_CmdBuf.CallRtsCmd));
+
+    /* Verify results */
+    UtAssert_True(RtsInfoPtr->RtsStatus == SC_Status_LOADED, "RtsInfoPtr->RtsStatus == SC_Status_LOADED");
+    UtAssert_True(TargetInfoPtr->RtsStatus == SC_Status_LOADED, "TargetInfoPtr->RtsStatus == SC_Status_LOADED");
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.RtsCmdErrCtr, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTS_CALL_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_ProcessRtsCall_Test_InvalidLength(void)
+{
+    SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+    size_t             MsgSize;
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    RtsInfoPtr->RtsStatus                     = SC_Status_EXECUTING;
+    SC_OperData.RtsCtrlBlckAddr->NumRtsActive = 1;
+
+    UT_CmdBuf.CallRtsCmd.Payload.RtsNum = SC_RTS_NUM_C(2);
+
+    MsgSize = sizeof(UT_CmdBuf.CallRtsCmd) - 1;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(SC_ProcessRtsCall(RtsIndex, SC_CALL_RTS_CC, &UT_CmdBuf.CallRtsCmd));
+
+    /* Verify results */
+    UtAssert_True(RtsInfoPtr->RtsStatus == SC_Status_LOADED, "RtsInfoPtr->RtsStatus == SC_Status_LOADED");
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.RtsCmdErrCtr, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTS_CALL_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_ProcessRtsCall_Test_InvalidRtsNum(void)
+{
+    SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+    size_t             MsgSize;
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    RtsInfoPtr->RtsStatus                     = SC_Status_EXECUTING;
+    SC_OperData.RtsCtrlBlckAddr->NumRtsActive = 1;
+
+    UT_CmdBuf.CallRtsCmd.Payload.RtsNum = SC_RTS_NUM_C(SC_NUMBER_OF_RTS + 1);
+
+    MsgSize = sizeof(UT_CmdBuf.CallRtsCmd);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(SC_ProcessRtsCall(RtsIndex, SC_CHAIN_RTS_CC, &UT_CmdBuf.CallRtsCmd));
+
+    /* Verify results */
+    UtAssert_True(RtsInfoPtr->RtsStatus == SC_Status_LOADED, "RtsInfoPtr->RtsStatus == SC_Status_LOADED");
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.RtsCmdErrCtr, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTS_CALL_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_ReturnFromRts_Test_ResumesCaller(void)
+{
+    SC_RtsIndex_t      CallerIndex = SC_RTS_IDX_C(0);
+    SC_RtsIndex_t      RtsIndex    = SC_RTS_IDX_C(1);
+    SC_RtsInfoEntry_t *CallerInfoPtr;
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+
+    CallerInfoPtr = SC_GetRtsInfoObject(CallerIndex);
+    RtsInfoPtr    = SC_GetRtsInfoObject(RtsIndex);
+
+    CallerInfoPtr->RtsStatus                  = SC_Status_EXECUTING;
+    CallerInfoPtr->CalleeRtsNum               = SC_RtsIndexToNum(RtsIndex);
+    RtsInfoPtr->RtsStatus                     = SC_Status_EXECUTING;
+    RtsInfoPtr->CallerRtsNum                  = SC_RtsIndexToNum(CallerIndex);
+    SC_OperData.RtsCtrlBlckAddr->NumRtsActive = 2;
+    SC_OperData.RtsCtrlBlckAddr->CurrRtsNum   = SC_RtsIndexToNum(RtsIndex);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_ReturnFromRts(RtsIndex));
+
+    /* Verify results */
+    UtAssert_True(RtsInfoPtr->RtsStatus == SC_Status_LOADED, "RtsInfoPtr->RtsStatus == SC_Status_LOADED");
+    UtAssert_True(CallerInfoPtr->RtsStatus == SC_Status_EXECUTING, "CallerInfoPtr->RtsStatus == SC_Status_EXECUTING");
+    SC_Assert_ID_VALUE(CallerInfoPtr->CalleeRtsNum, 0);
+    SC_Assert_ID_VALUE(SC_OperData.RtsCtrlBlckAddr->CurrRtsNum, 1);
+    UtAssert_UINT32_EQ(SC_OperData.RtsCtrlBlckAddr->NumRtsActive, 1);
+    UtAssert_STUB_COUNT(SC_GetNextRtsCommand, 1);
+}
+
+void SC_ReturnFromRts_Test_NotCalled(void)
+{
+    SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(1);
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    RtsInfoPtr->RtsStatus                     = SC_Status_EXECUTING;
+    SC_OperData.RtsCtrlBlckAddr->NumRtsActive = 1;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_ReturnFromRts(RtsIndex));
+
+    /* Verify results */
+    UtAssert_True(RtsInfoPtr->RtsStatus == SC_Status_LOADED, "RtsInfoPtr->RtsStatus == SC_Status_LOADED");
+    UtAssert_STUB_COUNT(SC_GetNextRtsCommand, 0);
+}
+
+void SC_StartRtsInstanceCmd_Test_Nominal(void)
+{
+    SC_RtsEntryHeader_t *Entry;
+    SC_RtsIndex_t        RtsIndex      = SC_RTS_IDX_C(0);
+    SC_RtsIndex_t        InstanceIndex = SC_RTS_IDX_C(1);
+    size_t               MsgSize;
+    SC_RtsInfoEntry_t *  RtsInfoPtr;
+    SC_RtsInfoEntry_t *  InstanceInfoPtr;
+
+    RtsInfoPtr      = SC_GetRtsInfoObject(RtsIndex);
+    InstanceInfoPtr = SC_GetRtsInfoObject(InstanceIndex);
+
+    Entry              = (SC_RtsEntryHeader_t *)SC_GetRtsEntryAtOffset(RtsIndex, SC_ENTRY_OFFSET_FIRST);
+    Entry->WakeupCount = 0;
+
+    UT_CmdBuf.StartRtsInstanceCmd.Payload.RtsNum         = SC_RtsIndexToNum(RtsIndex);
+    UT_CmdBuf.StartRtsInstanceCmd.Payload.InstanceRtsNum = SC_RtsIndexToNum(InstanceIndex);
+
+    /* the source may itself be running */
+    RtsInfoPtr->RtsStatus = SC_Status_EXECUTING;
+
+    MsgSize = SC_PACKET_MIN_SIZE;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_StartRtsInstanceCmd(&UT_CmdBuf.StartRtsInstanceCmd));
+
+    /* Verify results */
+    UtAssert_True(InstanceInfoPtr->RtsStatus == SC_Status_EXECUTING,
+                  "InstanceInfoPtr->RtsStatus == SC_Status_EXECUTING");
+    UtAssert_True(RtsInfoPtr->RtsStatus == SC_Status_EXECUTING, "RtsInfoPtr->RtsStatus == SC_Status_EXECUTING");
+    SC_Assert_ID_VALUE(InstanceInfoPtr->SourceRtsNum, 1);
+    UtAssert_UINT32_EQ(InstanceInfoPtr->UseCtr, 1);
+    UtAssert_STUB_COUNT(SC_SeekRtsCommand, 1);
+    UtAssert_True(SC_OperData.HkPacket.Payload.CmdCtr == 1, "SC_OperData.HkPacket.Payload.CmdCtr == 1");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_STARTRTS_INSTANCE_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_StartRtsInstanceCmd_Test_AnyInstance(void)
+{
+    SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
+    size_t             MsgSize;
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+    SC_RtsInfoEntry_t *InstanceInfoPtr;
+
+    RtsInfoPtr      = SC_GetRtsInfoObject(RtsIndex);
+    InstanceInfoPtr = SC_GetRtsInfoObject(SC_RTS_IDX_C(SC_NUMBER_OF_RTS - 1));
+
+    UT_CmdBuf.StartRtsInstanceCmd.Payload.RtsNum = SC_RtsIndexToNum(RtsIndex);
+
+    RtsInfoPtr->RtsStatus = SC_Status_LOADED;
+
+    MsgSize = SC_PACKET_MIN_SIZE;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_StartRtsInstanceCmd(&UT_CmdBuf.StartRtsInstanceCmd));
+
+    /* Verify results */
+    UtAssert_True(InstanceInfoPtr->RtsStatus == SC_Status_EXECUTING,
+                  "InstanceInfoPtr->RtsStatus == SC_Status_EXECUTING");
+    SC_Assert_ID_VALUE(InstanceInfoPtr->SourceRtsNum, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_STARTRTS_INSTANCE_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_StartRtsInstanceCmd_Test_InstanceOfInstance(void)
+{
+    SC_RtsIndex_t      RtsIndex      = SC_RTS_IDX_C(1);
+    SC_RtsIndex_t      InstanceIndex = SC_RTS_IDX_C(2);
+    size_t             MsgSize;
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+    SC_RtsInfoEntry_t *InstanceInfoPtr;
+
+    RtsInfoPtr      = SC_GetRtsInfoObject(RtsIndex);
+    InstanceInfoPtr = SC_GetRtsInfoObject(InstanceIndex);
+
+    UT_CmdBuf.StartRtsInstanceCmd.Payload.RtsNum         = SC_RtsIndexToNum(RtsIndex);
+    UT_CmdBuf.StartRtsInstanceCmd.Payload.InstanceRtsNum = SC_RtsIndexToNum(InstanceIndex);
+
+    SC_GetRtsInfoObject(SC_RTS_IDX_C(0))->RtsStatus = SC_Status_LOADED;
+    RtsInfoPtr->RtsStatus                           = SC_Status_EXECUTING;
+    RtsInfoPtr->SourceRtsNum                        = SC_RTS_NUM_C(1);
+
+    MsgSize = SC_PACKET_MIN_SIZE;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_StartRtsInstanceCmd(&UT_CmdBuf.StartRtsInstanceCmd));
+
+    /* Verify results */
+    UtAssert_True(InstanceInfoPtr->RtsStatus == SC_Status_EXECUTING,
+                  "InstanceInfoPtr->RtsStatus == SC_Status_EXECUTING");
+    SC_Assert_ID_VALUE(InstanceInfoPtr->SourceRtsNum, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_STARTRTS_INSTANCE_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_StartRtsInstanceCmd_Test_NoEmptyRts(void)
+{
+    uint16 i;
+
+    UT_CmdBuf.StartRtsInstanceCmd.Payload.RtsNum = SC_RTS_NUM_C(1);
+
+    for (i = 0; i < SC_NUMBER_OF_RTS; i++)
+    {
+        SC_GetRtsInfoObject(SC_RTS_IDX_C(i))->RtsStatus = SC_Status_LOADED;
+    }
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_StartRtsInstanceCmd(&UT_CmdBuf.StartRtsInstanceCmd));
+
+    /* Verify results */
+    UtAssert_True(SC_OperData.HkPacket.Payload.CmdErrCtr == 1, "SC_OperData.HkPacket.Payload.CmdErrCtr == 1");
+    UtAssert_True(SC_OperData.HkPacket.Payload.RtsActiveErrCtr == 1,
+                  "SC_OperData.HkPacket.Payload.RtsActiveErrCtr == 1");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_STARTRTS_INSTANCE_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_StartRtsInstanceCmd_Test_InvalidRtsNum(void)
+{
+    UT_CmdBuf.StartRtsInstanceCmd.Payload.RtsNum         = SC_RTS_NUM_C(SC_NUMBER_OF_RTS + 1);
+    UT_CmdBuf.StartRtsInstanceCmd.Payload.InstanceRtsNum = SC_RTS_NUM_C(1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_StartRtsInstanceCmd(&UT_CmdBuf.StartRtsInstanceCmd));
+
+    /* Verify results */
+    UtAssert_True(SC_OperData.HkPacket.Payload.CmdErrCtr == 1, "SC_OperData.HkPacket.Payload.CmdErrCtr == 1");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_STARTRTS_INSTANCE_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_StartRtsInstanceCmd_Test_RtsNotLoaded(void)
+{
+    size_t MsgSize;
+
+    UT_CmdBuf.StartRtsInstanceCmd.Payload.RtsNum         = SC_RTS_NUM_C(1);
+    UT_CmdBuf.StartRtsInstanceCmd.Payload.InstanceRtsNum = SC_RTS_NUM_C(2);
+
+    MsgSize = SC_PACKET_MIN_SIZE;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_StartRtsInstanceCmd(&UT_CmdBuf.StartRtsInstanceCmd));
+
+    /* Verify results */
+    UtAssert_True(SC_GetRtsInfoObject(SC_RTS_IDX_C(1))->RtsStatus == SC_Status_EMPTY,
+                  "InstanceInfoPtr->RtsStatus == SC_Status_EMPTY");
+    UtAssert_True(SC_OperData.HkPacket.Payload.CmdErrCtr == 1, "SC_OperData.HkPacket.Payload.CmdErrCtr == 1");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_STARTRTS_INSTANCE_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_StartRtsInstanceCmd_Test_InstanceNotEmpty(void)
+{
+    size_t MsgSize;
+
+    UT_CmdBuf.StartRtsInstanceCmd.Payload.RtsNum         = SC_RTS_NUM_C(1);
+    UT_CmdBuf.StartRtsInstanceCmd.Payload.InstanceRtsNum = SC_RTS_NUM_C(2);
+
+    SC_GetRtsInfoObject(SC_RTS_IDX_C(0))->RtsStatus = SC_Status_LOADED;
+    SC_GetRtsInfoObject(SC_RTS_IDX_C(1))->RtsStatus = SC_Status_LOADED;
+
+    MsgSize = SC_PACKET_MIN_SIZE;
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_StartRtsInstanceCmd(&UT_CmdBuf.StartRtsInstanceCmd));
+
+    /* Verify results */
+    UtAssert_True(SC_GetRtsInfoObject(SC_RTS_IDX_C(1))->RtsStatus == SC_Status_LOADED,
+                  "InstanceInfoPtr->RtsStatus == SC_Status_LOADED");
+    UtAssert_True(SC_OperData.HkPacket.Payload.CmdErrCtr == 1, "SC_OperData.HkPacket.Payload.CmdErrCtr == 1");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_STARTRTS_INSTANCE_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_KillRtsInstances_Test(void)
+{
+    SC_RtsInfoEntry_t *InstanceInfoPtr;
+    SC_RtsInfoEntry_t *OtherInfoPtr;
+
+    InstanceInfoPtr = SC_GetRtsInfoObject(SC_RTS_IDX_C(1));
+    OtherInfoPtr    = SC_GetRtsInfoObject(SC_RTS_IDX_C(2));
+
+    InstanceInfoPtr->RtsStatus                = SC_Status_EXECUTING;
+    InstanceInfoPtr->SourceRtsNum             = SC_RTS_NUM_C(1);
+    OtherInfoPtr->RtsStatus                   = SC_Status_EXECUTING;
+    OtherInfoPtr->SourceRtsNum                = SC_RTS_NUM_C(4);
+    SC_OperData.RtsCtrlBlckAddr->NumRtsActive = 2;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_KillRtsInstances(SC_RTS_IDX_C(0)));
+
+    /* Verify results */
+    UtAssert_True(InstanceInfoPtr->RtsStatus == SC_Status_EMPTY, "InstanceInfoPtr->RtsStatus == SC_Status_EMPTY");
+    UtAssert_True(OtherInfoPtr->RtsStatus == SC_Status_EXECUTING, "OtherInfoPtr->RtsStatus == SC_Status_EXECUTING");
+    UtAssert_True(SC_OperData.RtsCtrlBlckAddr->NumRtsActive == 1, "SC_OperData.RtsCtrlBlckAddr->NumRtsActive == 1");
+}
+
+void SC_AutoStartRts_Test_Nominal(void)
+{
+    SC_RtsNum_t RtsNum = SC_RTS_NUM_C(1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_AutoStartRts(RtsNum));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_AutoStartRts_Test_InvalidId(void)
+{
+    SC_RtsNum_t RtsNum = SC_RTS_NUM_C(SC_NUMBER_OF_RTS + 1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_AutoStartRts(RtsNum));
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_AUTOSTART_RTS_INV_ID_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_AutoStartRts_Test_InvalidIdZero(void)
+{
+    SC_RtsNum_t RtsNum = SC_RTS_NUM_C(0);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_AutoStartRts(RtsNum));
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_AUTOSTART_RTS_INV_ID_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_ProcessTriggerPipe_Test_StartsRts(void)
+{
+    CFE_SB_MsgId_t     MsgId      = CFE_SB_ValueToMsgId(0x1880);
+    size_t             MsgSize    = sizeof(UT_CmdBuf);
+    CFE_SB_Buffer_t *  BufPtr     = &UT_CmdBuf.Buf;
+    SC_RtsInfoEntry_t *RtsInfoPtr = SC_GetRtsInfoObject(SC_RTS_IDX_C(0));
+
+    SC_AppData.TriggerMsgId[0]   = MsgId;
+    SC_AppData.TriggerMsgIdCount = 1;
+
+    SC_OperData.TriggerTblAddr[0].MsgId  = 0x1880;
+    SC_OperData.TriggerTblAddr[0].RtsNum = SC_RTS_NUM_C(1);
+
+    RtsInfoPtr->RtsStatus = SC_Status_LOADED;
+
+    /* one matching message is published on the trigger pipe, then it is empty */
+    UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &BufPtr, sizeof(BufPtr), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 2, CFE_SB_NO_MESSAGE);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_ProcessTriggerPipe());
+
+    /* Verify results */
+    UtAssert_INT32_EQ(RtsInfoPtr->RtsStatus, SC_Status_EXECUTING);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.RtsActiveCtr, 1);
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 2);
+    UtAssert_STUB_COUNT(SC_FlushDeferredEvents, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_TRIGGER_RTS_STARTED_DBG_EID);
+}
+
+void SC_ProcessTriggerPipe_Test_Limit(void)
+{
+    CFE_SB_MsgId_t   MsgId = CFE_SB_ValueToMsgId(0x1880);
+    CFE_SB_Buffer_t *BufPtr[SC_TRIGGER_PIPE_DEPTH + 1];
+    int32            i;
+
+    for (i = 0; i <= SC_TRIGGER_PIPE_DEPTH; i++)
+    {
+        BufPtr[i] = &UT_CmdBuf.Buf;
+    }
+
+    /* the pipe never runs dry, but each call only takes what it can hold */
+    UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), BufPtr, sizeof(BufPtr), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_ProcessTriggerPipe());
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, SC_TRIGGER_PIPE_DEPTH);
+    UtAssert_STUB_COUNT(SC_FlushDeferredEvents, SC_TRIGGER_PIPE_DEPTH);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_ProcessTriggers_Test_Nominal(void)
+{
+    CFE_SB_MsgId_t     MsgId       = CFE_SB_ValueToMsgId(0x1880);
+    size_t             MsgSize     = sizeof(UT_CmdBuf);
+    SC_RtsInfoEntry_t *RtsInfoPtr0 = SC_GetRtsInfoObject(SC_RTS_IDX_C(0));
+    SC_RtsInfoEntry_t *RtsInfoPtr1 = SC_GetRtsInfoObject(SC_RTS_IDX_C(1));
+    SC_RtsInfoEntry_t *RtsInfoPtr2 = SC_GetRtsInfoObject(SC_RTS_IDX_C(2));
+
+    SC_AppData.TriggerMsgId[0]   = MsgId;
+    SC_AppData.TriggerMsgIdCount = 1;
+
+    /* RTS 1 is started, RTS 2 is already executing, and RTS 3 is on another message */
+    SC_OperData.TriggerTblAddr[0].MsgId  = 0x1880;
+    SC_OperData.TriggerTblAddr[0].RtsNum = SC_RTS_NUM_C(1);
+    SC_OperData.TriggerTblAddr[1].MsgId  = 0x1880;
+    SC_OperData.TriggerTblAddr[1].RtsNum = SC_RTS_NUM_C(2);
+    SC_OperData.TriggerTblAddr[2].MsgId  = 0x0881;
+    SC_OperData.TriggerTblAddr[2].RtsNum = SC_RTS_NUM_C(3);
+
+    RtsInfoPtr0->RtsStatus = SC_Status_LOADED;
+    RtsInfoPtr1->RtsStatus = SC_Status_EXECUTING;
+    RtsInfoPtr2->RtsStatus = SC_Status_LOADED;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(SC_ProcessTriggers(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_INT32_EQ(RtsInfoPtr0->RtsStatus, SC_Status_EXECUTING);
+    UtAssert_INT32_EQ(RtsInfoPtr2->RtsStatus, SC_Status_LOADED);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.RtsActiveCtr, 1);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.RtsActiveErrCtr, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_TRIGGER_RTS_STARTED_DBG_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, SC_TRIGGER_RTS_SKIPPED_DBG_EID);
+}
+
+void SC_ProcessTriggers_Test_NotTrigger(void)
+{
+    CFE_SB_MsgId_t MsgId = CFE_SB_ValueToMsgId(0x1880);
+
+    /* the table names the message, but SC is not subscribed to it */
+    SC_OperData.TriggerTblAddr[0].MsgId  = 0x1880;
+    SC_OperData.TriggerTblAddr[0].RtsNum = SC_RTS_NUM_C(1);
+
+    SC_GetRtsInfoObject(SC_RTS_IDX_C(0))->RtsStatus = SC_Status_LOADED;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(SC_ProcessTriggers(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.RtsActiveCtr, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_TriggerMatches_Test(void)
+{
+    SC_TriggerEntry_t Trigger;
+    uint32            Buffer32[4];
+    uint8 *           Buffer8 = (uint8 *)Buffer32;
+    uint16            Value16 = 0x1234;
+    uint32            Value32 = 0x89ABCDEF;
+
+    memset(&Trigger, 0, sizeof(Trigger));
+    memset(Buffer32, 0, sizeof(Buffer32));
+
+    Buffer8[9] = 0x5A;
+    memcpy(&Buffer8[3], &Value16, sizeof(Value16));
+    memcpy(&Buffer8[10], &Value32, sizeof(Value32));
+
+    /* no field match */
+    UtAssert_BOOL_TRUE(SC_TriggerMatches(&Trigger, (CFE_MSG_Message_t *)Buffer32, sizeof(Buffer32)));
+
+    /* one byte field, masked */
+    Trigger.MatchSize   = sizeof(uint8);
+    Trigger.MatchOffset = 9;
+    Trigger.MatchMask   = 0x0F;
+    Trigger.MatchValue  = 0x0A;
+    UtAssert_BOOL_TRUE(SC_TriggerMatches(&Trigger, (CFE_MSG_Message_t *)Buffer32, sizeof(Buffer32)));
+    Trigger.MatchValue = 0x5A;
+    UtAssert_BOOL_FALSE(SC_TriggerMatches(&Trigger, (CFE_MSG_Message_t *)Buffer32, sizeof(Buffer32)));
+
+    /* unaligned two byte field */
+    Trigger.MatchSize   = sizeof(uint16);
+    Trigger.MatchOffset = 3;
+    Trigger.MatchMask   = 0xFFFF;
+    Trigger.MatchValue  = Value16;
+    UtAssert_BOOL_TRUE(SC_TriggerMatches(&Trigger, (CFE_MSG_Message_t *)Buffer32, sizeof(Buffer32)));
+
+    /* unaligned four byte field */
+    Trigger.MatchSize   = sizeof(uint32);
+    Trigger.MatchOffset = 10;
+    Trigger.MatchMask   = 0xFFFFFFFF;
+    Trigger.MatchValue  = Value32;
+    UtAssert_BOOL_TRUE(SC_TriggerMatches(&Trigger, (CFE_MSG_Message_t *)Buffer32, sizeof(Buffer32)));
+
+    /* the message is too short to hold the field */
+    UtAssert_BOOL_FALSE(SC_TriggerMatches(&Trigger, (CFE_MSG_Message_t *)Buffer32, 13));
+}
+
 void UtTest_Setup(void)
 {
     UtTest_Add(SC_StartRtsCmd_Test_Nominal, SC_Test_Setup, SC_Test_TearDown, "SC_StartRtsCmd_Test_Nominal");
+    UtTest_Add(SC_StartRtsCmd_Test_Deferred, SC_Test_Setup, SC_Test_TearDown, "SC_StartRtsCmd_Test_Deferred");
     UtTest_Add(SC_StartRtsCmd_Test_StartRtsNoEvents, SC_Test_Setup, SC_Test_TearDown,
                "SC_StartRtsCmd_Test_StartRtsNoEvents");
     UtTest_Add(SC_StartRtsCmd_Test_InvalidCommandLength1, SC_Test_Setup, SC_Test_TearDown,
@@ -1078,6 +2187,10 @@ void UtTest_Setup(void)
 
     UtTest_Add(SC_StartRtsCmd_Test_InvalidRtsNumZero, SC_Test_Setup, SC_Test_TearDown,
                "SC_StartRtsCmd_Test_InvalidRtsNumZero");
+    UtTest_Add(SC_StartRtsParamCmd_Test_Nominal, SC_Test_Setup, SC_Test_TearDown, "SC_StartRtsParamCmd_Test_Nominal");
+    UtTest_Add(SC_StartRtsParamCmd_Test_RtsInUse, SC_Test_Setup, SC_Test_TearDown, "SC_StartRtsParamCmd_Test_RtsInUse");
+    UtTest_Add(SC_StartRtsParamCmd_Test_InvalidRtsNum, SC_Test_Setup, SC_Test_TearDown,
+               "SC_StartRtsParamCmd_Test_InvalidRtsNum");
     UtTest_Add(SC_StartRtsGrpCmd_Test_Nominal, SC_Test_Setup, SC_Test_TearDown, "SC_StartRtsGrpCmd_Test_Nominal");
     UtTest_Add(SC_StartRtsGrpCmd_Test_StartRtsGroupError, SC_Test_Setup, SC_Test_TearDown,
                "SC_StartRtsGrpCmd_Test_StartRtsGroupError");
@@ -1093,6 +2206,7 @@ void UtTest_Setup(void)
                "SC_StartRtsGrpCmd_Test_FirstLastRtsIndex");
     UtTest_Add(SC_StartRtsGrpCmd_Test_DisabledFlag, SC_Test_Setup, SC_Test_TearDown,
                "SC_StartRtsGrpCmd_Test_DisabledFlag");
+    UtTest_Add(SC_StartRtsGrpCmd_Test_Deferred, SC_Test_Setup, SC_Test_TearDown, "SC_StartRtsGrpCmd_Test_Deferred");
     UtTest_Add(SC_StartRtsGrpCmd_Test_RtsStatus, SC_Test_Setup, SC_Test_TearDown, "SC_StartRtsGrpCmd_Test_RtsStatus");
     UtTest_Add(SC_StopRtsCmd_Test_Nominal, SC_Test_Setup, SC_Test_TearDown, "SC_StopRtsCmd_Test_Nominal");
     UtTest_Add(SC_StopRtsCmd_Test_InvalidRts, SC_Test_Setup, SC_Test_TearDown, "SC_StopRtsCmd_Test_InvalidRts");
@@ -1145,11 +2259,69 @@ void UtTest_Setup(void)
                "SC_EnableRtsGrpCmd_Test_FirstLastRtsIndex");
     UtTest_Add(SC_EnableRtsGrpCmd_Test_DisabledFlag, SC_Test_Setup, SC_Test_TearDown,
                "SC_EnableRtsGrpCmd_Test_DisabledFlag");
+    UtTest_Add(SC_StartRtsSetCmd_Test_Nominal, SC_Test_Setup, SC_Test_TearDown, "SC_StartRtsSetCmd_Test_Nominal");
+    UtTest_Add(SC_StartRtsSetCmd_Test_EmptySet, SC_Test_Setup, SC_Test_TearDown, "SC_StartRtsSetCmd_Test_EmptySet");
+    UtTest_Add(SC_StopRtsSetCmd_Test_Nominal, SC_Test_Setup, SC_Test_TearDown, "SC_StopRtsSetCmd_Test_Nominal");
+    UtTest_Add(SC_StopRtsSetCmd_Test_EmptySet, SC_Test_Setup, SC_Test_TearDown, "SC_StopRtsSetCmd_Test_EmptySet");
+    UtTest_Add(SC_DisableRtsSetCmd_Test_Nominal, SC_Test_Setup, SC_Test_TearDown, "SC_DisableRtsSetCmd_Test_Nominal");
+    UtTest_Add(SC_DisableRtsSetCmd_Test_EmptySet, SC_Test_Setup, SC_Test_TearDown, "SC_DisableRtsSetCmd_Test_EmptySet");
+    UtTest_Add(SC_EnableRtsSetCmd_Test_Nominal, SC_Test_Setup, SC_Test_TearDown, "SC_EnableRtsSetCmd_Test_Nominal");
+    UtTest_Add(SC_EnableRtsSetCmd_Test_EmptySet, SC_Test_Setup, SC_Test_TearDown, "SC_EnableRtsSetCmd_Test_EmptySet");
+    UtTest_Add(SC_SetRtsPriorityCmd_Test_Nominal, SC_Test_Setup, SC_Test_TearDown,
+               "SC_SetRtsPriorityCmd_Test_Nominal");
+    UtTest_Add(SC_SetRtsPriorityCmd_Test_EmptySet, SC_Test_Setup, SC_Test_TearDown,
+               "SC_SetRtsPriorityCmd_Test_EmptySet");
+    UtTest_Add(SC_SetRtsPriorityCmd_Test_InvalidPriority, SC_Test_Setup, SC_Test_TearDown,
+               "SC_SetRtsPriorityCmd_Test_InvalidPriority");
+    UtTest_Add(SC_RtsSetIsValid_Test, SC_Test_Setup, SC_Test_TearDown, "SC_RtsSetIsValid_Test");
     UtTest_Add(SC_KillRts_Test, SC_Test_Setup, SC_Test_TearDown, "SC_KillRts_Test");
     UtTest_Add(SC_KillRts_Test_NoActiveRts, SC_Test_Setup, SC_Test_TearDown, "SC_KillRts_Test_NoActiveRts");
     UtTest_Add(SC_KillRts_Test_InvalidIndex, SC_Test_Setup, SC_Test_TearDown, "SC_KillRts_Test_InvalidIndex");
+    UtTest_Add(SC_KillRts_Test_UnwindsCaller, SC_Test_Setup, SC_Test_TearDown,
+               "SC_KillRts_Test_UnwindsCaller");
+    UtTest_Add(SC_KillRts_Test_Instance, SC_Test_Setup, SC_Test_TearDown, "SC_KillRts_Test_Instance");
+    UtTest_Add(SC_ProcessRtsCall_Test_Call, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessRtsCall_Test_Call");
+    UtTest_Add(SC_ProcessRtsCall_Test_Chain, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessRtsCall_Test_Chain");
+    UtTest_Add(SC_ProcessRtsCall_Test_ChainSelf, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessRtsCall_Test_ChainSelf");
+    UtTest_Add(SC_ProcessRtsCall_Test_CallDepth, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessRtsCall_Test_CallDepth");
+    UtTest_Add(SC_ProcessRtsCall_Test_NotStartable, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessRtsCall_Test_NotStartable");
+    UtTest_Add(SC_ProcessRtsCall_Test_InvalidLength, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessRtsCall_Test_InvalidLength");
+    UtTest_Add(SC_ProcessRtsCall_Test_InvalidRtsNum, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessRtsCall_Test_InvalidRtsNum");
+    UtTest_Add(SC_ReturnFromRts_Test_ResumesCaller, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ReturnFromRts_Test_ResumesCaller");
+    UtTest_Add(SC_ReturnFromRts_Test_NotCalled, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ReturnFromRts_Test_NotCalled");
+    UtTest_Add(SC_StartRtsInstanceCmd_Test_Nominal, SC_Test_Setup, SC_Test_TearDown,
+               "SC_StartRtsInstanceCmd_Test_Nominal");
+    UtTest_Add(SC_StartRtsInstanceCmd_Test_AnyInstance, SC_Test_Setup, SC_Test_TearDown,
+               "SC_StartRtsInstanceCmd_Test_AnyInstance");
+    UtTest_Add(SC_StartRtsInstanceCmd_Test_InstanceOfInstance, SC_Test_Setup, SC_Test_TearDown,
+               "SC_StartRtsInstanceCmd_Test_InstanceOfInstance");
+    UtTest_Add(SC_StartRtsInstanceCmd_Test_NoEmptyRts, SC_Test_Setup, SC_Test_TearDown,
+               "SC_StartRtsInstanceCmd_Test_NoEmptyRts");
+    UtTest_Add(SC_StartRtsInstanceCmd_Test_InvalidRtsNum, SC_Test_Setup, SC_Test_TearDown,
+               "SC_StartRtsInstanceCmd_Test_InvalidRtsNum");
+    UtTest_Add(SC_StartRtsInstanceCmd_Test_RtsNotLoaded, SC_Test_Setup, SC_Test_TearDown,
+               "SC_StartRtsInstanceCmd_Test_RtsNotLoaded");
+    UtTest_Add(SC_StartRtsInstanceCmd_Test_InstanceNotEmpty, SC_Test_Setup, SC_Test_TearDown,
+               "SC_StartRtsInstanceCmd_Test_InstanceNotEmpty");
+    UtTest_Add(SC_KillRtsInstances_Test, SC_Test_Setup, SC_Test_TearDown, "SC_KillRtsInstances_Test");
     UtTest_Add(SC_AutoStartRts_Test_Nominal, SC_Test_Setup, SC_Test_TearDown, "SC_AutoStartRts_Test_Nominal");
     UtTest_Add(SC_AutoStartRts_Test_InvalidId, SC_Test_Setup, SC_Test_TearDown, "SC_AutoStartRts_Test_InvalidId");
     UtTest_Add(SC_AutoStartRts_Test_InvalidIdZero, SC_Test_Setup, SC_Test_TearDown,
                "SC_AutoStartRts_Test_InvalidIdZero");
+    UtTest_Add(SC_ProcessTriggerPipe_Test_StartsRts, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessTriggerPipe_Test_StartsRts");
+    UtTest_Add(SC_ProcessTriggerPipe_Test_Limit, SC_Test_Setup, SC_Test_TearDown, "SC_ProcessTriggerPipe_Test_Limit");
+    UtTest_Add(SC_ProcessTriggers_Test_Nominal, SC_Test_Setup, SC_Test_TearDown, "SC_ProcessTriggers_Test_Nominal");
+    UtTest_Add(SC_ProcessTriggers_Test_NotTrigger, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessTriggers_Test_NotTrigger");
+    UtTest_Add(SC_TriggerMatches_Test, SC_Test_Setup, SC_Test_TearDown, "SC_TriggerMatches_Test");
 }
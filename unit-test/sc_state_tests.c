@@ -121,6 +121,155 @@ void SC_GetNextRtsTime_Test_RtsPriority(void)
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
+void SC_GetNextRtsTime_Test_TimedNotDue(void)
+{
+    SC_RtsInfoEntry_t *RtsInfoPtr0;
+    SC_RtsInfoEntry_t *RtsInfoPtr1;
+
+    RtsInfoPtr0 = SC_GetRtsInfoObject(SC_RTS_IDX_C(0));
+    RtsInfoPtr1 = SC_GetRtsInfoObject(SC_RTS_IDX_C(1));
+
+    RtsInfoPtr0->RtsStatus            = SC_Status_EXECUTING;
+    RtsInfoPtr0->TimedFlag            = true;
+    RtsInfoPtr0->NextCommandTgtWakeup = 0;
+
+    RtsInfoPtr1->RtsStatus            = SC_Status_EXECUTING;
+    RtsInfoPtr1->NextCommandTgtWakeup = 10;
+
+    /* the command of the timed RTS is not due yet */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TIME_Compare), CFE_TIME_A_GT_B);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_GetNextRtsTime());
+
+    /* Verify results */
+    SC_Assert_ID_VALUE(SC_OperData.RtsCtrlBlckAddr->CurrRtsNum, 2);
+    UtAssert_UINT32_EQ(SC_AppData.NextCmdTime[SC_Process_RTP], 10);
+    UtAssert_UINT32_EQ(RtsInfoPtr0->NextCommandTgtWakeup, 0);
+
+    UtAssert_STUB_COUNT(CFE_TIME_Compare, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_GetNextRtsTime_Test_TimedDue(void)
+{
+    SC_RtsInfoEntry_t *RtsInfoPtr0;
+    SC_RtsInfoEntry_t *RtsInfoPtr1;
+
+    RtsInfoPtr0 = SC_GetRtsInfoObject(SC_RTS_IDX_C(0));
+    RtsInfoPtr1 = SC_GetRtsInfoObject(SC_RTS_IDX_C(1));
+
+    RtsInfoPtr0->RtsStatus            = SC_Status_EXECUTING;
+    RtsInfoPtr0->TimedFlag            = true;
+    RtsInfoPtr0->NextCommandTgtWakeup = 0;
+
+    RtsInfoPtr1->RtsStatus            = SC_Status_EXECUTING;
+    RtsInfoPtr1->NextCommandTgtWakeup = 10;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TIME_Compare), CFE_TIME_A_LT_B);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_GetNextRtsTime());
+
+    /* Verify results */
+    SC_Assert_ID_VALUE(SC_OperData.RtsCtrlBlckAddr->CurrRtsNum, 1);
+    UtAssert_UINT32_EQ(SC_AppData.NextCmdTime[SC_Process_RTP], 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_GetNextRtsTime_Test_TimedHeld(void)
+{
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+
+    RtsInfoPtr = SC_GetRtsInfoObject(SC_RTS_IDX_C(0));
+
+    /* a timed RTS waiting on an RTS it called is not checked against the time */
+    RtsInfoPtr->RtsStatus            = SC_Status_EXECUTING;
+    RtsInfoPtr->TimedFlag            = true;
+    RtsInfoPtr->NextCommandTgtWakeup = SC_MAX_WAKEUP_CNT;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_GetNextRtsTime());
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(SC_AppData.NextCmdTime[SC_Process_RTP], SC_MAX_WAKEUP_CNT);
+
+    UtAssert_STUB_COUNT(CFE_TIME_Compare, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_GetNextRtsTime_Test_DuePriority(void)
+{
+    SC_RtsInfoEntry_t *RtsInfoPtr0;
+    SC_RtsInfoEntry_t *RtsInfoPtr1;
+
+    RtsInfoPtr0 = SC_GetRtsInfoObject(SC_RTS_IDX_C(0));
+    RtsInfoPtr1 = SC_GetRtsInfoObject(SC_RTS_IDX_C(1));
+
+    SC_AppData.CurrentWakeupCount = 20;
+
+    /* both are due, the higher priority level goes first even though it is later */
+    RtsInfoPtr0->RtsStatus            = SC_Status_EXECUTING;
+    RtsInfoPtr0->NextCommandTgtWakeup = 5;
+    RtsInfoPtr0->Priority             = 1;
+
+    RtsInfoPtr1->RtsStatus            = SC_Status_EXECUTING;
+    RtsInfoPtr1->NextCommandTgtWakeup = 15;
+    RtsInfoPtr1->Priority             = 0;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_GetNextRtsTime());
+
+    /* Verify results */
+    SC_Assert_ID_VALUE(SC_OperData.RtsCtrlBlckAddr->CurrRtsNum, 2);
+    UtAssert_UINT32_EQ(SC_AppData.NextCmdTime[SC_Process_RTP], 15);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_GetNextRtsTime_Test_DueTurns(void)
+{
+    SC_RtsInfoEntry_t *RtsInfoPtr0;
+    SC_RtsInfoEntry_t *RtsInfoPtr1;
+    SC_RtsInfoEntry_t *RtsInfoPtr2;
+
+    RtsInfoPtr0 = SC_GetRtsInfoObject(SC_RTS_IDX_C(0));
+    RtsInfoPtr1 = SC_GetRtsInfoObject(SC_RTS_IDX_C(1));
+    RtsInfoPtr2 = SC_GetRtsInfoObject(SC_RTS_IDX_C(2));
+
+    SC_AppData.CurrentWakeupCount = 20;
+
+    RtsInfoPtr0->RtsStatus            = SC_Status_EXECUTING;
+    RtsInfoPtr0->NextCommandTgtWakeup = 5;
+    RtsInfoPtr2->RtsStatus            = SC_Status_EXECUTING;
+    RtsInfoPtr2->NextCommandTgtWakeup = 5;
+
+    /* a not yet due RTS is passed over */
+    RtsInfoPtr1->RtsStatus            = SC_Status_EXECUTING;
+    RtsInfoPtr1->NextCommandTgtWakeup = 30;
+
+    /* RTS 1 had the last turn, so RTS 3 has this one */
+    SC_AppData.RtsLastServed[0] = SC_RTS_IDX_C(0);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_GetNextRtsTime());
+
+    /* Verify results */
+    SC_Assert_ID_VALUE(SC_OperData.RtsCtrlBlckAddr->CurrRtsNum, 3);
+
+    /* RTS 3 had the last turn, so it goes back around to RTS 1 */
+    SC_AppData.RtsLastServed[0] = SC_RTS_IDX_C(2);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_GetNextRtsTime());
+
+    /* Verify results */
+    SC_Assert_ID_VALUE(SC_OperData.RtsCtrlBlckAddr->CurrRtsNum, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void SC_GetNextRtsCommand_Test_GetNextCommand(void)
 {
     size_t             MsgSize;
@@ -280,8 +429,8 @@ void SC_GetNextRtsCommand_Test_RtsLengthError(void)
     RtsInfoPtr->RtsStatus                   = SC_Status_EXECUTING;
 
     Entry = (SC_RtsEntryHeader_t *)SC_GetRtsEntryAtOffset(RtsIndex, SC_ENTRY_OFFSET_FIRST);
-    EntryOffsetVal =
-        SC_RTS_BUFF_SIZE32 - SC_RTS_HDR_WORDS - ((SC_PACKET_MIN_SIZE + SC_RTS_HEADER_SIZE + 3) / SC_BYTES_IN_WORD);
+    EntryOffsetVal = SC_GetRtsSize(RtsIndex) - SC_RTS_HDR_WORDS -
+                     ((SC_PACKET_MIN_SIZE + SC_RTS_HEADER_SIZE + 3) / SC_BYTES_IN_WORD);
 
     /* Set to generate error message SC_RTS_LNGTH_ERR_EID */
     CFE_MSG_Init((CFE_MSG_Message_t *)Entry, CFE_SB_ValueToMsgId(SC_CMD_MID), SC_PACKET_MAX_SIZE);
@@ -332,8 +481,8 @@ void SC_GetNextRtsCommand_Test_CommandLengthError(void)
     RtsInfoPtr->RtsStatus                   = SC_Status_EXECUTING;
 
     Entry = (SC_RtsEntryHeader_t *)SC_GetRtsEntryAtOffset(RtsIndex, SC_ENTRY_OFFSET_FIRST);
-    EntryOffsetVal =
-        SC_RTS_BUFF_SIZE32 - SC_RTS_HDR_WORDS - ((SC_PACKET_MIN_SIZE + SC_RTS_HEADER_SIZE + 3) / SC_BYTES_IN_WORD);
+    EntryOffsetVal = SC_GetRtsSize(RtsIndex) - SC_RTS_HDR_WORDS -
+                     ((SC_PACKET_MIN_SIZE + SC_RTS_HEADER_SIZE + 3) / SC_BYTES_IN_WORD);
 
     /* Set to generate error message SC_RTS_LNGTH_ERR_EID */
     CFE_MSG_Init((CFE_MSG_Message_t *)Entry, CFE_SB_ValueToMsgId(SC_CMD_MID), SC_PACKET_MAX_SIZE);
@@ -384,8 +533,8 @@ void SC_GetNextRtsCommand_Test_ZeroCommandLength(void)
     RtsInfoPtr->RtsStatus                   = SC_Status_EXECUTING;
 
     Entry = (SC_RtsEntryHeader_t *)SC_GetRtsEntryAtOffset(RtsIndex, SC_ENTRY_OFFSET_FIRST);
-    EntryOffsetVal =
-        SC_RTS_BUFF_SIZE32 - SC_RTS_HDR_WORDS - ((SC_PACKET_MIN_SIZE + SC_RTS_HEADER_SIZE + 3) / SC_BYTES_IN_WORD) - 1;
+    EntryOffsetVal = SC_GetRtsSize(RtsIndex) - SC_RTS_HDR_WORDS -
+                     ((SC_PACKET_MIN_SIZE + SC_RTS_HEADER_SIZE + 3) / SC_BYTES_IN_WORD) - 1;
 
     /* Set to generate error message SC_RTS_LNGTH_ERR_EID */
     CFE_MSG_Init((CFE_MSG_Message_t *)Entry, CFE_SB_ValueToMsgId(SC_CMD_MID), SC_PACKET_MIN_SIZE - 1);
@@ -407,6 +556,7 @@ void SC_GetNextRtsCommand_Test_ZeroCommandLength(void)
     /* Verify results */
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTS_COMPL_INF_EID);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(SC_ReturnFromRts, 1);
 }
 
 void SC_GetNextRtsCommand_Test_ZeroCommandLengthLastRts(void)
@@ -432,8 +582,8 @@ void SC_GetNextRtsCommand_Test_ZeroCommandLengthLastRts(void)
         RtsInfoPtr->RtsStatus                   = SC_Status_EXECUTING;
 
         Entry = (SC_RtsEntryHeader_t *)SC_GetRtsEntryAtOffset(RtsIndex, SC_ENTRY_OFFSET_FIRST);
-        EntryOffsetVal =
-            SC_RTS_BUFF_SIZE32 - SC_RTS_HDR_WORDS - ((SC_PACKET_MIN_SIZE + SC_RTS_HEADER_SIZE + 3) / SC_BYTES_IN_WORD) - 1;
+        EntryOffsetVal = SC_GetRtsSize(RtsIndex) - SC_RTS_HDR_WORDS -
+                         ((SC_PACKET_MIN_SIZE + SC_RTS_HEADER_SIZE + 3) / SC_BYTES_IN_WORD) - 1;
 
         /* Set to generate error message SC_RTS_LNGTH_ERR_EID */
         CFE_MSG_Init((CFE_MSG_Message_t *)Entry, CFE_SB_ValueToMsgId(SC_CMD_MID), SC_PACKET_MIN_SIZE - 1);
@@ -476,8 +626,8 @@ void SC_GetNextRtsCommand_Test_EndOfBuffer(void)
     RtsInfoPtr->RtsStatus                   = SC_Status_EXECUTING;
 
     Entry = (SC_RtsEntryHeader_t *)SC_GetRtsEntryAtOffset(RtsIndex, SC_ENTRY_OFFSET_FIRST);
-    EntryOffsetVal =
-        SC_RTS_BUFF_SIZE32 - SC_RTS_HDR_WORDS - ((SC_PACKET_MIN_SIZE + SC_RTS_HEADER_SIZE + 3) / SC_BYTES_IN_WORD) - 1;
+    EntryOffsetVal = SC_GetRtsSize(RtsIndex) - SC_RTS_HDR_WORDS -
+                     ((SC_PACKET_MIN_SIZE + SC_RTS_HEADER_SIZE + 3) / SC_BYTES_IN_WORD) - 1;
 
     /* Set to generate error message SC_RTS_LNGTH_ERR_EID */
     CFE_MSG_Init((CFE_MSG_Message_t *)Entry, CFE_SB_ValueToMsgId(SC_CMD_MID), 2 * SC_RTS_BUFF_SIZE);
@@ -497,6 +647,45 @@ void SC_GetNextRtsCommand_Test_EndOfBuffer(void)
     /* Verify results */
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTS_COMPL_INF_EID);
     UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(SC_ReturnFromRts, 1);
+}
+
+void SC_GetNextRtsCommand_Test_EndOfBufferDeferred(void)
+{
+    SC_RtsEntryHeader_t *Entry;
+    size_t               MsgSize;
+    uint32               EntryOffsetVal;
+    SC_RtsIndex_t        RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsInfoEntry_t *  RtsInfoPtr;
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    SC_AppData.NextCmdTime[SC_Process_RTP]  = 0;
+    SC_AppData.CurrentTime                  = 1;
+    SC_OperData.RtsCtrlBlckAddr->CurrRtsNum = SC_RtsIndexToNum(RtsIndex);
+    RtsInfoPtr->RtsStatus                   = SC_Status_EXECUTING;
+
+    Entry = (SC_RtsEntryHeader_t *)SC_GetRtsEntryAtOffset(RtsIndex, SC_ENTRY_OFFSET_FIRST);
+    EntryOffsetVal = SC_GetRtsSize(RtsIndex) - SC_RTS_HDR_WORDS -
+                     ((SC_PACKET_MIN_SIZE + SC_RTS_HEADER_SIZE + 3) / SC_BYTES_IN_WORD) - 1;
+
+    CFE_MSG_Init((CFE_MSG_Message_t *)Entry, CFE_SB_ValueToMsgId(SC_CMD_MID), 2 * SC_RTS_BUFF_SIZE);
+    MsgSize = 2 * SC_RTS_BUFF_SIZE;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    RtsInfoPtr->NextCommandPtr = SC_ENTRY_OFFSET_C(EntryOffsetVal);
+
+    /* The completion is queued for a summary */
+    UT_SetDefaultReturnValue(UT_KEY(SC_DeferEvent), true);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_GetNextRtsCommand());
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(SC_DeferEvent, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+    UtAssert_STUB_COUNT(SC_ReturnFromRts, 1);
 }
 
 void SC_GetNextRtsCommand_Test_EndOfBufferLastRts(void)
@@ -521,8 +710,8 @@ void SC_GetNextRtsCommand_Test_EndOfBufferLastRts(void)
         RtsInfoPtr->RtsStatus                   = SC_Status_EXECUTING;
 
         Entry = (SC_RtsEntryHeader_t *)SC_GetRtsEntryAtOffset(RtsIndex, SC_ENTRY_OFFSET_FIRST);
-        EntryOffsetVal =
-            SC_RTS_BUFF_SIZE32 - SC_RTS_HDR_WORDS - ((SC_PACKET_MIN_SIZE + SC_RTS_HEADER_SIZE + 3) / SC_BYTES_IN_WORD) - 1;
+        EntryOffsetVal = SC_GetRtsSize(RtsIndex) - SC_RTS_HDR_WORDS -
+                         ((SC_PACKET_MIN_SIZE + SC_RTS_HEADER_SIZE + 3) / SC_BYTES_IN_WORD) - 1;
 
         /* Set to generate error message SC_RTS_LNGTH_ERR_EID */
         CFE_MSG_Init((CFE_MSG_Message_t *)Entry, CFE_SB_ValueToMsgId(SC_CMD_MID), 2 * SC_RTS_BUFF_SIZE);
@@ -544,6 +733,358 @@ void SC_GetNextRtsCommand_Test_EndOfBufferLastRts(void)
     }
 }
 
+void SC_SeekRtsCommand_Test_Loop(void)
+{
+    SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+    SC_RtsLoopCmd_t *  LoopCmd;
+    SC_EntryOffset_t   BodyOffset;
+    size_t             MsgSize[3];
+    CFE_SB_MsgId_t     MsgId[2];
+    CFE_MSG_FcnCode_t  FcnCode[2];
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    RtsInfoPtr->RtsStatus      = SC_Status_EXECUTING;
+    LoopCmd                    = (SC_RtsLoopCmd_t *)&SC_GetRtsEntryAtOffset(RtsIndex, SC_ENTRY_OFFSET_FIRST)->Msg;
+    LoopCmd->Payload.LoopCount = 3;
+    BodyOffset = SC_EntryOffsetAdvance(SC_ENTRY_OFFSET_FIRST, sizeof(SC_RtsLoopCmd_t) + SC_RTS_HEADER_SIZE);
+
+    /* a loop entry followed by a command for another app */
+    MsgSize[0] = sizeof(SC_RtsLoopCmd_t);
+    MsgSize[1] = sizeof(SC_RtsLoopCmd_t);
+    MsgSize[2] = SC_PACKET_MIN_SIZE;
+    MsgId[0]   = CFE_SB_ValueToMsgId(SC_CMD_MID);
+    MsgId[1]   = SC_UT_MID_1;
+    FcnCode[0] = SC_RTS_LOOP_CC;
+    FcnCode[1] = 0;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), MsgSize, sizeof(MsgSize), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), FcnCode, sizeof(FcnCode), false);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_SeekRtsCommand(RtsIndex, SC_ENTRY_OFFSET_FIRST));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(RtsInfoPtr->LoopDepth, 1);
+    UtAssert_UINT32_EQ(RtsInfoPtr->LoopCount[0], 3);
+    SC_Assert_IDX_EQ(RtsInfoPtr->LoopStart[0], BodyOffset);
+    SC_Assert_IDX_EQ(RtsInfoPtr->NextCommandPtr, BodyOffset);
+    UtAssert_UINT32_EQ(RtsInfoPtr->RtsStatus, SC_Status_EXECUTING);
+
+    UtAssert_STUB_COUNT(SC_KillRts, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_SeekRtsCommand_Test_EmptyRts(void)
+{
+    SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    RtsInfoPtr->RtsStatus                                  = SC_Status_EXECUTING;
+    SC_AppData.RtsPoolBlock[SC_IDX_AS_UINT(RtsIndex)].Size = 0;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_SeekRtsCommand(RtsIndex, SC_ENTRY_OFFSET_FIRST));
+
+    /* Verify results, an RTS with no room for a command ends without reading the pool */
+    UtAssert_STUB_COUNT(CFE_MSG_GetSize, 0);
+    UtAssert_STUB_COUNT(SC_ReturnFromRts, 1);
+    UtAssert_STUB_COUNT(SC_KillRts, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTS_COMPL_INF_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_SeekRtsCommand_Test_CtrlStepsError(void)
+{
+    SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+    SC_RtsGotoCmd_t *  GotoCmd;
+    size_t             MsgSize[2 * (SC_RTS_MAX_CTRL_STEPS + 1)];
+    CFE_SB_MsgId_t     MsgId[SC_RTS_MAX_CTRL_STEPS + 1];
+    CFE_MSG_FcnCode_t  FcnCode[SC_RTS_MAX_CTRL_STEPS + 1];
+    int                i;
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    RtsInfoPtr->RtsStatus        = SC_Status_EXECUTING;
+    GotoCmd                      = (SC_RtsGotoCmd_t *)&SC_GetRtsEntryAtOffset(RtsIndex, SC_ENTRY_OFFSET_FIRST)->Msg;
+    GotoCmd->Payload.EntryOffset = 0;
+
+    /* an entry that goes to itself never reaches a command */
+    for (i = 0; i < SC_RTS_MAX_CTRL_STEPS + 1; i++)
+    {
+        MsgSize[2 * i]     = sizeof(SC_RtsGotoCmd_t);
+        MsgSize[2 * i + 1] = sizeof(SC_RtsGotoCmd_t);
+        MsgId[i]           = CFE_SB_ValueToMsgId(SC_CMD_MID);
+        FcnCode[i]         = SC_RTS_GOTO_CC;
+    }
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), MsgSize, sizeof(MsgSize), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), FcnCode, sizeof(FcnCode), false);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_SeekRtsCommand(RtsIndex, SC_ENTRY_OFFSET_FIRST));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.RtsCmdErrCtr, 1);
+    UtAssert_UINT32_EQ(RtsInfoPtr->CmdErrCtr, 1);
+    SC_Assert_ID_EQ(SC_OperData.HkPacket.Payload.LastRtsErrSeq, SC_RtsIndexToNum(RtsIndex));
+    SC_Assert_IDX_EQ(SC_OperData.HkPacket.Payload.LastRtsErrCmd, SC_ENTRY_OFFSET_FIRST);
+
+    UtAssert_STUB_COUNT(SC_KillRts, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTS_CTRL_STEPS_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+static void UT_SC_RtsDueTimeHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_TIME_SysTime_t DueTime = {100, 0x80000000};
+
+    UT_Stub_SetReturnValue(FuncKey, DueTime);
+}
+
+void SC_SeekRtsCommand_Test_Timed(void)
+{
+    SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+    SC_RtsEntry_t *    EntryPtr;
+    SC_EntryOffset_t   CmdOffset;
+    size_t             MsgSize[3];
+    CFE_SB_MsgId_t     MsgId[2];
+    CFE_MSG_FcnCode_t  FcnCode[2];
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    RtsInfoPtr->RtsStatus                = SC_Status_EXECUTING;
+    SC_AppData.CurrentWakeupCount        = 50;
+    SC_AppData.CurrentSysTime.Seconds    = 99;
+    SC_AppData.CurrentSysTime.Subseconds = 0;
+
+    /* a timed entry followed by a command 1.5 seconds later */
+    CmdOffset = SC_EntryOffsetAdvance(SC_ENTRY_OFFSET_FIRST, sizeof(SC_RtsTimedCmd_t) + SC_RTS_HEADER_SIZE);
+    EntryPtr  = SC_GetRtsEntryAtOffset(RtsIndex, CmdOffset);
+    EntryPtr->Header.WakeupCount = 0x00018000;
+
+    MsgSize[0] = sizeof(SC_RtsTimedCmd_t);
+    MsgSize[1] = sizeof(SC_RtsTimedCmd_t);
+    MsgSize[2] = SC_PACKET_MIN_SIZE;
+    MsgId[0]   = CFE_SB_ValueToMsgId(SC_CMD_MID);
+    MsgId[1]   = SC_UT_MID_1;
+    FcnCode[0] = SC_RTS_TIMED_CC;
+    FcnCode[1] = 0;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), MsgSize, sizeof(MsgSize), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), FcnCode, sizeof(FcnCode), false);
+    UT_SetHandlerFunction(UT_KEY(SC_ComputeRtsDueTime), UT_SC_RtsDueTimeHandler, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_SeekRtsCommand(RtsIndex, SC_ENTRY_OFFSET_FIRST));
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(RtsInfoPtr->TimedFlag);
+    UtAssert_UINT32_EQ(RtsInfoPtr->NextCommandTime.Seconds, 100);
+    UtAssert_UINT32_EQ(RtsInfoPtr->NextCommandTime.Subseconds, 0x80000000);
+    UtAssert_UINT32_EQ(RtsInfoPtr->NextCommandTgtWakeup, 50);
+    SC_Assert_IDX_EQ(RtsInfoPtr->NextCommandPtr, CmdOffset);
+
+    UtAssert_STUB_COUNT(SC_ComputeRtsDueTime, 1);
+    UtAssert_STUB_COUNT(SC_ComputeAbsWakeup, 0);
+    UtAssert_STUB_COUNT(SC_KillRts, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_ProcessRtsControl_Test_EndLoopRepeat(void)
+{
+    SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+    SC_EntryOffset_t   CmdOffset = SC_ENTRY_OFFSET_C(10);
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    RtsInfoPtr->LoopDepth    = 1;
+    RtsInfoPtr->LoopCount[0] = 3;
+    RtsInfoPtr->LoopStart[0] = SC_ENTRY_OFFSET_C(4);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(SC_ProcessRtsControl(RtsIndex, SC_RTS_END_LOOP_CC, &CmdOffset));
+
+    /* Verify results */
+    SC_Assert_IDX_VALUE(CmdOffset, 4);
+    UtAssert_UINT32_EQ(RtsInfoPtr->LoopDepth, 1);
+    UtAssert_UINT32_EQ(RtsInfoPtr->LoopCount[0], 2);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_ProcessRtsControl_Test_EndLoopDone(void)
+{
+    SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+    SC_EntryOffset_t   CmdOffset = SC_ENTRY_OFFSET_C(10);
+    size_t             MsgSize   = sizeof(SC_RtsEndLoopCmd_t);
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    RtsInfoPtr->LoopDepth    = 2;
+    RtsInfoPtr->LoopCount[1] = 1;
+    RtsInfoPtr->LoopStart[1] = SC_ENTRY_OFFSET_C(4);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(SC_ProcessRtsControl(RtsIndex, SC_RTS_END_LOOP_CC, &CmdOffset));
+
+    /* Verify results */
+    SC_Assert_IDX_EQ(CmdOffset,
+                     SC_EntryOffsetAdvance(SC_ENTRY_OFFSET_C(10), sizeof(SC_RtsEndLoopCmd_t) + SC_RTS_HEADER_SIZE));
+    UtAssert_UINT32_EQ(RtsInfoPtr->LoopDepth, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_ProcessRtsControl_Test_EndLoopForever(void)
+{
+    SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+    SC_EntryOffset_t   CmdOffset = SC_ENTRY_OFFSET_C(10);
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    RtsInfoPtr->LoopDepth    = 1;
+    RtsInfoPtr->LoopCount[0] = SC_RTS_LOOP_FOREVER;
+    RtsInfoPtr->LoopStart[0] = SC_ENTRY_OFFSET_C(4);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(SC_ProcessRtsControl(RtsIndex, SC_RTS_END_LOOP_CC, &CmdOffset));
+
+    /* Verify results */
+    SC_Assert_IDX_VALUE(CmdOffset, 4);
+    UtAssert_UINT32_EQ(RtsInfoPtr->LoopDepth, 1);
+    UtAssert_UINT32_EQ(RtsInfoPtr->LoopCount[0], SC_RTS_LOOP_FOREVER);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_ProcessRtsControl_Test_Goto(void)
+{
+    SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+    SC_RtsGotoCmd_t *  GotoCmd;
+    SC_EntryOffset_t   CmdOffset = SC_ENTRY_OFFSET_C(10);
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    RtsInfoPtr->LoopDepth        = 2;
+    GotoCmd                      = (SC_RtsGotoCmd_t *)&SC_GetRtsEntryAtOffset(RtsIndex, CmdOffset)->Msg;
+    GotoCmd->Payload.EntryOffset = 2;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(SC_ProcessRtsControl(RtsIndex, SC_RTS_GOTO_CC, &CmdOffset));
+
+    /* Verify results */
+    SC_Assert_IDX_VALUE(CmdOffset, 2);
+    UtAssert_UINT32_EQ(RtsInfoPtr->LoopDepth, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_ProcessRtsControl_Test_LoopDepthError(void)
+{
+    SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+    SC_EntryOffset_t   CmdOffset = SC_ENTRY_OFFSET_C(10);
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    RtsInfoPtr->LoopDepth = SC_RTS_MAX_LOOP_DEPTH;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(SC_ProcessRtsControl(RtsIndex, SC_RTS_LOOP_CC, &CmdOffset));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(RtsInfoPtr->LoopDepth, SC_RTS_MAX_LOOP_DEPTH);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.RtsCmdErrCtr, 1);
+    UtAssert_UINT32_EQ(RtsInfoPtr->CmdErrCtr, 1);
+    SC_Assert_IDX_VALUE(SC_OperData.HkPacket.Payload.LastRtsErrCmd, 10);
+
+    UtAssert_STUB_COUNT(SC_KillRts, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTS_LOOP_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_ProcessRtsControl_Test_EndLoopNoLoop(void)
+{
+    SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+    SC_EntryOffset_t   CmdOffset = SC_ENTRY_OFFSET_C(10);
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(SC_ProcessRtsControl(RtsIndex, SC_RTS_END_LOOP_CC, &CmdOffset));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.RtsCmdErrCtr, 1);
+    UtAssert_UINT32_EQ(RtsInfoPtr->CmdErrCtr, 1);
+
+    UtAssert_STUB_COUNT(SC_KillRts, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTS_LOOP_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
+void SC_ProcessRtsControl_Test_Patch(void)
+{
+    SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+    SC_EntryOffset_t   CmdOffset = SC_ENTRY_OFFSET_C(10);
+    size_t             MsgSize   = sizeof(SC_RtsPatchCmd_t);
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    RtsInfoPtr->PatchCount = 1;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(SC_ProcessRtsControl(RtsIndex, SC_RTS_PATCH_CC, &CmdOffset));
+
+    /* Verify results */
+    SC_Assert_IDX_EQ(CmdOffset,
+                     SC_EntryOffsetAdvance(SC_ENTRY_OFFSET_C(10), sizeof(SC_RtsPatchCmd_t) + SC_RTS_HEADER_SIZE));
+    UtAssert_UINT32_EQ(RtsInfoPtr->PatchCount, 2);
+    SC_Assert_IDX_VALUE(RtsInfoPtr->PatchEntry[1], 10);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_ProcessRtsControl_Test_PatchCountError(void)
+{
+    SC_RtsIndex_t      RtsIndex = SC_RTS_IDX_C(0);
+    SC_RtsInfoEntry_t *RtsInfoPtr;
+    SC_EntryOffset_t   CmdOffset = SC_ENTRY_OFFSET_C(10);
+
+    RtsInfoPtr = SC_GetRtsInfoObject(RtsIndex);
+
+    RtsInfoPtr->PatchCount = SC_RTS_MAX_PATCHES;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(SC_ProcessRtsControl(RtsIndex, SC_RTS_PATCH_CC, &CmdOffset));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(RtsInfoPtr->PatchCount, SC_RTS_MAX_PATCHES);
+    UtAssert_UINT32_EQ(SC_OperData.HkPacket.Payload.RtsCmdErrCtr, 1);
+
+    UtAssert_STUB_COUNT(SC_KillRts, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTS_PATCH_ERR_EID);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
 void SC_GetNextAtsCommand_Test_Starting(void)
 {
     SC_OperData.AtsCtrlBlckAddr->AtpState = SC_Status_STARTING;
@@ -684,6 +1225,14 @@ void UtTest_Setup(void)
                "SC_GetNextRtsTime_Test_InvalidRtsNum");
     UtTest_Add(SC_GetNextRtsTime_Test_RtsPriority, SC_Test_Setup, SC_Test_TearDown,
                "SC_GetNextRtsTime_Test_RtsPriority");
+    UtTest_Add(SC_GetNextRtsTime_Test_TimedNotDue, SC_Test_Setup, SC_Test_TearDown,
+               "SC_GetNextRtsTime_Test_TimedNotDue");
+    UtTest_Add(SC_GetNextRtsTime_Test_TimedDue, SC_Test_Setup, SC_Test_TearDown, "SC_GetNextRtsTime_Test_TimedDue");
+    UtTest_Add(SC_GetNextRtsTime_Test_TimedHeld, SC_Test_Setup, SC_Test_TearDown,
+               "SC_GetNextRtsTime_Test_TimedHeld");
+    UtTest_Add(SC_GetNextRtsTime_Test_DuePriority, SC_Test_Setup, SC_Test_TearDown,
+               "SC_GetNextRtsTime_Test_DuePriority");
+    UtTest_Add(SC_GetNextRtsTime_Test_DueTurns, SC_Test_Setup, SC_Test_TearDown, "SC_GetNextRtsTime_Test_DueTurns");
     UtTest_Add(SC_GetNextRtsCommand_Test_GetNextCommand, SC_Test_Setup, SC_Test_TearDown,
                "SC_GetNextRtsCommand_Test_GetNextCommand");
     UtTest_Add(SC_GetNextRtsCommand_Test_RtsNumZero, SC_Test_Setup, SC_Test_TearDown,
@@ -706,6 +1255,30 @@ void UtTest_Setup(void)
                "SC_GetNextRtsCommand_Test_EndOfBufferLastRts");
     UtTest_Add(SC_GetNextRtsCommand_Test_EndOfBuffer, SC_Test_Setup, SC_Test_TearDown,
                "SC_GetNextRtsCommand_Test_EndOfBuffer");
+    UtTest_Add(SC_GetNextRtsCommand_Test_EndOfBufferDeferred, SC_Test_Setup, SC_Test_TearDown,
+               "SC_GetNextRtsCommand_Test_EndOfBufferDeferred");
+    UtTest_Add(SC_SeekRtsCommand_Test_Loop, SC_Test_Setup, SC_Test_TearDown,
+               "SC_SeekRtsCommand_Test_Loop");
+    UtTest_Add(SC_SeekRtsCommand_Test_EmptyRts, SC_Test_Setup, SC_Test_TearDown, "SC_SeekRtsCommand_Test_EmptyRts");
+    UtTest_Add(SC_SeekRtsCommand_Test_CtrlStepsError, SC_Test_Setup, SC_Test_TearDown,
+               "SC_SeekRtsCommand_Test_CtrlStepsError");
+    UtTest_Add(SC_SeekRtsCommand_Test_Timed, SC_Test_Setup, SC_Test_TearDown, "SC_SeekRtsCommand_Test_Timed");
+    UtTest_Add(SC_ProcessRtsControl_Test_EndLoopRepeat, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessRtsControl_Test_EndLoopRepeat");
+    UtTest_Add(SC_ProcessRtsControl_Test_EndLoopDone, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessRtsControl_Test_EndLoopDone");
+    UtTest_Add(SC_ProcessRtsControl_Test_EndLoopForever, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessRtsControl_Test_EndLoopForever");
+    UtTest_Add(SC_ProcessRtsControl_Test_Goto, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessRtsControl_Test_Goto");
+    UtTest_Add(SC_ProcessRtsControl_Test_LoopDepthError, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessRtsControl_Test_LoopDepthError");
+    UtTest_Add(SC_ProcessRtsControl_Test_EndLoopNoLoop, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessRtsControl_Test_EndLoopNoLoop");
+    UtTest_Add(SC_ProcessRtsControl_Test_Patch, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessRtsControl_Test_Patch");
+    UtTest_Add(SC_ProcessRtsControl_Test_PatchCountError, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ProcessRtsControl_Test_PatchCountError");
     UtTest_Add(SC_GetNextAtsCommand_Test_Starting, SC_Test_Setup, SC_Test_TearDown,
                "SC_GetNextAtsCommand_Test_Starting");
     UtTest_Add(SC_GetNextAtsCommand_Test_Idle, SC_Test_Setup, SC_Test_TearDown, "SC_GetNextAtsCommand_Test_Idle");
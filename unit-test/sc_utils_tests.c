@@ -86,11 +86,294 @@ void SC_ComputeAbsTime_Test(void)
 void SC_ComputeAbsWakeup_Test(void)
 {
     SC_AppData.CurrentWakeupCount = 0;
+    SC_AppData.InWakeup           = true;
 
     /* Execute the function being tested */
     UtAssert_UINT32_EQ(SC_ComputeAbsWakeup(1), 1);
 }
 
+void SC_ComputeAbsWakeup_Test_BetweenWakeups(void)
+{
+    SC_AppData.CurrentWakeupCount = 6;
+    SC_AppData.InWakeup           = false;
+
+    /* Execute the function being tested: counted from the wakeup that will next run */
+    UtAssert_UINT32_EQ(SC_ComputeAbsWakeup(0), 7);
+    UtAssert_UINT32_EQ(SC_ComputeAbsWakeup(2), 9);
+}
+
+void SC_ComputeRtsDueTime_Test(void)
+{
+    CFE_TIME_SysTime_t PrevTime = {10, 0};
+
+    /* Execute the function being tested */
+    SC_ComputeRtsDueTime(PrevTime, 0x00018000);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_TIME_Add, 1);
+}
+
+static void UT_SC_TimeSubtractHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_TIME_SysTime_t *Delta = UserObj;
+
+    UT_Stub_SetReturnValue(FuncKey, *Delta);
+}
+
+void SC_WakeupsToTime_Test(void)
+{
+    CFE_TIME_SysTime_t Span;
+
+    /* Execute the function being tested */
+    Span = SC_WakeupsToTime(3 * SC_WAKEUPS_PER_SECOND);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Span.Seconds, 3);
+    UtAssert_ZERO(Span.Subseconds);
+
+    Span = SC_WakeupsToTime(0);
+
+    UtAssert_ZERO(Span.Seconds);
+    UtAssert_ZERO(Span.Subseconds);
+}
+
+void SC_RecordDispatchLatency_Test(void)
+{
+    CFE_TIME_SysTime_t ScheduledTime = {1230, 0};
+    CFE_TIME_SysTime_t Delta         = {4, 0};
+    SC_LatencyHist_t * HistPtr       = &SC_OperData.DiagPacket.Payload.Latency[SC_Process_ATP];
+
+    SC_AppData.TimeRef = (SC_TimeAccessor_t) {UT_TimeRefFunc};
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TIME_Compare), CFE_TIME_A_GT_B);
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_Subtract), UT_SC_TimeSubtractHandler, &Delta);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TIME_Sub2MicroSecs), 500);
+
+    /* Execute the function being tested: 4.0005 seconds late */
+    UtAssert_VOIDCALL(SC_RecordDispatchLatency(SC_Process_ATP, ScheduledTime));
+
+    /* Verify results: 4000 ms is in the bin from 2048 ms to 4096 ms */
+    UtAssert_UINT32_EQ(HistPtr->Count, 1);
+    UtAssert_UINT32_EQ(HistPtr->MinUsec, 4000500);
+    UtAssert_UINT32_EQ(HistPtr->MaxUsec, 4000500);
+    UtAssert_UINT32_EQ(HistPtr->Bin[12], 1);
+    UtAssert_UINT32_EQ(SC_AppData.LatencySumUsec[SC_Process_ATP], 4000500);
+
+    /* A command sent ahead of its time counts as on time */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TIME_Compare), CFE_TIME_A_LT_B);
+
+    UtAssert_VOIDCALL(SC_RecordDispatchLatency(SC_Process_ATP, ScheduledTime));
+
+    UtAssert_UINT32_EQ(HistPtr->Count, 2);
+    UtAssert_ZERO(HistPtr->MinUsec);
+    UtAssert_UINT32_EQ(HistPtr->MaxUsec, 4000500);
+    UtAssert_UINT32_EQ(HistPtr->Bin[0], 1);
+    UtAssert_ZERO(SC_OperData.DiagPacket.Payload.Latency[SC_Process_RTP].Count);
+}
+
+void SC_RecordDispatchLatency_Test_LateRts(void)
+{
+    CFE_TIME_SysTime_t ScheduledTime = {1230, 0};
+    CFE_TIME_SysTime_t Delta;
+    SC_LatencyHist_t * HistPtr = &SC_OperData.DiagPacket.Payload.Latency[SC_Process_RTP];
+
+    SC_AppData.TimeRef = (SC_TimeAccessor_t) {UT_TimeRefFunc};
+
+    /* an RTS command sent 3 wakeups after its wakeup count, with its scheduled time back-dated to match */
+    Delta = SC_WakeupsToTime(3 * SC_WAKEUPS_PER_SECOND);
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TIME_Compare), CFE_TIME_A_GT_B);
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_Subtract), UT_SC_TimeSubtractHandler, &Delta);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_RecordDispatchLatency(SC_Process_RTP, ScheduledTime));
+
+    /* Verify results: 3000 ms is in the bin from 2048 ms to 4096 ms, not the on time bin */
+    UtAssert_UINT32_EQ(HistPtr->Count, 1);
+    UtAssert_ZERO(HistPtr->Bin[0]);
+    UtAssert_UINT32_EQ(HistPtr->Bin[12], 1);
+    UtAssert_UINT32_EQ(HistPtr->MaxUsec, 3000000);
+}
+
+void SC_RecordDispatchLatency_Test_Saturate(void)
+{
+    CFE_TIME_SysTime_t ScheduledTime = {0, 0};
+    CFE_TIME_SysTime_t Delta         = {5000, 0};
+    SC_LatencyHist_t * HistPtr       = &SC_OperData.DiagPacket.Payload.Latency[SC_Process_RTP];
+
+    SC_AppData.TimeRef = (SC_TimeAccessor_t) {UT_TimeRefFunc};
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TIME_Compare), CFE_TIME_A_GT_B);
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_Subtract), UT_SC_TimeSubtractHandler, &Delta);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_RecordDispatchLatency(SC_Process_RTP, ScheduledTime));
+
+    /* Verify results: too late to measure goes in the last bin */
+    UtAssert_UINT32_EQ(HistPtr->MaxUsec, SC_MAX_TIME);
+    UtAssert_UINT32_EQ(HistPtr->Bin[SC_LATENCY_HIST_BINS - 1], 1);
+}
+
+void SC_RecordTrace_Test(void)
+{
+    CFE_TIME_SysTime_t ScheduledTime = {1230, 0};
+    SC_TraceTable_t *  TracePtr      = SC_OperData.TraceTblAddr;
+    SC_TraceEntry_t *  EntryPtr      = &TracePtr->Entry[SC_TRACE_ENTRIES - 1];
+
+    SC_AppData.TimeRef = (SC_TimeAccessor_t) {UT_TimeRefFunc};
+
+    /* start on the last entry so the ring wraps */
+    TracePtr->NextEntry = SC_TRACE_ENTRIES - 1;
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_RecordTrace(SC_Process_RTP, 5, 12, SC_UT_MID_1, SC_NOOP_CC, ScheduledTime,
+                                     SC_Status_FAILED_DISTRIB));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(EntryPtr->ScheduledTime.Seconds, 1230);
+    UtAssert_UINT32_EQ(EntryPtr->SourceNum, 5);
+    UtAssert_UINT32_EQ(EntryPtr->CmdId, 12);
+    UtAssert_UINT32_EQ(EntryPtr->Process, SC_Process_RTP);
+    UtAssert_UINT32_EQ(EntryPtr->FcnCode, SC_NOOP_CC);
+    UtAssert_UINT32_EQ(EntryPtr->Status, SC_Status_FAILED_DISTRIB);
+    UtAssert_ZERO(TracePtr->NextEntry);
+    UtAssert_UINT32_EQ(TracePtr->EntryCount, 1);
+}
+
+void SC_BeginEndPhase_Test(void)
+{
+    CFE_TIME_SysTime_t Delta    = {0, 0};
+    SC_PhaseStats_t *  StatsPtr = &SC_OperData.DiagPacket.Payload.Phase[SC_Phase_APPEND];
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TIME_Compare), CFE_TIME_A_GT_B);
+    UT_SetHandlerFunction(UT_KEY(CFE_TIME_Subtract), UT_SC_TimeSubtractHandler, &Delta);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TIME_Sub2MicroSecs), 250);
+
+    /* Execute the function being tested: a phase that takes 250 us */
+    UtAssert_VOIDCALL(SC_BeginPhase(SC_Phase_APPEND));
+    UtAssert_VOIDCALL(SC_EndPhase(SC_Phase_APPEND));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_ES_PerfLogEntry, 1);
+    UtAssert_STUB_COUNT(CFE_ES_PerfLogExit, 1);
+    UtAssert_STUB_COUNT(CFE_TIME_GetMET, 2);
+    UtAssert_UINT32_EQ(StatsPtr->Count, 1);
+    UtAssert_UINT32_EQ(StatsPtr->LastUsec, 250);
+    UtAssert_UINT32_EQ(StatsPtr->MaxUsec, 250);
+    UtAssert_UINT32_EQ(SC_AppData.PhaseSumUsec[SC_Phase_APPEND], 250);
+
+    /* A clock stepped back between the two counts as no time */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TIME_Compare), CFE_TIME_A_LT_B);
+
+    UtAssert_VOIDCALL(SC_BeginPhase(SC_Phase_APPEND));
+    UtAssert_VOIDCALL(SC_EndPhase(SC_Phase_APPEND));
+
+    UtAssert_UINT32_EQ(StatsPtr->Count, 2);
+    UtAssert_ZERO(StatsPtr->LastUsec);
+    UtAssert_UINT32_EQ(StatsPtr->MaxUsec, 250);
+    UtAssert_UINT32_EQ(SC_AppData.PhaseSumUsec[SC_Phase_APPEND], 250);
+    UtAssert_ZERO(SC_OperData.DiagPacket.Payload.Phase[SC_Phase_WAKEUP].Count);
+}
+
+void SC_DeferEvent_Test(void)
+{
+    uint16 i;
+
+    /* Immediate mode leaves the event to the caller */
+    SC_OperData.HkPacket.Payload.EventMode = SC_EventMode_IMMEDIATE;
+
+    UtAssert_BOOL_FALSE(SC_DeferEvent(SC_RTS_COMPL_INF_EID, 3));
+    UtAssert_ZERO(SC_AppData.NumDeferredEvents);
+
+    SC_OperData.HkPacket.Payload.EventMode = SC_EventMode_DEFERRED;
+
+    UtAssert_BOOL_TRUE(SC_DeferEvent(SC_RTS_COMPL_INF_EID, 3));
+    UtAssert_UINT32_EQ(SC_AppData.NumDeferredEvents, 1);
+    UtAssert_UINT32_EQ(SC_AppData.DeferredEvent[0].EventID, SC_RTS_COMPL_INF_EID);
+    UtAssert_UINT32_EQ(SC_AppData.DeferredEvent[0].Num, 3);
+
+    /* A full queue leaves the event to the caller */
+    for (i = 1; i < SC_DEFERRED_EVENT_DEPTH; i++)
+    {
+        UtAssert_BOOL_TRUE(SC_DeferEvent(SC_RTS_COMPL_INF_EID, i));
+    }
+
+    UtAssert_BOOL_FALSE(SC_DeferEvent(SC_RTS_COMPL_INF_EID, 3));
+    UtAssert_UINT32_EQ(SC_AppData.NumDeferredEvents, SC_DEFERRED_EVENT_DEPTH);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void SC_FlushDeferredEvents_Test(void)
+{
+    SC_OperData.HkPacket.Payload.EventMode = SC_EventMode_DEFERRED;
+
+    SC_DeferEvent(SC_RTS_COMPL_INF_EID, 3);
+    SC_DeferEvent(SC_RTS_START_INF_EID, 4);
+    SC_DeferEvent(SC_RTS_COMPL_INF_EID, 5);
+    SC_DeferEvent(SC_RTS_START_INF_EID, 6);
+    SC_DeferEvent(SC_RTS_COMPL_INF_EID, 9);
+    SC_DeferEvent(SC_NOOP_INF_EID, 1);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_FlushDeferredEvents());
+
+    /* Verify results: one summary per event ID, in the order first queued */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 3);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTS_COMPL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, SC_RTS_START_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventID, SC_NOOP_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+    UtAssert_ZERO(SC_AppData.NumDeferredEvents);
+
+    /* Nothing queued sends nothing */
+    UtAssert_VOIDCALL(SC_FlushDeferredEvents());
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 3);
+}
+
+void SC_FlushDeferredEvents_Test_Errors(void)
+{
+    SC_OperData.HkPacket.Payload.EventMode = SC_EventMode_DEFERRED;
+
+    SC_DeferEvent(SC_RTS_CHKSUM_ERR_EID, 3);
+    SC_DeferEvent(SC_RTS_DIST_ERR_EID, 4);
+    SC_DeferEvent(SC_RTS_CHKSUM_ERR_EID, 5);
+    SC_DeferEvent(SC_STARTRTSGRP_CMD_NOT_LDED_ERR_EID, 6);
+    SC_DeferEvent(SC_STARTRTSGRP_CMD_DISABLED_ERR_EID, 7);
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_FlushDeferredEvents());
+
+    /* Verify results: the summaries of errors are errors */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 4);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTS_CHKSUM_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, SC_RTS_DIST_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[3].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void SC_FlushDeferredEvents_Test_LongList(void)
+{
+    uint16 i;
+
+    SC_OperData.HkPacket.Payload.EventMode = SC_EventMode_DEFERRED;
+
+    /* More numbers than fit in one event message */
+    for (i = 0; i < SC_DEFERRED_EVENT_DEPTH; i++)
+    {
+        SC_DeferEvent(SC_RTS_START_INF_EID, 60000 + i);
+    }
+
+    /* Execute the function being tested */
+    UtAssert_VOIDCALL(SC_FlushDeferredEvents());
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, SC_RTS_START_INF_EID);
+    UtAssert_ZERO(SC_AppData.NumDeferredEvents);
+}
+
 void SC_CompareAbsTime_Test_True(void)
 {
     SC_AbsTimeTag_t AbsTimeTag1 = {0};
@@ -131,6 +414,23 @@ void UtTest_Setup(void)
     UtTest_Add(SC_GetAtsEntryTime_Test, SC_Test_Setup, SC_Test_TearDown, "SC_GetAtsEntryTime_Test");
     UtTest_Add(SC_ComputeAbsTime_Test, SC_Test_Setup, SC_Test_TearDown, "SC_ComputeAbsTime_Test");
     UtTest_Add(SC_ComputeAbsWakeup_Test, SC_Test_Setup, SC_Test_TearDown, "SC_ComputeAbsWakeup_Test");
+    UtTest_Add(SC_ComputeAbsWakeup_Test_BetweenWakeups, SC_Test_Setup, SC_Test_TearDown,
+               "SC_ComputeAbsWakeup_Test_BetweenWakeups");
+    UtTest_Add(SC_ComputeRtsDueTime_Test, SC_Test_Setup, SC_Test_TearDown, "SC_ComputeRtsDueTime_Test");
+    UtTest_Add(SC_WakeupsToTime_Test, SC_Test_Setup, SC_Test_TearDown, "SC_WakeupsToTime_Test");
+    UtTest_Add(SC_RecordDispatchLatency_Test, SC_Test_Setup, SC_Test_TearDown, "SC_RecordDispatchLatency_Test");
+    UtTest_Add(SC_RecordDispatchLatency_Test_LateRts, SC_Test_Setup, SC_Test_TearDown,
+               "SC_RecordDispatchLatency_Test_LateRts");
+    UtTest_Add(SC_RecordDispatchLatency_Test_Saturate, SC_Test_Setup, SC_Test_TearDown,
+               "SC_RecordDispatchLatency_Test_Saturate");
+    UtTest_Add(SC_RecordTrace_Test, SC_Test_Setup, SC_Test_TearDown, "SC_RecordTrace_Test");
+    UtTest_Add(SC_BeginEndPhase_Test, SC_Test_Setup, SC_Test_TearDown, "SC_BeginEndPhase_Test");
+    UtTest_Add(SC_DeferEvent_Test, SC_Test_Setup, SC_Test_TearDown, "SC_DeferEvent_Test");
+    UtTest_Add(SC_FlushDeferredEvents_Test, SC_Test_Setup, SC_Test_TearDown, "SC_FlushDeferredEvents_Test");
+    UtTest_Add(SC_FlushDeferredEvents_Test_Errors, SC_Test_Setup, SC_Test_TearDown,
+               "SC_FlushDeferredEvents_Test_Errors");
+    UtTest_Add(SC_FlushDeferredEvents_Test_LongList, SC_Test_Setup, SC_Test_TearDown,
+               "SC_FlushDeferredEvents_Test_LongList");
     UtTest_Add(SC_CompareAbsTime_Test_True, SC_Test_Setup, SC_Test_TearDown, "SC_CompareAbsTime_Test_True");
     UtTest_Add(SC_CompareAbsTime_Test_False, SC_Test_Setup, SC_Test_TearDown, "SC_CompareAbsTime_Test_False");
     UtTest_Add(SC_ToggleAtsIndex_Test, SC_Test_Setup, SC_Test_TearDown, "SC_ToggleAtsIndex_Test");
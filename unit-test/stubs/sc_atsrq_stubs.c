@@ -67,6 +67,26 @@ void SC_ContinueAtsOnFailureCmd(const SC_ContinueAtsOnFailureCmd_t *Cmd)
     UT_GenStub_Execute(SC_ContinueAtsOnFailureCmd, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_FindAtsSeqForTime()
+ * ----------------------------------------------------
+ */
+SC_SeqIndex_t SC_FindAtsSeqForTime(SC_AtsIndex_t AtsIndex, SC_AbsTimeTag_t SearchTime, SC_SeqIndex_t First,
+                                   uint32 Limit)
+{
+    UT_GenStub_SetupReturnBuffer(SC_FindAtsSeqForTime, SC_SeqIndex_t);
+
+    UT_GenStub_AddParam(SC_FindAtsSeqForTime, SC_AtsIndex_t, AtsIndex);
+    UT_GenStub_AddParam(SC_FindAtsSeqForTime, SC_AbsTimeTag_t, SearchTime);
+    UT_GenStub_AddParam(SC_FindAtsSeqForTime, SC_SeqIndex_t, First);
+    UT_GenStub_AddParam(SC_FindAtsSeqForTime, uint32, Limit);
+
+    UT_GenStub_Execute(SC_FindAtsSeqForTime, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SC_FindAtsSeqForTime, SC_SeqIndex_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for SC_InlineSwitch()
@@ -103,6 +123,62 @@ void SC_KillAts(void)
     UT_GenStub_Execute(SC_KillAts, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_ProcessAtsStatusSummary()
+ * ----------------------------------------------------
+ */
+void SC_ProcessAtsStatusSummary(uint32 MaxEntries)
+{
+    UT_GenStub_AddParam(SC_ProcessAtsStatusSummary, uint32, MaxEntries);
+
+    UT_GenStub_Execute(SC_ProcessAtsStatusSummary, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_QueryAtsWindowCmd()
+ * ----------------------------------------------------
+ */
+void SC_QueryAtsWindowCmd(const SC_QueryAtsWindowCmd_t *Cmd)
+{
+    UT_GenStub_AddParam(SC_QueryAtsWindowCmd, const SC_QueryAtsWindowCmd_t *, Cmd);
+
+    UT_GenStub_Execute(SC_QueryAtsWindowCmd, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_ReportAtsStatusCmd()
+ * ----------------------------------------------------
+ */
+void SC_ReportAtsStatusCmd(const SC_ReportAtsStatusCmd_t *Cmd)
+{
+    UT_GenStub_AddParam(SC_ReportAtsStatusCmd, const SC_ReportAtsStatusCmd_t *, Cmd);
+
+    UT_GenStub_Execute(SC_ReportAtsStatusCmd, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_SendAtsStatusPacket()
+ * ----------------------------------------------------
+ */
+void SC_SendAtsStatusPacket(void)
+{
+    UT_GenStub_Execute(SC_SendAtsStatusPacket, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_SendAtsWindowPacket()
+ * ----------------------------------------------------
+ */
+void SC_SendAtsWindowPacket(void)
+{
+    UT_GenStub_Execute(SC_SendAtsWindowPacket, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for SC_ServiceSwitchPend()
@@ -137,6 +213,18 @@ void SC_StopAtsCmd(const SC_StopAtsCmd_t *Cmd)
     UT_GenStub_Execute(SC_StopAtsCmd, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_StopAtsStatusSummary()
+ * ----------------------------------------------------
+ */
+void SC_StopAtsStatusSummary(SC_AtsIndex_t AtsIndex)
+{
+    UT_GenStub_AddParam(SC_StopAtsStatusSummary, SC_AtsIndex_t, AtsIndex);
+
+    UT_GenStub_Execute(SC_StopAtsStatusSummary, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for SC_SwitchAtsCmd()
@@ -26,6 +26,35 @@
 #include "sc_cmds.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_CopyLocalCmd()
+ * ----------------------------------------------------
+ */
+const CFE_SB_Buffer_t *SC_CopyLocalCmd(const CFE_MSG_Message_t *Msg)
+{
+    UT_GenStub_SetupReturnBuffer(SC_CopyLocalCmd, const CFE_SB_Buffer_t *);
+
+    UT_GenStub_AddParam(SC_CopyLocalCmd, const CFE_MSG_Message_t *, Msg);
+
+    UT_GenStub_Execute(SC_CopyLocalCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SC_CopyLocalCmd, const CFE_SB_Buffer_t *);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_InsertLookaheadEntry()
+ * ----------------------------------------------------
+ */
+void SC_InsertLookaheadEntry(const SC_LookaheadEntry_t *Entry, uint16 MaxEntries)
+{
+    UT_GenStub_AddParam(SC_InsertLookaheadEntry, const SC_LookaheadEntry_t *, Entry);
+    UT_GenStub_AddParam(SC_InsertLookaheadEntry, uint16, MaxEntries);
+
+    UT_GenStub_Execute(SC_InsertLookaheadEntry, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for SC_ManageAtsTable()
@@ -99,6 +128,24 @@ void SC_WakeupCmd(const SC_WakeupCmd_t *Cmd)
     UT_GenStub_Execute(SC_WakeupCmd, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_PatchRtsCommand()
+ * ----------------------------------------------------
+ */
+bool SC_PatchRtsCommand(SC_RtsIndex_t RtsIndex, const CFE_MSG_Message_t *Msg, CFE_MSG_Message_t *PatchedMsg)
+{
+    UT_GenStub_SetupReturnBuffer(SC_PatchRtsCommand, bool);
+
+    UT_GenStub_AddParam(SC_PatchRtsCommand, SC_RtsIndex_t, RtsIndex);
+    UT_GenStub_AddParam(SC_PatchRtsCommand, const CFE_MSG_Message_t *, Msg);
+    UT_GenStub_AddParam(SC_PatchRtsCommand, CFE_MSG_Message_t *, PatchedMsg);
+
+    UT_GenStub_Execute(SC_PatchRtsCommand, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SC_PatchRtsCommand, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for SC_ProcessAtpCmd()
@@ -119,6 +166,18 @@ void SC_ProcessRtpCommand(void)
     UT_GenStub_Execute(SC_ProcessRtpCommand, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_QueryLookaheadCmd()
+ * ----------------------------------------------------
+ */
+void SC_QueryLookaheadCmd(const SC_QueryLookaheadCmd_t *Cmd)
+{
+    UT_GenStub_AddParam(SC_QueryLookaheadCmd, const SC_QueryLookaheadCmd_t *, Cmd);
+
+    UT_GenStub_Execute(SC_QueryLookaheadCmd, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for SC_ResetCountersCmd()
@@ -131,6 +190,28 @@ void SC_ResetCountersCmd(const SC_ResetCountersCmd_t *Cmd)
     UT_GenStub_Execute(SC_ResetCountersCmd, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_ResetDiagCmd()
+ * ----------------------------------------------------
+ */
+void SC_ResetDiagCmd(const SC_ResetDiagCmd_t *Cmd)
+{
+    UT_GenStub_AddParam(SC_ResetDiagCmd, const SC_ResetDiagCmd_t *, Cmd);
+
+    UT_GenStub_Execute(SC_ResetDiagCmd, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_SendDiagPacket()
+ * ----------------------------------------------------
+ */
+void SC_SendDiagPacket(void)
+{
+    UT_GenStub_Execute(SC_SendDiagPacket, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for SC_SendHkCmd()
@@ -152,3 +233,15 @@ void SC_SendHkPacket(void)
 {
     UT_GenStub_Execute(SC_SendHkPacket, Basic, NULL);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_SetEventModeCmd()
+ * ----------------------------------------------------
+ */
+void SC_SetEventModeCmd(const SC_SetEventModeCmd_t *Cmd)
+{
+    UT_GenStub_AddParam(SC_SetEventModeCmd, const SC_SetEventModeCmd_t *, Cmd);
+
+    UT_GenStub_Execute(SC_SetEventModeCmd, Basic, NULL);
+}
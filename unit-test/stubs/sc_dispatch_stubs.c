@@ -27,6 +27,22 @@
 #include "sc_dispatch.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_GetCmdLength()
+ * ----------------------------------------------------
+ */
+size_t SC_GetCmdLength(CFE_MSG_FcnCode_t CommandCode)
+{
+    UT_GenStub_SetupReturnBuffer(SC_GetCmdLength, size_t);
+
+    UT_GenStub_AddParam(SC_GetCmdLength, CFE_MSG_FcnCode_t, CommandCode);
+
+    UT_GenStub_Execute(SC_GetCmdLength, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SC_GetCmdLength, size_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for SC_ProcessCommand()
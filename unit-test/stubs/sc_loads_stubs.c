@@ -26,6 +26,53 @@
 #include "sc_loads.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_AllocRtsBlock()
+ * ----------------------------------------------------
+ */
+bool SC_AllocRtsBlock(SC_RtsIndex_t RtsIndex, uint32 Size)
+{
+    UT_GenStub_SetupReturnBuffer(SC_AllocRtsBlock, bool);
+
+    UT_GenStub_AddParam(SC_AllocRtsBlock, SC_RtsIndex_t, RtsIndex);
+    UT_GenStub_AddParam(SC_AllocRtsBlock, uint32, Size);
+
+    UT_GenStub_Execute(SC_AllocRtsBlock, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SC_AllocRtsBlock, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_AtsCmdIsLater()
+ * ----------------------------------------------------
+ */
+bool SC_AtsCmdIsLater(SC_AtsIndex_t AtsIndex, SC_CommandNum_t CmdNum1, SC_CommandNum_t CmdNum2)
+{
+    UT_GenStub_SetupReturnBuffer(SC_AtsCmdIsLater, bool);
+
+    UT_GenStub_AddParam(SC_AtsCmdIsLater, SC_AtsIndex_t, AtsIndex);
+    UT_GenStub_AddParam(SC_AtsCmdIsLater, SC_CommandNum_t, CmdNum1);
+    UT_GenStub_AddParam(SC_AtsCmdIsLater, SC_CommandNum_t, CmdNum2);
+
+    UT_GenStub_Execute(SC_AtsCmdIsLater, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SC_AtsCmdIsLater, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_BeginAtsLoad()
+ * ----------------------------------------------------
+ */
+void SC_BeginAtsLoad(SC_AtsIndex_t AtsIndex)
+{
+    UT_GenStub_AddParam(SC_BeginAtsLoad, SC_AtsIndex_t, AtsIndex);
+
+    UT_GenStub_Execute(SC_BeginAtsLoad, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for SC_BuildTimeIndexTable()
@@ -40,28 +87,80 @@ void SC_BuildTimeIndexTable(SC_AtsIndex_t AtsIndex)
 
 /*
  * ----------------------------------------------------
- * Generated stub function for SC_InitAtsTables()
+ * Generated stub function for SC_CompactRtsPool()
  * ----------------------------------------------------
  */
-void SC_InitAtsTables(SC_AtsIndex_t AtsIndex)
+void SC_CompactRtsPool(void)
 {
-    UT_GenStub_AddParam(SC_InitAtsTables, SC_AtsIndex_t, AtsIndex);
+    UT_GenStub_Execute(SC_CompactRtsPool, Basic, NULL);
+}
 
-    UT_GenStub_Execute(SC_InitAtsTables, Basic, NULL);
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_FindRtsPoolGap()
+ * ----------------------------------------------------
+ */
+uint32 SC_FindRtsPoolGap(uint32 Size)
+{
+    UT_GenStub_SetupReturnBuffer(SC_FindRtsPoolGap, uint32);
+
+    UT_GenStub_AddParam(SC_FindRtsPoolGap, uint32, Size);
+
+    UT_GenStub_Execute(SC_FindRtsPoolGap, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SC_FindRtsPoolGap, uint32);
 }
 
 /*
  * ----------------------------------------------------
- * Generated stub function for SC_Insert()
+ * Generated stub function for SC_ForecastAtsLoad()
  * ----------------------------------------------------
  */
-void SC_Insert(SC_AtsIndex_t AtsIndex, SC_CommandIndex_t NewCmdIndex, uint32 ListLength)
+bool SC_ForecastAtsLoad(uint32 NumCmds)
 {
-    UT_GenStub_AddParam(SC_Insert, SC_AtsIndex_t, AtsIndex);
-    UT_GenStub_AddParam(SC_Insert, SC_CommandIndex_t, NewCmdIndex);
-    UT_GenStub_AddParam(SC_Insert, uint32, ListLength);
+    UT_GenStub_SetupReturnBuffer(SC_ForecastAtsLoad, bool);
+
+    UT_GenStub_AddParam(SC_ForecastAtsLoad, uint32, NumCmds);
+
+    UT_GenStub_Execute(SC_ForecastAtsLoad, Basic, NULL);
 
-    UT_GenStub_Execute(SC_Insert, Basic, NULL);
+    return UT_GenStub_GetReturnValue(SC_ForecastAtsLoad, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_GetRtsLength()
+ * ----------------------------------------------------
+ */
+uint32 SC_GetRtsLength(uint32 Buffer32[])
+{
+    UT_GenStub_SetupReturnBuffer(SC_GetRtsLength, uint32);
+
+    UT_GenStub_Execute(SC_GetRtsLength, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SC_GetRtsLength, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_IndexAtsLoadEntry()
+ * ----------------------------------------------------
+ */
+void SC_IndexAtsLoadEntry(void)
+{
+    UT_GenStub_Execute(SC_IndexAtsLoadEntry, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_InitAtsTables()
+ * ----------------------------------------------------
+ */
+void SC_InitAtsTables(SC_AtsIndex_t AtsIndex)
+{
+    UT_GenStub_AddParam(SC_InitAtsTables, SC_AtsIndex_t, AtsIndex);
+
+    UT_GenStub_Execute(SC_InitAtsTables, Basic, NULL);
 }
 
 /*
@@ -88,6 +187,16 @@ void SC_LoadRts(SC_RtsIndex_t RtsIndex)
     UT_GenStub_Execute(SC_LoadRts, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_ParseAtsLoadEntry()
+ * ----------------------------------------------------
+ */
+void SC_ParseAtsLoadEntry(void)
+{
+    UT_GenStub_Execute(SC_ParseAtsLoadEntry, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for SC_ParseRts()
@@ -114,6 +223,106 @@ void SC_ProcessAppend(SC_AtsIndex_t AtsIndex)
     UT_GenStub_Execute(SC_ProcessAppend, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_ProcessAtsLoad()
+ * ----------------------------------------------------
+ */
+bool SC_ProcessAtsLoad(uint32 MaxEntries)
+{
+    UT_GenStub_SetupReturnBuffer(SC_ProcessAtsLoad, bool);
+
+    UT_GenStub_AddParam(SC_ProcessAtsLoad, uint32, MaxEntries);
+
+    UT_GenStub_Execute(SC_ProcessAtsLoad, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SC_ProcessAtsLoad, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_RtsEntryWords()
+ * ----------------------------------------------------
+ */
+uint16 SC_RtsEntryWords(uint32 Buffer32[], uint16 Offset)
+{
+    UT_GenStub_SetupReturnBuffer(SC_RtsEntryWords, uint16);
+
+    UT_GenStub_AddParam(SC_RtsEntryWords, uint32 *, Buffer32);
+    UT_GenStub_AddParam(SC_RtsEntryWords, uint16, Offset);
+
+    UT_GenStub_Execute(SC_RtsEntryWords, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SC_RtsEntryWords, uint16);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_SiftAtsTimeIndex()
+ * ----------------------------------------------------
+ */
+void SC_SiftAtsTimeIndex(SC_AtsIndex_t AtsIndex, uint32 Node, uint32 HeapSize)
+{
+    UT_GenStub_AddParam(SC_SiftAtsTimeIndex, SC_AtsIndex_t, AtsIndex);
+    UT_GenStub_AddParam(SC_SiftAtsTimeIndex, uint32, Node);
+    UT_GenStub_AddParam(SC_SiftAtsTimeIndex, uint32, HeapSize);
+
+    UT_GenStub_Execute(SC_SiftAtsTimeIndex, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_SiftForecastTimes()
+ * ----------------------------------------------------
+ */
+void SC_SiftForecastTimes(uint32 Node, uint32 HeapSize)
+{
+    UT_GenStub_AddParam(SC_SiftForecastTimes, uint32, Node);
+    UT_GenStub_AddParam(SC_SiftForecastTimes, uint32, HeapSize);
+
+    UT_GenStub_Execute(SC_SiftForecastTimes, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_StartAtsLoadJob()
+ * ----------------------------------------------------
+ */
+void SC_StartAtsLoadJob(SC_AtsIndex_t AtsIndex)
+{
+    UT_GenStub_AddParam(SC_StartAtsLoadJob, SC_AtsIndex_t, AtsIndex);
+
+    UT_GenStub_Execute(SC_StartAtsLoadJob, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_SortAtsTimeIndexStep()
+ * ----------------------------------------------------
+ */
+void SC_SortAtsTimeIndexStep(SC_AtsIndex_t AtsIndex, uint32 ListLength, uint32 Step)
+{
+    UT_GenStub_AddParam(SC_SortAtsTimeIndexStep, SC_AtsIndex_t, AtsIndex);
+    UT_GenStub_AddParam(SC_SortAtsTimeIndexStep, uint32, ListLength);
+    UT_GenStub_AddParam(SC_SortAtsTimeIndexStep, uint32, Step);
+
+    UT_GenStub_Execute(SC_SortAtsTimeIndexStep, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_SortRtsPoolBlocks()
+ * ----------------------------------------------------
+ */
+uint32 SC_SortRtsPoolBlocks(uint16 Order[])
+{
+    UT_GenStub_SetupReturnBuffer(SC_SortRtsPoolBlocks, uint32);
+
+    UT_GenStub_Execute(SC_SortRtsPoolBlocks, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SC_SortRtsPoolBlocks, uint32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for SC_UpdateAppend()
@@ -124,6 +333,26 @@ void SC_UpdateAppend(void)
     UT_GenStub_Execute(SC_UpdateAppend, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_UpdateRtsPoolStats()
+ * ----------------------------------------------------
+ */
+void SC_UpdateRtsPoolStats(void)
+{
+    UT_GenStub_Execute(SC_UpdateRtsPoolStats, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_UpdateTriggers()
+ * ----------------------------------------------------
+ */
+void SC_UpdateTriggers(void)
+{
+    UT_GenStub_Execute(SC_UpdateTriggers, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for SC_ValidateAppend()
@@ -172,6 +401,22 @@ int32 SC_ValidateRts(void *TableData)
     return UT_GenStub_GetReturnValue(SC_ValidateRts, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_ValidateTriggers()
+ * ----------------------------------------------------
+ */
+int32 SC_ValidateTriggers(void *TableData)
+{
+    UT_GenStub_SetupReturnBuffer(SC_ValidateTriggers, int32);
+
+    UT_GenStub_AddParam(SC_ValidateTriggers, void *, TableData);
+
+    UT_GenStub_Execute(SC_ValidateTriggers, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SC_ValidateTriggers, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for SC_VerifyAtsEntry()
@@ -206,3 +451,53 @@ int32 SC_VerifyAtsTable(uint32 *Buffer32, int32 BufferWords)
 
     return UT_GenStub_GetReturnValue(SC_VerifyAtsTable, int32);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_VerifyLocalCmd()
+ * ----------------------------------------------------
+ */
+bool SC_VerifyLocalCmd(const CFE_MSG_Message_t *Msg, CFE_MSG_Size_t CommandBytes, bool InRts)
+{
+    UT_GenStub_SetupReturnBuffer(SC_VerifyLocalCmd, bool);
+
+    UT_GenStub_AddParam(SC_VerifyLocalCmd, const CFE_MSG_Message_t *, Msg);
+    UT_GenStub_AddParam(SC_VerifyLocalCmd, CFE_MSG_Size_t, CommandBytes);
+    UT_GenStub_AddParam(SC_VerifyLocalCmd, bool, InRts);
+
+    UT_GenStub_Execute(SC_VerifyLocalCmd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SC_VerifyLocalCmd, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_VerifyRtsGotos()
+ * ----------------------------------------------------
+ */
+bool SC_VerifyRtsGotos(uint32 Buffer32[])
+{
+    UT_GenStub_SetupReturnBuffer(SC_VerifyRtsGotos, bool);
+
+    UT_GenStub_AddParam(SC_VerifyRtsGotos, uint32 *, Buffer32);
+
+    UT_GenStub_Execute(SC_VerifyRtsGotos, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SC_VerifyRtsGotos, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_VerifyRtsPatches()
+ * ----------------------------------------------------
+ */
+bool SC_VerifyRtsPatches(uint32 Buffer32[])
+{
+    UT_GenStub_SetupReturnBuffer(SC_VerifyRtsPatches, bool);
+
+    UT_GenStub_AddParam(SC_VerifyRtsPatches, uint32 *, Buffer32);
+
+    UT_GenStub_Execute(SC_VerifyRtsPatches, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SC_VerifyRtsPatches, bool);
+}
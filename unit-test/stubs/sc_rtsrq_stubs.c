@@ -38,6 +38,20 @@ void SC_AutoStartRts(SC_RtsNum_t RtsNum)
     UT_GenStub_Execute(SC_AutoStartRts, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_BeginRts()
+ * ----------------------------------------------------
+ */
+void SC_BeginRts(SC_RtsIndex_t RtsIndex, SC_RtsNum_t CallerRtsNum, uint16 CallDepth)
+{
+    UT_GenStub_AddParam(SC_BeginRts, SC_RtsIndex_t, RtsIndex);
+    UT_GenStub_AddParam(SC_BeginRts, SC_RtsNum_t, CallerRtsNum);
+    UT_GenStub_AddParam(SC_BeginRts, uint16, CallDepth);
+
+    UT_GenStub_Execute(SC_BeginRts, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for SC_DisableRtsCmd()
@@ -62,6 +76,18 @@ void SC_DisableRtsGrpCmd(const SC_DisableRtsGrpCmd_t *Cmd)
     UT_GenStub_Execute(SC_DisableRtsGrpCmd, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_DisableRtsSetCmd()
+ * ----------------------------------------------------
+ */
+void SC_DisableRtsSetCmd(const SC_DisableRtsSetCmd_t *Cmd)
+{
+    UT_GenStub_AddParam(SC_DisableRtsSetCmd, const SC_DisableRtsSetCmd_t *, Cmd);
+
+    UT_GenStub_Execute(SC_DisableRtsSetCmd, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for SC_EnableRtsCmd()
@@ -86,6 +112,18 @@ void SC_EnableRtsGrpCmd(const SC_EnableRtsGrpCmd_t *Cmd)
     UT_GenStub_Execute(SC_EnableRtsGrpCmd, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_EnableRtsSetCmd()
+ * ----------------------------------------------------
+ */
+void SC_EnableRtsSetCmd(const SC_EnableRtsSetCmd_t *Cmd)
+{
+    UT_GenStub_AddParam(SC_EnableRtsSetCmd, const SC_EnableRtsSetCmd_t *, Cmd);
+
+    UT_GenStub_Execute(SC_EnableRtsSetCmd, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for SC_KillRts()
@@ -98,6 +136,102 @@ void SC_KillRts(SC_RtsIndex_t RtsIndex)
     UT_GenStub_Execute(SC_KillRts, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_KillRtsInstances()
+ * ----------------------------------------------------
+ */
+void SC_KillRtsInstances(SC_RtsIndex_t RtsIndex)
+{
+    UT_GenStub_AddParam(SC_KillRtsInstances, SC_RtsIndex_t, RtsIndex);
+
+    UT_GenStub_Execute(SC_KillRtsInstances, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_ProcessRtsCall()
+ * ----------------------------------------------------
+ */
+bool SC_ProcessRtsCall(SC_RtsIndex_t RtsIndex, CFE_MSG_FcnCode_t CommandCode, const SC_CallRtsCmd_t *Cmd)
+{
+    UT_GenStub_SetupReturnBuffer(SC_ProcessRtsCall, bool);
+
+    UT_GenStub_AddParam(SC_ProcessRtsCall, SC_RtsIndex_t, RtsIndex);
+    UT_GenStub_AddParam(SC_ProcessRtsCall, CFE_MSG_FcnCode_t, CommandCode);
+    UT_GenStub_AddParam(SC_ProcessRtsCall, const SC_CallRtsCmd_t *, Cmd);
+
+    UT_GenStub_Execute(SC_ProcessRtsCall, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SC_ProcessRtsCall, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_ProcessTriggerPipe()
+ * ----------------------------------------------------
+ */
+void SC_ProcessTriggerPipe(void)
+{
+    UT_GenStub_Execute(SC_ProcessTriggerPipe, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_ProcessTriggers()
+ * ----------------------------------------------------
+ */
+bool SC_ProcessTriggers(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_GenStub_SetupReturnBuffer(SC_ProcessTriggers, bool);
+
+    UT_GenStub_AddParam(SC_ProcessTriggers, const CFE_SB_Buffer_t *, BufPtr);
+
+    UT_GenStub_Execute(SC_ProcessTriggers, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SC_ProcessTriggers, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_ReturnFromRts()
+ * ----------------------------------------------------
+ */
+void SC_ReturnFromRts(SC_RtsIndex_t RtsIndex)
+{
+    UT_GenStub_AddParam(SC_ReturnFromRts, SC_RtsIndex_t, RtsIndex);
+
+    UT_GenStub_Execute(SC_ReturnFromRts, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_RtsSetIsValid()
+ * ----------------------------------------------------
+ */
+bool SC_RtsSetIsValid(const uint16 RtsSet[])
+{
+    UT_GenStub_SetupReturnBuffer(SC_RtsSetIsValid, bool);
+
+    UT_GenStub_AddParam(SC_RtsSetIsValid, const uint16 *, RtsSet);
+
+    UT_GenStub_Execute(SC_RtsSetIsValid, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SC_RtsSetIsValid, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_SetRtsPriorityCmd()
+ * ----------------------------------------------------
+ */
+void SC_SetRtsPriorityCmd(const SC_SetRtsPriorityCmd_t *Cmd)
+{
+    UT_GenStub_AddParam(SC_SetRtsPriorityCmd, const SC_SetRtsPriorityCmd_t *, Cmd);
+
+    UT_GenStub_Execute(SC_SetRtsPriorityCmd, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for SC_StartRtsCmd()
@@ -122,6 +256,42 @@ void SC_StartRtsGrpCmd(const SC_StartRtsGrpCmd_t *Cmd)
     UT_GenStub_Execute(SC_StartRtsGrpCmd, Basic, NULL);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_StartRtsInstanceCmd()
+ * ----------------------------------------------------
+ */
+void SC_StartRtsInstanceCmd(const SC_StartRtsInstanceCmd_t *Cmd)
+{
+    UT_GenStub_AddParam(SC_StartRtsInstanceCmd, const SC_StartRtsInstanceCmd_t *, Cmd);
+
+    UT_GenStub_Execute(SC_StartRtsInstanceCmd, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_StartRtsParamCmd()
+ * ----------------------------------------------------
+ */
+void SC_StartRtsParamCmd(const SC_StartRtsParamCmd_t *Cmd)
+{
+    UT_GenStub_AddParam(SC_StartRtsParamCmd, const SC_StartRtsParamCmd_t *, Cmd);
+
+    UT_GenStub_Execute(SC_StartRtsParamCmd, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_StartRtsSetCmd()
+ * ----------------------------------------------------
+ */
+void SC_StartRtsSetCmd(const SC_StartRtsSetCmd_t *Cmd)
+{
+    UT_GenStub_AddParam(SC_StartRtsSetCmd, const SC_StartRtsSetCmd_t *, Cmd);
+
+    UT_GenStub_Execute(SC_StartRtsSetCmd, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for SC_StopRtsCmd()
@@ -145,3 +315,33 @@ void SC_StopRtsGrpCmd(const SC_StopRtsGrpCmd_t *Cmd)
 
     UT_GenStub_Execute(SC_StopRtsGrpCmd, Basic, NULL);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_StopRtsSetCmd()
+ * ----------------------------------------------------
+ */
+void SC_StopRtsSetCmd(const SC_StopRtsSetCmd_t *Cmd)
+{
+    UT_GenStub_AddParam(SC_StopRtsSetCmd, const SC_StopRtsSetCmd_t *, Cmd);
+
+    UT_GenStub_Execute(SC_StopRtsSetCmd, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_TriggerMatches()
+ * ----------------------------------------------------
+ */
+bool SC_TriggerMatches(const SC_TriggerEntry_t *TriggerPtr, const CFE_MSG_Message_t *Msg, CFE_MSG_Size_t MsgSize)
+{
+    UT_GenStub_SetupReturnBuffer(SC_TriggerMatches, bool);
+
+    UT_GenStub_AddParam(SC_TriggerMatches, const SC_TriggerEntry_t *, TriggerPtr);
+    UT_GenStub_AddParam(SC_TriggerMatches, const CFE_MSG_Message_t *, Msg);
+    UT_GenStub_AddParam(SC_TriggerMatches, CFE_MSG_Size_t, MsgSize);
+
+    UT_GenStub_Execute(SC_TriggerMatches, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SC_TriggerMatches, bool);
+}
@@ -55,3 +55,34 @@ void SC_GetNextRtsTime(void)
 {
     UT_GenStub_Execute(SC_GetNextRtsTime, Basic, NULL);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_ProcessRtsControl()
+ * ----------------------------------------------------
+ */
+bool SC_ProcessRtsControl(SC_RtsIndex_t RtsIndex, CFE_MSG_FcnCode_t CommandCode, SC_EntryOffset_t *CmdOffset)
+{
+    UT_GenStub_SetupReturnBuffer(SC_ProcessRtsControl, bool);
+
+    UT_GenStub_AddParam(SC_ProcessRtsControl, SC_RtsIndex_t, RtsIndex);
+    UT_GenStub_AddParam(SC_ProcessRtsControl, CFE_MSG_FcnCode_t, CommandCode);
+    UT_GenStub_AddParam(SC_ProcessRtsControl, SC_EntryOffset_t *, CmdOffset);
+
+    UT_GenStub_Execute(SC_ProcessRtsControl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SC_ProcessRtsControl, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_SeekRtsCommand()
+ * ----------------------------------------------------
+ */
+void SC_SeekRtsCommand(SC_RtsIndex_t RtsIndex, SC_EntryOffset_t CmdOffset)
+{
+    UT_GenStub_AddParam(SC_SeekRtsCommand, SC_RtsIndex_t, RtsIndex);
+    UT_GenStub_AddParam(SC_SeekRtsCommand, SC_EntryOffset_t, CmdOffset);
+
+    UT_GenStub_Execute(SC_SeekRtsCommand, Basic, NULL);
+}
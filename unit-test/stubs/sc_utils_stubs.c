@@ -26,6 +26,18 @@
 #include "sc_utils.h"
 #include "utgenstub.h"
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_BeginPhase()
+ * ----------------------------------------------------
+ */
+void SC_BeginPhase(SC_Phase_Enum_t Phase)
+{
+    UT_GenStub_AddParam(SC_BeginPhase, SC_Phase_Enum_t, Phase);
+
+    UT_GenStub_Execute(SC_BeginPhase, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for SC_CompareAbsTime()
@@ -75,6 +87,79 @@ uint32 SC_ComputeAbsWakeup(uint32 RelWakeup)
     return UT_GenStub_GetReturnValue(SC_ComputeAbsWakeup, uint32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_ComputeRtsDueTime()
+ * ----------------------------------------------------
+ */
+CFE_TIME_SysTime_t SC_ComputeRtsDueTime(CFE_TIME_SysTime_t PrevTime, uint32 RelTime)
+{
+    UT_GenStub_SetupReturnBuffer(SC_ComputeRtsDueTime, CFE_TIME_SysTime_t);
+
+    UT_GenStub_AddParam(SC_ComputeRtsDueTime, CFE_TIME_SysTime_t, PrevTime);
+    UT_GenStub_AddParam(SC_ComputeRtsDueTime, uint32, RelTime);
+
+    UT_GenStub_Execute(SC_ComputeRtsDueTime, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SC_ComputeRtsDueTime, CFE_TIME_SysTime_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_DeferEvent()
+ * ----------------------------------------------------
+ */
+bool SC_DeferEvent(uint16 EventID, uint16 Num)
+{
+    UT_GenStub_SetupReturnBuffer(SC_DeferEvent, bool);
+
+    UT_GenStub_AddParam(SC_DeferEvent, uint16, EventID);
+    UT_GenStub_AddParam(SC_DeferEvent, uint16, Num);
+
+    UT_GenStub_Execute(SC_DeferEvent, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SC_DeferEvent, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_ElapsedUsec()
+ * ----------------------------------------------------
+ */
+uint32 SC_ElapsedUsec(CFE_TIME_SysTime_t StartTime, CFE_TIME_SysTime_t EndTime)
+{
+    UT_GenStub_SetupReturnBuffer(SC_ElapsedUsec, uint32);
+
+    UT_GenStub_AddParam(SC_ElapsedUsec, CFE_TIME_SysTime_t, StartTime);
+    UT_GenStub_AddParam(SC_ElapsedUsec, CFE_TIME_SysTime_t, EndTime);
+
+    UT_GenStub_Execute(SC_ElapsedUsec, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SC_ElapsedUsec, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_EndPhase()
+ * ----------------------------------------------------
+ */
+void SC_EndPhase(SC_Phase_Enum_t Phase)
+{
+    UT_GenStub_AddParam(SC_EndPhase, SC_Phase_Enum_t, Phase);
+
+    UT_GenStub_Execute(SC_EndPhase, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_FlushDeferredEvents()
+ * ----------------------------------------------------
+ */
+void SC_FlushDeferredEvents(void)
+{
+    UT_GenStub_Execute(SC_FlushDeferredEvents, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for SC_GetAtsEntryTime()
@@ -117,6 +202,38 @@ SC_TimeAccessor_t SC_LookupTimeAccessor(SC_TimeRef_Enum_t TimeRef)
     return UT_GenStub_GetReturnValue(SC_LookupTimeAccessor, SC_TimeAccessor_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_RecordDispatchLatency()
+ * ----------------------------------------------------
+ */
+void SC_RecordDispatchLatency(SC_Process_Enum_t Process, CFE_TIME_SysTime_t ScheduledTime)
+{
+    UT_GenStub_AddParam(SC_RecordDispatchLatency, SC_Process_Enum_t, Process);
+    UT_GenStub_AddParam(SC_RecordDispatchLatency, CFE_TIME_SysTime_t, ScheduledTime);
+
+    UT_GenStub_Execute(SC_RecordDispatchLatency, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_RecordTrace()
+ * ----------------------------------------------------
+ */
+void SC_RecordTrace(SC_Process_Enum_t Process, uint16 SourceNum, uint32 CmdId, CFE_SB_MsgId_t MsgId,
+                    CFE_MSG_FcnCode_t FcnCode, CFE_TIME_SysTime_t ScheduledTime, SC_Status_Enum_t Status)
+{
+    UT_GenStub_AddParam(SC_RecordTrace, SC_Process_Enum_t, Process);
+    UT_GenStub_AddParam(SC_RecordTrace, uint16, SourceNum);
+    UT_GenStub_AddParam(SC_RecordTrace, uint32, CmdId);
+    UT_GenStub_AddParam(SC_RecordTrace, CFE_SB_MsgId_t, MsgId);
+    UT_GenStub_AddParam(SC_RecordTrace, CFE_MSG_FcnCode_t, FcnCode);
+    UT_GenStub_AddParam(SC_RecordTrace, CFE_TIME_SysTime_t, ScheduledTime);
+    UT_GenStub_AddParam(SC_RecordTrace, SC_Status_Enum_t, Status);
+
+    UT_GenStub_Execute(SC_RecordTrace, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for SC_ToggleAtsIndex()
@@ -130,3 +247,19 @@ SC_AtsIndex_t SC_ToggleAtsIndex(void)
 
     return UT_GenStub_GetReturnValue(SC_ToggleAtsIndex, SC_AtsIndex_t);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for SC_WakeupsToTime()
+ * ----------------------------------------------------
+ */
+CFE_TIME_SysTime_t SC_WakeupsToTime(uint32 Wakeups)
+{
+    UT_GenStub_SetupReturnBuffer(SC_WakeupsToTime, CFE_TIME_SysTime_t);
+
+    UT_GenStub_AddParam(SC_WakeupsToTime, uint32, Wakeups);
+
+    UT_GenStub_Execute(SC_WakeupsToTime, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(SC_WakeupsToTime, CFE_TIME_SysTime_t);
+}
@@ -43,12 +43,15 @@ UT_CmdBuf_t UT_CmdBuf;
 /* Table buffers */
 uint32                 AtsTblAddr[SC_NUMBER_OF_ATS][SC_ATS_BUFF_SIZE32];
 uint32                 AppendTblAddr[SC_APPEND_BUFF_SIZE32];
-uint32                 RtsTblAddr[SC_NUMBER_OF_RTS][SC_RTS_BUFF_SIZE32];
+uint32                 RtsTblAddr[SC_NUMBER_OF_RTS][SC_RTS_MAX_SIZE32];
 SC_AtsInfoTable_t      AtsInfoTblAddr[SC_NUMBER_OF_ATS];
 SC_RtsInfoEntry_t      RtsInfoTblAddr[SC_NUMBER_OF_RTS];
 SC_RtpControlBlock_t   RtsCtrlBlckAddr;
 SC_AtpControlBlock_t   AtsCtrlBlckAddr;
 SC_AtsCmdStatusEntry_t AtsCmdStatusTblAddr[SC_NUMBER_OF_ATS][SC_MAX_ATS_CMDS];
+SC_TriggerEntry_t      TriggerTblAddr[SC_NUMBER_OF_TRIGGERS];
+SC_TraceTable_t        TraceTblAddr;
+SC_RtsStatsEntry_t     RtsStatsTblAddr[SC_NUMBER_OF_RTS];
 
 /*
  * Function Definitions
@@ -97,12 +100,19 @@ void SC_Test_SetTableAddrs(void)
     for (i = 0; i < SC_NUMBER_OF_RTS; i++)
     {
         SC_OperData.RtsTblAddr[i] = RtsTblAddr[i];
+
+        /* give each RTS an equal share of the storage pool */
+        SC_AppData.RtsPoolBlock[i].Offset = i * (SC_RTS_POOL_SIZE32 / SC_NUMBER_OF_RTS);
+        SC_AppData.RtsPoolBlock[i].Size   = SC_RTS_POOL_SIZE32 / SC_NUMBER_OF_RTS;
     }
     SC_OperData.AppendTblAddr   = AppendTblAddr;
     SC_OperData.AtsInfoTblAddr  = AtsInfoTblAddr;
     SC_OperData.RtsInfoTblAddr  = RtsInfoTblAddr;
     SC_OperData.RtsCtrlBlckAddr = &RtsCtrlBlckAddr;
     SC_OperData.AtsCtrlBlckAddr = &AtsCtrlBlckAddr;
+    SC_OperData.TriggerTblAddr  = TriggerTblAddr;
+    SC_OperData.TraceTblAddr    = &TraceTblAddr;
+    SC_OperData.RtsStatsTblAddr = RtsStatsTblAddr;
 }
 
 void SC_Test_Setup(void)
@@ -124,6 +134,9 @@ void SC_Test_Setup(void)
     memset(&RtsCtrlBlckAddr, 0, sizeof(RtsCtrlBlckAddr));
     memset(&AtsCtrlBlckAddr, 0, sizeof(AtsCtrlBlckAddr));
     memset(&AtsCmdStatusTblAddr, 0, sizeof(AtsCmdStatusTblAddr));
+    memset(&TriggerTblAddr, 0, sizeof(TriggerTblAddr));
+    memset(&TraceTblAddr, 0, sizeof(TraceTblAddr));
+    memset(&RtsStatsTblAddr, 0, sizeof(RtsStatsTblAddr));
 
     /* Clear unit test buffers */
     memset(context_CFE_EVS_SendEvent, 0, sizeof(context_CFE_EVS_SendEvent));
@@ -78,6 +78,19 @@ typedef union
     SC_StopRtsGrpCmd_t           StopRtsGrpCmd;
     SC_DisableRtsGrpCmd_t        DisableRtsGrpCmd;
     SC_EnableRtsGrpCmd_t         EnableRtsGrpCmd;
+    SC_QueryAtsWindowCmd_t       QueryAtsWindowCmd;
+    SC_ReportAtsStatusCmd_t      ReportAtsStatusCmd;
+    SC_CallRtsCmd_t              CallRtsCmd;
+    SC_StartRtsInstanceCmd_t     StartRtsInstanceCmd;
+    SC_StartRtsParamCmd_t        StartRtsParamCmd;
+    SC_StartRtsSetCmd_t          StartRtsSetCmd;
+    SC_StopRtsSetCmd_t           StopRtsSetCmd;
+    SC_DisableRtsSetCmd_t        DisableRtsSetCmd;
+    SC_EnableRtsSetCmd_t         EnableRtsSetCmd;
+    SC_SetRtsPriorityCmd_t       SetRtsPriorityCmd;
+    SC_ResetDiagCmd_t            ResetDiagCmd;
+    SC_QueryLookaheadCmd_t       QueryLookaheadCmd;
+    SC_SetEventModeCmd_t         SetEventModeCmd;
 } UT_CmdBuf_t;
 
 extern UT_CmdBuf_t UT_CmdBuf;
@@ -0,0 +1,35 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,924-1, and identified as “Core Flight
+ * System (cFS) Stored Command Application version 3.1.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Wide index unit test configuration, interface definitions
+ *
+ * The default interface configuration with 32-bit ATS command numbers and
+ * entry offsets, so the unit tests also cover the widened build.
+ */
+#ifndef SC_UT_WIDE_INTERFACE_CFG_H
+#define SC_UT_WIDE_INTERFACE_CFG_H
+
+#include "../../config/default_sc_interface_cfg.h"
+
+#undef SC_CMD_INDEX_BITS
+#define SC_CMD_INDEX_BITS 32
+
+#endif
@@ -0,0 +1,42 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,924-1, and identified as “Core Flight
+ * System (cFS) Stored Command Application version 3.1.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Wide index unit test configuration, internal definitions
+ *
+ * The default internal configuration with an ATS that holds more than
+ * 65535 commands, so command numbers and entry offsets beyond the 16-bit
+ * range are exercised, and with RTSs longer than the nominal RTS buffer.
+ */
+#ifndef SC_UT_WIDE_INTERNAL_CFG_H
+#define SC_UT_WIDE_INTERNAL_CFG_H
+
+#include "../../config/default_sc_internal_cfg.h"
+
+#undef SC_ATS_BUFF_SIZE
+#define SC_ATS_BUFF_SIZE 600000
+
+#undef SC_MAX_ATS_CMDS
+#define SC_MAX_ATS_CMDS 70000
+
+#undef SC_RTS_MAX_SIZE
+#define SC_RTS_MAX_SIZE (SC_RTS_BUFF_SIZE * 4)
+
+#endif